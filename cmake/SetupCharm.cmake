@@ -26,9 +26,11 @@ endif(NOT TARGET Charmxx)
 # will call your normal compiler, set at charm++ installation time internally.
 # Note: The -pthread is necessary with Charm v6.10 to get linking working
 #       with GCC
+# Note: CkLoop is used by Parallel::parallel_for to share work among the PEs
+#       of a node
 string(
     REGEX REPLACE "<CMAKE_CXX_COMPILER>"
-    "${CHARM_COMPILER} -pthread -module DistributedLB -no-charmrun"
+    "${CHARM_COMPILER} -pthread -module DistributedLB -module CkLoop -no-charmrun"
     CMAKE_CXX_LINK_EXECUTABLE "${CMAKE_CXX_LINK_EXECUTABLE}")
 
 # When building for trace analysis the PAPI counters passed to charmc
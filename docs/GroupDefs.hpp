@@ -383,6 +383,31 @@
  * \brief Various useful data structures used in SpECTRE
  */
 
+/*!
+ * \defgroup DgSubcellGroup DG-Subcell
+ * \brief Functions and classes specific to the discontinuous Galerkin method
+ * supplemented with a finite volume or finite difference subcell method.
+ *
+ * \warning Only the building blocks of the method are implemented so far:
+ * - the subcell mesh
+ * - the projection to and reconstruction from the subcells
+ * - the troubled-cell indicators
+ * - the slicing of ghost zones
+ * - the minmod reconstruction to the cell faces
+ *
+ * The DG-subcell evolution itself is not implemented. That includes the
+ * actions that:
+ * - switch an element between DG and subcell
+ * - exchange the ghost zones through
+ *   `evolution::dg::Tags::BoundaryCorrectionAndGhostCellsInbox`
+ * - compute the finite-difference time derivative with the numerical fluxes
+ *   of a system
+ *
+ * It is deferred to future work, and no system or executable can evolve with
+ * the subcell method yet. NewtonianEuler and ValenciaDivClean still rely on
+ * the limiters to capture shocks.
+ */
+
 /*!
  * \defgroup DiscontinuousGalerkinGroup Discontinuous Galerkin
  * \brief Functions and classes specific to the Discontinuous Galerkin
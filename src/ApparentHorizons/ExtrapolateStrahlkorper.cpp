@@ -0,0 +1,67 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "ApparentHorizons/ExtrapolateStrahlkorper.hpp"
+
+#include <iterator>
+
+#include "ApparentHorizons/Strahlkorper.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/IndexType.hpp"
+#include "ErrorHandling/Assert.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+
+template <typename Frame>
+void extrapolate_strahlkorper_in_time(
+    const gsl::not_null<Strahlkorper<Frame>*> strahlkorper, const double time,
+    const std::deque<std::pair<double, Strahlkorper<Frame>>>&
+        previous_strahlkorpers) noexcept {
+  ASSERT(not previous_strahlkorpers.empty(),
+         "Need at least one previous Strahlkorper to extrapolate from.");
+  const auto& newest = previous_strahlkorpers.back().second;
+
+  // Only surfaces with the same spectral basis as the newest one can be
+  // combined coefficient by coefficient.
+  auto first = std::prev(previous_strahlkorpers.end());
+  while (first != previous_strahlkorpers.begin()) {
+    const auto& older = std::prev(first)->second;
+    if (older.l_max() != newest.l_max() or older.m_max() != newest.m_max() or
+        older.center() != newest.center()) {
+      break;
+    }
+    --first;
+  }
+
+  // Lagrange extrapolation of the coefficients
+  DataVector coefs(newest.coefficients().size(), 0.0);
+  for (auto it = first; it != previous_strahlkorpers.end(); ++it) {
+    double weight = 1.0;
+    for (auto other = first; other != previous_strahlkorpers.end(); ++other) {
+      if (other != it) {
+        ASSERT(other->first != it->first,
+               "Cannot extrapolate from two Strahlkorpers at the same time "
+                   << it->first);
+        weight *= (time - other->first) / (it->first - other->first);
+      }
+    }
+    coefs += weight * it->second.coefficients();
+  }
+  *strahlkorper = Strahlkorper<Frame>(std::move(coefs), newest);
+}
+
+/// \cond
+#define FRAME(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATE(_, data)                                          \
+  template void extrapolate_strahlkorper_in_time(                     \
+      const gsl::not_null<Strahlkorper<FRAME(data)>*> strahlkorper,   \
+      const double time,                                              \
+      const std::deque<std::pair<double, Strahlkorper<FRAME(data)>>>& \
+          previous_strahlkorpers) noexcept;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (::Frame::Inertial))
+
+#undef INSTANTIATE
+#undef FRAME
+/// \endcond
@@ -0,0 +1,32 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <deque>
+#include <utility>
+
+/// \cond
+template <typename Frame>
+class Strahlkorper;
+namespace gsl {
+template <typename T>
+class not_null;
+}  // namespace gsl
+/// \endcond
+
+/// \ingroup SurfacesGroup
+/// Extrapolates the shape of a surface in time.
+///
+/// `previous_strahlkorpers` holds pairs of times and surfaces at those
+/// times, ordered from the oldest to the newest. The spectral coefficients
+/// of the newest surfaces that have the same `l_max`, `m_max` and expansion
+/// center as the newest one are extrapolated to `time` with the polynomial
+/// through them, so with a single previous surface the result is that
+/// surface. `strahlkorper` is set to the extrapolated surface, with the
+/// resolution and expansion center of the newest surface.
+template <typename Frame>
+void extrapolate_strahlkorper_in_time(
+    gsl::not_null<Strahlkorper<Frame>*> strahlkorper, double time,
+    const std::deque<std::pair<double, Strahlkorper<Frame>>>&
+        previous_strahlkorpers) noexcept;
@@ -156,23 +156,40 @@ FastFlow::iterate_horizon_finder(
       // LCOV_EXCL_STOP
   }
 
+  // Transform the weighted residual and its square in a single batched
+  // transform.  The residual and its square are stored one after the other.
+  const size_t physical_size = strahlkorper.ylm_spherepack().physical_size();
+  const size_t spectral_size = strahlkorper.ylm_spherepack().spectral_size();
+  DataVector residual_fields(2 * physical_size);
+  {
+    DataVector residual_view(residual_fields.data(), physical_size);
+    residual_view = weighted_residual;
+    // clang-tidy: 'do not use pointer arithmetic'
+    DataVector square_residual_view(
+        residual_fields.data() + physical_size, physical_size);  // NOLINT
+    square_residual_view = square(weighted_residual);
+  }
+  DataVector residual_fields_coefs =
+      strahlkorper.ylm_spherepack().phys_to_spec_for_fields(residual_fields);
+  const DataVector weighted_residual_coefs(residual_fields_coefs.data(),
+                                           spectral_size);
+  // clang-tidy: 'do not use pointer arithmetic'
+  const DataVector square_weighted_residual_coefs(
+      residual_fields_coefs.data() + spectral_size, spectral_size);  // NOLINT
+
   // Norm of the residual on the surface of size l_mesh.
   // Note: In SpEC, this norm is computed as a pointwise L2 norm.  But
   // here we compute the L2 integral norm.  The integral should be
   // more accurate, but if it turns out that this integral is
   // expensive, we can switch back to the pointwise L2 norm.
-  const double residual_mesh_norm = sqrt(strahlkorper.ylm_spherepack().average(
-      strahlkorper.ylm_spherepack().phys_to_spec(square(weighted_residual))));
+  const double residual_mesh_norm = sqrt(
+      strahlkorper.ylm_spherepack().average(square_weighted_residual_coefs));
 
   if (residual_mesh_norm < min_residual_mesh_norm_) {
     min_residual_mesh_norm_ = residual_mesh_norm;
     iter_at_min_residual_mesh_norm_ = current_iter_;
   }
 
-  // Transform the weighted residual
-  const auto weighted_residual_coefs =
-      strahlkorper.ylm_spherepack().phys_to_spec(weighted_residual);
-
   // Restrict to the basis of the surface
   const auto residual_on_surface =
       strahlkorper.ylm_spherepack().prolong_or_restrict(
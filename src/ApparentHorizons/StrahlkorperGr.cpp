@@ -87,36 +87,61 @@ tnsr::I<DataVector, 2, Frame::Spherical<Fr>> get_trace_christoffel_second_kind(
   // reimplement this code to avoid dividing by sin(theta).
   //
   // Note: YlmSpherepack gradients are flat-space Pfaffian derivatives.
-  auto grad_surface_metric_theta_theta =
-      ylm.gradient(square(get(sin_theta)) * get<0, 0>(surface_metric));
-  get<0>(grad_surface_metric_theta_theta) /= square(get(sin_theta));
-  get<1>(grad_surface_metric_theta_theta) /= square(get(sin_theta));
-  get<0>(grad_surface_metric_theta_theta) -=
-      2.0 * get<0, 0>(surface_metric) * get(cos_theta) / get(sin_theta);
+  //
+  // The three fields are stored one after the other so that their gradients
+  // are computed in a single batched transform.
+  const size_t physical_size = ylm.physical_size();
+  DataVector fields(3 * physical_size);
+  std::array<DataVector, 3> field_views{};
+  for (size_t k = 0; k < 3; ++k) {
+    // clang-tidy: 'do not use pointer arithmetic'
+    gsl::at(field_views, k)
+        .set_data_ref(fields.data() + k * physical_size,  // NOLINT
+                      physical_size);
+  }
+  field_views[0] = square(get(sin_theta)) * get<0, 0>(surface_metric);
+  field_views[1] = get(sin_theta) * get<0, 1>(surface_metric);
+  field_views[2] = get<1, 1>(surface_metric);
+
+  auto grad_fields = ylm.gradient_for_fields(fields);
+  // grad[k][d] is the d-th Pfaffian derivative of field k
+  std::array<std::array<DataVector, 2>, 3> grad{};
+  for (size_t k = 0; k < 3; ++k) {
+    for (size_t d = 0; d < 2; ++d) {
+      // clang-tidy: 'do not use pointer arithmetic'
+      gsl::at(gsl::at(grad, k), d)
+          .set_data_ref(
+              grad_fields.get(d).data() + k * physical_size,  // NOLINT
+              physical_size);
+    }
+  }
+  auto& grad_surface_metric_theta_theta = grad[0];
+  auto& grad_surface_metric_theta_phi = grad[1];
+  const auto& grad_surface_metric_phi_phi = grad[2];
 
-  auto grad_surface_metric_theta_phi =
-      ylm.gradient(get(sin_theta) * get<0, 1>(surface_metric));
+  grad_surface_metric_theta_theta[0] /= square(get(sin_theta));
+  grad_surface_metric_theta_theta[1] /= square(get(sin_theta));
+  grad_surface_metric_theta_theta[0] -=
+      2.0 * get<0, 0>(surface_metric) * get(cos_theta) / get(sin_theta);
 
-  get<0>(grad_surface_metric_theta_phi) /= get(sin_theta);
-  get<1>(grad_surface_metric_theta_phi) /= get(sin_theta);
-  get<0>(grad_surface_metric_theta_phi) -=
+  grad_surface_metric_theta_phi[0] /= get(sin_theta);
+  grad_surface_metric_theta_phi[1] /= get(sin_theta);
+  grad_surface_metric_theta_phi[0] -=
       get<0, 1>(surface_metric) * get(cos_theta) / get(sin_theta);
 
-  auto grad_surface_metric_phi_phi = ylm.gradient(get<1, 1>(surface_metric));
-
   auto deriv_surface_metric =
       make_with_value<tnsr::ijj<DataVector, 2, Frame::Spherical<Fr>>>(
           get<0, 0>(surface_metric), 0.0);
   // Get the partial derivative of the metric from the Pfaffian derivative
-  get<0, 0, 0>(deriv_surface_metric) = get<0>(grad_surface_metric_theta_theta);
+  get<0, 0, 0>(deriv_surface_metric) = grad_surface_metric_theta_theta[0];
   get<1, 0, 0>(deriv_surface_metric) =
-      get(sin_theta) * get<1>(grad_surface_metric_theta_theta);
-  get<0, 0, 1>(deriv_surface_metric) = get<0>(grad_surface_metric_theta_phi);
+      get(sin_theta) * grad_surface_metric_theta_theta[1];
+  get<0, 0, 1>(deriv_surface_metric) = grad_surface_metric_theta_phi[0];
   get<1, 0, 1>(deriv_surface_metric) =
-      get(sin_theta) * get<1>(grad_surface_metric_theta_phi);
-  get<0, 1, 1>(deriv_surface_metric) = get<0>(grad_surface_metric_phi_phi);
+      get(sin_theta) * grad_surface_metric_theta_phi[1];
+  get<0, 1, 1>(deriv_surface_metric) = grad_surface_metric_phi_phi[0];
   get<1, 1, 1>(deriv_surface_metric) =
-      get(sin_theta) * get<1>(grad_surface_metric_phi_phi);
+      get(sin_theta) * grad_surface_metric_phi_phi[1];
 
   return trace_last_indices(
       raise_or_lower_first_index(
@@ -674,10 +699,14 @@ void spin_function(
     component = 0.0;
   }
 
-  auto extrinsic_curvature_theta_normal_sin_theta =
-      make_with_value<Scalar<DataVector>>(area_element, 0.0);
-  auto extrinsic_curvature_phi_normal =
-      make_with_value<Scalar<DataVector>>(area_element, 0.0);
+  // Both fields are stored one after the other so that their gradients are
+  // computed in a single batched transform.
+  const size_t physical_size = get(area_element).size();
+  DataVector fields(2 * physical_size, 0.0);
+  DataVector extrinsic_curvature_phi_normal(fields.data(), physical_size);
+  // clang-tidy: 'do not use pointer arithmetic'
+  DataVector extrinsic_curvature_theta_normal_sin_theta(
+      fields.data() + physical_size, physical_size);  // NOLINT
 
   // using result as temporary
   DataVector& extrinsic_curvature_dot_normal = get(*result);
@@ -694,27 +723,30 @@ void spin_function(
     // the spherepack gradient, which includes a
     // sin_theta in the denominator of the phi derivative.
     // Will do this outside the i,j loops.
-    get(extrinsic_curvature_theta_normal_sin_theta) +=
+    extrinsic_curvature_theta_normal_sin_theta +=
         extrinsic_curvature_dot_normal * tangents.get(i, 0);
 
     // Note: I must multiply by sin_theta because tangents.get(i,1)
     // actually contains \partial_\phi / sin(theta), but I want just
     //\partial_\phi. Will do this outside the i,j loops.
-    get(extrinsic_curvature_phi_normal) +=
+    extrinsic_curvature_phi_normal +=
         extrinsic_curvature_dot_normal * tangents.get(i, 1);
   }
 
   // using result as temporary
   DataVector& sin_theta = get(*result);
   sin_theta = sin(strahlkorper.ylm_spherepack().theta_phi_points()[0]);
-  get(extrinsic_curvature_theta_normal_sin_theta) *= sin_theta;
-  get(extrinsic_curvature_phi_normal) *= sin_theta;
+  extrinsic_curvature_theta_normal_sin_theta *= sin_theta;
+  extrinsic_curvature_phi_normal *= sin_theta;
 
   // now computing actual result
-  get(*result) = (get<0>(strahlkorper.ylm_spherepack().gradient(
-                      get(extrinsic_curvature_phi_normal))) -
-                  get<1>(strahlkorper.ylm_spherepack().gradient(
-                      get(extrinsic_curvature_theta_normal_sin_theta)))) /
+  auto grad_fields = strahlkorper.ylm_spherepack().gradient_for_fields(fields);
+  const DataVector dtheta_phi_normal(get<0>(grad_fields).data(),
+                                     physical_size);
+  // clang-tidy: 'do not use pointer arithmetic'
+  const DataVector dphi_theta_normal_sin_theta(
+      get<1>(grad_fields).data() + physical_size, physical_size);  // NOLINT
+  get(*result) = (dtheta_phi_normal - dphi_theta_normal_sin_theta) /
                  (sin_theta * get(area_element));
 }
 
@@ -167,7 +167,8 @@ void DxRadiusCompute<Frame>::function(
     const aliases::InvJacobian<Frame>& inv_jac) noexcept {
   destructive_resize_components(dx_radius, radius.size());
   const DataVector one_over_r = 1.0 / radius;
-  const auto dr = strahlkorper.ylm_spherepack().gradient(radius);
+  const auto dr = strahlkorper.ylm_spherepack().gradient_from_coefs(
+      strahlkorper.coefficients());
   get<0>(*dx_radius) =
       (get<0, 0>(inv_jac) * get<0>(dr) + get<1, 0>(inv_jac) * get<1>(dr)) *
       one_over_r;
@@ -221,13 +222,12 @@ void D2xRadiusCompute<Frame>::function(
 template <typename Frame>
 void LaplacianRadiusCompute<Frame>::function(
     const gsl::not_null<DataVector*> lap_radius,
-    const ::Strahlkorper<Frame>& strahlkorper, const DataVector& radius,
-    const aliases::ThetaPhi<Frame>& theta_phi) noexcept {
-  lap_radius->destructive_resize(radius.size());
-  const auto derivs =
-      strahlkorper.ylm_spherepack().first_and_second_derivative(radius);
-  *lap_radius = get<0, 0>(derivs.second) + get<1, 1>(derivs.second) +
-                get<0>(derivs.first) / tan(get<0>(theta_phi));
+    const ::Strahlkorper<Frame>& strahlkorper) noexcept {
+  // The Laplacian is applied to the coefficients of the Strahlkorper, which
+  // avoids transforming the radius back to spectral space.
+  lap_radius->destructive_resize(strahlkorper.ylm_spherepack().physical_size());
+  strahlkorper.ylm_spherepack().scalar_laplacian_from_coefs(
+      lap_radius->data(), strahlkorper.coefficients().data());
 }
 
 template <typename Frame>
@@ -248,7 +248,8 @@ void TangentsCompute<Frame>::function(
     const aliases::OneForm<Frame>& r_hat,
     const aliases::Jacobian<Frame>& jac) noexcept {
   destructive_resize_components(tangents, radius.size());
-  const auto dr = strahlkorper.ylm_spherepack().gradient(radius);
+  const auto dr = strahlkorper.ylm_spherepack().gradient_from_coefs(
+      strahlkorper.coefficients());
   for (size_t i = 0; i < 2; ++i) {
     for (size_t j = 0; j < 3; ++j) {
       tangents->get(j, i) = dr.get(i) * r_hat.get(j) + radius * jac.get(j, i);
@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <deque>
 #include <string>
+#include <utility>
 
 #include "ApparentHorizons/Strahlkorper.hpp"
 #include "ApparentHorizons/StrahlkorperGr.hpp"
@@ -29,6 +31,14 @@ namespace ah::Tags {
 struct FastFlow : db::SimpleTag {
   using type = ::FastFlow;
 };
+
+/// The most recently found horizons and the times at which they were found,
+/// ordered from the oldest to the newest. The initial guess for the next
+/// horizon find is extrapolated in time from these.
+template <typename Frame>
+struct PreviousStrahlkorpers : db::SimpleTag {
+  using type = std::deque<std::pair<double, ::Strahlkorper<Frame>>>;
+};
 }  // namespace ah::Tags
 
 /// \ingroup SurfacesGroup
@@ -244,11 +254,8 @@ struct LaplacianRadiusCompute : LaplacianRadius<Frame>, db::ComputeTag {
   using base = LaplacianRadius<Frame>;
   using return_type = DataVector;
   static void function(gsl::not_null<DataVector*> lap_radius,
-                       const ::Strahlkorper<Frame>& strahlkorper,
-                       const DataVector& radius,
-                       const aliases::ThetaPhi<Frame>& theta_phi) noexcept;
-  using argument_tags =
-      tmpl::list<Strahlkorper<Frame>, Radius<Frame>, ThetaPhi<Frame>>;
+                       const ::Strahlkorper<Frame>& strahlkorper) noexcept;
+  using argument_tags = tmpl::list<Strahlkorper<Frame>>;
 };
 // }@
 
@@ -4,6 +4,7 @@
 #include "ApparentHorizons/YlmSpherepack.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <ostream>
 #include <tuple>
@@ -11,6 +12,7 @@
 #include "ApparentHorizons/SpherepackIterator.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"  // IWYU pragma: keep
 #include "DataStructures/Tensor/TypeAliases.hpp"
+#include "DataStructures/Transpose.hpp"
 #include "ErrorHandling/Assert.hpp"
 #include "ErrorHandling/Error.hpp"
 #include "Utilities/ConstantExpressions.hpp"
@@ -182,6 +184,76 @@ DataVector YlmSpherepack::spec_to_phys_all_offsets(
   return result;
 }
 
+void YlmSpherepack::phys_to_spec_for_fields(
+    const gsl::not_null<double*> spectral_coefs,
+    const gsl::not_null<const double*> collocation_values,
+    const size_t number_of_fields) const noexcept {
+  if (number_of_fields == 1) {
+    phys_to_spec_impl(spectral_coefs, collocation_values, 1, 0, 1, 0, false);
+    return;
+  }
+  auto& interleaved_values =
+      memory_pool_.get(number_of_fields * physical_size());
+  auto& interleaved_coefs =
+      memory_pool_.get(number_of_fields * spectral_size());
+  raw_transpose(make_not_null(interleaved_values.data()),
+                collocation_values.get(), physical_size(), number_of_fields);
+  phys_to_spec_impl(interleaved_coefs.data(), interleaved_values.data(),
+                    number_of_fields, 0, number_of_fields, 0, true);
+  raw_transpose(spectral_coefs, interleaved_coefs.data(), number_of_fields,
+                spectral_size());
+  memory_pool_.free(interleaved_coefs);
+  memory_pool_.free(interleaved_values);
+}
+
+void YlmSpherepack::spec_to_phys_for_fields(
+    const gsl::not_null<double*> collocation_values,
+    const gsl::not_null<const double*> spectral_coefs,
+    const size_t number_of_fields) const noexcept {
+  if (number_of_fields == 1) {
+    spec_to_phys_impl(collocation_values, spectral_coefs, 1, 0, 1, 0, false);
+    return;
+  }
+  auto& interleaved_coefs =
+      memory_pool_.get(number_of_fields * spectral_size());
+  auto& interleaved_values =
+      memory_pool_.get(number_of_fields * physical_size());
+  raw_transpose(make_not_null(interleaved_coefs.data()), spectral_coefs.get(),
+                spectral_size(), number_of_fields);
+  spec_to_phys_impl(interleaved_values.data(), interleaved_coefs.data(),
+                    number_of_fields, 0, number_of_fields, 0, true);
+  raw_transpose(collocation_values, interleaved_values.data(), number_of_fields,
+                physical_size());
+  memory_pool_.free(interleaved_values);
+  memory_pool_.free(interleaved_coefs);
+}
+
+DataVector YlmSpherepack::phys_to_spec_for_fields(
+    const DataVector& collocation_values) const noexcept {
+  ASSERT(collocation_values.size() % physical_size() == 0,
+         "Size " << collocation_values.size()
+                 << " is not a multiple of the physical size "
+                 << physical_size());
+  const size_t number_of_fields = collocation_values.size() / physical_size();
+  DataVector result(spectral_size() * number_of_fields);
+  phys_to_spec_for_fields(result.data(), collocation_values.data(),
+                          number_of_fields);
+  return result;
+}
+
+DataVector YlmSpherepack::spec_to_phys_for_fields(
+    const DataVector& spectral_coefs) const noexcept {
+  ASSERT(spectral_coefs.size() % spectral_size() == 0,
+         "Size " << spectral_coefs.size()
+                 << " is not a multiple of the spectral size "
+                 << spectral_size());
+  const size_t number_of_fields = spectral_coefs.size() / spectral_size();
+  DataVector result(physical_size() * number_of_fields);
+  spec_to_phys_for_fields(result.data(), spectral_coefs.data(),
+                          number_of_fields);
+  return result;
+}
+
 /// \cond DOXYGEN_FAILS_TO_PARSE_THIS
 void YlmSpherepack::gradient(
     const std::array<double*, 2>& df,
@@ -254,6 +326,52 @@ void YlmSpherepack::gradient_from_coefs_impl(
   memory_pool_.free(work);
 }
 
+/// \cond DOXYGEN_FAILS_TO_PARSE_THIS
+void YlmSpherepack::gradient_for_fields(
+    const std::array<double*, 2>& df,
+    const gsl::not_null<const double*> collocation_values,
+    const size_t number_of_fields) const noexcept {
+  if (number_of_fields == 1) {
+    gradient(df, collocation_values);
+    return;
+  }
+  const size_t size = number_of_fields * physical_size();
+  auto& interleaved_values = memory_pool_.get(size);
+  auto& interleaved_coefs =
+      memory_pool_.get(number_of_fields * spectral_size());
+  raw_transpose(make_not_null(interleaved_values.data()),
+                collocation_values.get(), physical_size(), number_of_fields);
+  phys_to_spec_impl(interleaved_coefs.data(), interleaved_values.data(),
+                    number_of_fields, 0, number_of_fields, 0, true);
+  // The interleaved values are no longer needed, so they hold the first
+  // component of the interleaved gradient.
+  auto& interleaved_df_1 = memory_pool_.get(size);
+  gradient_from_coefs_impl(
+      {{interleaved_values.data(), interleaved_df_1.data()}},
+      interleaved_coefs.data(), number_of_fields, 0, number_of_fields, 0, true);
+  raw_transpose(make_not_null(df[0]), interleaved_values.data(),
+                number_of_fields, physical_size());
+  raw_transpose(make_not_null(df[1]), interleaved_df_1.data(),
+                number_of_fields, physical_size());
+  memory_pool_.free(interleaved_df_1);
+  memory_pool_.free(interleaved_coefs);
+  memory_pool_.free(interleaved_values);
+}
+/// \endcond
+
+YlmSpherepack::FirstDeriv YlmSpherepack::gradient_for_fields(
+    const DataVector& collocation_values) const noexcept {
+  ASSERT(collocation_values.size() % physical_size() == 0,
+         "Size " << collocation_values.size()
+                 << " is not a multiple of the physical size "
+                 << physical_size());
+  FirstDeriv result(collocation_values.size());
+  gradient_for_fields({{result.get(0).data(), result.get(1).data()}},
+                      collocation_values.data(),
+                      collocation_values.size() / physical_size());
+  return result;
+}
+
 YlmSpherepack::FirstDeriv YlmSpherepack::gradient(
     const DataVector& collocation_values, const size_t physical_stride,
     const size_t physical_offset) const noexcept {
@@ -374,6 +492,37 @@ DataVector YlmSpherepack::scalar_laplacian_from_coefs(
   return result;
 }
 
+void YlmSpherepack::scalar_laplacian_for_fields(
+    const gsl::not_null<double*> scalar_laplacian,
+    const gsl::not_null<const double*> collocation_values,
+    const size_t number_of_fields) const noexcept {
+  // slapgs has no all-offsets mode, so the Laplacian is instead applied in
+  // spectral space, where it multiplies each coefficient by -l(l+1), between
+  // the batched transforms.
+  auto& f_k = memory_pool_.get(number_of_fields * spectral_size());
+  phys_to_spec_for_fields(f_k.data(), collocation_values, number_of_fields);
+  for (size_t k = 0; k < number_of_fields; ++k) {
+    for (SpherepackIterator it(l_max_, m_max_); it; ++it) {
+      f_k[k * spectral_size() + it()] *=
+          -static_cast<double>(it.l() * (it.l() + 1));
+    }
+  }
+  spec_to_phys_for_fields(scalar_laplacian, f_k.data(), number_of_fields);
+  memory_pool_.free(f_k);
+}
+
+DataVector YlmSpherepack::scalar_laplacian_for_fields(
+    const DataVector& collocation_values) const noexcept {
+  ASSERT(collocation_values.size() % physical_size() == 0,
+         "Size " << collocation_values.size()
+                 << " is not a multiple of the physical size "
+                 << physical_size());
+  DataVector result(collocation_values.size());
+  scalar_laplacian_for_fields(result.data(), collocation_values.data(),
+                              collocation_values.size() / physical_size());
+  return result;
+}
+
 std::array<DataVector, 2> YlmSpherepack::theta_phi_points() const noexcept {
   std::array<DataVector, 2> result = make_array<2>(DataVector(physical_size()));
   const auto& theta = theta_points();
@@ -457,10 +606,14 @@ void YlmSpherepack::second_derivative(
 
   // Now get Cartesian derivatives.
 
-  // First derivative
-  std::vector<double*> dfc(3, nullptr);
+  // First derivative.  The three Cartesian components are stored one after
+  // the other so that their gradients are computed in a single batched
+  // transform.
+  auto& dfc_storage = memory_pool_.get(3 * physical_size());
+  std::array<double*, 3> dfc{};
   for (size_t i = 0; i < 3; ++i) {
-    dfc[i] = memory_pool_.get(physical_size()).data();
+    // clang-tidy: 'do not use pointer arithmetic'
+    gsl::at(dfc, i) = dfc_storage.data() + i * physical_size();  // NOLINT
   }
   for (size_t j = 0, s = 0; j < n_phi_; ++j) {
     for (size_t i = 0; i < n_theta_; ++i, ++s) {
@@ -475,14 +628,20 @@ void YlmSpherepack::second_derivative(
   }
 
   // Take derivatives of Cartesian derivatives to get second derivatives.
-  std::vector<std::array<double*, 2>> ddfc(3, {{nullptr, nullptr}});
+  // ddfc[i][j] is the j-th Pfaffian derivative of dfc[i].
+  auto& ddfc_0_storage = memory_pool_.get(3 * physical_size());
+  auto& ddfc_1_storage = memory_pool_.get(3 * physical_size());
+  gradient_for_fields({{ddfc_0_storage.data(), ddfc_1_storage.data()}},
+                      dfc_storage.data(), 3);
+  memory_pool_.free(dfc_storage);
+  std::array<std::array<double*, 2>, 3> ddfc{};
   for (size_t i = 0; i < 3; ++i) {
     for (size_t j = 0; j < 2; ++j) {
-      gsl::at(ddfc[i], j) = memory_pool_.get(physical_size()).data();
+      // clang-tidy: 'do not use pointer arithmetic'
+      gsl::at(gsl::at(ddfc, i), j) =
+          (j == 0 ? ddfc_0_storage : ddfc_1_storage).data() +  // NOLINT
+          i * physical_size();
     }
-    gradient(ddfc[i], dfc[i], 1, 0);
-    // Here we free the storage for dfc[i], so we can reuse it in ddfc.
-    memory_pool_.free(dfc[i]);
   }
 
   // Combine into Pfaffian second derivatives
@@ -503,11 +662,8 @@ void YlmSpherepack::second_derivative(
     }
   }
 
-  for (size_t i = 0; i < 3; ++i) {
-    for (size_t j = 0; j < 2; ++j) {
-      memory_pool_.free(gsl::at(ddfc[i], j));
-    }
-  }
+  memory_pool_.free(ddfc_1_storage);
+  memory_pool_.free(ddfc_0_storage);
 }
 
 std::pair<YlmSpherepack::FirstDeriv, YlmSpherepack::SecondDeriv>
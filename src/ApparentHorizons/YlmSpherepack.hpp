@@ -148,6 +148,37 @@ class YlmSpherepack {
                                       size_t stride) const noexcept;
   ///@}
 
+  ///@{
+  /// Spectral transformations of `number_of_fields` independent fields in
+  /// a single call.  `collocation_values` holds the fields one after the
+  /// other, each of size `physical_size()`, and `spectral_coefs` holds
+  /// their coefficients one after the other, each of size
+  /// `spectral_size()`.  The fields are interleaved internally and
+  /// transformed together as in `phys_to_spec_all_offsets`, so the
+  /// Legendre sums and the temporary storage are shared between the
+  /// fields.
+  ///
+  /// \note Like all other member functions, these take their temporaries
+  /// from the mutable memory pool of the YlmSpherepack, so a single
+  /// instance must not be used from several threads at once.
+  void phys_to_spec_for_fields(gsl::not_null<double*> spectral_coefs,
+                               gsl::not_null<const double*> collocation_values,
+                               size_t number_of_fields) const noexcept;
+  void spec_to_phys_for_fields(gsl::not_null<double*> collocation_values,
+                               gsl::not_null<const double*> spectral_coefs,
+                               size_t number_of_fields) const noexcept;
+  ///@}
+
+  ///@{
+  /// Simpler interfaces to `phys_to_spec_for_fields` and
+  /// `spec_to_phys_for_fields`, where the number of fields is deduced from
+  /// the size of the input.
+  DataVector phys_to_spec_for_fields(
+      const DataVector& collocation_values) const noexcept;
+  DataVector spec_to_phys_for_fields(
+      const DataVector& spectral_coefs) const noexcept;
+  ///@}
+
   /// Computes Pfaffian derivative (df/dtheta, csc(theta) df/dphi) at
   /// the collocation values.
   /// To act on a slice of the input and output arrays, specify stride
@@ -211,6 +242,18 @@ class YlmSpherepack {
                                              size_t stride = 1) const noexcept;
   ///@}
 
+  /// Same as `gradient`, but for `number_of_fields` independent fields
+  /// stored one after the other (see `phys_to_spec_for_fields`).  Each
+  /// component of `df` has the same layout as `collocation_values`.
+  void gradient_for_fields(const std::array<double*, 2>& df,
+                           gsl::not_null<const double*> collocation_values,
+                           size_t number_of_fields) const noexcept;
+
+  /// Simpler interface to `gradient_for_fields`, where the number of fields
+  /// is deduced from the size of the input.
+  FirstDeriv gradient_for_fields(
+      const DataVector& collocation_values) const noexcept;
+
   /// Computes Laplacian in physical space.
   /// To act on a slice of the input and output arrays, specify stride
   /// and offset (assumed to be the same for input and output).
@@ -243,6 +286,19 @@ class YlmSpherepack {
       size_t spectral_offset = 0) const noexcept;
   ///@}
 
+  /// Same as `scalar_laplacian`, but for `number_of_fields` independent
+  /// fields stored one after the other (see `phys_to_spec_for_fields`).
+  /// `scalar_laplacian` has the same layout as `collocation_values`.
+  void scalar_laplacian_for_fields(
+      gsl::not_null<double*> scalar_laplacian,
+      gsl::not_null<const double*> collocation_values,
+      size_t number_of_fields) const noexcept;
+
+  /// Simpler interface to `scalar_laplacian_for_fields`, where the number of
+  /// fields is deduced from the size of the input.
+  DataVector scalar_laplacian_for_fields(
+      const DataVector& collocation_values) const noexcept;
+
   /// Computes Pfaffian first and second derivative in physical space.
   /// The first derivative is \f$df(i) = d_i f\f$, and the
   /// second derivative is \f$ddf(i,j) = d_i (d_j f)\f$,
@@ -107,6 +107,10 @@ struct AddSub<T1, T2, ArgsList1<Args1...>, ArgsList2<Args2...>, Sign>
     }
   }
 
+  bool is_aliased(const void* const tensor) const noexcept {
+    return t1_.is_aliased(tensor) or t2_.is_aliased(tensor);
+  }
+
   SPECTRE_ALWAYS_INLINE typename T1::type operator[](size_t i) const {
     if constexpr (Sign == 1) {
       return t1_[i] + t2_[i];
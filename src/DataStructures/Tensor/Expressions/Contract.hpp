@@ -459,6 +459,10 @@ struct TensorContract
             map_of_components_to_sum, t_, lhs_storage_index);
   }
 
+  bool is_aliased(const void* const tensor) const noexcept {
+    return t_.is_aliased(tensor);
+  }
+
  private:
   const std::conditional_t<std::is_base_of<Expression, T>::value, T,
                            TensorExpression<T, X, Symm, IndexList, ArgsList>>
@@ -6,12 +6,29 @@
 
 #pragma once
 
+#include <algorithm>
+#include <blaze/math/Subvector.h>
+#include <cstddef>
+#include <type_traits>
+
 #include "DataStructures/Tensor/Expressions/LhsTensorSymmAndIndices.hpp"
 #include "DataStructures/Tensor/Expressions/TensorExpression.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/VectorImpl.hpp"
+#include "ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Requires.hpp"
+#include "Utilities/TMPL.hpp"
 
 namespace TensorExpressions {
+namespace detail {
+// Number of grid points per block of the in-place evaluate. All LHS
+// components are computed for one block before moving on to the next, so the
+// RHS operands of a block stay in cache. It is a multiple of the SIMD width
+// of every current architecture.
+constexpr size_t evaluate_block_size = 128;
+}  // namespace detail
+
 /*!
  * \ingroup TensorExpressionsGroup
  * \brief Evaluate a RHS tensor expression to a tensor with the LHS index order
@@ -77,4 +94,114 @@ auto evaluate(const T& rhs_te) {
                 typename lhs_tensor::tensorindextype_list>(
       rhs_te, lhs_tensorindex_list{});
 }
+
+/*!
+ * \ingroup TensorExpressionsGroup
+ * \brief Evaluate a RHS tensor expression into an existing LHS tensor with the
+ * index order set in the template parameters
+ *
+ * \details This is the in-place counterpart of
+ * `TensorExpressions::evaluate(const T&)`: instead of constructing and
+ * returning a new Tensor, the components of `lhs_tensor` are overwritten. If
+ * the components of `lhs_tensor` already have the size of the RHS components
+ * no memory is allocated.
+ *
+ * For vector data types such as DataVector the evaluation is a single loop
+ * over blocks of `detail::evaluate_block_size` grid points. Every LHS
+ * component is computed on a block before the loop moves on to the next
+ * block, so the operands that several components share are read from cache
+ * rather than streamed from memory once per component. Within a block each
+ * component is a vectorized Blaze expression on subvectors of the operands.
+ * For `double` components each component is assigned directly.
+ *
+ * ### Example usage
+ * Given two rank 2 Tensors `R` and `S` with index order (a, b), add them
+ * together and store the result in the existing Tensor `L` with index order
+ * (b, a):
+ * \code{.cpp}
+ * TensorExpressions::evaluate<ti_b, ti_a>(make_not_null(&L),
+ *                                         R(ti_a, ti_b) + S(ti_a, ti_b));
+ * \endcode
+ *
+ * \warning Because the LHS components are written one after the other,
+ * `lhs_tensor` must not appear in the RHS expression.
+ *
+ * @tparam LhsTensorIndices the TensorIndexs of the Tensor on the LHS of the
+ * tensor expression, e.g. `ti_a`, `ti_b`, `ti_c`
+ * @param lhs_tensor the LHS Tensor into which the result is written
+ * @param rhs_te the RHS TensorExpression to be evaluated
+ */
+template <auto&... LhsTensorIndices, typename X, typename LhsSymmetry,
+          typename LhsIndexList, typename T,
+          Requires<std::is_base_of<Expression, T>::value> = nullptr>
+void evaluate(const gsl::not_null<Tensor<X, LhsSymmetry, LhsIndexList>*>
+                  lhs_tensor,
+              const T& rhs_te) noexcept {
+  static_assert(
+      sizeof...(LhsTensorIndices) == tmpl::size<typename T::args_list>::value,
+      "Must have the same number of indices on the LHS and RHS of a tensor "
+      "equation.");
+  using rhs = tmpl::transform<tmpl::remove_duplicates<typename T::args_list>,
+                              std::decay<tmpl::_1>>;
+  static_assert(
+      tmpl::equal_members<
+          tmpl::list<std::decay_t<decltype(LhsTensorIndices)>...>, rhs>::value,
+      "All indices on the LHS of a Tensor Expression (that is, those specified "
+      "in evaluate<Indices::...>) must be present on the RHS of the expression "
+      "as well.");
+  static_assert(std::is_same_v<X, typename T::type>,
+                "The data type of the LHS Tensor must be the same as the data "
+                "type of the RHS tensor expression.");
+
+  using lhs_tensorindex_list =
+      tmpl::list<std::decay_t<decltype(LhsTensorIndices)>...>;
+  using lhs_tensor_symm_and_indices =
+      LhsTensorSymmAndIndices<typename T::args_list, lhs_tensorindex_list,
+                              typename T::symmetry, typename T::index_list>;
+  static_assert(
+      std::is_same_v<LhsSymmetry,
+                     typename lhs_tensor_symm_and_indices::symmetry> and
+          std::is_same_v<
+              LhsIndexList,
+              typename lhs_tensor_symm_and_indices::tensorindextype_list>,
+      "The symmetry and index types of the LHS Tensor must be those that "
+      "result from evaluating the RHS tensor expression with the given LHS "
+      "index order.");
+
+  using lhs_structure =
+      typename Tensor<X, LhsSymmetry, LhsIndexList>::structure;
+  constexpr size_t number_of_components = lhs_structure::size();
+
+  ASSERT(not rhs_te.is_aliased(lhs_tensor.get()),
+         "The LHS Tensor must not appear in the RHS tensor expression when "
+         "evaluating in place.");
+  if constexpr (is_derived_of_vector_impl_v<X>) {
+    const size_t number_of_grid_points =
+        rhs_te
+            .template get<lhs_structure,
+                          std::decay_t<decltype(LhsTensorIndices)>...>(0)
+            .size();
+    for (size_t i = 0; i < number_of_components; ++i) {
+      (*lhs_tensor)[i].destructive_resize(number_of_grid_points);
+    }
+    for (size_t offset = 0; offset < number_of_grid_points;
+         offset += detail::evaluate_block_size) {
+      const size_t block_size = std::min(detail::evaluate_block_size,
+                                         number_of_grid_points - offset);
+      for (size_t i = 0; i < number_of_components; ++i) {
+        blaze::subvector((*lhs_tensor)[i], offset, block_size) =
+            blaze::subvector(
+                rhs_te.template get<
+                    lhs_structure,
+                    std::decay_t<decltype(LhsTensorIndices)>...>(i),
+                offset, block_size);
+      }
+    }
+  } else {
+    for (size_t i = 0; i < number_of_components; ++i) {
+      (*lhs_tensor)[i] = rhs_te.template get<
+          lhs_structure, std::decay_t<decltype(LhsTensorIndices)>...>(i);
+    }
+  }
+}
 }  // namespace TensorExpressions
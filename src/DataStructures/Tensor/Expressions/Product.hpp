@@ -59,6 +59,10 @@ struct Product<T1, T2, ArgsList1<Args1...>, ArgsList2<Args2...>>
            t2_.template get<LhsIndices...>(tensor_index);
   }
 
+  bool is_aliased(const void* const tensor) const noexcept {
+    return t1_.is_aliased(tensor) or t2_.is_aliased(tensor);
+  }
+
  private:
   const T1 t1_;
   const T2 t2_;
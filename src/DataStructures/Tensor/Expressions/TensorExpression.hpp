@@ -533,6 +533,20 @@ struct TensorExpression<Derived, DataType, Symm, tmpl::list<Indices...>,
     }
   }
 
+  /// \brief Whether the Tensor at `tensor` is an operand of the expression
+  ///
+  /// \details
+  /// If Derived is a TensorExpression, the check is forwarded onto the
+  /// concrete derived TensorExpression. Otherwise, it is a Tensor, and it is
+  /// compared to the address of the Tensor being held.
+  bool is_aliased(const void* const tensor) const noexcept {
+    if constexpr (tt::is_a_v<Tensor, Derived>) {
+      return static_cast<const void*>(t_) == tensor;
+    } else {
+      return static_cast<const Derived&>(*this).is_aliased(tensor);
+    }
+  }
+
   /// Retrieve the i'th entry of the Tensor being held
   template <typename V = Derived,
             Requires<tt::is_a<Tensor, V>::value> = nullptr>
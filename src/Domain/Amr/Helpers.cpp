@@ -3,10 +3,13 @@
 
 #include "Domain/Amr/Helpers.hpp"
 
+#include <utility>
+
 #include "Domain/Structure/Direction.hpp"       // IWYU pragma: keep
 #include "Domain/Structure/ElementId.hpp"       // IWYU pragma: keep
 #include "Domain/Structure/OrientationMap.hpp"  // IWYU pragma: keep
 #include "Domain/Structure/SegmentId.hpp"       // IWYU pragma: keep
+#include "Domain/Structure/Side.hpp"
 #include "ErrorHandling/Assert.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
@@ -63,6 +66,56 @@ bool has_potential_sibling(const ElementId<VolumeDim>& element_id,
              .side_of_sibling();
 }
 
+template <size_t VolumeDim>
+std::vector<ElementId<VolumeDim>> ids_of_children(
+    const ElementId<VolumeDim>& element_id,
+    const std::array<amr::Flag, VolumeDim>& flags) noexcept {
+  std::vector<std::array<SegmentId, VolumeDim>> children_segment_ids{
+      element_id.segment_ids()};
+  for (size_t d = 0; d < VolumeDim; ++d) {
+    ASSERT(amr::Flag::Undefined != gsl::at(flags, d),
+           "Undefined amr::Flag in dimension " << d);
+    if (amr::Flag::Split != gsl::at(flags, d)) {
+      continue;
+    }
+    // Each child found so far is split in dimension d, so the lower
+    // dimensions continue to vary fastest.
+    std::vector<std::array<SegmentId, VolumeDim>> split_segment_ids{};
+    split_segment_ids.reserve(2 * children_segment_ids.size());
+    for (const Side side : {Side::Lower, Side::Upper}) {
+      for (auto segment_ids : children_segment_ids) {
+        gsl::at(segment_ids, d) = gsl::at(segment_ids, d).id_of_child(side);
+        split_segment_ids.push_back(segment_ids);
+      }
+    }
+    children_segment_ids = std::move(split_segment_ids);
+  }
+
+  std::vector<ElementId<VolumeDim>> result{};
+  result.reserve(children_segment_ids.size());
+  for (const auto& segment_ids : children_segment_ids) {
+    result.emplace_back(element_id.block_id(), segment_ids);
+  }
+  return result;
+}
+
+template <size_t VolumeDim>
+ElementId<VolumeDim> id_of_parent(
+    const ElementId<VolumeDim>& element_id,
+    const std::array<amr::Flag, VolumeDim>& flags) noexcept {
+  std::array<SegmentId, VolumeDim> parent_segment_ids =
+      element_id.segment_ids();
+  for (size_t d = 0; d < VolumeDim; ++d) {
+    ASSERT(amr::Flag::Undefined != gsl::at(flags, d),
+           "Undefined amr::Flag in dimension " << d);
+    if (amr::Flag::Join == gsl::at(flags, d)) {
+      gsl::at(parent_segment_ids, d) =
+          gsl::at(parent_segment_ids, d).id_of_parent();
+    }
+  }
+  return {element_id.block_id(), parent_segment_ids};
+}
+
 /// \cond
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 
@@ -76,7 +129,13 @@ bool has_potential_sibling(const ElementId<VolumeDim>& element_id,
       const OrientationMap<DIM(data)>&) noexcept;                              \
   template bool has_potential_sibling(                                         \
       const ElementId<DIM(data)>& element_id,                                  \
-      const Direction<DIM(data)>& direction) noexcept;
+      const Direction<DIM(data)>& direction) noexcept;                      \
+  template std::vector<ElementId<DIM(data)>> ids_of_children(                  \
+      const ElementId<DIM(data)>& element_id,                                  \
+      const std::array<amr::Flag, DIM(data)>& flags) noexcept;                 \
+  template ElementId<DIM(data)> id_of_parent(                                  \
+      const ElementId<DIM(data)>& element_id,                                  \
+      const std::array<amr::Flag, DIM(data)>& flags) noexcept;
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
 
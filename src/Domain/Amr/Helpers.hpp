@@ -8,6 +8,7 @@
 
 #include <array>
 #include <cstddef>
+#include <vector>
 
 #include "Domain/Amr/Flag.hpp"
 
@@ -50,4 +51,28 @@ std::array<size_t, VolumeDim> desired_refinement_levels_of_neighbor(
 template <size_t VolumeDim>
 bool has_potential_sibling(const ElementId<VolumeDim>& element_id,
                            const Direction<VolumeDim>& direction) noexcept;
+
+/// \ingroup ComputationalDomainGroup
+/// \brief The ElementId%s of the children of the Element with ElementId
+/// `element_id` that are created when it is refined according to `flags`
+///
+/// \details Every dimension flagged with amr::Flag::Split is split into its
+/// lower and upper child segments, so an Element split in \f$n\f$ dimensions
+/// has \f$2^n\f$ children. The children are ordered with the lowest dimension
+/// varying fastest.
+template <size_t VolumeDim>
+std::vector<ElementId<VolumeDim>> ids_of_children(
+    const ElementId<VolumeDim>& element_id,
+    const std::array<amr::Flag, VolumeDim>& flags) noexcept;
+
+/// \ingroup ComputationalDomainGroup
+/// \brief The ElementId of the parent of the Element with ElementId
+/// `element_id` that is created when it is joined with its siblings according
+/// to `flags`
+///
+/// \details Only dimensions flagged with amr::Flag::Join are joined.
+template <size_t VolumeDim>
+ElementId<VolumeDim> id_of_parent(
+    const ElementId<VolumeDim>& element_id,
+    const std::array<amr::Flag, VolumeDim>& flags) noexcept;
 }  // namespace amr
@@ -0,0 +1,150 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Domain/Amr/Projectors.hpp"
+
+#include "Domain/Structure/SegmentId.hpp"
+#include "Domain/Structure/Side.hpp"
+#include "ErrorHandling/Assert.hpp"
+#include "ErrorHandling/Error.hpp"
+#include "NumericalAlgorithms/Spectral/Projection.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace amr {
+namespace {
+// The Spectral projections between a segment and one of its halves require
+// the half to have at least as many grid points as the full segment. When
+// the number of grid points changes along with the refinement level such
+// that this does not hold, the projection is split into an interpolation
+// (to more grid points) or a truncation (to fewer grid points) on the finer
+// segment and an h-projection between meshes of equal extents.
+Matrix projection_matrix_to_child(const Spectral::MortarSize half,
+                                  const Mesh<1>& target_mesh,
+                                  const Mesh<1>& source_mesh) noexcept {
+  if (target_mesh.extents(0) >= source_mesh.extents(0)) {
+    return Spectral::projection_matrix_element_to_mortar(half, target_mesh,
+                                                         source_mesh);
+  }
+  const Mesh<1> intermediate_mesh(source_mesh.extents(0),
+                                  target_mesh.basis(0),
+                                  target_mesh.quadrature(0));
+  return Spectral::projection_matrix_mortar_to_element(
+             Spectral::MortarSize::Full, target_mesh, intermediate_mesh) *
+         Spectral::projection_matrix_element_to_mortar(half, intermediate_mesh,
+                                                       source_mesh);
+}
+
+Matrix projection_matrix_to_parent(const Spectral::MortarSize half,
+                                   const Mesh<1>& target_mesh,
+                                   const Mesh<1>& source_mesh) noexcept {
+  if (target_mesh.extents(0) <= source_mesh.extents(0)) {
+    return Spectral::projection_matrix_mortar_to_element(half, target_mesh,
+                                                         source_mesh);
+  }
+  // Interpolating the child first keeps the projection onto the parent
+  // exact for all modes the parent resolves.
+  const Mesh<1> intermediate_mesh(target_mesh.extents(0),
+                                  source_mesh.basis(0),
+                                  source_mesh.quadrature(0));
+  return Spectral::projection_matrix_mortar_to_element(half, target_mesh,
+                                                       intermediate_mesh) *
+         Spectral::projection_matrix_element_to_mortar(
+             Spectral::MortarSize::Full, intermediate_mesh, source_mesh);
+}
+}  // namespace
+
+template <size_t VolumeDim>
+Mesh<VolumeDim> new_mesh(
+    const Mesh<VolumeDim>& current_mesh,
+    const std::array<amr::Flag, VolumeDim>& flags) noexcept {
+  std::array<size_t, VolumeDim> extents = current_mesh.extents().indices();
+  for (size_t d = 0; d < VolumeDim; ++d) {
+    ASSERT(amr::Flag::Undefined != gsl::at(flags, d),
+           "Undefined amr::Flag in dimension " << d);
+    if (amr::Flag::IncreaseResolution == gsl::at(flags, d)) {
+      ++gsl::at(extents, d);
+    } else if (amr::Flag::DecreaseResolution == gsl::at(flags, d)) {
+      ASSERT(gsl::at(extents, d) > 1,
+             "Cannot decrease the resolution of a mesh with "
+                 << gsl::at(extents, d) << " points in dimension " << d);
+      --gsl::at(extents, d);
+    }
+  }
+  return {extents, current_mesh.basis(), current_mesh.quadrature()};
+}
+
+template <size_t VolumeDim>
+std::array<Matrix, VolumeDim> projection_matrices(
+    const Mesh<VolumeDim>& source_mesh, const ElementId<VolumeDim>& source_id,
+    const Mesh<VolumeDim>& target_mesh,
+    const ElementId<VolumeDim>& target_id) noexcept {
+  ASSERT(source_id.block_id() == target_id.block_id(),
+         "Cannot project between Elements " << source_id << " and "
+                                            << target_id
+                                            << " in different Blocks");
+  std::array<Matrix, VolumeDim> result{};
+  const auto source_slices = source_mesh.slices();
+  const auto target_slices = target_mesh.slices();
+  for (size_t d = 0; d < VolumeDim; ++d) {
+    const auto& source_slice = gsl::at(source_slices, d);
+    const auto& target_slice = gsl::at(target_slices, d);
+    const SegmentId& source_segment = gsl::at(source_id.segment_ids(), d);
+    const SegmentId& target_segment = gsl::at(target_id.segment_ids(), d);
+    if (source_segment == target_segment) {
+      if (source_slice == target_slice) {
+        continue;
+      }
+      // Adding modes is an interpolation, removing modes is a truncation.
+      gsl::at(result, d) =
+          target_slice.extents(0) >= source_slice.extents(0)
+              ? Spectral::projection_matrix_element_to_mortar(
+                    Spectral::MortarSize::Full, target_slice, source_slice)
+              : Spectral::projection_matrix_mortar_to_element(
+                    Spectral::MortarSize::Full, target_slice, source_slice);
+    } else if (target_segment.refinement_level() > 0 and
+               target_segment.id_of_parent() == source_segment) {
+      // The target is the child of the source, which covers the half of the
+      // source that is opposite to the sibling of the target.
+      gsl::at(result, d) = projection_matrix_to_child(
+          target_segment.side_of_sibling() == Side::Upper
+              ? Spectral::MortarSize::LowerHalf
+              : Spectral::MortarSize::UpperHalf,
+          target_slice, source_slice);
+    } else if (source_segment.refinement_level() > 0 and
+               source_segment.id_of_parent() == target_segment) {
+      gsl::at(result, d) = projection_matrix_to_parent(
+          source_segment.side_of_sibling() == Side::Upper
+              ? Spectral::MortarSize::LowerHalf
+              : Spectral::MortarSize::UpperHalf,
+          target_slice, source_slice);
+    } else {
+      ERROR("Cannot project from segment "
+            << source_segment << " to segment " << target_segment
+            << " in dimension " << d
+            << ". The target must be the same segment, a child, or the parent "
+               "of the source.");
+    }
+  }
+  return result;
+}
+
+/// \cond
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATE(_, data)                                                   \
+  template Mesh<DIM(data)> new_mesh(                                           \
+      const Mesh<DIM(data)>& current_mesh,                                     \
+      const std::array<amr::Flag, DIM(data)>& flags) noexcept;                 \
+  template std::array<Matrix, DIM(data)> projection_matrices(                  \
+      const Mesh<DIM(data)>& source_mesh,                                      \
+      const ElementId<DIM(data)>& source_id,                                   \
+      const Mesh<DIM(data)>& target_mesh,                                      \
+      const ElementId<DIM(data)>& target_id) noexcept;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
+
+#undef DIM
+#undef INSTANTIATE
+/// \endcond
+}  // namespace amr
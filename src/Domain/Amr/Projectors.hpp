@@ -0,0 +1,125 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Functions that transfer data between Element%s during adaptive mesh
+/// refinement.
+///
+/// \note These are the projections only. The phase that evaluates the
+/// refinement criteria, exchanges the decisions between neighbors, and
+/// creates and destroys Element%s at runtime is not implemented yet.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <unordered_map>
+#include <utility>
+
+#include "DataStructures/ApplyMatrices.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/Amr/Flag.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "ErrorHandling/Assert.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace amr {
+/// \ingroup ComputationalDomainGroup
+/// \brief The Mesh of an Element after its resolution is changed according
+/// to `flags`
+///
+/// \details The number of grid points is increased (decreased) by one in each
+/// dimension flagged with amr::Flag::IncreaseResolution
+/// (amr::Flag::DecreaseResolution). A split or joined dimension keeps its
+/// number of grid points, so the children or the parent of an Element have
+/// the same resolution per unit logical length in that dimension.
+template <size_t VolumeDim>
+Mesh<VolumeDim> new_mesh(
+    const Mesh<VolumeDim>& current_mesh,
+    const std::array<amr::Flag, VolumeDim>& flags) noexcept;
+
+/// \ingroup ComputationalDomainGroup
+/// \brief The matrices, one per dimension, that project data from the Element
+/// with ElementId `source_id` and Mesh `source_mesh` to the Element with
+/// ElementId `target_id` and Mesh `target_mesh`
+///
+/// \details In each dimension the target segment must be the same as, a
+/// child of, or the parent of the source segment. Projections to the same or
+/// a child segment with at least as many grid points are interpolations, and
+/// are exact. All other projections are \f$L_2\f$ projections (i.e. they
+/// truncate the higher modes), and a projection to the parent segment only
+/// accounts for the half of the parent that the source covers, so the
+/// projections from all children must be summed (see project_from_children).
+/// A dimension that changes both its refinement level and its number of grid
+/// points is projected in two steps: the number of grid points is changed on
+/// the finer segment, and the data is projected between the segments at equal
+/// extents. An empty matrix denotes the identity, as for apply_matrices.
+template <size_t VolumeDim>
+std::array<Matrix, VolumeDim> projection_matrices(
+    const Mesh<VolumeDim>& source_mesh, const ElementId<VolumeDim>& source_id,
+    const Mesh<VolumeDim>& target_mesh,
+    const ElementId<VolumeDim>& target_id) noexcept;
+
+/// \ingroup ComputationalDomainGroup
+/// \brief Project `vars` from an Element to one of its children or to itself
+/// with a different Mesh
+///
+/// \details This handles both h-refinement (splitting an Element, in which
+/// case `target_id` is one of amr::ids_of_children) and p-refinement
+/// (changing the Mesh of an Element, in which case `target_id` is
+/// `source_id`). See projection_matrices for details.
+template <typename TagsList, size_t VolumeDim>
+Variables<TagsList> project(const Variables<TagsList>& vars,
+                            const Mesh<VolumeDim>& source_mesh,
+                            const ElementId<VolumeDim>& source_id,
+                            const Mesh<VolumeDim>& target_mesh,
+                            const ElementId<VolumeDim>& target_id) noexcept {
+  ASSERT(vars.number_of_grid_points() == source_mesh.number_of_grid_points(),
+         "The variables have " << vars.number_of_grid_points()
+                               << " grid points, but the source mesh has "
+                               << source_mesh.number_of_grid_points());
+  if (source_id == target_id and source_mesh == target_mesh) {
+    return vars;
+  }
+  return apply_matrices(
+      projection_matrices(source_mesh, source_id, target_mesh, target_id),
+      vars, source_mesh.extents());
+}
+
+/// \ingroup ComputationalDomainGroup
+/// \brief Project the variables of all children of the Element with ElementId
+/// `parent_id` onto its Mesh `parent_mesh`
+///
+/// \details `children_data` holds the Mesh and the variables of each child,
+/// and must contain every child that is joined into the parent. The result is
+/// the \f$L_2\f$ projection of the piecewise data of the children onto the
+/// parent.
+template <typename TagsList, size_t VolumeDim>
+Variables<TagsList> project_from_children(
+    const Mesh<VolumeDim>& parent_mesh, const ElementId<VolumeDim>& parent_id,
+    const std::unordered_map<ElementId<VolumeDim>,
+                             std::pair<Mesh<VolumeDim>, Variables<TagsList>>>&
+        children_data) noexcept {
+  ASSERT(not children_data.empty(), "Cannot join an Element with no children");
+  Variables<TagsList> result(parent_mesh.number_of_grid_points(), 0.0);
+  Variables<TagsList> projected_child_vars(
+      parent_mesh.number_of_grid_points());
+  for (const auto& [child_id, child_mesh_and_vars] : children_data) {
+    const auto& [child_mesh, child_vars] = child_mesh_and_vars;
+    ASSERT(child_vars.number_of_grid_points() ==
+               child_mesh.number_of_grid_points(),
+           "The variables of child " << child_id << " have "
+                                     << child_vars.number_of_grid_points()
+                                     << " grid points, but its mesh has "
+                                     << child_mesh.number_of_grid_points());
+    apply_matrices(make_not_null(&projected_child_vars),
+                   projection_matrices(child_mesh, child_id, parent_mesh,
+                                       parent_id),
+                   child_vars, child_mesh.extents());
+    result += projected_child_vars;
+  }
+  return result;
+}
+}  // namespace amr
@@ -3,9 +3,15 @@
 
 #include "Domain/BlockLogicalCoordinates.hpp"
 
+#include <algorithm>
 #include <cstddef>
+#include <numeric>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/IdPair.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
@@ -13,6 +19,7 @@
 #include "Domain/Structure/BlockId.hpp"
 #include "ErrorHandling/Error.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
 
 namespace {
 // Define this alias so we don't need to keep typing this monster.
@@ -21,6 +28,43 @@ using block_logical_coord_holder = boost::optional<
     IdPair<domain::BlockId, tnsr::I<double, Dim, typename ::Frame::Logical>>>;
 using functions_of_time_type = std::unordered_map<
     std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>;
+
+// Collect the points at the `indices` into a new tensor
+template <size_t Dim, typename Frame>
+tnsr::I<DataVector, Dim, Frame> gather_points(
+    const tnsr::I<DataVector, Dim, Frame>& x,
+    const std::vector<size_t>& indices) noexcept {
+  tnsr::I<DataVector, Dim, Frame> result(indices.size());
+  for (size_t d = 0; d < Dim; ++d) {
+    for (size_t i = 0; i < indices.size(); ++i) {
+      result.get(d)[i] = x.get(d)[indices[i]];
+    }
+  }
+  return result;
+}
+
+// Remove the points that are not flagged in `is_valid` from `x` and from the
+// corresponding `indices`
+template <size_t Dim, typename Frame>
+void keep_valid_points(const gsl::not_null<tnsr::I<DataVector, Dim, Frame>*> x,
+                       const gsl::not_null<std::vector<size_t>*> indices,
+                       const std::vector<bool>& is_valid) noexcept {
+  std::vector<size_t> valid_positions{};
+  valid_positions.reserve(indices->size());
+  for (size_t i = 0; i < indices->size(); ++i) {
+    if (is_valid[i]) {
+      valid_positions.push_back(i);
+    }
+  }
+  if (valid_positions.size() == indices->size()) {
+    return;
+  }
+  *x = gather_points(*x, valid_positions);
+  for (size_t i = 0; i < valid_positions.size(); ++i) {
+    (*indices)[i] = (*indices)[valid_positions[i]];
+  }
+  indices->resize(valid_positions.size());
+}
 }  // namespace
 
 template <size_t Dim, typename Frame>
@@ -30,98 +74,94 @@ std::vector<block_logical_coord_holder<Dim>> block_logical_coordinates(
     const functions_of_time_type& functions_of_time) noexcept {
   const size_t num_pts = get<0>(x).size();
   std::vector<block_logical_coord_holder<Dim>> block_coord_holders(num_pts);
-  for (size_t s = 0; s < num_pts; ++s) {
-    tnsr::I<double, Dim, Frame> x_frame(0.0);
-    for (size_t d = 0; d < Dim; ++d) {
-      x_frame.get(d) = x.get(d)[s];
+  // The points that are not yet found in a block. Each point will be in one
+  // and only one block, unless it is on a shared boundary. In that case,
+  // choose the first matching block (and this block will have the smallest
+  // block_id). So we invert the map of each block in turn on all points that
+  // are not yet found, using the batched inverse of the maps.
+  std::vector<size_t> unlocated_points(num_pts);
+  std::iota(unlocated_points.begin(), unlocated_points.end(), size_t{0});
+  for (const auto& block : domain.blocks()) {
+    if (unlocated_points.empty()) {
+      break;
     }
-    tnsr::I<double, Dim, typename ::Frame::Logical> x_logical{};
-    // Check which block this point is in. Each point will be in one
-    // and only one block, unless it is on a shared boundary.  In that
-    // case, choose the first matching block (and this block will have
-    // the smallest block_id).
-    for (const auto& block : domain.blocks()) {
-      if (block.is_time_dependent()) {
-        if constexpr (std::is_same_v<Frame, ::Frame::Inertial>) {
-          // Point is in the inertial frame, so we need to map to the grid
-          // frame and then the logical frame.
-          const auto moving_inv =
-              block.moving_mesh_grid_to_inertial_map().inverse(
-                  x_frame, time, functions_of_time);
-          if (not moving_inv) {
-            continue;
-          }
-          // logical to grid map is time-independent.
-          const auto inv =
-              block.moving_mesh_logical_to_grid_map().inverse(moving_inv.get());
-          if (inv) {
-            x_logical = inv.get();
-          } else {
-            continue;  // Not in this block
-          }
-        } else {  // frame is different than ::Frame::Inertial
-          // Currently 'time' is unused in this branch.
-          // To make the compiler happy, need to trick it to think that
-          // 'time' is used.
-          (void) time;
-          // Currently we only support Grid and Inertial frames in the
-          // block, so make sure Frame is ::Frame::Grid. (The
-          // Inertial case was handled above.)
-          static_assert(std::is_same_v<Frame, ::Frame::Grid>,
-                        "Cannot convert from given frame to Grid frame");
+    std::vector<size_t> candidates = unlocated_points;
+    tnsr::I<DataVector, Dim, Frame> x_frame = gather_points(x, candidates);
+    tnsr::I<DataVector, Dim, typename ::Frame::Logical> x_logical{};
+    std::vector<bool> is_valid{};
+    if (block.is_time_dependent()) {
+      if constexpr (std::is_same_v<Frame, ::Frame::Inertial>) {
+        // Points are in the inertial frame, so we need to map to the grid
+        // frame and then the logical frame.
+        auto [x_grid, is_valid_grid] =
+            block.moving_mesh_grid_to_inertial_map().inverse(
+                std::move(x_frame), time, functions_of_time);
+        keep_valid_points(make_not_null(&x_grid), make_not_null(&candidates),
+                          is_valid_grid);
+        // logical to grid map is time-independent.
+        std::tie(x_logical, is_valid) =
+            block.moving_mesh_logical_to_grid_map().inverse(std::move(x_grid));
+      } else {  // frame is different than ::Frame::Inertial
+        // Currently 'time' is unused in this branch.
+        // To make the compiler happy, need to trick it to think that
+        // 'time' is used.
+        (void) time;
+        // Currently we only support Grid and Inertial frames in the
+        // block, so make sure Frame is ::Frame::Grid. (The
+        // Inertial case was handled above.)
+        static_assert(std::is_same_v<Frame, ::Frame::Grid>,
+                      "Cannot convert from given frame to Grid frame");
 
-          // Point is in the grid frame, just map to logical frame.
-          const auto inv =
-              block.moving_mesh_logical_to_grid_map().inverse(x_frame);
-          if (inv) {
-            x_logical = inv.get();
-          } else {
-            continue;  // Not in this block
-          }
-        }
-      } else {  // not block.is_time_dependent()
-        if constexpr (std::is_same_v<Frame, ::Frame::Inertial>) {
-          const auto inv = block.stationary_map().inverse(x_frame);
-          if (inv) {
-            x_logical = inv.get();
-          } else {
-            continue;  // Not in this block
-          }
-        } else {
-          // If the map is time-independent, then the grid and
-          // inertial frames are the same.  So if we are in the grid frame,
-          // convert to the inertial frame.  Otherwise throw a static_assert.
-          // Once we support more frames (e.g. distorted) this logic will
-          // change.
-          static_assert(std::is_same_v<Frame, ::Frame::Grid>,
-                        "Cannot convert from given frame to Grid frame");
-          tnsr::I<double, Dim, ::Frame::Inertial> x_inertial(0.0);
-          for (size_t d = 0; d < Dim; ++d) {
-            x_inertial.get(d) = x_frame.get(d);
-          }
-          const auto inv = block.stationary_map().inverse(x_inertial);
-          if (inv) {
-            x_logical = inv.get();
-          } else {
-            continue;  // Not in this block
-          }
+        // Points are in the grid frame, just map to logical frame.
+        std::tie(x_logical, is_valid) =
+            block.moving_mesh_logical_to_grid_map().inverse(std::move(x_frame));
+      }
+    } else {  // not block.is_time_dependent()
+      if constexpr (std::is_same_v<Frame, ::Frame::Inertial>) {
+        std::tie(x_logical, is_valid) =
+            block.stationary_map().inverse(std::move(x_frame));
+      } else {
+        // If the map is time-independent, then the grid and
+        // inertial frames are the same.  So if we are in the grid frame,
+        // convert to the inertial frame.  Otherwise throw a static_assert.
+        // Once we support more frames (e.g. distorted) this logic will
+        // change.
+        static_assert(std::is_same_v<Frame, ::Frame::Grid>,
+                      "Cannot convert from given frame to Grid frame");
+        tnsr::I<DataVector, Dim, ::Frame::Inertial> x_inertial{};
+        for (size_t d = 0; d < Dim; ++d) {
+          x_inertial.get(d) = std::move(x_frame.get(d));
         }
+        std::tie(x_logical, is_valid) =
+            block.stationary_map().inverse(std::move(x_inertial));
+      }
+    }
+    for (size_t i = 0; i < candidates.size(); ++i) {
+      if (not is_valid[i]) {
+        continue;  // Not in this block
       }
       bool is_contained = true;
+      tnsr::I<double, Dim, typename ::Frame::Logical> x_logical_point{};
       for (size_t d = 0; d < Dim; ++d) {
+        x_logical_point.get(d) = x_logical.get(d)[i];
         // Assumes that logical coordinates go from -1 to +1 in each
         // dimension.
-        is_contained = is_contained and x_logical.get(d) >= -1.0 and
-                       x_logical.get(d) <= 1.0;
+        is_contained = is_contained and x_logical_point.get(d) >= -1.0 and
+                       x_logical_point.get(d) <= 1.0;
       }
       if (is_contained) {
         // Point is in this block.  Don't bother checking subsequent
         // blocks.
-        block_coord_holders[s] =
-            make_id_pair(domain::BlockId(block.id()), std::move(x_logical));
-        break;
+        block_coord_holders[candidates[i]] = make_id_pair(
+            domain::BlockId(block.id()), std::move(x_logical_point));
       }
     }
+    unlocated_points.erase(
+        std::remove_if(unlocated_points.begin(), unlocated_points.end(),
+                       [&block_coord_holders](const size_t s) noexcept {
+                         return static_cast<bool>(block_coord_holders[s]);
+                       }),
+        unlocated_points.end());
   }
   return block_coord_holders;
 }
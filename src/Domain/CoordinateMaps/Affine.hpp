@@ -37,6 +37,8 @@ namespace CoordinateMaps {
 class Affine {
  public:
   static constexpr size_t dim = 1;
+  static constexpr bool jacobian_is_spatially_uniform = true;
+  static constexpr bool jacobian_is_separable = true;
 
   Affine(double A, double B, double a, double b);
 
@@ -4,16 +4,21 @@
 #include "Domain/CoordinateMaps/BulgedCube.hpp"
 
 #include <boost/none.hpp>
+#include <algorithm>
 #include <boost/optional.hpp>
 #include <cmath>
 #include <exception>
 #include <functional>  // for std::reference_wrapper
 #include <limits>
 #include <pup.h>
+#include <utility>
+#include <vector>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "ErrorHandling/Assert.hpp"
+#include "NumericalAlgorithms/RootFinding/NewtonRaphson.hpp"
 #include "NumericalAlgorithms/RootFinding/TOMS748.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/DereferenceWrapper.hpp"
@@ -177,6 +182,102 @@ boost::optional<std::array<double, 3>> BulgedCube::inverse(
         physical_z * scaling_factor.get()}}};
 }
 
+void BulgedCube::inverse(
+    const gsl::not_null<std::array<DataVector, 3>*> target_coords,
+    const gsl::not_null<std::vector<bool>*> is_valid) const noexcept {
+  // Gather the points that need a root find. As in the single-point inverse,
+  // the origin is handled separately because it maps to itself.
+  std::vector<size_t> indices{};
+  indices.reserve(is_valid->size());
+  for (size_t s = 0; s < is_valid->size(); ++s) {
+    if ((*is_valid)[s] and (square((*target_coords)[0][s]) +
+                            square((*target_coords)[1][s]) +
+                            square((*target_coords)[2][s])) > 0.0) {
+      indices.push_back(s);
+    }
+  }
+  if (indices.empty()) {
+    return;
+  }
+  const size_t num_points = indices.size();
+  constexpr double tol = 10.0 * std::numeric_limits<double>::epsilon();
+  constexpr double lower_bound = std::numeric_limits<double>::min();
+  constexpr double upper_bound = 1.7320508075688772 + tol;
+  DataVector physical_r{num_points};
+  DataVector x_sq_over_r_sq{num_points};
+  DataVector y_sq_over_r_sq{num_points};
+  DataVector z_sq_over_r_sq{num_points};
+  // The initial guess is the root for vanishing sphericity
+  DataVector rho{num_points};
+  for (size_t i = 0; i < num_points; ++i) {
+    const double x = (*target_coords)[0][indices[i]];
+    const double y = (*target_coords)[1][indices[i]];
+    const double z = (*target_coords)[2][indices[i]];
+    const double physical_r_squared = square(x) + square(y) + square(z);
+    physical_r[i] = sqrt(physical_r_squared);
+    x_sq_over_r_sq[i] = square(x) / physical_r_squared;
+    y_sq_over_r_sq[i] = square(y) / physical_r_squared;
+    z_sq_over_r_sq[i] = square(z) / physical_r_squared;
+    rho[i] = std::clamp(sqrt(3.0) * physical_r[i] / radius_, lower_bound,
+                        upper_bound);
+  }
+
+  // The same root function as in the single-point inverse, together with its
+  // derivative with respect to rho
+  const auto root_function_and_deriv =
+      [this, &physical_r, &x_sq_over_r_sq, &y_sq_over_r_sq,
+       &z_sq_over_r_sq](const DataVector& local_rho) noexcept {
+        const DataVector rho_sq = square(local_rho);
+        const DataVector one_over_rho_xy =
+            1.0 / sqrt(1.0 + rho_sq * (x_sq_over_r_sq + y_sq_over_r_sq));
+        const DataVector one_over_rho_xz =
+            1.0 / sqrt(1.0 + rho_sq * (x_sq_over_r_sq + z_sq_over_r_sq));
+        const DataVector one_over_rho_yz =
+            1.0 / sqrt(1.0 + rho_sq * (y_sq_over_r_sq + z_sq_over_r_sq));
+        const DataVector one_over_rho_x =
+            1.0 / sqrt(2.0 + rho_sq * x_sq_over_r_sq);
+        const DataVector one_over_rho_y =
+            1.0 / sqrt(2.0 + rho_sq * y_sq_over_r_sq);
+        const DataVector one_over_rho_z =
+            1.0 / sqrt(2.0 + rho_sq * z_sq_over_r_sq);
+        const DataVector radial_scaling_factor =
+            1.0 / sqrt(3.0) +
+            sphericity_ * (one_over_rho_xy + one_over_rho_xz + one_over_rho_yz -
+                           one_over_rho_x - one_over_rho_y - one_over_rho_z);
+        const DataVector d_radial_scaling_factor =
+            sphericity_ * local_rho *
+            (x_sq_over_r_sq * cube(one_over_rho_x) +
+             y_sq_over_r_sq * cube(one_over_rho_y) +
+             z_sq_over_r_sq * cube(one_over_rho_z) -
+             (x_sq_over_r_sq + y_sq_over_r_sq) * cube(one_over_rho_xy) -
+             (x_sq_over_r_sq + z_sq_over_r_sq) * cube(one_over_rho_xz) -
+             (y_sq_over_r_sq + z_sq_over_r_sq) * cube(one_over_rho_yz));
+        return std::make_pair(
+            DataVector{physical_r -
+                       radius_ * local_rho * radial_scaling_factor},
+            DataVector{-radius_ * (radial_scaling_factor +
+                                   local_rho * d_radial_scaling_factor)});
+      };
+  const std::vector<bool> converged = RootFinder::safeguarded_newton_raphson(
+      make_not_null(&rho), root_function_and_deriv,
+      DataVector{num_points, lower_bound}, DataVector{num_points, upper_bound},
+      tol, tol);
+
+  for (size_t i = 0; i < num_points; ++i) {
+    const size_t s = indices[i];
+    if (not converged[i]) {
+      (*is_valid)[s] = false;
+      continue;
+    }
+    const double scaling_factor = rho[i] / physical_r[i];
+    for (size_t d = 0; d < 3; ++d) {
+      double& coord = gsl::at(*target_coords, d)[s];
+      coord = use_equiangular_map_ ? 2.0 * M_2_PI * atan(coord * scaling_factor)
+                                   : coord * scaling_factor;
+    }
+  }
+}
+
 template <typename T>
 std::array<tt::remove_cvref_wrap_t<T>, 3> BulgedCube::xi_derivative(
     const std::array<T, 3>& source_coords) const noexcept {
@@ -9,11 +9,14 @@
 #include <boost/optional.hpp>
 #include <cstddef>
 #include <limits>
+#include <vector>
 
 #include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TypeTraits/RemoveReferenceWrapper.hpp"
 
 /// \cond
+class DataVector;
 namespace PUP {
 class er;
 }  // namespace PUP
@@ -506,6 +509,12 @@ class BulgedCube {
   boost::optional<std::array<double, 3>> inverse(
       const std::array<double, 3>& target_coords) const noexcept;
 
+  /// Inverts the points flagged in `is_valid` in place, doing the radial root
+  /// find for all of them at once. Clears the flags of the points where the
+  /// root find fails.
+  void inverse(gsl::not_null<std::array<DataVector, 3>*> target_coords,
+               gsl::not_null<std::vector<bool>*> is_valid) const noexcept;
+
   template <typename T>
   tnsr::Ij<tt::remove_cvref_wrap_t<T>, 3, Frame::NoFrame> jacobian(
       const std::array<T, 3>& source_coords) const noexcept;
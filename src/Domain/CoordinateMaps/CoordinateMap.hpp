@@ -72,6 +72,13 @@ class CoordinateMapBase : public PUP::able {
   /// Returns `true` if the map is the identity
   virtual bool is_identity() const noexcept = 0;
 
+  /// Returns `true` if each target coordinate depends only on the
+  /// corresponding source coordinate (and possibly time), so that the
+  /// Jacobian is diagonal and each diagonal entry varies along a single
+  /// dimension. This is the case if all maps in the composition are separable
+  /// (see `domain::is_jacobian_separable_v`).
+  virtual bool is_separable() const noexcept = 0;
+
   /// Returns `true` if the inverse Jacobian depends on time.
   virtual bool inv_jacobian_is_time_dependent() const noexcept = 0;
 
@@ -118,6 +125,21 @@ class CoordinateMapBase : public PUP::able {
       std::string,
       std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>{}) const
       noexcept = 0;
+  /// Batched version of the inverse that inverts all `target_points` in one
+  /// call. The returned `std::vector<bool>` flags the points where the inverse
+  /// is defined, i.e. where the single-point overload would return a valid
+  /// boost::optional. The returned coordinates of the other points are
+  /// undefined.
+  virtual std::pair<tnsr::I<DataVector, Dim, SourceFrame>, std::vector<bool>>
+  inverse(tnsr::I<DataVector, Dim, TargetFrame> target_points,
+          double time = std::numeric_limits<double>::signaling_NaN(),
+          const std::unordered_map<
+              std::string,
+              std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+              functions_of_time = std::unordered_map<
+                  std::string,
+                  std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>{})
+      const noexcept = 0;
   // @}
 
   // @{
@@ -274,6 +296,10 @@ class CoordinateMap
   /// Returns `true` if the map is the identity
   bool is_identity() const noexcept override;
 
+  /// Returns `true` if all `Maps...` are one-dimensional maps, products of
+  /// one-dimensional maps, or the identity.
+  bool is_separable() const noexcept override;
+
   /// Returns `true` if the inverse Jacobian depends on time.
   bool inv_jacobian_is_time_dependent() const noexcept override;
 
@@ -325,6 +351,20 @@ class CoordinateMap
     return inverse_impl(std::move(target_point), time, functions_of_time,
                         std::make_index_sequence<sizeof...(Maps)>{});
   }
+  std::pair<tnsr::I<DataVector, dim, SourceFrame>, std::vector<bool>> inverse(
+      tnsr::I<DataVector, dim, TargetFrame> target_points,
+      const double time = std::numeric_limits<double>::signaling_NaN(),
+      const std::unordered_map<
+          std::string,
+          std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+          functions_of_time = std::unordered_map<
+              std::string,
+              std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>{}) const
+      noexcept override {
+    return batch_inverse_impl(std::move(target_points), time,
+                              functions_of_time,
+                              std::make_index_sequence<sizeof...(Maps)>{});
+  }
   // @}
 
   // @{
@@ -499,6 +539,16 @@ class CoordinateMap
           functions_of_time,
       std::index_sequence<Is...> /*meta*/) const noexcept;
 
+  template <size_t... Is>
+  std::pair<tnsr::I<DataVector, dim, SourceFrame>, std::vector<bool>>
+  batch_inverse_impl(
+      tnsr::I<DataVector, dim, TargetFrame>&& target_points, double time,
+      const std::unordered_map<
+          std::string,
+          std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+          functions_of_time,
+      std::index_sequence<Is...> /*meta*/) const noexcept;
+
   template <typename T>
   InverseJacobian<T, dim, SourceFrame, TargetFrame> inv_jacobian_impl(
       tnsr::I<T, dim, SourceFrame>&& source_point, double time,
@@ -20,14 +20,17 @@
 #include <utility>
 #include <vector>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Identity.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/CoordinateMaps/CoordinateMapHelpers.hpp"
 #include "Domain/CoordinateMaps/TimeDependentHelpers.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
 #include "Parallel/CharmPupable.hpp"
+#include "Utilities/ContainerHelpers.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeArray.hpp"
+#include "Utilities/MakeWithValue.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/Tuple.hpp"
 
@@ -62,6 +65,12 @@ bool CoordinateMap<SourceFrame, TargetFrame, Maps...>::is_identity() const
       maps_, std::make_index_sequence<sizeof...(Maps)>{});
 }
 
+template <typename SourceFrame, typename TargetFrame, typename... Maps>
+bool CoordinateMap<SourceFrame, TargetFrame, Maps...>::is_separable() const
+    noexcept {
+  return tmpl2::flat_all_v<domain::is_jacobian_separable_v<Maps>...>;
+}
+
 template <typename SourceFrame, typename TargetFrame, typename... Maps>
 bool CoordinateMap<SourceFrame, TargetFrame,
                    Maps...>::inv_jacobian_is_time_dependent() const noexcept {
@@ -159,6 +168,31 @@ CoordinateMap<SourceFrame, TargetFrame, Maps...>::inverse_impl(
              : boost::optional<tnsr::I<T, dim, SourceFrame>>{};
 }
 
+template <typename SourceFrame, typename TargetFrame, typename... Maps>
+template <size_t... Is>
+std::pair<
+    tnsr::I<DataVector, CoordinateMap<SourceFrame, TargetFrame, Maps...>::dim,
+            SourceFrame>,
+    std::vector<bool>>
+CoordinateMap<SourceFrame, TargetFrame, Maps...>::batch_inverse_impl(
+    tnsr::I<DataVector, dim, TargetFrame>&& target_points, const double time,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time,
+    std::index_sequence<Is...> /*meta*/) const noexcept {
+  std::array<DataVector, dim> mapped_points =
+      make_array<DataVector, dim>(std::move(target_points));
+  std::vector<bool> is_valid(mapped_points[0].size(), true);
+  // this is the inverse function, so the iterator sequence below is reversed
+  EXPAND_PACK_LEFT_TO_RIGHT(CoordinateMap_detail::apply_inverse_map(
+      make_not_null(&mapped_points), make_not_null(&is_valid),
+      std::get<sizeof...(Maps) - 1 - Is>(maps_), time, functions_of_time,
+      domain::is_map_time_dependent_t<decltype(
+          std::get<sizeof...(Maps) - 1 - Is>(maps_))>{}));
+  return {tnsr::I<DataVector, dim, SourceFrame>(std::move(mapped_points)),
+          std::move(is_valid)};
+}
+
 namespace detail {
 template <typename T, typename Map, size_t Dim>
 void get_jacobian(
@@ -212,10 +246,13 @@ void get_inv_jacobian(
   *no_frame_inv_jac = the_map.inv_jacobian(point, t, funcs_of_time);
 }
 
-template <typename T, size_t Dim, typename SourceFrame, typename TargetFrame>
+// The Jacobian of the current map, `noframe_jac`, may be a `double`-valued
+// tensor if it is spatially uniform.
+template <typename T, typename NoFrameT, size_t Dim, typename SourceFrame,
+          typename TargetFrame>
 void multiply_jacobian(
     const gsl::not_null<Jacobian<T, Dim, SourceFrame, TargetFrame>*> jac,
-    const tnsr::Ij<T, Dim, Frame::NoFrame>& noframe_jac) noexcept {
+    const tnsr::Ij<NoFrameT, Dim, Frame::NoFrame>& noframe_jac) noexcept {
   std::array<T, Dim> temp{};
   for (size_t source = 0; source < Dim; ++source) {
     for (size_t target = 0; target < Dim; ++target) {
@@ -231,10 +268,11 @@ void multiply_jacobian(
   }
 }
 
-template <typename T, size_t Dim, typename SourceFrame, typename TargetFrame>
+template <typename T, typename NoFrameT, size_t Dim, typename SourceFrame,
+          typename TargetFrame>
 void multiply_inv_jacobian(
     const gsl::not_null<Jacobian<T, Dim, SourceFrame, TargetFrame>*> inv_jac,
-    const tnsr::Ij<T, Dim, Frame::NoFrame>& noframe_inv_jac) noexcept {
+    const tnsr::Ij<NoFrameT, Dim, Frame::NoFrame>& noframe_inv_jac) noexcept {
   std::array<T, Dim> temp{};
   for (size_t source = 0; source < Dim; ++source) {
     for (size_t target = 0; target < Dim; ++target) {
@@ -250,6 +288,39 @@ void multiply_inv_jacobian(
     }
   }
 }
+
+// The point at which the Jacobians of a map whose Jacobian is spatially uniform
+// are evaluated. Any point gives the same result, so we use the first. If there
+// are no points the Jacobians are never applied to anything, and the origin is
+// returned.
+template <typename T, size_t Dim>
+std::array<double, Dim> uniform_evaluation_point(
+    const std::array<T, Dim>& point) noexcept {
+  std::array<double, Dim> result{};
+  if (get_size(gsl::at(point, 0)) == 0) {
+    return result;
+  }
+  for (size_t i = 0; i < Dim; ++i) {
+    gsl::at(result, i) = get_element(gsl::at(point, i), 0);
+  }
+  return result;
+}
+
+// Set the Jacobian or inverse Jacobian of the first map of a chain from the
+// `double`-valued matrix of a map whose Jacobian is spatially uniform, with one
+// value per point of `point`.
+template <typename T, size_t Dim, typename JacobianType>
+void broadcast_uniform_jacobian(
+    const gsl::not_null<JacobianType*> result,
+    const tnsr::Ij<double, Dim, Frame::NoFrame>& uniform_jacobian,
+    const std::array<T, Dim>& point) noexcept {
+  for (size_t i = 0; i < Dim; ++i) {
+    for (size_t j = 0; j < Dim; ++j) {
+      result->get(i, j) =
+          make_with_value<T>(gsl::at(point, 0), uniform_jacobian.get(i, j));
+    }
+  }
+}
 }  // namespace detail
 
 template <typename SourceFrame, typename TargetFrame, typename... Maps>
@@ -273,23 +344,45 @@ auto CoordinateMap<SourceFrame, TargetFrame, Maps...>::inv_jacobian_impl(
         tnsr::Ij<T, dim, Frame::NoFrame> noframe_inv_jac{};
 
         if (UNLIKELY(count == 0)) {
-          detail::get_inv_jacobian(
-              make_not_null(&noframe_inv_jac), map, mapped_point, time,
-              functions_of_time,
-              domain::is_jacobian_time_dependent_t<Map, T>{});
-          for (size_t source = 0; source < dim; ++source) {
-            for (size_t target = 0; target < dim; ++target) {
-              inv_jac.get(source, target) =
-                  std::move(noframe_inv_jac.get(source, target));
+          if constexpr (domain::is_jacobian_spatially_uniform_v<Map>) {
+            tnsr::Ij<double, dim, Frame::NoFrame> uniform_inv_jac{};
+            detail::get_inv_jacobian(
+                make_not_null(&uniform_inv_jac), map,
+                detail::uniform_evaluation_point(mapped_point), time,
+                functions_of_time,
+                domain::is_jacobian_time_dependent_t<Map, double>{});
+            detail::broadcast_uniform_jacobian(make_not_null(&inv_jac),
+                                               uniform_inv_jac, mapped_point);
+          } else {
+            detail::get_inv_jacobian(
+                make_not_null(&noframe_inv_jac), map, mapped_point, time,
+                functions_of_time,
+                domain::is_jacobian_time_dependent_t<Map, T>{});
+            for (size_t source = 0; source < dim; ++source) {
+              for (size_t target = 0; target < dim; ++target) {
+                inv_jac.get(source, target) =
+                    std::move(noframe_inv_jac.get(source, target));
+              }
             }
           }
         } else if (LIKELY(not map.is_identity())) {
-          detail::get_inv_jacobian(
-              make_not_null(&noframe_inv_jac), map, mapped_point, time,
-              functions_of_time,
-              domain::is_jacobian_time_dependent_t<Map, T>{});
-          detail::multiply_inv_jacobian(make_not_null(&inv_jac),
-                                        noframe_inv_jac);
+          if constexpr (domain::is_jacobian_spatially_uniform_v<Map>) {
+            tnsr::Ij<double, dim, Frame::NoFrame> uniform_inv_jac{};
+            detail::get_inv_jacobian(
+                make_not_null(&uniform_inv_jac), map,
+                detail::uniform_evaluation_point(mapped_point), time,
+                functions_of_time,
+                domain::is_jacobian_time_dependent_t<Map, double>{});
+            detail::multiply_inv_jacobian(make_not_null(&inv_jac),
+                                          uniform_inv_jac);
+          } else {
+            detail::get_inv_jacobian(
+                make_not_null(&noframe_inv_jac), map, mapped_point, time,
+                functions_of_time,
+                domain::is_jacobian_time_dependent_t<Map, T>{});
+            detail::multiply_inv_jacobian(make_not_null(&inv_jac),
+                                          noframe_inv_jac);
+          }
         }
 
         // Compute the source coordinates for the next map, only if we are not
@@ -323,20 +416,43 @@ auto CoordinateMap<SourceFrame, TargetFrame, Maps...>::jacobian_impl(
         tnsr::Ij<T, dim, Frame::NoFrame> noframe_jac{};
 
         if (UNLIKELY(count == 0)) {
-          detail::get_jacobian(make_not_null(&noframe_jac), map, mapped_point,
-                               time, functions_of_time,
-                               domain::is_jacobian_time_dependent_t<Map, T>{});
-          for (size_t target = 0; target < dim; ++target) {
-            for (size_t source = 0; source < dim; ++source) {
-              jac.get(target, source) =
-                  std::move(noframe_jac.get(target, source));
+          if constexpr (domain::is_jacobian_spatially_uniform_v<Map>) {
+            tnsr::Ij<double, dim, Frame::NoFrame> uniform_jac{};
+            detail::get_jacobian(
+                make_not_null(&uniform_jac), map,
+                detail::uniform_evaluation_point(mapped_point), time,
+                functions_of_time,
+                domain::is_jacobian_time_dependent_t<Map, double>{});
+            detail::broadcast_uniform_jacobian(make_not_null(&jac),
+                                               uniform_jac, mapped_point);
+          } else {
+            detail::get_jacobian(
+                make_not_null(&noframe_jac), map, mapped_point, time,
+                functions_of_time,
+                domain::is_jacobian_time_dependent_t<Map, T>{});
+            for (size_t target = 0; target < dim; ++target) {
+              for (size_t source = 0; source < dim; ++source) {
+                jac.get(target, source) =
+                    std::move(noframe_jac.get(target, source));
+              }
             }
           }
         } else if (LIKELY(not map.is_identity())) {
-          detail::get_jacobian(make_not_null(&noframe_jac), map, mapped_point,
-                               time, functions_of_time,
-                               domain::is_jacobian_time_dependent_t<Map, T>{});
-          detail::multiply_jacobian(make_not_null(&jac), noframe_jac);
+          if constexpr (domain::is_jacobian_spatially_uniform_v<Map>) {
+            tnsr::Ij<double, dim, Frame::NoFrame> uniform_jac{};
+            detail::get_jacobian(
+                make_not_null(&uniform_jac), map,
+                detail::uniform_evaluation_point(mapped_point), time,
+                functions_of_time,
+                domain::is_jacobian_time_dependent_t<Map, double>{});
+            detail::multiply_jacobian(make_not_null(&jac), uniform_jac);
+          } else {
+            detail::get_jacobian(
+                make_not_null(&noframe_jac), map, mapped_point, time,
+                functions_of_time,
+                domain::is_jacobian_time_dependent_t<Map, T>{});
+            detail::multiply_jacobian(make_not_null(&jac), noframe_jac);
+          }
         }
 
         // Compute the source coordinates for the next map, only if we are not
@@ -404,19 +520,39 @@ auto CoordinateMap<SourceFrame, TargetFrame, Maps...>::
 
         if (UNLIKELY(count == 0)) {
           // Set Jacobian and inverse Jacobian
-          detail::get_inv_jacobian(
-              make_not_null(&noframe_inv_jac), map, mapped_point, time,
-              functions_of_time,
-              domain::is_jacobian_time_dependent_t<Map, T>{});
-          detail::get_jacobian(make_not_null(&noframe_jac), map, mapped_point,
-                               time, functions_of_time,
-                               domain::is_jacobian_time_dependent_t<Map, T>{});
-          for (size_t target = 0; target < dim; ++target) {
-            for (size_t source = 0; source < dim; ++source) {
-              jac.get(target, source) =
-                  std::move(noframe_jac.get(target, source));
-              inv_jac.get(source, target) =
-                  std::move(noframe_inv_jac.get(source, target));
+          if constexpr (domain::is_jacobian_spatially_uniform_v<Map>) {
+            const std::array<double, dim> uniform_point =
+                detail::uniform_evaluation_point(mapped_point);
+            tnsr::Ij<double, dim, Frame::NoFrame> uniform_jac{};
+            tnsr::Ij<double, dim, Frame::NoFrame> uniform_inv_jac{};
+            detail::get_inv_jacobian(
+                make_not_null(&uniform_inv_jac), map, uniform_point, time,
+                functions_of_time,
+                domain::is_jacobian_time_dependent_t<Map, double>{});
+            detail::get_jacobian(
+                make_not_null(&uniform_jac), map, uniform_point, time,
+                functions_of_time,
+                domain::is_jacobian_time_dependent_t<Map, double>{});
+            detail::broadcast_uniform_jacobian(make_not_null(&jac),
+                                               uniform_jac, mapped_point);
+            detail::broadcast_uniform_jacobian(make_not_null(&inv_jac),
+                                               uniform_inv_jac, mapped_point);
+          } else {
+            detail::get_inv_jacobian(
+                make_not_null(&noframe_inv_jac), map, mapped_point, time,
+                functions_of_time,
+                domain::is_jacobian_time_dependent_t<Map, T>{});
+            detail::get_jacobian(
+                make_not_null(&noframe_jac), map, mapped_point, time,
+                functions_of_time,
+                domain::is_jacobian_time_dependent_t<Map, T>{});
+            for (size_t target = 0; target < dim; ++target) {
+              for (size_t source = 0; source < dim; ++source) {
+                jac.get(target, source) =
+                    std::move(noframe_jac.get(target, source));
+                inv_jac.get(source, target) =
+                    std::move(noframe_inv_jac.get(source, target));
+              }
             }
           }
 
@@ -442,54 +578,81 @@ auto CoordinateMap<SourceFrame, TargetFrame, Maps...>::
           // velocity is also zero. That is, we do not optimize for the map
           // being instantaneously zero.
 
-          detail::get_inv_jacobian(
-              make_not_null(&noframe_inv_jac), map, mapped_point, time,
-              functions_of_time,
-              domain::is_jacobian_time_dependent_t<Map, T>{});
-          detail::get_jacobian(make_not_null(&noframe_jac), map, mapped_point,
-                               time, functions_of_time,
-                               domain::is_jacobian_time_dependent_t<Map, T>{});
-
-          // Perform matrix multiplication for Jacobian and inverse Jacobian
-          detail::multiply_inv_jacobian(make_not_null(&inv_jac),
-                                        noframe_inv_jac);
-          detail::multiply_jacobian(make_not_null(&jac), noframe_jac);
-
-          // Set frame velocity, only if map is time-dependent
-          std::array<T, dim> noframe_frame_velocity{};
-          if (domain::is_map_time_dependent_v<
-                  std::tuple_element_t<count, std::decay_t<decltype(maps)>>>) {
-            noframe_frame_velocity = detail::get_frame_velocity(
-                map, mapped_point, time, functions_of_time);
-            for (size_t target_frame_index = 0; target_frame_index < dim;
-                 ++target_frame_index) {
-              for (size_t source_frame_index = 0; source_frame_index < dim;
-                   ++source_frame_index) {
-                gsl::at(noframe_frame_velocity, target_frame_index) +=
-                    noframe_jac.get(target_frame_index, source_frame_index) *
+          // Accumulate the Jacobian and inverse Jacobian of this map, which
+          // are `double`-valued if they are spatially uniform, into those of
+          // the map chain, and transform the frame velocity.
+          const auto accumulate = [&frame_velocity, &inv_jac, &jac, &map,
+                                   &mapped_point, time, &functions_of_time](
+                                      const auto& current_jac,
+                                      const auto& current_inv_jac) noexcept {
+            // Perform matrix multiplication for Jacobian and inverse Jacobian
+            detail::multiply_inv_jacobian(make_not_null(&inv_jac),
+                                          current_inv_jac);
+            detail::multiply_jacobian(make_not_null(&jac), current_jac);
+
+            // Set frame velocity, only if map is time-dependent
+            std::array<T, dim> noframe_frame_velocity{};
+            if (domain::is_map_time_dependent_v<Map>) {
+              noframe_frame_velocity = detail::get_frame_velocity(
+                  map, mapped_point, time, functions_of_time);
+              for (size_t target_frame_index = 0; target_frame_index < dim;
+                   ++target_frame_index) {
+                for (size_t source_frame_index = 0; source_frame_index < dim;
+                     ++source_frame_index) {
+                  gsl::at(noframe_frame_velocity, target_frame_index) +=
+                      current_jac.get(target_frame_index, source_frame_index) *
+                      frame_velocity.get(source_frame_index);
+                }
+              }
+            } else {
+              for (size_t target_frame_index = 0; target_frame_index < dim;
+                   ++target_frame_index) {
+                size_t source_frame_index = 0;
+                gsl::at(noframe_frame_velocity, target_frame_index) =
+                    current_jac.get(target_frame_index, source_frame_index) *
                     frame_velocity.get(source_frame_index);
+                for (source_frame_index = 1; source_frame_index < dim;
+                     ++source_frame_index) {
+                  gsl::at(noframe_frame_velocity, target_frame_index) +=
+                      current_jac.get(target_frame_index, source_frame_index) *
+                      frame_velocity.get(source_frame_index);
+                }
               }
             }
-          } else {
             for (size_t target_frame_index = 0; target_frame_index < dim;
                  ++target_frame_index) {
-              size_t source_frame_index = 0;
-              gsl::at(noframe_frame_velocity, target_frame_index) =
-                  noframe_jac.get(target_frame_index, source_frame_index) *
-                  frame_velocity.get(source_frame_index);
-              for (source_frame_index = 1; source_frame_index < dim;
-                   ++source_frame_index) {
-                gsl::at(noframe_frame_velocity, target_frame_index) +=
-                    noframe_jac.get(target_frame_index, source_frame_index) *
-                    frame_velocity.get(source_frame_index);
-              }
+              using std::swap;
+              swap(gsl::at(noframe_frame_velocity, target_frame_index),
+                   frame_velocity.get(target_frame_index));
             }
-          }
-          for (size_t target_frame_index = 0; target_frame_index < dim;
-               ++target_frame_index) {
-            using std::swap;
-            swap(gsl::at(noframe_frame_velocity, target_frame_index),
-                 frame_velocity.get(target_frame_index));
+          };
+
+          if constexpr (domain::is_jacobian_spatially_uniform_v<Map>) {
+            // The Jacobians are evaluated once and applied to every point as a
+            // single small matrix transform of the accumulated quantities.
+            const std::array<double, dim> uniform_point =
+                detail::uniform_evaluation_point(mapped_point);
+            tnsr::Ij<double, dim, Frame::NoFrame> uniform_jac{};
+            tnsr::Ij<double, dim, Frame::NoFrame> uniform_inv_jac{};
+            detail::get_inv_jacobian(
+                make_not_null(&uniform_inv_jac), map, uniform_point, time,
+                functions_of_time,
+                domain::is_jacobian_time_dependent_t<Map, double>{});
+            detail::get_jacobian(
+                make_not_null(&uniform_jac), map, uniform_point, time,
+                functions_of_time,
+                domain::is_jacobian_time_dependent_t<Map, double>{});
+            accumulate(uniform_jac, uniform_inv_jac);
+          } else {
+            detail::get_inv_jacobian(
+                make_not_null(&noframe_inv_jac), map, mapped_point, time,
+                functions_of_time,
+                domain::is_jacobian_time_dependent_t<Map, T>{});
+            detail::get_jacobian(
+                make_not_null(&noframe_jac), map, mapped_point, time,
+                functions_of_time,
+                domain::is_jacobian_time_dependent_t<Map, T>{});
+            accumulate(noframe_jac, noframe_inv_jac);
           }
         }
 
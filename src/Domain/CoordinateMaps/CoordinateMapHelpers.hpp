@@ -8,13 +8,16 @@
 #include <string>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Identity.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
 #include "ErrorHandling/FloatingPointExceptions.hpp"
 #include "Utilities/DereferenceWrapper.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/TypeTraits/CreateIsCallable.hpp"
 #include "Utilities/TypeTraits/RemoveReferenceWrapper.hpp"
 
 namespace domain {
@@ -144,6 +147,101 @@ auto apply_inverse_map(
 }
 // @}
 
+CREATE_IS_CALLABLE(inverse)
+CREATE_IS_CALLABLE_V(inverse)
+
+/// Invert the points flagged in `is_valid` one at a time with
+/// `scalar_inverse`, and clear the flag of the points where it fails
+template <size_t Dim, typename ScalarInverse>
+void apply_inverse_map_pointwise(
+    const gsl::not_null<std::array<DataVector, Dim>*> target_points,
+    const gsl::not_null<std::vector<bool>*> is_valid,
+    const ScalarInverse& scalar_inverse) noexcept {
+  std::array<double, Dim> target_point{};
+  for (size_t s = 0; s < is_valid->size(); ++s) {
+    if (not(*is_valid)[s]) {
+      continue;
+    }
+    for (size_t d = 0; d < Dim; ++d) {
+      gsl::at(target_point, d) = gsl::at(*target_points, d)[s];
+    }
+    const auto source_point = scalar_inverse(target_point);
+    if (source_point) {
+      for (size_t d = 0; d < Dim; ++d) {
+        gsl::at(*target_points, d)[s] = gsl::at(*source_point, d);
+      }
+    } else {
+      (*is_valid)[s] = false;
+    }
+  }
+}
+
+// @{
+/// Apply the inverse map in place to the points flagged in `is_valid`, and
+/// clear the flag of the points where the inverse isn't defined. Maps that
+/// provide a batched `inverse` overload taking the points and the flags by
+/// `gsl::not_null` invert all points at once, all other maps are inverted
+/// point by point.
+template <size_t Dim, typename Map>
+void apply_inverse_map(
+    const gsl::not_null<std::array<DataVector, Dim>*> target_points,
+    const gsl::not_null<std::vector<bool>*> is_valid, const Map& the_map,
+    const double /*t*/,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+    /*functions_of_time*/,
+    const std::false_type /*is_time_independent*/) noexcept {
+  if (UNLIKELY(the_map.is_identity())) {
+    return;
+  }
+  if constexpr (is_inverse_callable_v<
+                    Map, gsl::not_null<std::array<DataVector, Dim>*>,
+                    gsl::not_null<std::vector<bool>*>>) {
+    the_map.inverse(target_points, is_valid);
+  } else {
+    apply_inverse_map_pointwise(
+        target_points, is_valid,
+        [&the_map](const std::array<double, Dim>& target_point) noexcept {
+          return the_map.inverse(target_point);
+        });
+  }
+}
+
+template <size_t Dim, typename Map>
+void apply_inverse_map(
+    const gsl::not_null<std::array<DataVector, Dim>*> target_points,
+    const gsl::not_null<std::vector<bool>*> is_valid, const Map& the_map,
+    const double t,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time,
+    const std::true_type /*is_time_dependent*/) noexcept {
+  ASSERT(not functions_of_time.empty(),
+         "A function of time must be present if the maps are time-dependent.");
+  ASSERT(
+      [t]() noexcept {
+        disable_floating_point_exceptions();
+        const bool isnan = std::isnan(t);
+        enable_floating_point_exceptions();
+        return not isnan;
+      }(),
+      "The time must not be NaN for time-dependent maps.");
+  if constexpr (is_inverse_callable_v<
+                    Map, gsl::not_null<std::array<DataVector, Dim>*>,
+                    gsl::not_null<std::vector<bool>*>, double,
+                    decltype(functions_of_time)>) {
+    the_map.inverse(target_points, is_valid, t, functions_of_time);
+  } else {
+    apply_inverse_map_pointwise(
+        target_points, is_valid,
+        [&the_map, &t, &functions_of_time](
+            const std::array<double, Dim>& target_point) noexcept {
+          return the_map.inverse(target_point, t, functions_of_time);
+        });
+  }
+}
+// @}
+
 // @{
 /// Compute the frame velocity
 template <typename T, size_t Dim, typename Map>
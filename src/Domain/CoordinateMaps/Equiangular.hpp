@@ -53,6 +53,7 @@ namespace CoordinateMaps {
 class Equiangular {
  public:
   static constexpr size_t dim = 1;
+  static constexpr bool jacobian_is_separable = true;
 
   Equiangular(double A, double B, double a, double b) noexcept;
 
@@ -28,6 +28,8 @@ template <size_t Dim>
 class Identity {
  public:
   static constexpr size_t dim = Dim;
+  static constexpr bool jacobian_is_spatially_uniform = true;
+  static constexpr bool jacobian_is_separable = true;
 
   Identity() = default;
   ~Identity() = default;
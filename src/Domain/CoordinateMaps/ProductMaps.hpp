@@ -13,6 +13,7 @@
 #include <utility>
 
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/CoordinateMaps/TimeDependentHelpers.hpp"
 #include "Utilities/DereferenceWrapper.hpp"
 #include "Utilities/MakeWithValue.hpp"
 #include "Utilities/TMPL.hpp"
@@ -36,6 +37,12 @@ class ProductOf2Maps {
  public:
   static constexpr size_t dim = Map1::dim + Map2::dim;
   using map_list = tmpl::list<Map1, Map2>;
+  static constexpr bool jacobian_is_spatially_uniform =
+      domain::is_jacobian_spatially_uniform_v<Map1> and
+      domain::is_jacobian_spatially_uniform_v<Map2>;
+  static constexpr bool jacobian_is_separable =
+      domain::is_jacobian_separable_v<Map1> and
+      domain::is_jacobian_separable_v<Map2>;
   static_assert(dim == 2 or dim == 3,
                 "Only 2D and 3D maps are supported by ProductOf2Maps");
 
@@ -87,6 +94,14 @@ class ProductOf3Maps {
  public:
   static constexpr size_t dim = Map1::dim + Map2::dim + Map3::dim;
   using map_list = tmpl::list<Map1, Map2, Map3>;
+  static constexpr bool jacobian_is_spatially_uniform =
+      domain::is_jacobian_spatially_uniform_v<Map1> and
+      domain::is_jacobian_spatially_uniform_v<Map2> and
+      domain::is_jacobian_spatially_uniform_v<Map3>;
+  static constexpr bool jacobian_is_separable =
+      domain::is_jacobian_separable_v<Map1> and
+      domain::is_jacobian_separable_v<Map2> and
+      domain::is_jacobian_separable_v<Map3>;
   static_assert(dim == 3, "Only 3D maps are implemented for ProductOf3Maps");
 
   // Needed for Charm++ serialization
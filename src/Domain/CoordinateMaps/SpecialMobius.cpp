@@ -7,7 +7,9 @@
 #include <boost/optional.hpp>
 #include <cmath>
 #include <pup.h>
+#include <vector>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "ErrorHandling/Assert.hpp"
 #include "Utilities/ConstantExpressions.hpp"
@@ -94,6 +96,27 @@ boost::optional<std::array<double, 3>> SpecialMobius::inverse(
   return boost::none;
 }
 
+void SpecialMobius::inverse(
+    const gsl::not_null<std::array<DataVector, 3>*> target_coords,
+    const gsl::not_null<std::vector<bool>*> is_valid) const noexcept {
+  // Invert only points inside or on the unit sphere. The other points are
+  // moved to the origin so the map can be applied to all points at once.
+  for (size_t s = 0; s < is_valid->size(); ++s) {
+    if ((*is_valid)[s]) {
+      const double r = sqrt(square((*target_coords)[0][s]) +
+                            square((*target_coords)[1][s]) +
+                            square((*target_coords)[2][s]));
+      (*is_valid)[s] = r <= 1.0 or equal_within_roundoff(r, 1.0);
+    }
+    if (not(*is_valid)[s]) {
+      for (size_t d = 0; d < 3; ++d) {
+        gsl::at(*target_coords, d)[s] = 0.0;
+      }
+    }
+  }
+  *target_coords = mobius_distortion(*target_coords, -mu_);
+}
+
 template <typename T>
 tnsr::Ij<tt::remove_cvref_wrap_t<T>, 3, Frame::NoFrame> SpecialMobius::jacobian(
     const std::array<T, 3>& source_coords) const noexcept {
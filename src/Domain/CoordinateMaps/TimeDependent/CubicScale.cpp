@@ -14,6 +14,7 @@
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
@@ -209,6 +210,117 @@ CubicScale<Dim>::inverse(
   return {std::move(result)};
 }
 
+template <size_t Dim>
+void CubicScale<Dim>::inverse(
+    const gsl::not_null<std::array<DataVector, Dim>*> target_coords,
+    const gsl::not_null<std::vector<bool>*> is_valid, const double time,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time) const noexcept {
+  ASSERT(functions_of_time.find(f_of_t_a_) != functions_of_time.end(),
+         "Could not find function of time: '"
+             << f_of_t_a_ << "' in functions of time. Known functions are "
+             << keys_of(functions_of_time));
+  ASSERT(functions_of_time.find(f_of_t_b_) != functions_of_time.end(),
+         "Could not find function of time: '"
+             << f_of_t_b_ << "' in functions of time. Known functions are "
+             << keys_of(functions_of_time));
+
+  if (functions_of_time_equal_) {
+    // optimization for linear radial scaling
+    const double one_over_a_of_t =
+        1.0 / functions_of_time.at(f_of_t_a_)->func(time)[0][0];
+    for (size_t i = 0; i < Dim; ++i) {
+      gsl::at(*target_coords, i) *= one_over_a_of_t;
+    }
+    return;
+  }
+
+  const double a_of_t = functions_of_time.at(f_of_t_a_)->func(time)[0][0];
+  const double b_of_t = functions_of_time.at(f_of_t_b_)->func(time)[0][0];
+  if (a_of_t <= 0.0) {
+    ERROR("We require expansion_a > 0 for invertibility, however expansion_a = "
+          << a_of_t << ".");
+  }
+  if (b_of_t < 2.0 / 3.0 * a_of_t or b_of_t <= 0.0) {
+    ERROR("The map is invertible only if 0 < expansion_b < expansion_a*2/3, "
+          << " but expansion_b = " << b_of_t << " and expansion_a = " << a_of_t
+          << ".");
+  }
+
+  // Gather the points that need a root find. The origin maps to itself, and
+  // points at the outer boundary map to the outer boundary. As in the
+  // single-point inverse we support epsilon above b(t).
+  std::vector<size_t> indices{};
+  indices.reserve(is_valid->size());
+  DataVector target_dimensionless_radius{is_valid->size()};
+  for (size_t s = 0; s < is_valid->size(); ++s) {
+    if (not(*is_valid)[s]) {
+      continue;
+    }
+    double radius_squared = 0.0;
+    for (size_t i = 0; i < Dim; ++i) {
+      radius_squared += square(gsl::at(*target_coords, i)[s]);
+    }
+    const double dimensionless_radius =
+        sqrt(radius_squared) * one_over_outer_boundary_;
+    if (UNLIKELY(dimensionless_radius == 0.0)) {
+      continue;
+    }
+    if (UNLIKELY(dimensionless_radius >
+                 b_of_t *
+                     (1.0 + 2.0 * std::numeric_limits<double>::epsilon()))) {
+      (*is_valid)[s] = false;
+    } else if (UNLIKELY(dimensionless_radius >= b_of_t)) {
+      for (size_t i = 0; i < Dim; ++i) {
+        gsl::at(*target_coords, i)[s] /= dimensionless_radius;
+      }
+    } else {
+      target_dimensionless_radius[indices.size()] = dimensionless_radius;
+      indices.push_back(s);
+    }
+  }
+  if (indices.empty()) {
+    return;
+  }
+  const size_t num_points = indices.size();
+  const DataVector dimensionless_radius(target_dimensionless_radius.data(),
+                                        num_points);
+
+  // Solve q * ( (b-a) q^2 + a) - r / R = 0 for q = rho / R on all points at
+  // once, starting from the linearly approximated solution r / (R b).
+  const double cubic_coef_a = b_of_t - a_of_t;
+  const auto cubic_and_deriv =
+      [&cubic_coef_a, &a_of_t, &dimensionless_radius](
+          const DataVector& source_dimensionless_radius) noexcept {
+        return std::make_pair(
+            DataVector{source_dimensionless_radius *
+                           (cubic_coef_a * square(source_dimensionless_radius) +
+                            a_of_t) -
+                       dimensionless_radius},
+            DataVector{3.0 * cubic_coef_a *
+                           square(source_dimensionless_radius) +
+                       a_of_t});
+      };
+  DataVector source_dimensionless_radius = dimensionless_radius / b_of_t;
+  const std::vector<bool> converged = RootFinder::safeguarded_newton_raphson(
+      make_not_null(&source_dimensionless_radius), cubic_and_deriv,
+      DataVector{num_points, 0.0}, DataVector{num_points, 1.0}, 0.0, 1.0e-14);
+
+  for (size_t j = 0; j < num_points; ++j) {
+    const size_t s = indices[j];
+    if (not converged[j]) {
+      (*is_valid)[s] = false;
+      continue;
+    }
+    const double scale_factor =
+        source_dimensionless_radius[j] / dimensionless_radius[j];
+    for (size_t i = 0; i < Dim; ++i) {
+      gsl::at(*target_coords, i)[s] *= scale_factor;
+    }
+  }
+}
+
 template <size_t Dim>
 template <typename T>
 std::array<tt::remove_cvref_wrap_t<T>, Dim> CubicScale<Dim>::frame_velocity(
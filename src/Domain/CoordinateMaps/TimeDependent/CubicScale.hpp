@@ -10,11 +10,14 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TypeTraits/RemoveReferenceWrapper.hpp"
 
 /// \cond
+class DataVector;
 namespace domain {
 namespace FunctionsOfTime {
 class FunctionOfTime;
@@ -122,6 +125,16 @@ class CubicScale {
           std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
           functions_of_time) const noexcept;
 
+  /// Inverts the points flagged in `is_valid` in place, solving the cubic
+  /// equation for all of them at once. Clears the flags of the points outside
+  /// the range of the map.
+  void inverse(gsl::not_null<std::array<DataVector, Dim>*> target_coords,
+               gsl::not_null<std::vector<bool>*> is_valid, double time,
+               const std::unordered_map<
+                   std::string,
+                   std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+                   functions_of_time) const noexcept;
+
   template <typename T>
   std::array<tt::remove_cvref_wrap_t<T>, Dim> frame_velocity(
       const std::array<T, Dim>& source_coords, double time,
@@ -57,6 +57,7 @@ template <>
 class Rotation<2> {
  public:
   static constexpr size_t dim = 2;
+  static constexpr bool jacobian_is_spatially_uniform = true;
 
   explicit Rotation(std::string function_of_time_name) noexcept;
   Rotation() = default;
@@ -37,6 +37,8 @@ namespace TimeDependent {
 class Translation {
  public:
   static constexpr size_t dim = 1;
+  static constexpr bool jacobian_is_spatially_uniform = true;
+  static constexpr bool jacobian_is_separable = true;
 
   Translation() = default;
   explicit Translation(std::string function_of_time_name) noexcept;
@@ -11,6 +11,7 @@
 #include <unordered_map>
 
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Utilities/TypeTraits/CreateHasStaticMemberVariable.hpp"
 #include "Utilities/TypeTraits/CreateIsCallable.hpp"
 #include "Utilities/TypeTraits/IsCallable.hpp"
 
@@ -30,6 +31,27 @@ constexpr bool is_map_time_dependent_v = is_map_time_dependent_t<T>::value;
 
 namespace detail {
 CREATE_IS_CALLABLE(jacobian)
+CREATE_HAS_STATIC_MEMBER_VARIABLE(jacobian_is_spatially_uniform)
+CREATE_HAS_STATIC_MEMBER_VARIABLE_V(jacobian_is_spatially_uniform)
+
+template <typename Map, bool HasMember = has_jacobian_is_spatially_uniform_v<
+                                            Map, bool>>
+struct is_jacobian_spatially_uniform : std::false_type {};
+
+template <typename Map>
+struct is_jacobian_spatially_uniform<Map, true>
+    : std::bool_constant<Map::jacobian_is_spatially_uniform> {};
+
+CREATE_HAS_STATIC_MEMBER_VARIABLE(jacobian_is_separable)
+CREATE_HAS_STATIC_MEMBER_VARIABLE_V(jacobian_is_separable)
+
+template <typename Map,
+          bool HasMember = has_jacobian_is_separable_v<Map, bool>>
+struct is_jacobian_separable : std::false_type {};
+
+template <typename Map>
+struct is_jacobian_separable<Map, true>
+    : std::bool_constant<Map::jacobian_is_separable> {};
 }  // namespace detail
 
 /// Check if the calls to the Jacobian and inverse Jacobian of the coordinate
@@ -45,4 +67,37 @@ using is_jacobian_time_dependent_t = detail::is_jacobian_callable_t<
 template <typename Map, typename T>
 constexpr bool is_jacobian_time_dependent_v =
     is_jacobian_time_dependent_t<Map, T>::value;
+
+/*!
+ * \brief Check if the Jacobian and inverse Jacobian of the coordinate map are
+ * the same at every point in space (though possibly time-dependent), as they
+ * are for rigid maps such as translations and rotations.
+ *
+ * \details A map opts in by declaring `static constexpr bool
+ * jacobian_is_spatially_uniform = true;`. `CoordinateMap` then evaluates the
+ * Jacobians of such a map at a single point with `double`s, and applies them to
+ * the Jacobians accumulated along the map chain as one small matrix transform
+ * instead of as a product of full-element tensors.
+ */
+template <typename Map>
+constexpr bool is_jacobian_spatially_uniform_v =
+    detail::is_jacobian_spatially_uniform<std::decay_t<Map>>::value;
+
+/*!
+ * \brief Check if each target coordinate of the coordinate map depends only on
+ * the corresponding source coordinate (and possibly time), so that the Jacobian
+ * is diagonal and each diagonal component varies along a single dimension.
+ *
+ * \details Maps opt in like for `is_jacobian_spatially_uniform_v`, by declaring
+ * `static constexpr bool jacobian_is_separable = true;`, and are otherwise
+ * assumed not to be separable. This includes one-dimensional maps, so that a
+ * map whose target coordinate also depends on time or on other quantities is
+ * never treated as separable by accident. `CoordinateMap::is_separable()` is
+ * `true` if all maps it is composed of are separable, in which case volume
+ * derivatives can be computed from the diagonal of the inverse Jacobian alone
+ * (see `domain::SeparableInverseJacobian`).
+ */
+template <typename Map>
+constexpr bool is_jacobian_separable_v =
+    detail::is_jacobian_separable<std::decay_t<Map>>::value;
 }  // namespace domain
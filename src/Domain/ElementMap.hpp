@@ -52,6 +52,11 @@ class ElementMap {
 
   const ElementId<Dim>& element_id() const noexcept { return element_id_; }
 
+  /// Returns `true` if the map is separable, see
+  /// `domain::CoordinateMapBase::is_separable`. The affine map from the
+  /// Element to the Block is always separable.
+  bool is_separable() const noexcept { return block_map_->is_separable(); }
+
   template <typename T>
   tnsr::I<T, Dim, TargetFrame> operator()(
       tnsr::I<T, Dim, Frame::Logical> source_point) const noexcept {
@@ -0,0 +1,175 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Domain/SeparableInverseJacobian.hpp"
+
+#include <array>
+#include <pup.h>
+#include <pup_stl.h>
+#include <utility>
+
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.hpp"
+#include "Domain/ElementMap.hpp"
+#include "ErrorHandling/Assert.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+
+namespace domain {
+namespace {
+// Fill the volume data `result` with the values of the one-dimensional
+// `factor` along the dimension `d`
+template <size_t Dim>
+void expand_factor(const gsl::not_null<DataVector*> result,
+                   const DataVector& factor, const Index<Dim>& extents,
+                   const size_t d) noexcept {
+  // The stride between consecutive grid points along dimension d
+  size_t stride = 1;
+  for (size_t i = 0; i < d; ++i) {
+    stride *= extents[i];
+  }
+  const size_t number_of_blocks = extents.product() / (stride * extents[d]);
+  size_t s = 0;
+  for (size_t block = 0; block < number_of_blocks; ++block) {
+    for (size_t j = 0; j < extents[d]; ++j) {
+      for (size_t i = 0; i < stride; ++i, ++s) {
+        (*result)[s] = factor[j];
+      }
+    }
+  }
+}
+}  // namespace
+
+template <size_t Dim, typename TargetFrame>
+SeparableInverseJacobian<Dim, TargetFrame>::SeparableInverseJacobian(
+    const ElementMap<Dim, TargetFrame>& element_map,
+    const Mesh<Dim>& mesh) noexcept
+    : extents_(mesh.extents()) {
+  ASSERT(element_map.is_separable(),
+         "Can only factor the inverse Jacobian of a separable map.");
+  for (size_t d = 0; d < Dim; ++d) {
+    // Since the d-th diagonal component only depends on the d-th logical
+    // coordinate, it suffices to evaluate it along a single grid line.
+    const DataVector& points_1d =
+        Spectral::collocation_points(mesh.slice_through(d));
+    tnsr::I<DataVector, Dim, Frame::Logical> logical_coords(points_1d.size(),
+                                                            0.0);
+    logical_coords.get(d) = points_1d;
+    gsl::at(factors_, d) = element_map.inv_jacobian(logical_coords).get(d, d);
+  }
+}
+
+template <size_t Dim, typename TargetFrame>
+SeparableInverseJacobian<Dim, TargetFrame>::SeparableInverseJacobian(
+    Index<Dim> extents, std::array<DataVector, Dim> factors) noexcept
+    : extents_(std::move(extents)), factors_(std::move(factors)) {
+  for (size_t d = 0; d < Dim; ++d) {
+    ASSERT(gsl::at(factors_, d).size() == extents_[d],
+           "The factor in dimension " << d << " has "
+                                      << gsl::at(factors_, d).size()
+                                      << " points but the extents are "
+                                      << extents_);
+  }
+}
+
+template <size_t Dim, typename TargetFrame>
+InverseJacobian<DataVector, Dim, Frame::Logical, TargetFrame>
+SeparableInverseJacobian<Dim, TargetFrame>::inverse_jacobian() const noexcept {
+  InverseJacobian<DataVector, Dim, Frame::Logical, TargetFrame> result(
+      extents_.product(), 0.0);
+  for (size_t d = 0; d < Dim; ++d) {
+    expand_factor(make_not_null(&result.get(d, d)), gsl::at(factors_, d),
+                  extents_, d);
+  }
+  return result;
+}
+
+template <size_t Dim, typename TargetFrame>
+Scalar<DataVector> SeparableInverseJacobian<Dim, TargetFrame>::determinant()
+    const noexcept {
+  Scalar<DataVector> result{extents_.product()};
+  expand_factor(make_not_null(&get(result)), factors_[0], extents_, 0);
+  DataVector buffer{extents_.product()};
+  for (size_t d = 1; d < Dim; ++d) {
+    expand_factor(make_not_null(&buffer), gsl::at(factors_, d), extents_, d);
+    get(result) *= buffer;
+  }
+  return result;
+}
+
+template <size_t Dim, typename TargetFrame>
+void SeparableInverseJacobian<Dim, TargetFrame>::pup(PUP::er& p) noexcept {
+  p | extents_;
+  p | factors_;
+}
+
+template <size_t Dim, typename TargetFrame>
+bool operator==(
+    const SeparableInverseJacobian<Dim, TargetFrame>& lhs,
+    const SeparableInverseJacobian<Dim, TargetFrame>& rhs) noexcept {
+  if (lhs.extents() != rhs.extents()) {
+    return false;
+  }
+  for (size_t d = 0; d < Dim; ++d) {
+    if (lhs.factor(d) != rhs.factor(d)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <size_t Dim, typename TargetFrame>
+bool operator!=(
+    const SeparableInverseJacobian<Dim, TargetFrame>& lhs,
+    const SeparableInverseJacobian<Dim, TargetFrame>& rhs) noexcept {
+  return not(lhs == rhs);
+}
+
+namespace Tags {
+template <size_t Dim>
+void ElementToInertialSeparableInverseJacobian<Dim>::function(
+    const gsl::not_null<return_type*> result,
+    const std::optional<domain::SeparableInverseJacobian<Dim, Frame::Grid>>&
+        logical_to_grid_inverse_jacobian,
+    const domain::CoordinateMapBase<Frame::Grid, Frame::Inertial, Dim>&
+        grid_to_inertial_map) noexcept {
+  if (not logical_to_grid_inverse_jacobian.has_value() or
+      not grid_to_inertial_map.is_identity()) {
+    result->reset();
+    return;
+  }
+  std::array<DataVector, Dim> factors{};
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(factors, d) = logical_to_grid_inverse_jacobian->factor(d);
+  }
+  result->emplace(logical_to_grid_inverse_jacobian->extents(),
+                  std::move(factors));
+}
+}  // namespace Tags
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+#define FRAME(data) BOOST_PP_TUPLE_ELEM(1, data)
+
+#define INSTANTIATE(_, data)                                                   \
+  template class SeparableInverseJacobian<DIM(data), FRAME(data)>;             \
+  template bool operator==(                                                    \
+      const SeparableInverseJacobian<DIM(data), FRAME(data)>& lhs,             \
+      const SeparableInverseJacobian<DIM(data), FRAME(data)>& rhs) noexcept;   \
+  template bool operator!=(                                                    \
+      const SeparableInverseJacobian<DIM(data), FRAME(data)>& lhs,             \
+      const SeparableInverseJacobian<DIM(data), FRAME(data)>& rhs) noexcept;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3), (Frame::Inertial, Frame::Grid))
+
+#undef INSTANTIATE
+
+#define INSTANTIATE(_, data) \
+  template struct Tags::ElementToInertialSeparableInverseJacobian<DIM(data)>;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
+
+#undef INSTANTIATE
+#undef FRAME
+#undef DIM
+}  // namespace domain
@@ -0,0 +1,159 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <optional>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
+#include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Domain/CoordinateMaps/Tags.hpp"
+#include "Domain/Tags.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+template <size_t Dim, typename TargetFrame>
+class ElementMap;
+template <size_t Dim>
+class Mesh;
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace domain {
+/*!
+ * \ingroup ComputationalDomainGroup
+ * \brief The diagonal of the inverse Jacobian of a separable `ElementMap`,
+ * factored into one-dimensional pieces.
+ *
+ * \details When the map is separable (see
+ * `domain::CoordinateMapBase::is_separable`), e.g. for a `Brick` or a
+ * `Rectangle` with affine or equiangular maps in each dimension, the inverse
+ * Jacobian \f$\partial\xi^{\hat{i}}/\partial x^i\f$ is diagonal and its
+ * \f$d\f$-th diagonal component only varies along the \f$d\f$-th logical
+ * dimension. It is then held as `Dim` one-dimensional factors, each holding
+ * one value per grid point along its dimension, from which derivatives can be
+ * computed without contracting the logical derivatives with the full inverse
+ * Jacobian (see `partial_derivatives`).
+ *
+ * \note The DataBox of an element still holds the full inverse Jacobian (see
+ * `evolution::dg::Initialization::Domain`), since the boundary terms and other
+ * quantities need it. This class is kept in addition to it, so it saves
+ * operations in the volume derivatives but does not save memory.
+ */
+template <size_t Dim, typename TargetFrame>
+class SeparableInverseJacobian {
+ public:
+  SeparableInverseJacobian() = default;
+
+  /// Compute the factors of the inverse Jacobian of `element_map` at the
+  /// collocation points of `mesh`. The map must be separable.
+  SeparableInverseJacobian(const ElementMap<Dim, TargetFrame>& element_map,
+                           const Mesh<Dim>& mesh) noexcept;
+
+  /// Construct from the one-dimensional `factors`, where `factors[d]` holds
+  /// one value per grid point of `extents` along the logical dimension `d`
+  SeparableInverseJacobian(Index<Dim> extents,
+                           std::array<DataVector, Dim> factors) noexcept;
+
+  const Index<Dim>& extents() const noexcept { return extents_; }
+
+  /// The diagonal component \f$\partial\xi^d/\partial x^d\f$ at the grid
+  /// points along the logical dimension `d`
+  const DataVector& factor(const size_t d) const noexcept {
+    return gsl::at(factors_, d);
+  }
+
+  /// The full inverse Jacobian on the volume grid
+  InverseJacobian<DataVector, Dim, Frame::Logical, TargetFrame>
+  inverse_jacobian() const noexcept;
+
+  /// The determinant of the inverse Jacobian on the volume grid
+  Scalar<DataVector> determinant() const noexcept;
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) noexcept;
+
+ private:
+  Index<Dim> extents_{};
+  std::array<DataVector, Dim> factors_{};
+};
+
+template <size_t Dim, typename TargetFrame>
+bool operator==(const SeparableInverseJacobian<Dim, TargetFrame>& lhs,
+                const SeparableInverseJacobian<Dim, TargetFrame>& rhs) noexcept;
+
+template <size_t Dim, typename TargetFrame>
+bool operator!=(const SeparableInverseJacobian<Dim, TargetFrame>& lhs,
+                const SeparableInverseJacobian<Dim, TargetFrame>& rhs) noexcept;
+
+namespace Tags {
+/// \ingroup DataBoxTagsGroup
+/// \ingroup ComputationalDomainGroup
+/// The factored inverse Jacobian of the element map, or `std::nullopt` if
+/// the map is not separable.
+template <size_t Dim, typename TargetFrame>
+struct SeparableInverseJacobian : db::SimpleTag {
+  using type =
+      std::optional<domain::SeparableInverseJacobian<Dim, TargetFrame>>;
+};
+
+/// \ingroup DataBoxTagsGroup
+/// \ingroup ComputationalDomainGroup
+/// Computes the factored inverse Jacobian of the map held by `MapTag` at
+/// the collocation points of the mesh, if the map is separable.
+template <typename MapTag>
+struct SeparableInverseJacobianCompute
+    : SeparableInverseJacobian<MapTag::dim, typename MapTag::target_frame>,
+      db::ComputeTag {
+  using base =
+      SeparableInverseJacobian<MapTag::dim, typename MapTag::target_frame>;
+  using return_type = typename base::type;
+  using argument_tags = tmpl::list<MapTag, Mesh<MapTag::dim>>;
+  static void function(const gsl::not_null<return_type*> result,
+                       const typename MapTag::type& element_map,
+                       const ::Mesh<MapTag::dim>& mesh) noexcept {
+    if (element_map.is_separable()) {
+      result->emplace(element_map, mesh);
+    } else {
+      result->reset();
+    }
+  }
+};
+
+/// \ingroup DataBoxTagsGroup
+/// \ingroup ComputationalDomainGroup
+/// Computes the factored logical to inertial inverse Jacobian from the
+/// factored logical to grid inverse Jacobian, if the element is separable and
+/// the map from the grid to the inertial frame is the identity, i.e. the mesh
+/// is not moving.
+///
+/// This is the factored counterpart of
+/// `domain::Tags::ElementToInertialInverseJacobian`, and allows evolution
+/// systems to compute volume derivatives without the full inverse Jacobian on
+/// grids that are separable.
+template <size_t Dim>
+struct ElementToInertialSeparableInverseJacobian
+    : SeparableInverseJacobian<Dim, Frame::Inertial>,
+      db::ComputeTag {
+  using base = SeparableInverseJacobian<Dim, Frame::Inertial>;
+  using return_type = typename base::type;
+  using argument_tags =
+      tmpl::list<SeparableInverseJacobian<Dim, Frame::Grid>,
+                 CoordinateMaps::Tags::CoordinateMap<Dim, Frame::Grid,
+                                                     Frame::Inertial>>;
+  static void function(
+      gsl::not_null<return_type*> result,
+      const std::optional<domain::SeparableInverseJacobian<Dim, Frame::Grid>>&
+          logical_to_grid_inverse_jacobian,
+      const domain::CoordinateMapBase<Frame::Grid, Frame::Inertial, Dim>&
+          grid_to_inertial_map) noexcept;
+};
+}  // namespace Tags
+}  // namespace domain
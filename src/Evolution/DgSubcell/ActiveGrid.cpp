@@ -0,0 +1,24 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/DgSubcell/ActiveGrid.hpp"
+
+#include <ostream>
+
+#include "ErrorHandling/Error.hpp"
+
+namespace evolution::dg::subcell {
+std::ostream& operator<<(std::ostream& os,
+                         const ActiveGrid active_grid) noexcept {
+  switch (active_grid) {
+    case ActiveGrid::Dg:
+      return os << "Dg";
+    case ActiveGrid::Subcell:
+      return os << "Subcell";
+    default:  // LCOV_EXCL_LINE
+      // LCOV_EXCL_START
+      ERROR("Missing a case for operator<<(ActiveGrid)");
+      // LCOV_EXCL_STOP
+  }
+}
+}  // namespace evolution::dg::subcell
@@ -0,0 +1,174 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/DgSubcell/Matrices.hpp"
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "ErrorHandling/Assert.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/StaticCache.hpp"
+
+namespace evolution::dg::subcell::fd {
+namespace {
+constexpr size_t maximum_number_of_dg_points =
+    Spectral::maximum_number_of_points<Spectral::Basis::Legendre>;
+
+Matrix compute_projection_matrix(const Mesh<1>& dg_mesh) noexcept {
+  const size_t num_dg_points = dg_mesh.extents(0);
+  const size_t num_subcells = 2 * num_dg_points - 1;
+  const double delta_xi = 2.0 / num_subcells;
+  // Gauss quadrature with as many points as the DG mesh integrates the DG
+  // polynomial exactly over each subcell.
+  const DataVector& gauss_points =
+      Spectral::collocation_points<Spectral::Basis::Legendre,
+                                   Spectral::Quadrature::Gauss>(num_dg_points);
+  const DataVector& gauss_weights =
+      Spectral::quadrature_weights<Spectral::Basis::Legendre,
+                                   Spectral::Quadrature::Gauss>(num_dg_points);
+  DataVector target_points(num_subcells * num_dg_points);
+  for (size_t i = 0; i < num_subcells; ++i) {
+    const double subcell_center = -1.0 + (i + 0.5) * delta_xi;
+    for (size_t q = 0; q < num_dg_points; ++q) {
+      target_points[i * num_dg_points + q] =
+          subcell_center + 0.5 * delta_xi * gauss_points[q];
+    }
+  }
+  const Matrix interpolation =
+      Spectral::interpolation_matrix(dg_mesh, target_points);
+  Matrix projection(num_subcells, num_dg_points, 0.0);
+  for (size_t i = 0; i < num_subcells; ++i) {
+    for (size_t j = 0; j < num_dg_points; ++j) {
+      for (size_t q = 0; q < num_dg_points; ++q) {
+        projection(i, j) +=
+            0.5 * gauss_weights[q] * interpolation(i * num_dg_points + q, j);
+      }
+    }
+  }
+  return projection;
+}
+
+Matrix compute_reconstruction_matrix(const Mesh<1>& dg_mesh) noexcept {
+  const size_t num_dg_points = dg_mesh.extents(0);
+  const size_t num_subcells = 2 * num_dg_points - 1;
+  const double delta_xi = 2.0 / num_subcells;
+  const Matrix& projection = projection_matrix(dg_mesh);
+  const DataVector& dg_weights = Spectral::quadrature_weights(dg_mesh);
+
+  // Solve the constrained least-squares problem through its KKT system
+  //   [P^T P  w] [u     ]   [P^T          ]
+  //   [w^T    0] [lambda] = [delta_xi 1^T ] ubar
+  Matrix kkt_matrix(num_dg_points + 1, num_dg_points + 1, 0.0);
+  Matrix kkt_rhs(num_dg_points + 1, num_subcells, 0.0);
+  for (size_t j = 0; j < num_dg_points; ++j) {
+    for (size_t k = 0; k < num_dg_points; ++k) {
+      for (size_t i = 0; i < num_subcells; ++i) {
+        kkt_matrix(j, k) += projection(i, j) * projection(i, k);
+      }
+    }
+    kkt_matrix(j, num_dg_points) = dg_weights[j];
+    kkt_matrix(num_dg_points, j) = dg_weights[j];
+    for (size_t i = 0; i < num_subcells; ++i) {
+      kkt_rhs(j, i) = projection(i, j);
+    }
+  }
+  for (size_t i = 0; i < num_subcells; ++i) {
+    kkt_rhs(num_dg_points, i) = delta_xi;
+  }
+  const Matrix kkt_solution = inv(kkt_matrix) * kkt_rhs;
+
+  Matrix reconstruction(num_dg_points, num_subcells);
+  for (size_t j = 0; j < num_dg_points; ++j) {
+    for (size_t i = 0; i < num_subcells; ++i) {
+      reconstruction(j, i) = kkt_solution(j, i);
+    }
+  }
+  return reconstruction;
+}
+}  // namespace
+
+const Matrix& projection_matrix(const Mesh<1>& dg_mesh) noexcept {
+  ASSERT(dg_mesh.basis(0) == Spectral::Basis::Legendre,
+         "The DG basis must be Legendre but got " << dg_mesh);
+  ASSERT(dg_mesh.extents(0) >= 2,
+         "The DG mesh must have at least two points but got " << dg_mesh);
+  ASSERT(dg_mesh.extents(0) <= maximum_number_of_dg_points,
+         "The DG mesh has more points than supported by its quadrature: "
+             << dg_mesh);
+  const static auto cache = make_static_cache<
+      CacheEnumeration<Spectral::Quadrature, Spectral::Quadrature::Gauss,
+                       Spectral::Quadrature::GaussLobatto>,
+      CacheRange<2, maximum_number_of_dg_points + 1>>(
+      [](const Spectral::Quadrature quadrature,
+         const size_t num_points) noexcept {
+        return compute_projection_matrix(
+            Mesh<1>{num_points, Spectral::Basis::Legendre, quadrature});
+      });
+  return cache(dg_mesh.quadrature(0), dg_mesh.extents(0));
+}
+
+const Matrix& reconstruction_matrix(const Mesh<1>& dg_mesh) noexcept {
+  ASSERT(dg_mesh.basis(0) == Spectral::Basis::Legendre,
+         "The DG basis must be Legendre but got " << dg_mesh);
+  ASSERT(dg_mesh.extents(0) >= 2,
+         "The DG mesh must have at least two points but got " << dg_mesh);
+  ASSERT(dg_mesh.extents(0) <= maximum_number_of_dg_points,
+         "The DG mesh has more points than supported by its quadrature: "
+             << dg_mesh);
+  const static auto cache = make_static_cache<
+      CacheEnumeration<Spectral::Quadrature, Spectral::Quadrature::Gauss,
+                       Spectral::Quadrature::GaussLobatto>,
+      CacheRange<2, maximum_number_of_dg_points + 1>>(
+      [](const Spectral::Quadrature quadrature,
+         const size_t num_points) noexcept {
+        return compute_reconstruction_matrix(
+            Mesh<1>{num_points, Spectral::Basis::Legendre, quadrature});
+      });
+  return cache(dg_mesh.quadrature(0), dg_mesh.extents(0));
+}
+
+namespace {
+template <size_t Dim, size_t... Is>
+std::array<std::reference_wrapper<const Matrix>, Dim> make_matrices(
+    const Mesh<Dim>& dg_mesh,
+    const Matrix& (*const matrix_1d)(const Mesh<1>&) noexcept,
+    std::index_sequence<Is...> /*meta*/) noexcept {
+  return {{matrix_1d(dg_mesh.slice_through(Is))...}};
+}
+}  // namespace
+
+template <size_t Dim>
+std::array<std::reference_wrapper<const Matrix>, Dim> projection_matrices(
+    const Mesh<Dim>& dg_mesh) noexcept {
+  return make_matrices(dg_mesh, &projection_matrix,
+                       std::make_index_sequence<Dim>{});
+}
+
+template <size_t Dim>
+std::array<std::reference_wrapper<const Matrix>, Dim> reconstruction_matrices(
+    const Mesh<Dim>& dg_mesh) noexcept {
+  return make_matrices(dg_mesh, &reconstruction_matrix,
+                       std::make_index_sequence<Dim>{});
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATION(r, data)                                               \
+  template std::array<std::reference_wrapper<const Matrix>, DIM(data)>       \
+  projection_matrices(const Mesh<DIM(data)>& dg_mesh) noexcept;              \
+  template std::array<std::reference_wrapper<const Matrix>, DIM(data)>       \
+  reconstruction_matrices(const Mesh<DIM(data)>& dg_mesh) noexcept;
+
+GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
+
+#undef INSTANTIATION
+#undef DIM
+}  // namespace evolution::dg::subcell::fd
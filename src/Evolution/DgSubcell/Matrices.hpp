@@ -0,0 +1,71 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <functional>
+
+/// \cond
+class Matrix;
+template <size_t Dim>
+class Mesh;
+/// \endcond
+
+namespace evolution::dg::subcell::fd {
+/*!
+ * \ingroup DgSubcellGroup
+ * \brief Computes the matrix that projects the solution on the 1d DG grid to
+ * the cell averages on the \f$2N-1\f$ subcells (see `fd::mesh`).
+ *
+ * The subcell average \f$\bar{u}_i\f$ of the DG polynomial \f$u(\xi)\f$ is
+ * computed exactly by evaluating the interpolating polynomial at the Gauss
+ * points of each subcell,
+ *
+ * \f{align}{
+ * \bar{u}_i = \frac{1}{\Delta\xi}\int_{\xi_{i-1/2}}^{\xi_{i+1/2}} u(\xi)d\xi
+ * = \frac{1}{2}\sum_{q=0}^{N-1} w_q u\left(\xi_i + \frac{\Delta\xi}{2}
+ * \xi_q\right),
+ * \f}
+ *
+ * where \f$\xi_q\f$ and \f$w_q\f$ are the \f$N\f$ Legendre-Gauss points and
+ * weights. Since the subcells partition the element, the projection conserves
+ * the integral of the solution in logical coordinates.
+ */
+const Matrix& projection_matrix(const Mesh<1>& dg_mesh) noexcept;
+
+/*!
+ * \ingroup DgSubcellGroup
+ * \brief Computes the matrix that reconstructs the 1d DG solution from the
+ * \f$2N-1\f$ subcell averages.
+ *
+ * Since there are more subcells than DG grid points the reconstruction is
+ * computed by solving the constrained least-squares problem
+ *
+ * \f{align}{
+ * \min_{u}\lVert P u - \bar{u} \rVert^2 \quad\text{subject to}\quad
+ * \sum_{j=0}^{N-1} w_j u_j = \Delta\xi \sum_{i=0}^{2N-2} \bar{u}_i,
+ * \f}
+ *
+ * where \f$P\f$ is the `projection_matrix` and \f$w_j\f$ are the quadrature
+ * weights of the DG mesh. The constraint makes the reconstruction conservative,
+ * and projecting and then reconstructing a DG solution returns the original
+ * solution up to roundoff.
+ */
+const Matrix& reconstruction_matrix(const Mesh<1>& dg_mesh) noexcept;
+
+/// \ingroup DgSubcellGroup
+/// The `projection_matrix` in every dimension of the `dg_mesh`, suitable for
+/// `apply_matrices`
+template <size_t Dim>
+std::array<std::reference_wrapper<const Matrix>, Dim> projection_matrices(
+    const Mesh<Dim>& dg_mesh) noexcept;
+
+/// \ingroup DgSubcellGroup
+/// The `reconstruction_matrix` in every dimension of the `dg_mesh`, suitable
+/// for `apply_matrices`
+template <size_t Dim>
+std::array<std::reference_wrapper<const Matrix>, Dim> reconstruction_matrices(
+    const Mesh<Dim>& dg_mesh) noexcept;
+}  // namespace evolution::dg::subcell::fd
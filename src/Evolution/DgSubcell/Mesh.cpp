@@ -0,0 +1,38 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/DgSubcell/Mesh.hpp"
+
+#include <array>
+#include <cstddef>
+
+#include "ErrorHandling/Assert.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MakeArray.hpp"
+
+namespace evolution::dg::subcell::fd {
+template <size_t Dim>
+Mesh<Dim> mesh(const Mesh<Dim>& dg_mesh) noexcept {
+  ASSERT(dg_mesh.basis() == make_array<Dim>(Spectral::Basis::Legendre),
+         "The DG basis must be Legendre but got " << dg_mesh);
+  std::array<size_t, Dim> subcell_extents{};
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(subcell_extents, d) = 2 * dg_mesh.extents(d) - 1;
+  }
+  return Mesh<Dim>{subcell_extents, Spectral::Basis::FiniteDifference,
+                   Spectral::Quadrature::CellCentered};
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATION(r, data) \
+  template Mesh<DIM(data)> mesh(const Mesh<DIM(data)>& dg_mesh) noexcept;
+
+GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
+
+#undef INSTANTIATION
+#undef DIM
+}  // namespace evolution::dg::subcell::fd
@@ -0,0 +1,119 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/DgSubcell/MinmodReconstruction.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
+#include "DataStructures/IndexIterator.hpp"
+#include "ErrorHandling/Assert.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace evolution::dg::subcell::fd::reconstruction {
+namespace {
+double minmod_slope(const double a, const double b) noexcept {
+  return 0.5 * (std::copysign(1.0, a) + std::copysign(1.0, b)) *
+         std::min(std::abs(a), std::abs(b));
+}
+}  // namespace
+
+template <size_t Dim>
+void minmod(const gsl::not_null<DataVector*> lower_side_of_face_vars,
+            const gsl::not_null<DataVector*> upper_side_of_face_vars,
+            const DataVector& volume_vars, const DataVector& lower_ghost_vars,
+            const DataVector& upper_ghost_vars,
+            const Index<Dim>& subcell_extents, const size_t dim) noexcept {
+  const size_t num_cells = subcell_extents.product();
+  const size_t number_of_components = volume_vars.size() / num_cells;
+  const size_t num_cells_in_dim = subcell_extents[dim];
+  Index<Dim> ghost_extents = subcell_extents;
+  ghost_extents[dim] = minmod_ghost_zone_size;
+  Index<Dim> face_extents = subcell_extents;
+  ++face_extents[dim];
+  const size_t num_ghost_cells = ghost_extents.product();
+  const size_t num_faces = face_extents.product();
+  ASSERT(volume_vars.size() == number_of_components * num_cells,
+         "The size of the volume variables ("
+             << volume_vars.size()
+             << ") must be a multiple of the number of cells (" << num_cells
+             << ").");
+  ASSERT(lower_ghost_vars.size() == number_of_components * num_ghost_cells and
+             upper_ghost_vars.size() == number_of_components * num_ghost_cells,
+         "The ghost cells must hold " << number_of_components * num_ghost_cells
+                                      << " values, but the lower ghost cells "
+                                         "hold "
+                                      << lower_ghost_vars.size()
+                                      << " and the upper ghost cells hold "
+                                      << upper_ghost_vars.size());
+  if (lower_side_of_face_vars->size() != number_of_components * num_faces) {
+    lower_side_of_face_vars->destructive_resize(number_of_components *
+                                                num_faces);
+  }
+  if (upper_side_of_face_vars->size() != number_of_components * num_faces) {
+    upper_side_of_face_vars->destructive_resize(number_of_components *
+                                                num_faces);
+  }
+
+  for (IndexIterator<Dim> face(face_extents); face; ++face) {
+    // Cell values along the stripe through this face, from the ghost zones
+    // where the stripe leaves the element. The cell index is offset by the
+    // ghost zone size so it can't become negative.
+    Index<Dim> cell_index = *face;
+    const auto cell_value = [&](const size_t component,
+                                const size_t shifted_cell) noexcept {
+      if (shifted_cell < minmod_ghost_zone_size) {
+        cell_index[dim] = shifted_cell;
+        return lower_ghost_vars[component * num_ghost_cells +
+                                collapsed_index(cell_index, ghost_extents)];
+      }
+      if (shifted_cell >= num_cells_in_dim + minmod_ghost_zone_size) {
+        cell_index[dim] =
+            shifted_cell - num_cells_in_dim - minmod_ghost_zone_size;
+        return upper_ghost_vars[component * num_ghost_cells +
+                                collapsed_index(cell_index, ghost_extents)];
+      }
+      cell_index[dim] = shifted_cell - minmod_ghost_zone_size;
+      return volume_vars[component * num_cells +
+                         collapsed_index(cell_index, subcell_extents)];
+    };
+    // Face f lies between the cells f - 1 and f, which are the shifted cells
+    // f + 1 and f + 2
+    const size_t upper_cell = (*face)[dim] + minmod_ghost_zone_size;
+    for (size_t component = 0; component < number_of_components; ++component) {
+      const double u_lower_lower = cell_value(component, upper_cell - 2);
+      const double u_lower = cell_value(component, upper_cell - 1);
+      const double u_upper = cell_value(component, upper_cell);
+      const double u_upper_upper = cell_value(component, upper_cell + 1);
+      (*lower_side_of_face_vars)[component * num_faces +
+                                 face.collapsed_index()] =
+          u_lower +
+          0.5 * minmod_slope(u_lower - u_lower_lower, u_upper - u_lower);
+      (*upper_side_of_face_vars)[component * num_faces +
+                                 face.collapsed_index()] =
+          u_upper -
+          0.5 * minmod_slope(u_upper - u_lower, u_upper_upper - u_upper);
+    }
+  }
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATION(r, data)                                                \
+  template void minmod(gsl::not_null<DataVector*> lower_side_of_face_vars,    \
+                       gsl::not_null<DataVector*> upper_side_of_face_vars,    \
+                       const DataVector& volume_vars,                         \
+                       const DataVector& lower_ghost_vars,                    \
+                       const DataVector& upper_ghost_vars,                    \
+                       const Index<DIM(data)>& subcell_extents,               \
+                       size_t dim) noexcept;
+
+GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
+
+#undef INSTANTIATION
+#undef DIM
+}  // namespace evolution::dg::subcell::fd::reconstruction
@@ -0,0 +1,47 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+class DataVector;
+template <size_t Dim>
+class Index;
+/// \endcond
+
+namespace evolution::dg::subcell::fd::reconstruction {
+/// The number of ghost cells needed on each side of the element by `minmod`
+constexpr size_t minmod_ghost_zone_size = 2;
+
+/*!
+ * \ingroup DgSubcellGroup
+ * \brief Reconstructs the cell-centered variables to both sides of the cell
+ * faces in the dimension `dim` using a minmod-limited linear slope (MUSCL).
+ *
+ * In cell \f$i\f$ the slope is
+ * \f$\sigma_i=\mathrm{minmod}(u_i-u_{i-1},u_{i+1}-u_i)\f$, and the values on
+ * the lower and upper side of face \f$i-1/2\f$ are
+ * \f$u_{i-1}+\sigma_{i-1}/2\f$ and \f$u_i-\sigma_i/2\f$, respectively. The
+ * reconstruction is total variation diminishing and second-order accurate
+ * away from extrema.
+ *
+ * The face grid has the `subcell_extents` with one additional point in the
+ * dimension `dim`. The cells outside the element are taken from the
+ * `lower_ghost_vars` and `upper_ghost_vars`, which hold
+ * `minmod_ghost_zone_size` cells in the dimension `dim` as sliced by the
+ * neighbors with `evolution::dg::subcell::slice_data`, reoriented to this
+ * element. All variables may hold several independent components, each stored
+ * contiguously. The resulting face values are the input of the system's
+ * numerical flux, i.e. its approximate Riemann solver.
+ */
+template <size_t Dim>
+void minmod(gsl::not_null<DataVector*> lower_side_of_face_vars,
+            gsl::not_null<DataVector*> upper_side_of_face_vars,
+            const DataVector& volume_vars, const DataVector& lower_ghost_vars,
+            const DataVector& upper_ghost_vars,
+            const Index<Dim>& subcell_extents, size_t dim) noexcept;
+}  // namespace evolution::dg::subcell::fd::reconstruction
@@ -0,0 +1,61 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/DgSubcell/PerssonTci.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
+#include "DataStructures/IndexIterator.hpp"
+#include "DataStructures/ModalVector.hpp"
+#include "ErrorHandling/Assert.hpp"
+#include "NumericalAlgorithms/LinearOperators/CoefficientTransforms.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+
+namespace evolution::dg::subcell {
+template <size_t Dim>
+bool persson_tci(const DataVector& dg_u, const Mesh<Dim>& dg_mesh,
+                 const double alpha, const size_t num_highest_modes) noexcept {
+  ASSERT(num_highest_modes > 0,
+         "At least one of the highest modes must be checked.");
+  const ModalVector modal_u = to_modal_coefficients(dg_u, dg_mesh);
+  double high_mode_sum = 0.0;
+  double total_sum = 0.0;
+  size_t max_extent = 0;
+  for (size_t d = 0; d < Dim; ++d) {
+    max_extent = std::max(max_extent, dg_mesh.extents(d));
+  }
+  for (IndexIterator<Dim> index(dg_mesh.extents()); index; ++index) {
+    const double coef_squared = square(modal_u[index.collapsed_index()]);
+    total_sum += coef_squared;
+    for (size_t d = 0; d < Dim; ++d) {
+      if ((*index)[d] + num_highest_modes >= dg_mesh.extents(d)) {
+        high_mode_sum += coef_squared;
+        break;
+      }
+    }
+  }
+  if (total_sum == 0.0) {
+    return false;
+  }
+  return high_mode_sum / total_sum >
+         pow(static_cast<double>(max_extent - 1), -alpha);
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATION(r, data)                                                \
+  template bool persson_tci(const DataVector& dg_u,                           \
+                            const Mesh<DIM(data)>& dg_mesh, double alpha,     \
+                            size_t num_highest_modes) noexcept;
+
+GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
+
+#undef INSTANTIATION
+#undef DIM
+}  // namespace evolution::dg::subcell
@@ -0,0 +1,40 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+
+/// \cond
+class DataVector;
+template <size_t Dim>
+class Mesh;
+/// \endcond
+
+namespace evolution::dg::subcell {
+/*!
+ * \ingroup DgSubcellGroup
+ * \brief Troubled cell indicator using spectral falloff of
+ * \cite Persson2006sub.
+ *
+ * Consider a discontinuity sensing quantity \f$U\f$, which is typically a
+ * scalar but could be a tensor of any rank. Let \f$U\f$ have the 1d spectral
+ * decomposition (generalization to higher-dimensional tensor product bases is
+ * done dimension-by-dimension):
+ *
+ * \f{align}{
+ *   U(x)=\sum_{i=0}^{N}c_i P_i(x),
+ * \f}
+ *
+ * where \f$P_i(x)\f$ are the basis functions, in our case the Legendre
+ * polynomials, and \f$c_i\f$ are the spectral coefficients. The cell is
+ * troubled if the fraction of \f$\sum_i c_i^2\f$ held by the
+ * `num_highest_modes` highest modes in any dimension exceeds
+ * \f$N^{-\alpha}\f$, where \f$N\f$ is the largest polynomial degree of the
+ * mesh. Persson and Peraire recommend \f$\alpha=4\f$. A vanishing solution is
+ * never troubled.
+ */
+template <size_t Dim>
+bool persson_tci(const DataVector& dg_u, const Mesh<Dim>& dg_mesh,
+                 double alpha, size_t num_highest_modes) noexcept;
+}  // namespace evolution::dg::subcell
@@ -0,0 +1,81 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/DgSubcell/Projection.hpp"
+
+#include <cstddef>
+
+#include "DataStructures/ApplyMatrices.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "ErrorHandling/Assert.hpp"
+#include "Evolution/DgSubcell/Matrices.hpp"
+#include "Evolution/DgSubcell/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace evolution::dg::subcell::fd {
+template <size_t Dim>
+void project(const gsl::not_null<DataVector*> subcell_u, const DataVector& dg_u,
+             const Mesh<Dim>& dg_mesh) noexcept {
+  ASSERT(dg_u.size() == dg_mesh.number_of_grid_points(),
+         "The DG data has " << dg_u.size() << " points but the DG mesh has "
+                            << dg_mesh.number_of_grid_points());
+  const size_t number_of_subcells = mesh(dg_mesh).number_of_grid_points();
+  if (subcell_u->size() != number_of_subcells) {
+    subcell_u->destructive_resize(number_of_subcells);
+  }
+  apply_matrices(subcell_u, projection_matrices(dg_mesh), dg_u,
+                 dg_mesh.extents());
+}
+
+template <size_t Dim>
+DataVector project(const DataVector& dg_u, const Mesh<Dim>& dg_mesh) noexcept {
+  DataVector subcell_u{mesh(dg_mesh).number_of_grid_points()};
+  project(make_not_null(&subcell_u), dg_u, dg_mesh);
+  return subcell_u;
+}
+
+template <size_t Dim>
+void reconstruct(const gsl::not_null<DataVector*> dg_u,
+                 const DataVector& subcell_u,
+                 const Mesh<Dim>& dg_mesh) noexcept {
+  const Mesh<Dim> subcell_mesh = mesh(dg_mesh);
+  ASSERT(subcell_u.size() == subcell_mesh.number_of_grid_points(),
+         "The subcell data has " << subcell_u.size()
+                                 << " points but the subcell mesh has "
+                                 << subcell_mesh.number_of_grid_points());
+  if (dg_u->size() != dg_mesh.number_of_grid_points()) {
+    dg_u->destructive_resize(dg_mesh.number_of_grid_points());
+  }
+  apply_matrices(dg_u, reconstruction_matrices(dg_mesh), subcell_u,
+                 subcell_mesh.extents());
+}
+
+template <size_t Dim>
+DataVector reconstruct(const DataVector& subcell_u,
+                       const Mesh<Dim>& dg_mesh) noexcept {
+  DataVector dg_u{dg_mesh.number_of_grid_points()};
+  reconstruct(make_not_null(&dg_u), subcell_u, dg_mesh);
+  return dg_u;
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATION(r, data)                                                \
+  template void project(gsl::not_null<DataVector*> subcell_u,                 \
+                        const DataVector& dg_u,                               \
+                        const Mesh<DIM(data)>& dg_mesh) noexcept;             \
+  template DataVector project(const DataVector& dg_u,                         \
+                              const Mesh<DIM(data)>& dg_mesh) noexcept;       \
+  template void reconstruct(gsl::not_null<DataVector*> dg_u,                  \
+                            const DataVector& subcell_u,                      \
+                            const Mesh<DIM(data)>& dg_mesh) noexcept;         \
+  template DataVector reconstruct(const DataVector& subcell_u,                 \
+                                  const Mesh<DIM(data)>& dg_mesh) noexcept;
+
+GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
+
+#undef INSTANTIATION
+#undef DIM
+}  // namespace evolution::dg::subcell::fd
@@ -0,0 +1,95 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+
+#include "DataStructures/ApplyMatrices.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Evolution/DgSubcell/Matrices.hpp"
+#include "Evolution/DgSubcell/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+class DataVector;
+/// \endcond
+
+namespace evolution::dg::subcell::fd {
+// @{
+/*!
+ * \ingroup DgSubcellGroup
+ * \brief Project the variables from the DG grid to the cell averages on the
+ * subcell grid `fd::mesh(dg_mesh)`.
+ *
+ * The projection conserves the integral of the variables over the element in
+ * logical coordinates. See `fd::projection_matrix` for details.
+ */
+template <size_t Dim>
+void project(gsl::not_null<DataVector*> subcell_u, const DataVector& dg_u,
+             const Mesh<Dim>& dg_mesh) noexcept;
+
+template <size_t Dim>
+DataVector project(const DataVector& dg_u, const Mesh<Dim>& dg_mesh) noexcept;
+
+template <typename TagList, size_t Dim>
+void project(const gsl::not_null<Variables<TagList>*> subcell_u,
+             const Variables<TagList>& dg_u,
+             const Mesh<Dim>& dg_mesh) noexcept {
+  const size_t number_of_subcells = mesh(dg_mesh).number_of_grid_points();
+  if (subcell_u->number_of_grid_points() != number_of_subcells) {
+    subcell_u->initialize(number_of_subcells);
+  }
+  apply_matrices(subcell_u, projection_matrices(dg_mesh), dg_u,
+                 dg_mesh.extents());
+}
+
+template <typename TagList, size_t Dim>
+Variables<TagList> project(const Variables<TagList>& dg_u,
+                           const Mesh<Dim>& dg_mesh) noexcept {
+  Variables<TagList> subcell_u(mesh(dg_mesh).number_of_grid_points());
+  project(make_not_null(&subcell_u), dg_u, dg_mesh);
+  return subcell_u;
+}
+// @}
+
+// @{
+/*!
+ * \ingroup DgSubcellGroup
+ * \brief Reconstruct the variables on the DG grid from the cell averages on the
+ * subcell grid `fd::mesh(dg_mesh)`.
+ *
+ * The reconstruction conserves the integral of the variables over the element
+ * in logical coordinates, and inverts `fd::project` for variables that are
+ * representable on the DG grid. See `fd::reconstruction_matrix` for details.
+ */
+template <size_t Dim>
+void reconstruct(gsl::not_null<DataVector*> dg_u, const DataVector& subcell_u,
+                 const Mesh<Dim>& dg_mesh) noexcept;
+
+template <size_t Dim>
+DataVector reconstruct(const DataVector& subcell_u,
+                       const Mesh<Dim>& dg_mesh) noexcept;
+
+template <typename TagList, size_t Dim>
+void reconstruct(const gsl::not_null<Variables<TagList>*> dg_u,
+                 const Variables<TagList>& subcell_u,
+                 const Mesh<Dim>& dg_mesh) noexcept {
+  if (dg_u->number_of_grid_points() != dg_mesh.number_of_grid_points()) {
+    dg_u->initialize(dg_mesh.number_of_grid_points());
+  }
+  apply_matrices(dg_u, reconstruction_matrices(dg_mesh), subcell_u,
+                 mesh(dg_mesh).extents());
+}
+
+template <typename TagList, size_t Dim>
+Variables<TagList> reconstruct(const Variables<TagList>& subcell_u,
+                               const Mesh<Dim>& dg_mesh) noexcept {
+  Variables<TagList> dg_u(dg_mesh.number_of_grid_points());
+  reconstruct(make_not_null(&dg_u), subcell_u, dg_mesh);
+  return dg_u;
+}
+// @}
+}  // namespace evolution::dg::subcell::fd
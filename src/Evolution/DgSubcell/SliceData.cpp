@@ -0,0 +1,81 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/DgSubcell/SliceData.hpp"
+
+#include <cstddef>
+#include <unordered_set>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
+#include "DataStructures/IndexIterator.hpp"
+#include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/DirectionMap.hpp"
+#include "Domain/Structure/Side.hpp"
+#include "ErrorHandling/Assert.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+
+namespace evolution::dg::subcell {
+template <size_t Dim>
+DirectionMap<Dim, std::vector<double>> slice_data(
+    const DataVector& volume_subcell_vars, const Index<Dim>& subcell_extents,
+    const size_t number_of_ghost_points,
+    const std::unordered_set<Direction<Dim>>& directions_to_slice) noexcept {
+  const size_t num_subcells = subcell_extents.product();
+  const size_t number_of_components = volume_subcell_vars.size() / num_subcells;
+  ASSERT(volume_subcell_vars.size() == number_of_components * num_subcells,
+         "The size of the subcell variables ("
+             << volume_subcell_vars.size()
+             << ") must be a multiple of the number of subcells ("
+             << num_subcells << ").");
+
+  DirectionMap<Dim, std::vector<double>> sliced_data{};
+  for (const auto& direction : directions_to_slice) {
+    const size_t dim = direction.dimension();
+    ASSERT(number_of_ghost_points <= subcell_extents[dim],
+           "Cannot slice " << number_of_ghost_points
+                           << " ghost points from a grid with only "
+                           << subcell_extents[dim] << " points in direction "
+                           << direction);
+    Index<Dim> ghost_zone_extents = subcell_extents;
+    ghost_zone_extents[dim] = number_of_ghost_points;
+    const size_t offset = direction.side() == Side::Upper
+                              ? subcell_extents[dim] - number_of_ghost_points
+                              : 0;
+    const size_t num_ghost_zone_points = ghost_zone_extents.product();
+
+    std::vector<double>& slice = sliced_data[direction];
+    slice.resize(number_of_components * num_ghost_zone_points);
+    for (IndexIterator<Dim> ghost_index(ghost_zone_extents); ghost_index;
+         ++ghost_index) {
+      Index<Dim> volume_index = *ghost_index;
+      volume_index[dim] += offset;
+      const size_t volume_offset =
+          collapsed_index(volume_index, subcell_extents);
+      for (size_t component = 0; component < number_of_components;
+           ++component) {
+        slice[component * num_ghost_zone_points +
+              ghost_index.collapsed_index()] =
+            volume_subcell_vars[component * num_subcells + volume_offset];
+      }
+    }
+  }
+  return sliced_data;
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATION(r, data)                                  \
+  template DirectionMap<DIM(data), std::vector<double>>         \
+  slice_data(const DataVector& volume_subcell_vars,             \
+             const Index<DIM(data)>& subcell_extents,           \
+             size_t number_of_ghost_points,                     \
+             const std::unordered_set<Direction<DIM(data)>>&    \
+                 directions_to_slice) noexcept;
+
+GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
+
+#undef INSTANTIATION
+#undef DIM
+}  // namespace evolution::dg::subcell
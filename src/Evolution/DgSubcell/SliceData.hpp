@@ -0,0 +1,39 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <unordered_set>
+#include <vector>
+
+#include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/DirectionMap.hpp"
+
+/// \cond
+class DataVector;
+template <size_t Dim>
+class Index;
+/// \endcond
+
+namespace evolution::dg::subcell {
+/*!
+ * \ingroup DgSubcellGroup
+ * \brief Slice the subcell variables that neighbors need as ghost cells for
+ * their reconstruction.
+ *
+ * For each of the `directions_to_slice` the `number_of_ghost_points` cells
+ * closest to the boundary in that direction are copied into a contiguous
+ * buffer, ready to be sent as the ghost cell data of
+ * `evolution::dg::Tags::BoundaryCorrectionAndGhostCellsInbox`. The
+ * `volume_subcell_vars` may hold several independent components, each stored
+ * contiguously over the subcell grid as in a `Variables`. The sliced data has
+ * the same layout, restricted to the ghost zone, and is given in the logical
+ * orientation of the sending element.
+ */
+template <size_t Dim>
+DirectionMap<Dim, std::vector<double>> slice_data(
+    const DataVector& volume_subcell_vars, const Index<Dim>& subcell_extents,
+    size_t number_of_ghost_points,
+    const std::unordered_set<Direction<Dim>>& directions_to_slice) noexcept;
+}  // namespace evolution::dg::subcell
@@ -0,0 +1,29 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Evolution/DgSubcell/ActiveGrid.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+
+/// \ingroup DgSubcellGroup
+/// \brief Tags for the DG-subcell solver
+namespace evolution::dg::subcell::Tags {
+/// \ingroup DgSubcellGroup
+/// The grid currently used for the DG-subcell evolution
+struct ActiveGrid : db::SimpleTag {
+  using type = subcell::ActiveGrid;
+};
+
+/// \ingroup DgSubcellGroup
+/// The mesh on the subcells, see `evolution::dg::subcell::fd::mesh`
+template <size_t VolumeDim>
+struct Mesh : db::SimpleTag {
+  static std::string name() noexcept { return "Subcell(Mesh)"; }
+  using type = ::Mesh<VolumeDim>;
+};
+}  // namespace evolution::dg::subcell::Tags
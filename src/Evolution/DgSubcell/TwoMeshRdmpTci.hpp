@@ -0,0 +1,108 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/Variables.hpp"
+#include "ErrorHandling/Assert.hpp"
+
+namespace evolution::dg::subcell {
+/*!
+ * \ingroup DgSubcellGroup
+ * \brief The maximum and minimum of each independent component of the
+ * variables, taken over both the DG and the subcell grid.
+ *
+ * The components are ordered as they are stored in the `Variables`. The
+ * extrema of an element and its neighbors are combined by the caller to form
+ * the bounds used by `two_mesh_rdmp_tci`.
+ */
+template <typename TagList>
+std::pair<std::vector<double>, std::vector<double>> rdmp_max_min(
+    const Variables<TagList>& dg_u,
+    const Variables<TagList>& subcell_u) noexcept {
+  constexpr size_t number_of_components =
+      Variables<TagList>::number_of_independent_components;
+  std::pair<std::vector<double>, std::vector<double>> max_min{
+      std::vector<double>(number_of_components),
+      std::vector<double>(number_of_components)};
+  const size_t num_dg_points = dg_u.number_of_grid_points();
+  const size_t num_subcells = subcell_u.number_of_grid_points();
+  for (size_t i = 0; i < number_of_components; ++i) {
+    const auto [dg_min, dg_max] =
+        std::minmax_element(dg_u.data() + i * num_dg_points,
+                            dg_u.data() + (i + 1) * num_dg_points);
+    const auto [subcell_min, subcell_max] =
+        std::minmax_element(subcell_u.data() + i * num_subcells,
+                            subcell_u.data() + (i + 1) * num_subcells);
+    max_min.first[i] = std::max(*dg_max, *subcell_max);
+    max_min.second[i] = std::min(*dg_min, *subcell_min);
+  }
+  return max_min;
+}
+
+/*!
+ * \ingroup DgSubcellGroup
+ * \brief Troubled cell indicator using a relaxed discrete maximum principle,
+ * comparing the candidate solution with the past solution in the element and
+ * its neighbors.
+ *
+ * Let the candidate solution be denoted by \f$u^\star_\alpha(t^{n+1})\f$.
+ * Then the candidate solution is invalid if for any independent component
+ *
+ * \f{align}{
+ * \max\left[u^\star_\alpha(t^{n+1})\right] > \max\left[u_\alpha(t^n)\right]
+ * + \delta \quad\text{or}\quad
+ * \min\left[u^\star_\alpha(t^{n+1})\right] < \min\left[u_\alpha(t^n)\right]
+ * - \delta,
+ * \f}
+ *
+ * where
+ *
+ * \f{align}{
+ * \delta = \max\left(\delta_0, \epsilon\left\{\max\left[u_\alpha(t^n)\right]
+ * - \min\left[u_\alpha(t^n)\right]\right\}\right).
+ * \f}
+ *
+ * The extrema of the candidate solution are taken over both the DG grid and
+ * its projection to the subcells (hence "two mesh"), since oscillations of the
+ * DG polynomial can hide between the DG grid points. The past extrema
+ * `past_max_of_vars` and `past_min_of_vars` are those of the element and its
+ * neighbors at the previous time step, e.g. computed with `rdmp_max_min`.
+ * Typical values are \f$\delta_0=10^{-7}\f$ and \f$\epsilon=10^{-3}\f$.
+ */
+template <typename TagList>
+bool two_mesh_rdmp_tci(const Variables<TagList>& candidate_dg_u,
+                       const Variables<TagList>& candidate_subcell_u,
+                       const std::vector<double>& past_max_of_vars,
+                       const std::vector<double>& past_min_of_vars,
+                       const double rdmp_delta0,
+                       const double rdmp_epsilon) noexcept {
+  ASSERT(rdmp_delta0 > 0.0,
+         "The RDMP delta0 must be positive but is " << rdmp_delta0);
+  ASSERT(rdmp_epsilon > 0.0,
+         "The RDMP epsilon must be positive but is " << rdmp_epsilon);
+  ASSERT(past_max_of_vars.size() ==
+                 Variables<TagList>::number_of_independent_components and
+             past_min_of_vars.size() ==
+                 Variables<TagList>::number_of_independent_components,
+         "There must be one past maximum and minimum per independent "
+         "component.");
+  const auto [candidate_max, candidate_min] =
+      rdmp_max_min(candidate_dg_u, candidate_subcell_u);
+  for (size_t i = 0; i < past_max_of_vars.size(); ++i) {
+    const double delta =
+        std::max(rdmp_delta0,
+                 rdmp_epsilon * (past_max_of_vars[i] - past_min_of_vars[i]));
+    if (candidate_max[i] > past_max_of_vars[i] + delta or
+        candidate_min[i] < past_min_of_vars[i] - delta) {
+      return true;
+    }
+  }
+  return false;
+}
+}  // namespace evolution::dg::subcell
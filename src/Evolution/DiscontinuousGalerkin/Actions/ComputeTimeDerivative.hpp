@@ -15,12 +15,14 @@
 #include "DataStructures/Variables.hpp"
 #include "DataStructures/VariablesTag.hpp"
 #include "Domain/InterfaceHelpers.hpp"
+#include "Domain/SeparableInverseJacobian.hpp"
 #include "Domain/Tags.hpp"
 #include "Domain/TagsTimeDependent.hpp"
 #include "Evolution/BoundaryCorrectionTags.hpp"
 #include "Evolution/DiscontinuousGalerkin/MortarData.hpp"
 #include "Evolution/DiscontinuousGalerkin/MortarTags.hpp"
 #include "Evolution/DiscontinuousGalerkin/ProjectToBoundary.hpp"
+#include "Evolution/DiscontinuousGalerkin/TimeDerivativeIntermediates.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Formulation.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/MortarHelpers.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Tags.hpp"
@@ -31,6 +33,8 @@
 #include "NumericalAlgorithms/Spectral/Projection.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "ParallelAlgorithms/DiscontinuousGalerkin/FluxCommunication.hpp"
+#include "Time/Tags.hpp"
+#include "Time/TimeStepId.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TypeTraits/CreateHasTypeAlias.hpp"
@@ -270,12 +274,18 @@ struct get_primitive_vars<true> {
  *   - `Metavariables::system::flux_variables`
  *   - `Metavariables::system::primitive_tags` if exists
  *   - `Metavariables::system::boundary_correction::dg_package_data_volume_tags`
+ *   - `domain::Tags::SeparableInverseJacobian<Dim, Frame::Inertial>` if it is
+ *     in the DataBox, in which case it is used for the volume partial
+ *     derivatives whenever it holds a value
  *
  * DataBox changes:
  * - Adds: nothing
  * - Removes: nothing
  * - Modifies:
  *   - `evolution::dg::Tags::MortarData<Dim>`
+ *   - `evolution::dg::Tags::TimeDerivativeIntermediates<system>` if it is in
+ *     the DataBox, into which the temporaries and partial derivatives of the
+ *     volume terms are moved
  */
 template <typename Metavariables>
 struct ComputeTimeDerivative {
@@ -467,6 +477,22 @@ ComputeTimeDerivative<Metavariables>::apply(
                              tmpl::size_t<volume_dim>, Frame::Inertial>>
       partial_derivs{mesh.number_of_grid_points()};
 
+  // For systems without fluxes that use the current boundary schemes, the
+  // boundary data depends only on the evolved variables and on tags that the
+  // volume terms do not modify. We therefore compute and send the boundary data
+  // before the volume terms so that the communication with the neighbors
+  // overlaps with the volume computation.
+  constexpr bool send_boundary_data_before_volume_terms =
+      std::is_same_v<tmpl::list<>, flux_variables> and
+      not detail::has_boundary_correction_v<system>;
+  if constexpr (send_boundary_data_before_volume_terms) {
+    boundary_terms_nonconservative_products(make_not_null(&box));
+    fill_mortar_data_for_internal_boundaries<
+        volume_dim, typename Metavariables::boundary_scheme>(
+        make_not_null(&box));
+    send_data_for_fluxes<ParallelComponent>(make_not_null(&cache), box);
+  }
+
   volume_terms<volume_dim, compute_volume_time_derivative_terms>(
       make_not_null(&box), make_not_null(&volume_fluxes),
       make_not_null(&partial_derivs), make_not_null(&temporaries),
@@ -477,7 +503,9 @@ ComputeTimeDerivative<Metavariables>::apply(
   // compatibility with the current boundary schemes. Once the current
   // boundary schemes are removed the code will be refactored to reflect that
   // change.
-  if constexpr (not std::is_same_v<tmpl::list<>, flux_variables>) {
+  if constexpr (send_boundary_data_before_volume_terms) {
+    // The boundary data has already been sent.
+  } else if constexpr (not std::is_same_v<tmpl::list<>, flux_variables>) {
     using flux_variables_tag = ::Tags::Variables<flux_variables>;
     using fluxes_tag =
         db::add_tag_prefix<::Tags::Flux, flux_variables_tag,
@@ -519,7 +547,7 @@ ComputeTimeDerivative<Metavariables>::apply(
                 db::get<variables_tag>(box), volume_fluxes, temporaries);
           }
         });
-  } else {
+  } else if constexpr (not send_boundary_data_before_volume_terms) {
     // Compute internal boundary quantities
     fill_mortar_data_for_internal_boundaries<
         volume_dim, typename Metavariables::boundary_scheme>(
@@ -527,6 +555,24 @@ ComputeTimeDerivative<Metavariables>::apply(
 
     send_data_for_fluxes<ParallelComponent>(make_not_null(&cache), box);
   }
+
+  // Keep the buffers of the volume terms for quantities observed at this time
+  // step, if requested.
+  using intermediates_tag = Tags::TimeDerivativeIntermediates<system>;
+  if constexpr (db::tag_is_retrievable_v<intermediates_tag,
+                                         db::DataBox<DbTagsList>>) {
+    db::mutate<intermediates_tag>(
+        make_not_null(&box),
+        [&partial_derivs, &temporaries](
+            const gsl::not_null<typename intermediates_tag::type*>
+                intermediates,
+            const TimeStepId& time_step_id) noexcept {
+          intermediates->time_step_id = time_step_id;
+          intermediates->temporaries = std::move(temporaries);
+          intermediates->partial_derivatives = std::move(partial_derivs);
+        },
+        db::get<::Tags::TimeStepId>(box));
+  }
   return {std::move(box)};
 }
 
@@ -569,11 +615,29 @@ void ComputeTimeDerivative<Metavariables>::volume_terms(
       *box);
   const auto& evolved_vars = db::get<variables_tag>(*box);
 
-  // Compute d_i u_\alpha for nonconservative products
+  // Compute d_i u_\alpha for nonconservative products. If the element is
+  // separable and the mesh is not moving, the derivatives are computed from
+  // the separable inverse Jacobian instead of the full one.
   if constexpr (has_partial_derivs) {
-    partial_derivatives<partial_derivative_tags>(
-        partial_derivs, evolved_vars, mesh,
-        logical_to_inertial_inverse_jacobian);
+    using separable_inverse_jacobian_tag =
+        ::domain::Tags::SeparableInverseJacobian<Dim, Frame::Inertial>;
+    if constexpr (db::tag_is_retrievable_v<separable_inverse_jacobian_tag,
+                                           db::DataBox<DbTagsList>>) {
+      if (const auto& separable_inverse_jacobian =
+              db::get<separable_inverse_jacobian_tag>(*box);
+          separable_inverse_jacobian.has_value()) {
+        partial_derivatives<partial_derivative_tags>(
+            partial_derivs, evolved_vars, mesh, *separable_inverse_jacobian);
+      } else {
+        partial_derivatives<partial_derivative_tags>(
+            partial_derivs, evolved_vars, mesh,
+            logical_to_inertial_inverse_jacobian);
+      }
+    } else {
+      partial_derivatives<partial_derivative_tags>(
+          partial_derivs, evolved_vars, mesh,
+          logical_to_inertial_inverse_jacobian);
+    }
   }
 
   // Compute volume du/dt and fluxes
@@ -3,10 +3,12 @@
 
 #include "Evolution/DiscontinuousGalerkin/Limiters/WenoHelpers.hpp"
 
+#include <algorithm>
 #include <boost/functional/hash.hpp>  // IWYU pragma: keep
 #include <cstddef>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Variables.hpp"    // IWYU pragma: keep
@@ -72,16 +74,29 @@ void reconstruct_from_weighted_sum(
   }
 
   // Update `local_weights` and `neighbor_weights` to hold the unnormalized
-  // nonlinear weights.
-  local_weight = unnormalized_nonlinear_weight(
-      local_weight,
-      oscillation_indicator(derivative_weight, *local_polynomial, mesh));
+  // nonlinear weights. The oscillation indicators of the local and all
+  // neighbor polynomials are computed together.
+  const size_t number_of_grid_points = mesh.number_of_grid_points();
+  DataVector all_polynomials(
+      (1 + neighbor_polynomials.size()) * number_of_grid_points);
+  std::copy(local_polynomial->begin(), local_polynomial->end(),
+            all_polynomials.begin());
+  size_t offset = number_of_grid_points;
+  for (const auto& kv : neighbor_polynomials) {
+    std::copy(kv.second.begin(), kv.second.end(),
+              all_polynomials.begin() + static_cast<std::ptrdiff_t>(offset));
+    offset += number_of_grid_points;
+  }
+  std::vector<double> indicators{};
+  oscillation_indicators(make_not_null(&indicators), derivative_weight,
+                         all_polynomials, mesh);
+  local_weight = unnormalized_nonlinear_weight(local_weight, indicators[0]);
+  size_t neighbor_index = 1;
   for (const auto& kv : neighbor_polynomials) {
     const auto& key = kv.first;
-    const auto& neighbor_polynomial = kv.second;
     neighbor_weights[key] = unnormalized_nonlinear_weight(
-        neighbor_weights[key],
-        oscillation_indicator(derivative_weight, neighbor_polynomial, mesh));
+        neighbor_weights[key], indicators[neighbor_index]);
+    ++neighbor_index;
   }
 
   // Update `local_weights` and `neighbor_weights` to hold the normalized
@@ -6,7 +6,10 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <functional>
+#include <vector>
 
+#include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/IndexIterator.hpp"  // IWYU pragma: keep
 #include "DataStructures/Matrix.hpp"
@@ -78,91 +81,72 @@ double compute_sum_of_legendre_derivs(
   return result;
 }
 
-// Compute the indicator matrix, similar to that of Dumbser2007 Eq. 25, but
-// adapted for use on square/cube grids.
-//
-// The reference computes the indicator on a triangle/tetdrahedral grid, so
-// the basis functions (and their derivatives) do not factor into a tensor
-// product across dimensions. We instead compute the indicator on a square/cube
-// grid, where the basis functions (and their derivatives) do factor. We use
-// this factoring to write the indicator as a product of 1D contributions from
-// each xi/eta/zeta component of the basis function.
-//
-// Note that we compute the product using derivatives 0...N in each dimension.
-// We then subtract off the term with 0 derivatives in all dimensions, because
-// that term is just the original data and should be omitted.
-//
-// Note also that because the mean value of the data does not contribute to its
-// oscillation content, any matrix element associated with basis functions
-// m == 0 or n == 0 vanishes. We thus slightly reduce the necessary storage by
-// computing only the (N-1)^2 matrix where we start at m, n >= 1.
-template <size_t VolumeDim>
-Matrix compute_indicator_matrix(
-    const Limiters::Weno_detail::DerivativeWeight derivative_weight,
-    const Mesh<VolumeDim>& mesh) noexcept {
-  ASSERT(mesh.basis() == make_array<VolumeDim>(Spectral::Basis::Legendre),
-         "No implementation for mesh: " << mesh);
-  Matrix result(mesh.number_of_grid_points() - 1,
-                mesh.number_of_grid_points() - 1);
-
-  const std::array<
-      double, Spectral::maximum_number_of_points<Spectral::Basis::Legendre>>
-      weights_for_derivatives = [&derivative_weight]() noexcept {
-        auto weights = make_array<
-            Spectral::maximum_number_of_points<Spectral::Basis::Legendre>>(1.);
-        if (derivative_weight ==
-            Limiters::Weno_detail::DerivativeWeight::PowTwoEll) {
-          for (size_t l = 0; l < weights.size(); ++l) {
-            gsl::at(weights, l) = pow(2., 2. * l - 1.);
-          }
-        } else if (derivative_weight ==
-                   Limiters::Weno_detail::DerivativeWeight::
-                       PowTwoEllOverEllFactorial) {
-          for (size_t l = 0; l < weights.size(); ++l) {
-            gsl::at(weights, l) = 0.5 * square(pow(2., l) / factorial(l));
-          }
-        }
-        return weights;
-      }();
-
-  for (IndexIterator<VolumeDim> m(mesh.extents()); m; ++m) {
-    if (m.collapsed_index() == 0) {
-      // Skip the terms associated with the cell average of the data
-      continue;
+// The weight w(l) given to the l'th derivative in the indicator
+std::array<double,
+           Spectral::maximum_number_of_points<Spectral::Basis::Legendre>>
+weights_for_derivatives(
+    const Limiters::Weno_detail::DerivativeWeight derivative_weight) noexcept {
+  auto weights = make_array<
+      Spectral::maximum_number_of_points<Spectral::Basis::Legendre>>(1.);
+  if (derivative_weight == Limiters::Weno_detail::DerivativeWeight::PowTwoEll) {
+    for (size_t l = 0; l < weights.size(); ++l) {
+      gsl::at(weights, l) = pow(2., 2. * l - 1.);
     }
-    for (IndexIterator<VolumeDim> n(mesh.extents()); n; ++n) {
-      if (n.collapsed_index() == 0) {
-        // Skip the terms associated with the cell average of the data
-        continue;
-      }
-      // Compute each indicator matrix term by tensor-product of 1D Legendre
-      // polynomial math
-      auto& result_mn =
-          result(m.collapsed_index() - 1, n.collapsed_index() - 1);
-      result_mn = compute_sum_of_legendre_derivs(
-          mesh.extents(0), m()[0], n()[0], weights_for_derivatives);
-      for (size_t dim = 1; dim < VolumeDim; ++dim) {
-        result_mn *= compute_sum_of_legendre_derivs(
-            mesh.extents(dim), m()[dim], n()[dim], weights_for_derivatives);
-      }
+  } else if (derivative_weight == Limiters::Weno_detail::DerivativeWeight::
+                                      PowTwoEllOverEllFactorial) {
+    for (size_t l = 0; l < weights.size(); ++l) {
+      gsl::at(weights, l) = 0.5 * square(pow(2., l) / factorial(l));
     }
-    // Subtract the tensor-product term that has no derivatives
-    double term_with_no_derivs =
-        weights_for_derivatives[0] *
-        Spectral::compute_basis_function_normalization_square<
-            Spectral::Basis::Legendre>(m()[0]);
-    for (size_t dim = 1; dim < VolumeDim; ++dim) {
-      term_with_no_derivs *=
-          weights_for_derivatives[0] *
-          Spectral::compute_basis_function_normalization_square<
-              Spectral::Basis::Legendre>(m()[dim]);
+  }
+  return weights;
+}
+
+// Compute the 1D indicator matrix, whose (m, n) element is the sum of the
+// weighted integrals of all derivatives of the Legendre basis functions P_m and
+// P_n (see compute_sum_of_legendre_derivs).
+//
+// The indicator of Dumbser2007 Eq. 25 is computed on a triangle/tetdrahedral
+// grid, so the basis functions (and their derivatives) do not factor into a
+// tensor product across dimensions. We instead compute the indicator on a
+// square/cube grid, where the basis functions (and their derivatives) do
+// factor. The indicator matrix is then the tensor product of the 1D matrices
+// for each xi/eta/zeta dimension, minus the term with 0 derivatives in all
+// dimensions, because that term is just the original data and should be
+// omitted. We never form the full matrix, but apply the 1D matrices one
+// dimension at a time.
+Matrix compute_indicator_matrix_1d(
+    const Limiters::Weno_detail::DerivativeWeight derivative_weight,
+    const size_t number_of_modes) noexcept {
+  const auto weights = weights_for_derivatives(derivative_weight);
+  Matrix result(number_of_modes, number_of_modes);
+  for (size_t m = 0; m < number_of_modes; ++m) {
+    for (size_t n = 0; n < number_of_modes; ++n) {
+      result(m, n) =
+          compute_sum_of_legendre_derivs(number_of_modes, m, n, weights);
     }
-    result(m.collapsed_index() - 1, m.collapsed_index() - 1) -=
-        term_with_no_derivs;
   }
   return result;
 }
 
+const Matrix& indicator_matrix_1d(
+    const Limiters::Weno_detail::DerivativeWeight derivative_weight,
+    const size_t number_of_modes) noexcept {
+  using Limiters::Weno_detail::DerivativeWeight;
+  constexpr size_t max_number_of_modes =
+      Spectral::maximum_number_of_points<Spectral::Basis::Legendre>;
+  const static auto cache = make_static_cache<
+      CacheEnumeration<DerivativeWeight, DerivativeWeight::Unity,
+                       DerivativeWeight::PowTwoEll,
+                       DerivativeWeight::PowTwoEllOverEllFactorial>,
+      CacheRange<1, max_number_of_modes + 1>>(
+      [](const DerivativeWeight local_derivative_weight,
+         const size_t local_number_of_modes) noexcept {
+        return compute_indicator_matrix_1d(local_derivative_weight,
+                                           local_number_of_modes);
+      });
+  return cache(derivative_weight, number_of_modes);
+}
+
 }  // namespace
 
 namespace Limiters::Weno_detail {
@@ -182,57 +166,85 @@ std::ostream& operator<<(std::ostream& os,
 }
 
 template <size_t VolumeDim>
-double oscillation_indicator(const DerivativeWeight derivative_weight,
-                             const DataVector& data,
-                             const Mesh<VolumeDim>& mesh) noexcept {
+void oscillation_indicators(const gsl::not_null<std::vector<double>*> result,
+                            const DerivativeWeight derivative_weight,
+                            const DataVector& data,
+                            const Mesh<VolumeDim>& mesh) noexcept {
   ASSERT(mesh.basis() == make_array<VolumeDim>(Spectral::Basis::Legendre),
          "No implementation for mesh: " << mesh);
+  const size_t number_of_grid_points = mesh.number_of_grid_points();
+  ASSERT(data.size() % number_of_grid_points == 0,
+         "The data of size " << data.size()
+                             << " does not hold functions on the mesh "
+                             << mesh);
+  const size_t number_of_functions = data.size() / number_of_grid_points;
+
+  // Transform all functions to modal space at once
+  ModalVector coeffs = to_modal_coefficients(data, mesh);
+  // Because the 0'th modal coefficient encodes the mean of the data and does
+  // not contribute to the oscillation, we exclude it from the sum. This also
+  // avoids losing precision when the mean is large compared to the variation.
+  for (size_t k = 0; k < number_of_functions; ++k) {
+    coeffs[k * number_of_grid_points] = 0.;
+  }
 
-  // Optimization: cache the indicator matrix, because it does not depend on the
-  // data. This caching will have to be generalized to handle simulations with
-  // more than one mesh.
-  const auto cache = make_static_cache<CacheEnumeration<
-      DerivativeWeight, DerivativeWeight::Unity, DerivativeWeight::PowTwoEll,
-      DerivativeWeight::PowTwoEllOverEllFactorial>>(
-      [&mesh](const DerivativeWeight dw) noexcept -> Matrix {
-        return compute_indicator_matrix(dw, mesh);
-      });
-  const Matrix indicator_matrix = cache(derivative_weight);
-
-  // Check there is only one mesh, i.e., that we satisfy the cache assumptions.
-  static const Mesh<VolumeDim> mesh_for_cached_matrix = mesh;
-  ASSERT(
-      mesh_for_cached_matrix == mesh,
-      "This call to oscillation_indicator received as argument a different\n"
-      "Mesh than was previously cached, suggesting that multiple meshes are\n"
-      "used in the computational domain. This is not (yet) supported.\n"
-      "Cached mesh: "
-          << mesh_for_cached_matrix
-          << "\n"
-             "Argument mesh: "
-          << mesh);
-
-  const ModalVector coeffs = to_modal_coefficients(data, mesh);
+  // Apply the tensor product of the 1D indicator matrices to all functions
+  auto matrices = make_array<VolumeDim>(
+      std::cref(indicator_matrix_1d(derivative_weight, mesh.extents(0))));
+  for (size_t d = 1; d < VolumeDim; ++d) {
+    gsl::at(matrices, d) =
+        std::cref(indicator_matrix_1d(derivative_weight, mesh.extents(d)));
+  }
+  const ModalVector weighted_coeffs =
+      apply_matrices(matrices, coeffs, mesh.extents());
+
+  // The diagonal tensor-product term that has no derivatives, which we
+  // subtract
+  const double weight_for_no_derivs =
+      weights_for_derivatives(derivative_weight)[0];
+  std::vector<double> term_with_no_derivs(number_of_grid_points, 1.);
+  for (IndexIterator<VolumeDim> m(mesh.extents()); m; ++m) {
+    for (size_t dim = 0; dim < VolumeDim; ++dim) {
+      term_with_no_derivs[m.collapsed_index()] *=
+          weight_for_no_derivs *
+          Spectral::compute_basis_function_normalization_square<
+              Spectral::Basis::Legendre>(m()[dim]);
+    }
+  }
 
-  double result = 0.;
-  // Note: because the 0'th modal coefficient encodes the mean of the data and
-  // does not contribute to the oscillation, it is safe to exclude it from the
-  // sum and start summing at m == 1, n == 1. Note also that the indicator
-  // matrix is computed excluding the m == 0, n == 0 elements, so the indexing
-  // is offset by 1.
-  for (size_t m = 1; m < mesh.number_of_grid_points(); ++m) {
-    for (size_t n = 1; n < mesh.number_of_grid_points(); ++n) {
-      result += coeffs[m] * coeffs[n] * indicator_matrix(m - 1, n - 1);
+  result->assign(number_of_functions, 0.);
+  for (size_t k = 0; k < number_of_functions; ++k) {
+    const size_t offset = k * number_of_grid_points;
+    for (size_t m = 1; m < number_of_grid_points; ++m) {
+      (*result)[k] += coeffs[offset + m] *
+                      (weighted_coeffs[offset + m] -
+                       term_with_no_derivs[m] * coeffs[offset + m]);
     }
   }
-  return result;
+}
+
+template <size_t VolumeDim>
+double oscillation_indicator(const DerivativeWeight derivative_weight,
+                             const DataVector& data,
+                             const Mesh<VolumeDim>& mesh) noexcept {
+  ASSERT(data.size() == mesh.number_of_grid_points(),
+         "The data of size " << data.size()
+                             << " does not hold one function on the mesh "
+                             << mesh);
+  std::vector<double> result{};
+  oscillation_indicators(make_not_null(&result), derivative_weight, data,
+                         mesh);
+  return result[0];
 }
 
 // Explicit instantiations
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 
-#define INSTANTIATE(_, data)                        \
-  template double oscillation_indicator<DIM(data)>( \
+#define INSTANTIATE(_, data)                                                 \
+  template void oscillation_indicators<DIM(data)>(                           \
+      gsl::not_null<std::vector<double>*>, DerivativeWeight,                 \
+      const DataVector&, const Mesh<DIM(data)>&) noexcept;                   \
+  template double oscillation_indicator<DIM(data)>(                          \
       DerivativeWeight, const DataVector&, const Mesh<DIM(data)>&) noexcept;
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
@@ -5,6 +5,9 @@
 
 #include <cstddef>
 #include <ostream>
+#include <vector>
+
+#include "Utilities/Gsl.hpp"
 
 /// \cond
 class DataVector;
@@ -43,4 +46,17 @@ double oscillation_indicator(DerivativeWeight derivative_weight,
                              const DataVector& data,
                              const Mesh<VolumeDim>& mesh) noexcept;
 
+// Compute the WENO oscillation indicators of several functions at once
+//
+// The `data` holds the values of the functions on the `mesh` one after
+// another, and `result` is resized to hold one indicator per function. The
+// functions are transformed to modal space and the indicators are evaluated
+// together, which is considerably cheaper than computing them one by one. The
+// indicator matrices are cached for each mesh extent, so any mesh may be used.
+template <size_t VolumeDim>
+void oscillation_indicators(gsl::not_null<std::vector<double>*> result,
+                            DerivativeWeight derivative_weight,
+                            const DataVector& data,
+                            const Mesh<VolumeDim>& mesh) noexcept;
+
 }  // namespace Limiters::Weno_detail
@@ -0,0 +1,64 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <pup.h>
+
+#include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/Variables.hpp"
+#include "NumericalAlgorithms/LinearOperators/PartialDerivatives.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+namespace Frame {
+struct Inertial;
+}  // namespace Frame
+/// \endcond
+
+namespace evolution::dg {
+/*!
+ * \brief The buffers of the volume time derivative at the time step
+ * `time_step_id`
+ *
+ * \details `temporaries` holds the `temporary_tags` of the system's
+ * `compute_volume_time_derivative_terms`, and `partial_derivatives` the partial
+ * derivatives of its `gradient_variables`.
+ */
+template <typename TemporaryTagsList, typename PartialDerivTagsList>
+struct TimeDerivativeIntermediates {
+  TimeStepId time_step_id{};
+  Variables<TemporaryTagsList> temporaries{};
+  Variables<PartialDerivTagsList> partial_derivatives{};
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) noexcept {
+    p | time_step_id;
+    p | temporaries;
+    p | partial_derivatives;
+  }
+};
+
+namespace Tags {
+/*!
+ * \brief The buffers of the last volume time derivative computed by
+ * `evolution::dg::Actions::ComputeTimeDerivative`
+ *
+ * \details If this tag is in the DataBox, `ComputeTimeDerivative` moves the
+ * temporaries and partial derivatives of the volume time derivative into it
+ * instead of discarding them, so that quantities observed at the same time
+ * step can be computed from them (see
+ * `Actions::RunEventsAndTriggersAfterDuDt`). Keeping the buffers costs memory,
+ * but no additional computation.
+ */
+template <typename System>
+struct TimeDerivativeIntermediates : db::SimpleTag {
+  using type = evolution::dg::TimeDerivativeIntermediates<
+      typename System::compute_volume_time_derivative_terms::temporary_tags,
+      db::wrap_tags_in<::Tags::deriv, typename System::gradient_variables,
+                       tmpl::size_t<System::volume_dim>, Frame::Inertial>>;
+};
+}  // namespace Tags
+}  // namespace evolution::dg
@@ -32,6 +32,7 @@
 #include "Evolution/Systems/GeneralizedHarmonic/Equations.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/InitializeDampedHarmonic.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/Initialize.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/ObserveConstraintNorms.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/System.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/Tags.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/TimeDerivative.hpp"
@@ -85,6 +86,7 @@
 #include "ParallelAlgorithms/Events/ObserveFields.hpp"
 #include "ParallelAlgorithms/Events/ObserveTimeStep.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/Actions/RunEventsAndTriggers.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Actions/RunEventsAndTriggersAfterDuDt.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/EventsAndTriggers.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/Tags.hpp"
@@ -224,6 +226,9 @@ struct EvolutionMetavars {
         intrp::callbacks::FindApparentHorizon<AhA, ::Frame::Inertial>;
     using post_horizon_find_callback =
         intrp::callbacks::ObserveTimeSeriesOnSurface<tags_to_observe, AhA, AhA>;
+    // Locate the horizon points and assemble the interpolated variables
+    // using the PEs of the node.
+    static constexpr size_t number_of_parallel_chunks = 8;
   };
   using interpolation_target_tags = tmpl::list<AhA>;
   using interpolator_source_vars =
@@ -245,24 +250,34 @@ struct EvolutionMetavars {
       observation_events,
       intrp::Events::Registrars::Interpolate<3, AhA, interpolator_source_vars>>;
 
+  // Events that use the intermediates of the time derivative
+  using events_after_dudt = tmpl::list<
+      GeneralizedHarmonic::Events::Registrars::ObserveConstraintNorms<
+          volume_dim, Tags::Time>>;
+
   // A tmpl::list of tags to be added to the GlobalCache by the
   // metavariables
   using const_global_cache_tags = tmpl::list<
       analytic_solution_tag, normal_dot_numerical_flux, time_stepper_tag,
       Tags::EventsAndTriggers<events, triggers>,
+      Tags::EventsAndTriggersAfterDuDt<events_after_dudt, triggers>,
       GeneralizedHarmonic::ConstraintDamping::Tags::DampingFunctionGamma0<
           volume_dim, frame>,
       GeneralizedHarmonic::ConstraintDamping::Tags::DampingFunctionGamma1<
           volume_dim, frame>,
       GeneralizedHarmonic::ConstraintDamping::Tags::DampingFunctionGamma2<
-          volume_dim, frame>>;
+          volume_dim, frame>,
+      GeneralizedHarmonic::Tags::TimeDerivativeBlockSize>;
 
   using observed_reduction_data_tags = observers::collect_reduction_data_tags<
-      tmpl::push_back<typename Event<observation_events>::creatable_classes,
-                      typename AhA::post_horizon_find_callback>>;
+      tmpl::push_back<
+          tmpl::append<typename Event<observation_events>::creatable_classes,
+                       typename Event<events_after_dudt>::creatable_classes>,
+          typename AhA::post_horizon_find_callback>>;
 
   using step_actions = tmpl::list<
       evolution::dg::Actions::ComputeTimeDerivative<EvolutionMetavars>,
+      Actions::RunEventsAndTriggersAfterDuDt,
       dg::Actions::ComputeNonconservativeBoundaryFluxes<
           domain::Tags::BoundaryDirectionsInterior<volume_dim>>,
       dg::Actions::ImposeDirichletBoundaryConditions<EvolutionMetavars>,
@@ -439,6 +454,8 @@ static const std::vector<void (*)()> charm_init_node_funcs{
     &GeneralizedHarmonic::ConstraintDamping::register_derived_with_charm,
     &Parallel::register_derived_classes_with_charm<
         Event<metavariables::events>>,
+    &Parallel::register_derived_classes_with_charm<
+        Event<metavariables::events_after_dudt>>,
     &Parallel::register_derived_classes_with_charm<
         StepChooser<metavariables::slab_choosers>>,
     &Parallel::register_derived_classes_with_charm<
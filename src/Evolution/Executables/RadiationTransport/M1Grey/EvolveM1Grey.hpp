@@ -195,8 +195,7 @@ struct EvolutionMetavars {
                                      Actions::RecordTimeStepperData<>>>,
       Actions::UpdateU<>, Limiters::Actions::SendData<EvolutionMetavars>,
       Limiters::Actions::Limit<EvolutionMetavars>,
-      Actions::MutateApply<typename RadiationTransport::M1Grey::
-                               ComputeM1Closure<neutrino_species>>,
+      Actions::MutateApply<typename system::m1_closure>,
       Actions::MutateApply<typename RadiationTransport::M1Grey::
                                ComputeM1HydroCoupling<neutrino_species>>>>;
 
@@ -218,8 +217,7 @@ struct EvolutionMetavars {
           domain::Tags::Coordinates<volume_dim, Frame::Logical>>,
       Initialization::Actions::TimeStepperHistory<EvolutionMetavars>,
       RadiationTransport::M1Grey::Actions::InitializeM1Tags<system>,
-      Actions::MutateApply<typename RadiationTransport::M1Grey::
-                               ComputeM1Closure<neutrino_species>>,
+      Actions::MutateApply<typename system::m1_closure>,
       Actions::MutateApply<typename RadiationTransport::M1Grey::
                                ComputeM1HydroCoupling<neutrino_species>>,
       dg::Actions::InitializeInterfaces<
@@ -54,6 +54,7 @@
 #include "ParallelAlgorithms/Events/ObserveFields.hpp"      // IWYU pragma: keep
 #include "ParallelAlgorithms/Events/ObserveTimeStep.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/Actions/RunEventsAndTriggers.hpp"  // IWYU pragma: keep
+#include "ParallelAlgorithms/EventsAndTriggers/Actions/RunEventsAtDenseTimes.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/EventsAndTriggers.hpp"  // IWYU pragma: keep
 #include "ParallelAlgorithms/EventsAndTriggers/Tags.hpp"
@@ -158,14 +159,23 @@ struct EvolutionMetavars {
                  Events::Registrars::ChangeSlabSize<slab_choosers>>;
   using triggers = Triggers::time_triggers;
 
+  // Events that observe at times inside of time steps
+  using dense_events =
+      tmpl::list<dg::Events::Registrars::ObserveFields<
+                     Dim, Tags::Time, observe_fields, analytic_solution_fields>,
+                 dg::Events::Registrars::ObserveErrorNorms<
+                     Tags::Time, analytic_solution_fields>>;
+
   // A tmpl::list of tags to be added to the GlobalCache by the
   // metavariables
   using const_global_cache_tags =
       tmpl::list<initial_data_tag, normal_dot_numerical_flux, time_stepper_tag,
-                 Tags::EventsAndTriggers<events, triggers>>;
+                 Tags::EventsAndTriggers<events, triggers>,
+                 Tags::EventsAtDenseTimes<dense_events>>;
 
   using observed_reduction_data_tags = observers::collect_reduction_data_tags<
-      typename Event<events>::creatable_classes>;
+      tmpl::append<typename Event<events>::creatable_classes,
+                   typename Event<dense_events>::creatable_classes>>;
 
   // The scalar wave system generally does not require filtering, except
   // possibly on certain deformed domains.  Here a filter is added in 2D for
@@ -184,9 +194,11 @@ struct EvolutionMetavars {
       dg::Actions::ReceiveDataForFluxes<boundary_scheme>,
       tmpl::conditional_t<local_time_stepping,
                           tmpl::list<Actions::RecordTimeStepperData<>,
+                                     Actions::RunEventsAtDenseTimes<>,
                                      Actions::MutateApply<boundary_scheme>>,
                           tmpl::list<Actions::MutateApply<boundary_scheme>,
-                                     Actions::RecordTimeStepperData<>>>,
+                                     Actions::RecordTimeStepperData<>,
+                                     Actions::RunEventsAtDenseTimes<>>>,
       Actions::UpdateU<>,
       tmpl::conditional_t<
           use_filtering,
@@ -294,6 +306,8 @@ static const std::vector<void (*)()> charm_init_node_funcs{
     &domain::FunctionsOfTime::register_derived_with_charm,
     &Parallel::register_derived_classes_with_charm<
         Event<metavariables::events>>,
+    &Parallel::register_derived_classes_with_charm<
+        Event<metavariables::dense_events>>,
     &Parallel::register_derived_classes_with_charm<
         MathFunction<1, Frame::Inertial>>,
     &Parallel::register_derived_classes_with_charm<
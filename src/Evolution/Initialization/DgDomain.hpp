@@ -19,6 +19,7 @@
 #include "Domain/ElementMap.hpp"
 #include "Domain/LogicalCoordinates.hpp"
 #include "Domain/MinimumGridSpacing.hpp"
+#include "Domain/SeparableInverseJacobian.hpp"
 #include "Domain/Structure/CreateInitialMesh.hpp"
 #include "Domain/Structure/Element.hpp"
 #include "Domain/Structure/ElementId.hpp"
@@ -69,6 +70,8 @@ namespace Initialization {
  *   - `domain::Tags::InverseJacobian<Dim, Frame::Logical, Frame::Grid>`
  *   - `domain::Tags::InverseJacobian<Dim, Frame::Logical, Frame::Inertial>`
  *   - `domain::Tags::DetInvJacobian<Frame::Logical, Frame::Inertial>`
+ *   - `domain::Tags::SeparableInverseJacobian<Dim, Frame::Grid>`
+ *   - `domain::Tags::SeparableInverseJacobian<Dim, Frame::Inertial>`
  *   - `domain::Tags::MeshVelocity<Dim, Frame::Inertial>`
  *   - `domain::Tags::DivMeshVelocity`
  *   - `domain::Tags::MinimumGridSpacingCompute<Dim, Frame::Inertial>>`
@@ -115,6 +118,9 @@ struct Domain {
       ::domain::Tags::ElementToInertialInverseJacobian<Dim>,
       ::domain::Tags::DetInvJacobianCompute<Dim, Frame::Logical,
                                             Frame::Inertial>,
+      ::domain::Tags::SeparableInverseJacobianCompute<
+          ::domain::Tags::ElementMap<Dim, Frame::Grid>>,
+      ::domain::Tags::ElementToInertialSeparableInverseJacobian<Dim>,
       ::domain::Tags::InertialMeshVelocityCompute<Dim>,
       evolution::domain::Tags::DivMeshVelocityCompute<Dim>,
       // Compute tags for other mesh quantities
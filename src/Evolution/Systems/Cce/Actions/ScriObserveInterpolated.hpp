@@ -71,6 +71,10 @@ void correct_weyl_scalars_for_inertial_time(
  * formulas, we need to adjust the signs and factors of two to be compatible
  * with our definitions of \f$\eth\f$ and choice of Newman-Penrose tetrad.
  *
+ * If `Tags::NumberOfAngularChunks` is available, the interpolation of each
+ * quantity is split into that many chunks of angular points that are shared
+ * among the PEs of the node.
+ *
  * \f{align*}{
  * \Psi_0^{\prime (5)}
  * =&  \Psi_0^{(5)} + 2 \eth u^\prime \Psi_1^{(4)}
@@ -111,6 +115,11 @@ struct ScriObserveInterpolated {
       const ParallelComponent* const /*meta*/) noexcept {
     const size_t observation_l_max = db::get<Tags::ObservationLMax>(box);
     const size_t l_max = db::get<Tags::LMax>(box);
+    size_t number_of_angular_chunks = 1;
+    if constexpr (db::tag_is_retrievable_v<Tags::NumberOfAngularChunks,
+                                           db::DataBox<DbTags>>) {
+      number_of_angular_chunks = db::get<Tags::NumberOfAngularChunks>(box);
+    }
     std::vector<double> data_to_write(2 * square(observation_l_max + 1) + 1);
     ComplexModalVector goldberg_modes{square(l_max + 1)};
     std::vector<std::string> file_legend;
@@ -139,23 +148,25 @@ struct ScriObserveInterpolated {
             .first_time_is_ready_to_interpolate()) {
       // first get the weyl scalars and correct them
       double interpolation_time = 0.0;
-      tmpl::for_each<detail::weyl_correction_list>([&interpolation_time,
-                                                    &corrected_scri_plus_weyl,
-                                                    &box](auto tag_v) noexcept {
-        using tag = typename decltype(tag_v)::type;
-        std::pair<double, ComplexDataVector> interpolation;
-        db::mutate<Tags::InterpolationManager<ComplexDataVector, tag>>(
-            make_not_null(&box),
-            [&interpolation](
-                const gsl::not_null<
-                    ScriPlusInterpolationManager<ComplexDataVector, tag>*>
-                    interpolation_manager) {
-              interpolation =
-                  interpolation_manager->interpolate_and_pop_first_time();
-            });
-        interpolation_time = interpolation.first;
-        get(get<tag>(corrected_scri_plus_weyl)).data() = interpolation.second;
-      });
+      tmpl::for_each<detail::weyl_correction_list>(
+          [&interpolation_time, &corrected_scri_plus_weyl, &box,
+           &number_of_angular_chunks](auto tag_v) noexcept {
+            using tag = typename decltype(tag_v)::type;
+            std::pair<double, ComplexDataVector> interpolation;
+            db::mutate<Tags::InterpolationManager<ComplexDataVector, tag>>(
+                make_not_null(&box),
+                [&interpolation, &number_of_angular_chunks](
+                    const gsl::not_null<
+                        ScriPlusInterpolationManager<ComplexDataVector, tag>*>
+                        interpolation_manager) {
+                  interpolation =
+                      interpolation_manager->interpolate_and_pop_first_time(
+                          number_of_angular_chunks);
+                });
+            interpolation_time = interpolation.first;
+            get(get<tag>(corrected_scri_plus_weyl)).data() =
+                interpolation.second;
+          });
 
       detail::correct_weyl_scalars_for_inertial_time(
           make_not_null(&corrected_scri_plus_weyl));
@@ -183,17 +194,19 @@ struct ScriObserveInterpolated {
           tmpl::list_difference<typename Metavariables::scri_values_to_observe,
                                 detail::weyl_correction_list>>(
           [&box, &data_to_write, &file_legend, &observation_l_max, &l_max,
-           &cache, &goldberg_modes](auto tag_v) noexcept {
+           &cache, &goldberg_modes,
+           &number_of_angular_chunks](auto tag_v) noexcept {
             using tag = typename decltype(tag_v)::type;
             std::pair<double, ComplexDataVector> interpolation;
             db::mutate<Tags::InterpolationManager<ComplexDataVector, tag>>(
                 make_not_null(&box),
-                [&interpolation](
+                [&interpolation, &number_of_angular_chunks](
                     const gsl::not_null<
                         ScriPlusInterpolationManager<ComplexDataVector, tag>*>
                         interpolation_manager) {
                   interpolation =
-                      interpolation_manager->interpolate_and_pop_first_time();
+                      interpolation_manager->interpolate_and_pop_first_time(
+                          number_of_angular_chunks);
                 });
             ScriObserveInterpolated::transform_and_write<tag,
                                                          tag::type::type::spin>(
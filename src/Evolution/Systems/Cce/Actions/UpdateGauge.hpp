@@ -32,6 +32,10 @@ namespace Actions {
  * `GaugeUpdateJacobianFromCoordinates`, `GaugeUpdateInterpolator`, and
  * `GaugeUpdateOmega` to perform the computations. Refer to the documentation
  * for those mutators for mathematical details.
+ *
+ * If `Tags::NumberOfAngularChunks` is available, the interpolator used by the
+ * gauge transforms of the boundary data shares its target points among the
+ * PEs of the node in that many chunks.
  */
 struct UpdateGauge {
   using const_global_cache_tags = tmpl::list<Tags::LMax>;
@@ -51,8 +55,18 @@ struct UpdateGauge {
     db::mutate_apply<GaugeUpdateJacobianFromCoordinates<
         Tags::GaugeC, Tags::GaugeD, Tags::CauchyAngularCoords,
         Tags::CauchyCartesianCoords>>(make_not_null(&box));
-    db::mutate_apply<GaugeUpdateInterpolator<Tags::CauchyAngularCoords>>(
-        make_not_null(&box));
+    if constexpr (db::tag_is_retrievable_v<Tags::NumberOfAngularChunks,
+                                           db::DataBox<DbTags>>) {
+      db::mutate<
+          Spectral::Swsh::Tags::SwshInterpolator<Tags::CauchyAngularCoords>>(
+          make_not_null(&box),
+          GaugeUpdateInterpolator<Tags::CauchyAngularCoords>::apply,
+          db::get<Tags::CauchyAngularCoords>(box), db::get<Tags::LMax>(box),
+          db::get<Tags::NumberOfAngularChunks>(box));
+    } else {
+      db::mutate_apply<GaugeUpdateInterpolator<Tags::CauchyAngularCoords>>(
+          make_not_null(&box));
+    }
     db::mutate_apply<GaugeUpdateOmega>(make_not_null(&box));
     return {std::move(box)};
   }
@@ -87,11 +87,22 @@ namespace Cce {
  *  - `cce_hypersurface_initialization`: a mutator (for use with
  * `::Actions::MutateApply`) that is used to compute the initial hypersurface
  * data from the boundary data.
+ *
+ * Although the component is a singleton, the work that is independent for each
+ * angular collocation point is split into `Tags::NumberOfAngularChunks` chunks
+ * that `Parallel::parallel_for` shares among the PEs of the node in an SMP
+ * build. This covers the radial linear solve for `Tags::BondiH`, the
+ * interpolation onto the evolution gauge points in the gauge transforms of the
+ * boundary data, and the time interpolation of the scri+ quantities. For a
+ * standalone CCE run this should typically be a small multiple of the number
+ * of PEs per node. The spin-weighted transforms themselves still run on the PE
+ * of the component.
  */
 template <class Metavariables>
 struct CharacteristicEvolution {
   using chare_type = Parallel::Algorithms::Singleton;
   using metavariables = Metavariables;
+  using const_global_cache_tags = tmpl::list<Tags::NumberOfAngularChunks>;
 
   using initialize_action_list = tmpl::list<
       ::Actions::SetupDataBox,
@@ -696,6 +696,11 @@ struct GaugeUpdateJacobianFromCoordinates {
  * collocation points, the interpolator input should be the Cauchy coordinates
  * points as a function of the evolution gauge coordinates (at the evolution
  * gauge collocation points).
+ *
+ * The interpolator splits its target points into `number_of_angular_chunks`
+ * chunks that are shared among the PEs of the node (see
+ * `Spectral::Swsh::SwshInterpolator`). `Actions::UpdateGauge` passes
+ * `Tags::NumberOfAngularChunks` when it is available.
  */
 template <typename AngularCoordinates>
 struct GaugeUpdateInterpolator {
@@ -707,11 +712,12 @@ struct GaugeUpdateInterpolator {
       const gsl::not_null<Spectral::Swsh::SwshInterpolator*> interpolator,
       const tnsr::i<DataVector, 2, ::Frame::Spherical<::Frame::Inertial>>&
           angular_coordinates,
-      const size_t l_max) noexcept {
+      const size_t l_max, const size_t number_of_angular_chunks = 1) noexcept {
     // throw away the old interpolator and generate a new one for the current
     // grid points.
     *interpolator = Spectral::Swsh::SwshInterpolator(
-        get<0>(angular_coordinates), get<1>(angular_coordinates), l_max);
+        get<0>(angular_coordinates), get<1>(angular_coordinates), l_max,
+        number_of_angular_chunks);
   }
 };
 
@@ -14,6 +14,7 @@
 #include "NumericalAlgorithms/LinearSolver/Lapack.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "NumericalAlgorithms/Spectral/SwshCoefficients.hpp"
+#include "Parallel/ParallelFor.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/StaticCache.hpp"
 #include "Utilities/VectorAlgebra.hpp"
@@ -215,13 +216,11 @@ void RadialIntegrateBondi<BoundaryPrefix, Tags::BondiH>::apply(
         linear_factor_of_conjugate,
     const Scalar<SpinWeighted<ComplexDataVector, 2>>& boundary,
     const Scalar<SpinWeighted<ComplexDataVector, 0>>& one_minus_y,
-    const size_t l_max, const size_t number_of_radial_points) noexcept {
+    const size_t l_max, const size_t number_of_radial_points,
+    const size_t number_of_angular_chunks) noexcept {
   const size_t number_of_angular_points =
       Spectral::Swsh::number_of_swsh_collocation_points(l_max);
 
-  Matrix operator_matrix(2 * number_of_radial_points,
-                         2 * number_of_radial_points);
-
   ComplexDataVector integrand =
       get(pole_of_integrand).data() +
       get(one_minus_y).data() * get(regular_integrand).data();
@@ -243,76 +242,87 @@ void RadialIntegrateBondi<BoundaryPrefix, Tags::BondiH>::apply(
       Spectral::differentiation_matrix<Spectral::Basis::Legendre,
                                        Spectral::Quadrature::GaussLobatto>(
           number_of_radial_points);
-  for (size_t offset = 0; offset < number_of_angular_points; ++offset) {
-    // on repeated evaluations, the matrix gets permuted by the dgesv routine.
-    // We'll ignore its pivots and just overwrite the whole thing on each
-    // pass. There are probably optimizations that can be made which make use
-    // of the pivots.
+  // each angular collocation point is an independent linear solve, so the
+  // points are distributed among the PEs of the node in chunks, each with its
+  // own operator matrix.
+  const auto solve_angular_points = [&](const size_t begin_offset,
+                                        const size_t end_offset) noexcept {
+    Matrix operator_matrix(2 * number_of_radial_points,
+                           2 * number_of_radial_points);
+    for (size_t offset = begin_offset; offset < end_offset; ++offset) {
+      // on repeated evaluations, the matrix gets permuted by the dgesv routine.
+      // We'll ignore its pivots and just overwrite the whole thing on each
+      // pass. There are probably optimizations that can be made which make use
+      // of the pivots.
+
+      // first we apply the (1 - y) \partial_y part of the matrix
+      // to the upper right (real-real) and lower left (imag-imag) part of the
+      // matrix
+      for (size_t matrix_block = 0; matrix_block < 2; ++matrix_block) {
+        for (size_t i = 0; i < number_of_radial_points; ++i) {
+          for (size_t j = 0; j < number_of_radial_points; ++j) {
+            operator_matrix(i + matrix_block * number_of_radial_points,
+                            j + matrix_block * number_of_radial_points) =
+                derivative_matrix(i, j) *
+                real(get(one_minus_y).data()[i * number_of_angular_points]);
+          }
+        }
+      }
 
-    // first we apply the (1 - y) \partial_y part of the matrix
-    // to the upper right (real-real) and lower left (imag-imag) part of the
-    // matrix
-    for (size_t matrix_block = 0; matrix_block < 2; ++matrix_block) {
+      // zero out the lower left and upper right part of the matrix
       for (size_t i = 0; i < number_of_radial_points; ++i) {
         for (size_t j = 0; j < number_of_radial_points; ++j) {
-          operator_matrix(i + matrix_block * number_of_radial_points,
-                          j + matrix_block * number_of_radial_points) =
-              derivative_matrix(i, j) *
-              real(get(one_minus_y).data()[i * number_of_angular_points]);
+          operator_matrix(i + number_of_radial_points, j) = 0.0;
+          operator_matrix(i, j + number_of_radial_points) = 0.0;
         }
       }
-    }
 
-    // zero out the lower left and upper right part of the matrix
-    for (size_t i = 0; i < number_of_radial_points; ++i) {
-      for (size_t j = 0; j < number_of_radial_points; ++j) {
-        operator_matrix(i + number_of_radial_points, j) = 0.0;
-        operator_matrix(i, j + number_of_radial_points) = 0.0;
+      // gather the contributions to the matrix blocks from the linear factors
+      // each, we zero the first row
+      for (size_t i = 0; i < number_of_radial_points; ++i) {
+        const size_t linear_factor_index =
+            offset + i * number_of_angular_points;
+        // upper left
+        operator_matrix(i, i) +=
+            real(get(linear_factor).data()[linear_factor_index] +
+                 get(linear_factor_of_conjugate).data()[linear_factor_index]);
+        operator_matrix(0, i) = 0.0;
+        // upper right
+        operator_matrix(i, number_of_radial_points + i) -=
+            imag(get(linear_factor).data()[linear_factor_index] -
+                 get(linear_factor_of_conjugate).data()[linear_factor_index]);
+        operator_matrix(0, number_of_radial_points + i) = 0.0;
+        // lower left
+        operator_matrix(number_of_radial_points + i, i) +=
+            imag(get(linear_factor).data()[linear_factor_index] +
+                 get(linear_factor_of_conjugate).data()[linear_factor_index]);
+        operator_matrix(number_of_radial_points, i) = 0.0;
+        // lower right
+        operator_matrix(number_of_radial_points + i,
+                        number_of_radial_points + i) +=
+            real(get(linear_factor).data()[linear_factor_index] -
+                 get(linear_factor_of_conjugate).data()[linear_factor_index]);
+        operator_matrix(number_of_radial_points, number_of_radial_points + i) =
+            0.0;
       }
+      operator_matrix(0, 0) = 1.0;
+      operator_matrix(number_of_radial_points, number_of_radial_points) = 1.0;
+      // put the data currently in integrand into a real DataVector of twice the
+      // length
+      linear_solve_buffer[offset * 2 * number_of_radial_points] =
+          real(get(boundary).data()[offset]);
+      linear_solve_buffer[(offset * 2 + 1) * number_of_radial_points] =
+          imag(get(boundary).data()[offset]);
+      DataVector linear_solve_buffer_view{
+          linear_solve_buffer.data() + offset * 2 * number_of_radial_points,
+          2 * number_of_radial_points};
+      lapack::general_matrix_linear_solve(
+          make_not_null(&linear_solve_buffer_view),
+          make_not_null(&operator_matrix));
     }
-
-    // gather the contributions to the matrix blocks from the linear factors
-    // each, we zero the first row
-    for (size_t i = 0; i < number_of_radial_points; ++i) {
-      const size_t linear_factor_index = offset + i * number_of_angular_points;
-      // upper left
-      operator_matrix(i, i) +=
-          real(get(linear_factor).data()[linear_factor_index] +
-               get(linear_factor_of_conjugate).data()[linear_factor_index]);
-      operator_matrix(0, i) = 0.0;
-      // upper right
-      operator_matrix(i, number_of_radial_points + i) -=
-          imag(get(linear_factor).data()[linear_factor_index] -
-               get(linear_factor_of_conjugate).data()[linear_factor_index]);
-      operator_matrix(0, number_of_radial_points + i) = 0.0;
-      // lower left
-      operator_matrix(number_of_radial_points + i, i) +=
-          imag(get(linear_factor).data()[linear_factor_index] +
-               get(linear_factor_of_conjugate).data()[linear_factor_index]);
-      operator_matrix(number_of_radial_points, i) = 0.0;
-      // lower right
-      operator_matrix(number_of_radial_points + i,
-                      number_of_radial_points + i) +=
-          real(get(linear_factor).data()[linear_factor_index] -
-               get(linear_factor_of_conjugate).data()[linear_factor_index]);
-      operator_matrix(number_of_radial_points, number_of_radial_points + i) =
-          0.0;
-    }
-    operator_matrix(0, 0) = 1.0;
-    operator_matrix(number_of_radial_points, number_of_radial_points) = 1.0;
-    // put the data currently in integrand into a real DataVector of twice the
-    // length
-    linear_solve_buffer[offset * 2 * number_of_radial_points] =
-        real(get(boundary).data()[offset]);
-    linear_solve_buffer[(offset * 2 + 1) * number_of_radial_points] =
-        imag(get(boundary).data()[offset]);
-    DataVector linear_solve_buffer_view{
-        linear_solve_buffer.data() + offset * 2 * number_of_radial_points,
-        2 * number_of_radial_points};
-    lapack::general_matrix_linear_solve(
-        make_not_null(&linear_solve_buffer_view),
-        make_not_null(&operator_matrix));
-  }
+  };
+  Parallel::parallel_for(number_of_angular_points, number_of_angular_chunks,
+                         solve_angular_points);
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
   raw_transpose(make_not_null(reinterpret_cast<double*>(
                     get(*integral_result).data().data())),
@@ -94,6 +94,10 @@ void transpose_to_reals_then_imags_radial_stripes(
  * \f$L^\prime\f$ ensure that the only current method we have for evaluating the
  * \f$H\f$ hypersurface equation is a direct linear solve, rather than the
  * spectral matrix multiplications which are available for the other integrals.
+ * The linear solves are independent for each angular collocation point, so
+ * they are split into `Tags::NumberOfAngularChunks` chunks that
+ * `Parallel::parallel_for` shares among the PEs of the node. The result does
+ * not depend on the number of chunks.
  *
  * In each case, the boundary value at the world tube for the integration is
  * retrieved from `BoundaryPrefix<Tag>`.
@@ -180,7 +184,8 @@ struct RadialIntegrateBondi<BoundaryPrefix, Tags::BondiH> {
   using return_tags = tmpl::list<Tags::BondiH>;
   using argument_tags =
       tmpl::append<integrand_tags, boundary_tags, integration_independent_tags,
-                   tmpl::list<Tags::LMax, Tags::NumberOfRadialPoints>>;
+                   tmpl::list<Tags::LMax, Tags::NumberOfRadialPoints,
+                              Tags::NumberOfAngularChunks>>;
   static void apply(
       gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 2>>*>
           integral_result,
@@ -191,7 +196,8 @@ struct RadialIntegrateBondi<BoundaryPrefix, Tags::BondiH> {
           linear_factor_of_conjugate,
       const Scalar<SpinWeighted<ComplexDataVector, 2>>& boundary,
       const Scalar<SpinWeighted<ComplexDataVector, 0>>& one_minus_y,
-      size_t l_max, size_t number_of_radial_points) noexcept;
+      size_t l_max, size_t number_of_radial_points,
+      size_t number_of_angular_chunks = 1) noexcept;
 };
 // @}
 }  // namespace Cce
@@ -73,6 +73,17 @@ struct NumberOfRadialPoints {
   using group = Cce;
 };
 
+struct NumberOfAngularChunks {
+  using type = size_t;
+  static constexpr Options::String help{
+      "Number of chunks into which the angular collocation points are split "
+      "to share the pointwise work of the hypersurface integration, the gauge "
+      "transforms and the scri+ interpolation among the PEs of the node"};
+  static size_t suggested_value() noexcept { return 1; }
+  static size_t lower_bound() noexcept { return 1; }
+  using group = Cce;
+};
+
 struct ExtractionRadius {
   using type = double;
   static constexpr Options::String help{"Extraction radius of the CCE system."};
@@ -295,6 +306,22 @@ struct NumberOfRadialPoints : db::SimpleTag,
   }
 };
 
+/// The number of chunks into which the `CharacteristicEvolution` component
+/// splits work that is independent for each angular collocation point, such
+/// as the radial linear solves for `Tags::BondiH`, the gauge transform
+/// interpolation and the scri+ interpolation, to share it among the PEs of the
+/// node with `Parallel::parallel_for`.
+struct NumberOfAngularChunks : db::SimpleTag {
+  using type = size_t;
+  using option_tags = tmpl::list<OptionTags::NumberOfAngularChunks>;
+
+  static constexpr bool pass_metavariables = false;
+  static size_t create_from_options(
+      const size_t number_of_angular_chunks) noexcept {
+    return number_of_angular_chunks;
+  }
+};
+
 struct ObservationLMax : db::SimpleTag {
   using type = size_t;
   using option_tags = tmpl::list<OptionTags::ObservationLMax>;
@@ -19,6 +19,7 @@
 #include "ErrorHandling/Error.hpp"
 #include "Evolution/Systems/Cce/WorldtubeDataManager.hpp"
 #include "NumericalAlgorithms/Interpolation/SpanInterpolator.hpp"
+#include "Parallel/ParallelFor.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/Literals.hpp"
 #include "Utilities/MakeArray.hpp"
@@ -116,7 +117,12 @@ struct ScriPlusInterpolationManager {
   /// data is available, but for full accuracy, check
   /// `first_time_is_ready_to_interpolate` before calling the interpolation
   /// functions
-  std::pair<double, VectorTypeToInterpolate> interpolate_first_time() noexcept;
+  ///
+  /// The interpolation is independent for each point of the vector, so the
+  /// points are split into `number_of_angular_chunks` chunks that
+  /// `Parallel::parallel_for` shares among the PEs of the node.
+  std::pair<double, VectorTypeToInterpolate> interpolate_first_time(
+      size_t number_of_angular_chunks = 1) noexcept;
 
   /// \brief Interpolate to the first target time in the queue, returning both
   /// the time and the interpolated data at that time, and remove the first time
@@ -132,8 +138,11 @@ struct ScriPlusInterpolationManager {
   /// data is available, but for full accuracy, check
   /// `first_time_is_ready_to_interpolate` before calling the interpolation
   /// functions
-  std::pair<double, VectorTypeToInterpolate>
-  interpolate_and_pop_first_time() noexcept;
+  ///
+  /// The points are split into `number_of_angular_chunks` chunks as in
+  /// `interpolate_first_time`.
+  std::pair<double, VectorTypeToInterpolate> interpolate_and_pop_first_time(
+      size_t number_of_angular_chunks = 1) noexcept;
 
   /// \brief return the number of times in the target times queue
   size_t number_of_target_times() const noexcept {
@@ -199,8 +208,9 @@ bool ScriPlusInterpolationManager<
 }
 
 template <typename VectorTypeToInterpolate, typename Tag>
-std::pair<double, VectorTypeToInterpolate> ScriPlusInterpolationManager<
-    VectorTypeToInterpolate, Tag>::interpolate_first_time() noexcept {
+std::pair<double, VectorTypeToInterpolate>
+ScriPlusInterpolationManager<VectorTypeToInterpolate, Tag>::
+    interpolate_first_time(const size_t number_of_angular_chunks) noexcept {
   if (target_times_.empty()) {
     ERROR("There are no target times to interpolate.");
   }
@@ -213,65 +223,73 @@ std::pair<double, VectorTypeToInterpolate> ScriPlusInterpolationManager<
   VectorTypeToInterpolate result{vector_size_};
   const size_t interpolation_data_size = to_interpolate_values_.size();
 
-  VectorTypeToInterpolate interpolation_values{2 * target_number_of_points_};
-  DataVector interpolation_times{2 * target_number_of_points_};
-  for (size_t i = 0; i < vector_size_; ++i) {
-    // binary search assumes times placed in sorted order
-    auto upper_bound_offset = static_cast<size_t>(std::distance(
-        u_bondi_values_.begin(),
-        std::upper_bound(
-            u_bondi_values_.begin(), u_bondi_values_.end(),
-            target_times_.front(),
-            [&i](const double rhs, const DataVector& lhs) noexcept {
-              return rhs < lhs[i];
-            })));
-    size_t lower_bound_offset =
-        upper_bound_offset == 0 ? 0 : upper_bound_offset - 1;
-
-    if (upper_bound_offset + target_number_of_points_ >
-        interpolation_data_size) {
-      upper_bound_offset = interpolation_data_size;
-      lower_bound_offset =
-          interpolation_data_size - 2 * target_number_of_points_;
-    } else if (lower_bound_offset < target_number_of_points_ - 1) {
-      lower_bound_offset = 0;
-      upper_bound_offset = 2 * target_number_of_points_;
-    } else {
-      lower_bound_offset = lower_bound_offset + 1 - target_number_of_points_;
-      upper_bound_offset = lower_bound_offset + 2 * target_number_of_points_;
-    }
-    auto interpolation_values_begin =
-        to_interpolate_values_.begin() +
-        static_cast<ptrdiff_t>(lower_bound_offset);
-    auto interpolation_times_begin =
-        u_bondi_values_.begin() + static_cast<ptrdiff_t>(lower_bound_offset);
-    auto interpolation_times_end =
-        u_bondi_values_.begin() + static_cast<ptrdiff_t>(upper_bound_offset);
-
-    // interpolate using the data sets in the restricted iterators
-    auto value_it = interpolation_values_begin;
-    size_t vector_position = 0;
-    for (auto time_it = interpolation_times_begin;
-         time_it != interpolation_times_end;
-         ++time_it, ++value_it, ++vector_position) {
-      interpolation_values[vector_position] = (*value_it)[i];
-      interpolation_times[vector_position] = (*time_it)[i];
+  const auto interpolate_points = [this, &result, &interpolation_data_size](
+                                      const size_t begin,
+                                      const size_t end) noexcept {
+    VectorTypeToInterpolate interpolation_values{2 * target_number_of_points_};
+    DataVector interpolation_times{2 * target_number_of_points_};
+    for (size_t i = begin; i < end; ++i) {
+      // binary search assumes times placed in sorted order
+      auto upper_bound_offset = static_cast<size_t>(std::distance(
+          u_bondi_values_.begin(),
+          std::upper_bound(
+              u_bondi_values_.begin(), u_bondi_values_.end(),
+              target_times_.front(),
+              [&i](const double rhs, const DataVector& lhs) noexcept {
+                return rhs < lhs[i];
+              })));
+      size_t lower_bound_offset =
+          upper_bound_offset == 0 ? 0 : upper_bound_offset - 1;
+
+      if (upper_bound_offset + target_number_of_points_ >
+          interpolation_data_size) {
+        upper_bound_offset = interpolation_data_size;
+        lower_bound_offset =
+            interpolation_data_size - 2 * target_number_of_points_;
+      } else if (lower_bound_offset < target_number_of_points_ - 1) {
+        lower_bound_offset = 0;
+        upper_bound_offset = 2 * target_number_of_points_;
+      } else {
+        lower_bound_offset = lower_bound_offset + 1 - target_number_of_points_;
+        upper_bound_offset = lower_bound_offset + 2 * target_number_of_points_;
+      }
+      auto interpolation_values_begin =
+          to_interpolate_values_.begin() +
+          static_cast<ptrdiff_t>(lower_bound_offset);
+      auto interpolation_times_begin =
+          u_bondi_values_.begin() + static_cast<ptrdiff_t>(lower_bound_offset);
+      auto interpolation_times_end =
+          u_bondi_values_.begin() + static_cast<ptrdiff_t>(upper_bound_offset);
+
+      // interpolate using the data sets in the restricted iterators
+      auto value_it = interpolation_values_begin;
+      size_t vector_position = 0;
+      for (auto time_it = interpolation_times_begin;
+           time_it != interpolation_times_end;
+           ++time_it, ++value_it, ++vector_position) {
+        interpolation_values[vector_position] = (*value_it)[i];
+        interpolation_times[vector_position] = (*time_it)[i];
+      }
+      result[i] = interpolator_->interpolate(
+          gsl::span<const double>(interpolation_times.data(),
+                                  interpolation_times.size()),
+          gsl::span<const typename VectorTypeToInterpolate::value_type>(
+              interpolation_values.data(), interpolation_values.size()),
+          target_times_.front());
     }
-    result[i] = interpolator_->interpolate(
-        gsl::span<const double>(interpolation_times.data(),
-                                interpolation_times.size()),
-        gsl::span<const typename VectorTypeToInterpolate::value_type>(
-            interpolation_values.data(), interpolation_values.size()),
-        target_times_.front());
-  }
+  };
+  Parallel::parallel_for(vector_size_, number_of_angular_chunks,
+                         interpolate_points);
   return std::make_pair(target_times_.front(), std::move(result));
 }
 
 template <typename VectorTypeToInterpolate, typename Tag>
-std::pair<double, VectorTypeToInterpolate> ScriPlusInterpolationManager<
-    VectorTypeToInterpolate, Tag>::interpolate_and_pop_first_time() noexcept {
+std::pair<double, VectorTypeToInterpolate>
+ScriPlusInterpolationManager<VectorTypeToInterpolate, Tag>::
+    interpolate_and_pop_first_time(
+        const size_t number_of_angular_chunks) noexcept {
   std::pair<double, VectorTypeToInterpolate> interpolated =
-      interpolate_first_time();
+      interpolate_first_time(number_of_angular_chunks);
   target_times_.pop_front();
 
   if (not target_times_.empty()) {
@@ -391,11 +409,17 @@ struct ScriPlusInterpolationManager<
   /// data is available, but for full accuracy, check
   /// `first_time_is_ready_to_interpolate` before calling the interpolation
   /// functions
-  std::pair<double, VectorTypeToInterpolate> interpolate_first_time() noexcept {
+  ///
+  /// The points are split into `number_of_angular_chunks` chunks that
+  /// `Parallel::parallel_for` shares among the PEs of the node.
+  std::pair<double, VectorTypeToInterpolate> interpolate_first_time(
+      const size_t number_of_angular_chunks = 1) noexcept {
     const auto lhs_interpolation =
-        interpolation_manager_lhs_.interpolate_first_time();
+        interpolation_manager_lhs_.interpolate_first_time(
+            number_of_angular_chunks);
     const auto rhs_interpolation =
-        interpolation_manager_rhs_.interpolate_first_time();
+        interpolation_manager_rhs_.interpolate_first_time(
+            number_of_angular_chunks);
     return std::make_pair(lhs_interpolation.first,
                           lhs_interpolation.second * rhs_interpolation.second);
   }
@@ -414,12 +438,17 @@ struct ScriPlusInterpolationManager<
   /// data is available, but for full accuracy, check
   /// `first_time_is_ready_to_interpolate` before calling the interpolation
   /// functions
-  std::pair<double, VectorTypeToInterpolate>
-  interpolate_and_pop_first_time() noexcept {
+  ///
+  /// The points are split into `number_of_angular_chunks` chunks as in
+  /// `interpolate_first_time`.
+  std::pair<double, VectorTypeToInterpolate> interpolate_and_pop_first_time(
+      const size_t number_of_angular_chunks = 1) noexcept {
     const auto lhs_interpolation =
-        interpolation_manager_lhs_.interpolate_and_pop_first_time();
+        interpolation_manager_lhs_.interpolate_and_pop_first_time(
+            number_of_angular_chunks);
     const auto rhs_interpolation =
-        interpolation_manager_rhs_.interpolate_and_pop_first_time();
+        interpolation_manager_rhs_.interpolate_and_pop_first_time(
+            number_of_angular_chunks);
     return std::make_pair(lhs_interpolation.first,
                           lhs_interpolation.second * rhs_interpolation.second);
   }
@@ -532,7 +561,12 @@ struct ScriPlusInterpolationManager<VectorTypeToInterpolate, Tags::Du<Tag>> {
   /// data is available, but for full accuracy, check
   /// `first_time_is_ready_to_interpolate` before calling the interpolation
   /// functions
-  std::pair<double, VectorTypeToInterpolate> interpolate_first_time() noexcept;
+  ///
+  /// The interpolation is independent for each point of the vector, so the
+  /// points are split into `number_of_angular_chunks` chunks that
+  /// `Parallel::parallel_for` shares among the PEs of the node.
+  std::pair<double, VectorTypeToInterpolate> interpolate_first_time(
+      size_t number_of_angular_chunks = 1) noexcept;
 
   /// \brief Interpolate to the first target time in the queue, returning both
   /// the time and the interpolated data at that time, and remove the first time
@@ -548,8 +582,11 @@ struct ScriPlusInterpolationManager<VectorTypeToInterpolate, Tags::Du<Tag>> {
   /// data is available, but for full accuracy, check
   /// `first_time_is_ready_to_interpolate` before calling the interpolation
   /// functions
-  std::pair<double, VectorTypeToInterpolate>
-  interpolate_and_pop_first_time() noexcept;
+  ///
+  /// The points are split into `number_of_angular_chunks` chunks as in
+  /// `interpolate_first_time`.
+  std::pair<double, VectorTypeToInterpolate> interpolate_and_pop_first_time(
+      size_t number_of_angular_chunks = 1) noexcept;
 
   /// \brief return the number of times in the target times queue
   size_t number_of_target_times() const noexcept {
@@ -577,8 +614,9 @@ struct ScriPlusInterpolationManager<VectorTypeToInterpolate, Tags::Du<Tag>> {
 };
 
 template <typename VectorTypeToInterpolate, typename Tag>
-std::pair<double, VectorTypeToInterpolate> ScriPlusInterpolationManager<
-    VectorTypeToInterpolate, Tags::Du<Tag>>::interpolate_first_time() noexcept {
+std::pair<double, VectorTypeToInterpolate>
+ScriPlusInterpolationManager<VectorTypeToInterpolate, Tags::Du<Tag>>::
+    interpolate_first_time(const size_t number_of_angular_chunks) noexcept {
   const size_t target_number_of_points =
       argument_interpolation_manager_.target_number_of_points_;
   if (argument_interpolation_manager_.target_times_.empty()) {
@@ -597,13 +635,7 @@ std::pair<double, VectorTypeToInterpolate> ScriPlusInterpolationManager<
   // reasonable method.
   VectorTypeToInterpolate result{argument_interpolation_manager_.vector_size_};
 
-  VectorTypeToInterpolate interpolation_values{2 * target_number_of_points};
-  VectorTypeToInterpolate lobatto_collocation_values{2 *
-                                                     target_number_of_points};
-  VectorTypeToInterpolate derivative_lobatto_collocation_values{
-      2 * target_number_of_points};
-  DataVector interpolation_times{2 * target_number_of_points};
-  DataVector collocation_points =
+  const DataVector collocation_points =
       Spectral::collocation_points<Spectral::Basis::Legendre,
                                    Spectral::Quadrature::GaussLobatto>(
           2 * target_number_of_points);
@@ -611,103 +643,118 @@ std::pair<double, VectorTypeToInterpolate> ScriPlusInterpolationManager<
   const size_t interpolation_data_size =
       argument_interpolation_manager_.to_interpolate_values_.size();
 
-  for (size_t i = 0; i < argument_interpolation_manager_.vector_size_; ++i) {
-    // binary search assumes times placed in sorted order
-    auto upper_bound_offset = static_cast<size_t>(std::distance(
-        argument_interpolation_manager_.u_bondi_values_.begin(),
-        std::upper_bound(
-            argument_interpolation_manager_.u_bondi_values_.begin(),
-            argument_interpolation_manager_.u_bondi_values_.end(),
-            argument_interpolation_manager_.target_times_.front(),
-            [&i](const double rhs, const DataVector& lhs) noexcept {
-              return rhs < lhs[i];
-            })));
-    size_t lower_bound_offset =
-        upper_bound_offset == 0 ? 0 : upper_bound_offset - 1;
-
-    if (upper_bound_offset + target_number_of_points >
-        interpolation_data_size) {
-      upper_bound_offset = interpolation_data_size;
-      lower_bound_offset =
-          interpolation_data_size - 2 * target_number_of_points;
-    } else if (lower_bound_offset < target_number_of_points - 1) {
-      lower_bound_offset = 0;
-      upper_bound_offset = 2 * target_number_of_points;
-    } else {
-      lower_bound_offset = lower_bound_offset + 1 - target_number_of_points;
-      upper_bound_offset = lower_bound_offset + 2 * target_number_of_points;
-    }
-    auto interpolation_values_begin =
-        argument_interpolation_manager_.to_interpolate_values_.begin() +
-        static_cast<ptrdiff_t>(lower_bound_offset);
-    auto interpolation_times_begin =
-        argument_interpolation_manager_.u_bondi_values_.begin() +
-        static_cast<ptrdiff_t>(lower_bound_offset);
-    auto interpolation_times_end =
-        argument_interpolation_manager_.u_bondi_values_.begin() +
-        static_cast<ptrdiff_t>(upper_bound_offset);
-
-    // interpolate using the data sets in the restricted iterators
-    auto value_it = interpolation_values_begin;
-    size_t vector_position = 0;
-    for (auto time_it = interpolation_times_begin;
-         time_it != interpolation_times_end;
-         ++time_it, ++value_it, ++vector_position) {
-      interpolation_values[vector_position] = (*value_it)[i];
-      interpolation_times[vector_position] = (*time_it)[i];
-    }
-    for (size_t j = 0; j < lobatto_collocation_values.size(); ++j) {
-      lobatto_collocation_values[j] =
+  const auto interpolate_points = [this, &result, &target_number_of_points,
+                                   &collocation_points,
+                                   &interpolation_data_size](
+                                      const size_t begin,
+                                      const size_t end) noexcept {
+    VectorTypeToInterpolate interpolation_values{2 * target_number_of_points};
+    VectorTypeToInterpolate lobatto_collocation_values{2 *
+                                                       target_number_of_points};
+    VectorTypeToInterpolate derivative_lobatto_collocation_values{
+        2 * target_number_of_points};
+    DataVector interpolation_times{2 * target_number_of_points};
+    for (size_t i = begin; i < end; ++i) {
+      // binary search assumes times placed in sorted order
+      auto upper_bound_offset = static_cast<size_t>(std::distance(
+          argument_interpolation_manager_.u_bondi_values_.begin(),
+          std::upper_bound(
+              argument_interpolation_manager_.u_bondi_values_.begin(),
+              argument_interpolation_manager_.u_bondi_values_.end(),
+              argument_interpolation_manager_.target_times_.front(),
+              [&i](const double rhs, const DataVector& lhs) noexcept {
+                return rhs < lhs[i];
+              })));
+      size_t lower_bound_offset =
+          upper_bound_offset == 0 ? 0 : upper_bound_offset - 1;
+
+      if (upper_bound_offset + target_number_of_points >
+          interpolation_data_size) {
+        upper_bound_offset = interpolation_data_size;
+        lower_bound_offset =
+            interpolation_data_size - 2 * target_number_of_points;
+      } else if (lower_bound_offset < target_number_of_points - 1) {
+        lower_bound_offset = 0;
+        upper_bound_offset = 2 * target_number_of_points;
+      } else {
+        lower_bound_offset = lower_bound_offset + 1 - target_number_of_points;
+        upper_bound_offset = lower_bound_offset + 2 * target_number_of_points;
+      }
+      auto interpolation_values_begin =
+          argument_interpolation_manager_.to_interpolate_values_.begin() +
+          static_cast<ptrdiff_t>(lower_bound_offset);
+      auto interpolation_times_begin =
+          argument_interpolation_manager_.u_bondi_values_.begin() +
+          static_cast<ptrdiff_t>(lower_bound_offset);
+      auto interpolation_times_end =
+          argument_interpolation_manager_.u_bondi_values_.begin() +
+          static_cast<ptrdiff_t>(upper_bound_offset);
+
+      // interpolate using the data sets in the restricted iterators
+      auto value_it = interpolation_values_begin;
+      size_t vector_position = 0;
+      for (auto time_it = interpolation_times_begin;
+           time_it != interpolation_times_end;
+           ++time_it, ++value_it, ++vector_position) {
+        interpolation_values[vector_position] = (*value_it)[i];
+        interpolation_times[vector_position] = (*time_it)[i];
+      }
+      for (size_t j = 0; j < lobatto_collocation_values.size(); ++j) {
+        lobatto_collocation_values[j] =
+            argument_interpolation_manager_.interpolator_->interpolate(
+                gsl::span<const double>(interpolation_times.data(),
+                                        interpolation_times.size()),
+                gsl::span<const typename VectorTypeToInterpolate::value_type>(
+                    interpolation_values.data(), interpolation_values.size()),
+                // affine transformation between the Gauss-Lobatto collocation
+                // points and the physical times
+                (collocation_points[j] + 1.0) * 0.5 *
+                        (interpolation_times[interpolation_times.size() - 1] -
+                         interpolation_times[0]) +
+                    interpolation_times[0]);
+      }
+      // note the coordinate transformation to and from the Gauss-Lobatto basis
+      // range [-1, 1]
+      apply_matrices(
+          make_not_null(&derivative_lobatto_collocation_values),
+          make_array<1>(Spectral::differentiation_matrix<
+                        Spectral::Basis::Legendre,
+                        Spectral::Quadrature::GaussLobatto>(
+              lobatto_collocation_values.size())),
+          lobatto_collocation_values,
+          Index<1>(lobatto_collocation_values.size()));
+
+      result[i] =
           argument_interpolation_manager_.interpolator_->interpolate(
-              gsl::span<const double>(interpolation_times.data(),
-                                      interpolation_times.size()),
+              gsl::span<const double>(collocation_points.data(),
+                                      collocation_points.size()),
               gsl::span<const typename VectorTypeToInterpolate::value_type>(
-                  interpolation_values.data(), interpolation_values.size()),
-              // affine transformation between the Gauss-Lobatto collocation
-              // points and the physical times
-              (collocation_points[j] + 1.0) * 0.5 *
+                  derivative_lobatto_collocation_values.data(),
+                  derivative_lobatto_collocation_values.size()),
+              2.0 *
+                      (argument_interpolation_manager_.target_times_.front() -
+                       interpolation_times[0]) /
                       (interpolation_times[interpolation_times.size() - 1] -
-                       interpolation_times[0]) +
-                  interpolation_times[0]);
+                       interpolation_times[0]) -
+                  1.0) *
+          2.0 /
+          (interpolation_times[interpolation_times.size() - 1] -
+           interpolation_times[0]);
     }
-    // note the coordinate transformation to and from the Gauss-Lobatto basis
-    // range [-1, 1]
-    apply_matrices(
-        make_not_null(&derivative_lobatto_collocation_values),
-        make_array<1>(
-            Spectral::differentiation_matrix<
-                Spectral::Basis::Legendre, Spectral::Quadrature::GaussLobatto>(
-                lobatto_collocation_values.size())),
-        lobatto_collocation_values,
-        Index<1>(lobatto_collocation_values.size()));
-
-    result[i] =
-        argument_interpolation_manager_.interpolator_->interpolate(
-            gsl::span<const double>(collocation_points.data(),
-                                    collocation_points.size()),
-            gsl::span<const typename VectorTypeToInterpolate::value_type>(
-                derivative_lobatto_collocation_values.data(),
-                derivative_lobatto_collocation_values.size()),
-            2.0 *
-                    (argument_interpolation_manager_.target_times_.front() -
-                     interpolation_times[0]) /
-                    (interpolation_times[interpolation_times.size() - 1] -
-                     interpolation_times[0]) -
-                1.0) *
-        2.0 /
-        (interpolation_times[interpolation_times.size() - 1] -
-         interpolation_times[0]);
-  }
+  };
+  Parallel::parallel_for(argument_interpolation_manager_.vector_size_,
+                         number_of_angular_chunks, interpolate_points);
   return std::make_pair(argument_interpolation_manager_.target_times_.front(),
                         std::move(result));
 }
 
 template <typename VectorTypeToInterpolate, typename Tag>
-std::pair<double, VectorTypeToInterpolate> ScriPlusInterpolationManager<
-    VectorTypeToInterpolate,
-    Tags::Du<Tag>>::interpolate_and_pop_first_time() noexcept {
+std::pair<double, VectorTypeToInterpolate>
+ScriPlusInterpolationManager<VectorTypeToInterpolate, Tags::Du<Tag>>::
+    interpolate_and_pop_first_time(
+        const size_t number_of_angular_chunks) noexcept {
   std::pair<double, VectorTypeToInterpolate> interpolated =
-      interpolate_first_time();
+      interpolate_first_time(number_of_angular_chunks);
   argument_interpolation_manager_.target_times_.pop_front();
 
   if (not argument_interpolation_manager_.target_times_.empty()) {
@@ -20,6 +20,7 @@
 #include "NumericalAlgorithms/Interpolation/SpanInterpolator.hpp"
 #include "NumericalAlgorithms/Spectral/SwshCoefficients.hpp"
 #include "NumericalAlgorithms/Spectral/SwshTransform.hpp"
+#include "NumericalAlgorithms/Spectral/SwshTransformPlan.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -367,18 +368,20 @@ bool BondiWorldtubeDataManager::populate_hypersurface_boundary_data(
                       -static_cast<int>(libsharp_mode.m))));
         });
   }
-  // just inverse transform the 'direct' tags
+  // just inverse transform the 'direct' tags, collecting the transforms so
+  // that those of equal spin weight are performed in a single libsharp job
+  Spectral::Swsh::SwshTransformPlan<> transform_plan{l_max_};
   tmpl::for_each<tmpl::transform<cce_bondi_input_tags,
                                  tmpl::bind<db::remove_tag_prefix, tmpl::_1>>>(
-      [this, &boundary_data_variables](auto tag_v) {
+      [this, &boundary_data_variables, &transform_plan](auto tag_v) {
         using tag = typename decltype(tag_v)::type;
-        Spectral::Swsh::inverse_swsh_transform(
-            l_max_, 1,
+        transform_plan.add_inverse_transform(
             make_not_null(
                 &get(get<Tags::BoundaryValue<tag>>(*boundary_data_variables))),
             get(get<Spectral::Swsh::Tags::SwshTransform<tag>>(
                 interpolated_coefficients_)));
       });
+  transform_plan.execute();
   const auto& du_r = get(get<Tags::BoundaryValue<Tags::Du<Tags::BondiR>>>(
       *boundary_data_variables));
   const auto& bondi_r =
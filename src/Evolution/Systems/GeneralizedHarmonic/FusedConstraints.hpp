@@ -0,0 +1,263 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/TypeAliases.hpp"
+#include "DataStructures/Variables.hpp"
+#include "ErrorHandling/Assert.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/ConstraintDamping/Tags.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/Constraints.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/Tags.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/TimeDerivative.hpp"
+#include "NumericalAlgorithms/LinearOperators/PartialDerivatives.hpp"
+#include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace GeneralizedHarmonic {
+namespace FusedConstraints_detail {
+// Copy every `stride`-th grid point of `tensor`, starting with the first.
+template <typename TensorType>
+TensorType subsample(const TensorType& tensor, const size_t stride) noexcept {
+  const size_t number_of_points = tensor[0].size();
+  const size_t number_of_subsampled_points =
+      (number_of_points + stride - 1) / stride;
+  TensorType result(number_of_subsampled_points);
+  for (size_t storage_index = 0; storage_index < tensor.size();
+       ++storage_index) {
+    for (size_t s = 0; s < number_of_subsampled_points; ++s) {
+      result[storage_index][s] = tensor[storage_index][s * stride];
+    }
+  }
+  return result;
+}
+}  // namespace FusedConstraints_detail
+
+/*!
+ * \brief Computes any subset of the generalized-harmonic constraints in a
+ * single call from the quantities that `TimeDerivative` has already computed.
+ *
+ * \details The constraint compute tags in `Constraints.hpp` each derive the
+ * spatial derivatives of the evolved variables, the inverse metrics, the
+ * normal vectors and the Christoffel symbols from scratch, which roughly
+ * doubles the work on steps at which the constraints are observed.
+ * `TimeDerivative` already computes all of these: the quantities listed in
+ * `intermediate_tags` are among its `temporary_tags`, and the derivatives in
+ * `argument_tags` are the partial derivatives it is passed. If the caller
+ * keeps these buffers alive, this function evaluates the requested constraints
+ * directly from them. The gauge and three-index constraints are copied, the
+ * spatial derivative of the gauge source function is extracted once and shared
+ * by the two-index and F constraints, and the constraint energy uses the other
+ * constraints computed in the same call (computing those that were not
+ * requested into a temporary buffer).
+ *
+ * The constraints are computed for the tags in `constraints`, which must be a
+ * subset of `constraint_tags`. The four-index constraint and the constraint
+ * energy are only available in 3 spatial dimensions. The `constraints` are
+ * resized to the number of evaluated grid points.
+ *
+ * If `point_stride` is larger than one, the constraints are only evaluated at
+ * every `point_stride`-th grid point (in the order the points are stored),
+ * which is sufficient for monitoring constraint norms. Evaluating the
+ * constraints on only a subset of the elements is left to the caller, which
+ * can simply skip this function on the other elements.
+ */
+template <size_t Dim>
+struct FusedConstraints {
+  using frame = Frame::Inertial;
+
+  using constraint_tags = tmpl::flatten<tmpl::list<
+      Tags::GaugeConstraint<Dim, frame>, Tags::ThreeIndexConstraint<Dim, frame>,
+      Tags::TwoIndexConstraint<Dim, frame>, Tags::FConstraint<Dim, frame>,
+      tmpl::conditional_t<Dim == 3,
+                          tmpl::list<Tags::FourIndexConstraint<Dim, frame>,
+                                     Tags::ConstraintEnergy<Dim, frame>>,
+                          tmpl::list<>>>>;
+
+  using intermediate_tags =
+      tmpl::list<gr::Tags::InverseSpatialMetric<Dim, frame, DataVector>,
+                 gr::Tags::DetSpatialMetric<DataVector>,
+                 gr::Tags::InverseSpacetimeMetric<Dim, frame, DataVector>,
+                 gr::Tags::SpacetimeNormalVector<Dim, frame, DataVector>,
+                 gr::Tags::SpacetimeNormalOneForm<Dim, frame, DataVector>,
+                 Tags::GaugeConstraint<Dim, frame>,
+                 Tags::ThreeIndexConstraint<Dim, frame>>;
+  static_assert(
+      tmpl::size<tmpl::list_difference<
+          intermediate_tags,
+          typename TimeDerivative<Dim>::temporary_tags>>::value == 0,
+      "All intermediate quantities must be computed by TimeDerivative.");
+
+  using argument_tags = tmpl::list<
+      Tags::Pi<Dim, frame>, Tags::Phi<Dim, frame>,
+      ::Tags::deriv<Tags::Pi<Dim, frame>, tmpl::size_t<Dim>, frame>,
+      ::Tags::deriv<Tags::Phi<Dim, frame>, tmpl::size_t<Dim>, frame>,
+      ConstraintDamping::Tags::ConstraintGamma2, Tags::GaugeH<Dim, frame>,
+      Tags::SpacetimeDerivGaugeH<Dim, frame>>;
+
+  template <typename... ConstraintTags>
+  static void apply(
+      const gsl::not_null<Variables<tmpl::list<ConstraintTags...>>*>
+          constraints,
+      const size_t point_stride,
+      const tnsr::II<DataVector, Dim>& inverse_spatial_metric,
+      const Scalar<DataVector>& det_spatial_metric,
+      const tnsr::AA<DataVector, Dim>& inverse_spacetime_metric,
+      const tnsr::A<DataVector, Dim>& spacetime_normal_vector,
+      const tnsr::a<DataVector, Dim>& spacetime_normal_one_form,
+      const tnsr::a<DataVector, Dim>& gauge_constraint,
+      const tnsr::iaa<DataVector, Dim>& three_index_constraint,
+      const tnsr::aa<DataVector, Dim>& pi,
+      const tnsr::iaa<DataVector, Dim>& phi,
+      const tnsr::iaa<DataVector, Dim>& d_pi,
+      const tnsr::ijaa<DataVector, Dim>& d_phi,
+      const Scalar<DataVector>& gamma2,
+      const tnsr::a<DataVector, Dim>& gauge_function,
+      const tnsr::ab<DataVector, Dim>&
+          spacetime_deriv_gauge_function) noexcept {
+    ASSERT(point_stride > 0, "The point stride must be positive.");
+    if (point_stride == 1) {
+      apply_impl(constraints, inverse_spatial_metric, det_spatial_metric,
+                 inverse_spacetime_metric, spacetime_normal_vector,
+                 spacetime_normal_one_form, gauge_constraint,
+                 three_index_constraint, pi, phi, d_pi, d_phi, gamma2,
+                 gauge_function, spacetime_deriv_gauge_function);
+      return;
+    }
+    const auto subsample = [&point_stride](const auto& tensor) noexcept {
+      return FusedConstraints_detail::subsample(tensor, point_stride);
+    };
+    apply_impl(constraints, subsample(inverse_spatial_metric),
+               subsample(det_spatial_metric),
+               subsample(inverse_spacetime_metric),
+               subsample(spacetime_normal_vector),
+               subsample(spacetime_normal_one_form),
+               subsample(gauge_constraint), subsample(three_index_constraint),
+               subsample(pi), subsample(phi), subsample(d_pi),
+               subsample(d_phi), subsample(gamma2), subsample(gauge_function),
+               subsample(spacetime_deriv_gauge_function));
+  }
+
+ private:
+  // The requested constraint `Tag`, or the buffer for it if it is only needed
+  // to compute the constraint energy.
+  template <typename Tag, typename TagsList, typename Buffer>
+  static typename Tag::type& output(
+      const gsl::not_null<Variables<TagsList>*> constraints,
+      const gsl::not_null<Buffer*> buffer) noexcept {
+    if constexpr (tmpl::list_contains_v<TagsList, Tag>) {
+      (void)buffer;
+      return get<Tag>(*constraints);
+    } else {
+      (void)constraints;
+      return tuples::get<Tag>(*buffer);
+    }
+  }
+
+  template <typename... ConstraintTags>
+  static void apply_impl(
+      const gsl::not_null<Variables<tmpl::list<ConstraintTags...>>*>
+          constraints,
+      const tnsr::II<DataVector, Dim>& inverse_spatial_metric,
+      const Scalar<DataVector>& det_spatial_metric,
+      const tnsr::AA<DataVector, Dim>& inverse_spacetime_metric,
+      const tnsr::A<DataVector, Dim>& spacetime_normal_vector,
+      const tnsr::a<DataVector, Dim>& spacetime_normal_one_form,
+      const tnsr::a<DataVector, Dim>& gauge_constraint,
+      const tnsr::iaa<DataVector, Dim>& three_index_constraint,
+      const tnsr::aa<DataVector, Dim>& pi,
+      const tnsr::iaa<DataVector, Dim>& phi,
+      const tnsr::iaa<DataVector, Dim>& d_pi,
+      const tnsr::ijaa<DataVector, Dim>& d_phi,
+      const Scalar<DataVector>& gamma2,
+      const tnsr::a<DataVector, Dim>& gauge_function,
+      const tnsr::ab<DataVector, Dim>&
+          spacetime_deriv_gauge_function) noexcept {
+    using requested_tags = tmpl::list<ConstraintTags...>;
+    static_assert(
+        tmpl::size<tmpl::list_difference<requested_tags,
+                                         constraint_tags>>::value == 0,
+        "Only the constraints in `constraint_tags` can be computed.");
+    using two_index_tag = Tags::TwoIndexConstraint<Dim, frame>;
+    using f_tag = Tags::FConstraint<Dim, frame>;
+    using four_index_tag = Tags::FourIndexConstraint<Dim, frame>;
+    constexpr bool compute_energy =
+        tmpl::list_contains_v<requested_tags,
+                              Tags::ConstraintEnergy<Dim, frame>>;
+    constexpr bool compute_two_index =
+        compute_energy or tmpl::list_contains_v<requested_tags, two_index_tag>;
+    constexpr bool compute_f =
+        compute_energy or tmpl::list_contains_v<requested_tags, f_tag>;
+    constexpr bool compute_four_index =
+        compute_energy or tmpl::list_contains_v<requested_tags, four_index_tag>;
+
+    constraints->initialize(get(gamma2).size());
+    tuples::tagged_tuple_from_typelist<tmpl::conditional_t<
+        compute_energy,
+        tmpl::list_difference<tmpl::list<two_index_tag, f_tag, four_index_tag>,
+                              requested_tags>,
+        tmpl::list<>>>
+        buffer{};
+
+    if constexpr (tmpl::list_contains_v<requested_tags,
+                                        Tags::GaugeConstraint<Dim, frame>>) {
+      get<Tags::GaugeConstraint<Dim, frame>>(*constraints) = gauge_constraint;
+    }
+    if constexpr (tmpl::list_contains_v<
+                      requested_tags, Tags::ThreeIndexConstraint<Dim, frame>>) {
+      get<Tags::ThreeIndexConstraint<Dim, frame>>(*constraints) =
+          three_index_constraint;
+    }
+
+    if constexpr (compute_two_index or compute_f) {
+      tnsr::ia<DataVector, Dim> d_gauge_function(get(gamma2).size());
+      for (size_t i = 0; i < Dim; ++i) {
+        for (size_t a = 0; a < Dim + 1; ++a) {
+          d_gauge_function.get(i, a) =
+              spacetime_deriv_gauge_function.get(i + 1, a);
+        }
+      }
+      if constexpr (compute_two_index) {
+        two_index_constraint<Dim, frame, DataVector>(
+            make_not_null(&output<two_index_tag>(constraints,
+                                                 make_not_null(&buffer))),
+            d_gauge_function, spacetime_normal_one_form,
+            spacetime_normal_vector, inverse_spatial_metric,
+            inverse_spacetime_metric, pi, phi, d_pi, d_phi, gamma2,
+            three_index_constraint);
+      }
+      if constexpr (compute_f) {
+        f_constraint<Dim, frame, DataVector>(
+            make_not_null(&output<f_tag>(constraints, make_not_null(&buffer))),
+            gauge_function, d_gauge_function, spacetime_normal_one_form,
+            spacetime_normal_vector, inverse_spatial_metric,
+            inverse_spacetime_metric, pi, phi, d_pi, d_phi, gamma2,
+            three_index_constraint);
+      }
+    }
+
+    if constexpr (compute_four_index) {
+      four_index_constraint<Dim, frame, DataVector>(
+          make_not_null(
+              &output<four_index_tag>(constraints, make_not_null(&buffer))),
+          d_phi);
+    }
+
+    if constexpr (compute_energy) {
+      constraint_energy<Dim, frame, DataVector>(
+          make_not_null(&get<Tags::ConstraintEnergy<Dim, frame>>(*constraints)),
+          gauge_constraint,
+          output<f_tag>(constraints, make_not_null(&buffer)),
+          output<two_index_tag>(constraints, make_not_null(&buffer)),
+          three_index_constraint,
+          output<four_index_tag>(constraints, make_not_null(&buffer)),
+          inverse_spatial_metric, det_spatial_metric);
+    }
+  }
+};
+}  // namespace GeneralizedHarmonic
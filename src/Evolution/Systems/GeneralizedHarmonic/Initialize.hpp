@@ -15,6 +15,7 @@
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/Tags.hpp"
 #include "ErrorHandling/Assert.hpp"
+#include "Evolution/DiscontinuousGalerkin/TimeDerivativeIntermediates.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/ConstraintDamping/Tags.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/Constraints.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/System.hpp"
@@ -59,6 +60,12 @@ template <size_t Dim>
 struct InitializeConstraints {
   using frame = Frame::Inertial;
 
+  // Keeps the intermediates of the time derivative so that the constraints can
+  // be observed without recomputing them (see
+  // `GeneralizedHarmonic::Events::ObserveConstraintNorms`)
+  using simple_tags = tmpl::list<
+      evolution::dg::Tags::TimeDerivativeIntermediates<System<Dim>>>;
+
   using compute_tags = tmpl::flatten<db::AddComputeTags<
       GeneralizedHarmonic::Tags::GaugeConstraintCompute<Dim, frame>,
       // following tags added to observe constraints
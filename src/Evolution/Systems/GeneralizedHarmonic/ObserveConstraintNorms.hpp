@@ -0,0 +1,326 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <pup.h>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/TagName.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/TypeAliases.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/Structure/Element.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Tags.hpp"
+#include "ErrorHandling/Error.hpp"
+#include "Evolution/DiscontinuousGalerkin/TimeDerivativeIntermediates.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/ConstraintDamping/Tags.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/FusedConstraints.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/System.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/Tags.hpp"
+#include "IO/Observer/ArrayComponentId.hpp"
+#include "IO/Observer/Helpers.hpp"
+#include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/ObserverComponent.hpp"  // IWYU pragma: keep
+#include "IO/Observer/ReductionActions.hpp"   // IWYU pragma: keep
+#include "IO/Observer/TypeOfObservation.hpp"
+#include "NumericalAlgorithms/LinearOperators/PartialDerivatives.hpp"
+#include "Options/Options.hpp"
+#include "Parallel/ArrayIndex.hpp"
+#include "Parallel/CharmPupable.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/Reduction.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
+#include "Time/Tags.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Functional.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Numeric.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace GeneralizedHarmonic {
+namespace Events {
+namespace ObserveConstraintNorms_detail {
+template <typename Tag>
+struct LocalSquareNorm {
+  using type = double;
+};
+}  // namespace ObserveConstraintNorms_detail
+
+template <size_t Dim, typename ObservationValueTag, typename EventRegistrars>
+class ObserveConstraintNorms;
+
+namespace Registrars {
+template <size_t Dim, typename ObservationValueTag>
+// Presence of size_t template argument requires to define this struct
+// instead of using Registration::Registrar alias.
+struct ObserveConstraintNorms {
+  template <typename RegistrarList>
+  using f = Events::ObserveConstraintNorms<Dim, ObservationValueTag,
+                                           RegistrarList>;
+};
+}  // namespace Registrars
+
+template <size_t Dim, typename ObservationValueTag,
+          typename EventRegistrars = tmpl::list<
+              Registrars::ObserveConstraintNorms<Dim, ObservationValueTag>>>
+class ObserveConstraintNorms;  // IWYU pragma: keep
+
+/*!
+ * \brief %Observe the RMS norms of the generalized-harmonic constraints.
+ *
+ * Writes reduction quantities:
+ * - `ObservationValueTag`
+ * - `NumberOfPoints` = total number of points at which the constraints were
+ *   evaluated
+ * - `Norm(*)` = RMS norms of the constraints in
+ *   `GeneralizedHarmonic::FusedConstraints::constraint_tags` =
+ *   \f$\operatorname{RMS}\left(\sqrt{\sum_{\text{independent components}}
+ *   \text{value}^2}\right)\f$ over the evaluated points
+ *
+ * The constraints are computed by `GeneralizedHarmonic::FusedConstraints` from
+ * the intermediates of the time derivative stored in
+ * `evolution::dg::Tags::TimeDerivativeIntermediates`, so this event must be
+ * run by `Actions::RunEventsAndTriggersAfterDuDt`. It is an error to run it at
+ * a time step other than the one at which the intermediates were computed.
+ *
+ * The constraints are only evaluated at every `PointStride`-th grid point of
+ * every `ElementStride`-th element. An element is selected if the sum of its
+ * block id and the indices of its segments is divisible by `ElementStride`,
+ * which picks elements spread throughout each block. The other elements
+ * contribute no points to the norms.
+ */
+template <size_t Dim, typename ObservationValueTag, typename EventRegistrars>
+class ObserveConstraintNorms : public Event<EventRegistrars> {
+ private:
+  using frame = Frame::Inertial;
+  using constraint_tags = typename FusedConstraints<Dim>::constraint_tags;
+  using intermediates_tag =
+      evolution::dg::Tags::TimeDerivativeIntermediates<System<Dim>>;
+
+  using LocalSquareNorms =
+      tuples::tagged_tuple_from_typelist<tmpl::transform<
+          constraint_tags,
+          tmpl::bind<ObserveConstraintNorms_detail::LocalSquareNorm,
+                     tmpl::_1>>>;
+
+  using L2NormDatum = Parallel::ReductionDatum<double, funcl::Plus<>,
+                                               funcl::Sqrt<funcl::Divides<>>,
+                                               std::index_sequence<1>>;
+  using ReductionData = tmpl::wrap<
+      tmpl::append<
+          tmpl::list<Parallel::ReductionDatum<double, funcl::AssertEqual<>>,
+                     Parallel::ReductionDatum<size_t, funcl::Plus<>>>,
+          tmpl::filled_list<L2NormDatum, tmpl::size<constraint_tags>::value>>,
+      Parallel::ReductionData>;
+
+ public:
+  /// The name of the subfile inside the HDF5 file
+  struct SubfileName {
+    using type = std::string;
+    static constexpr Options::String help = {
+        "The name of the subfile inside the HDF5 file without an extension and "
+        "without a preceding '/'."};
+  };
+  /// Evaluate the constraints at every `PointStride`-th grid point
+  struct PointStride {
+    using type = size_t;
+    static constexpr Options::String help = {
+        "Evaluate the constraints at every PointStride-th grid point"};
+    static type lower_bound() noexcept { return 1; }
+  };
+  /// Evaluate the constraints on every `ElementStride`-th element
+  struct ElementStride {
+    using type = size_t;
+    static constexpr Options::String help = {
+        "Evaluate the constraints on every ElementStride-th element"};
+    static type lower_bound() noexcept { return 1; }
+  };
+
+  /// \cond
+  explicit ObserveConstraintNorms(CkMigrateMessage* /*unused*/) noexcept {}
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(ObserveConstraintNorms);  // NOLINT
+  /// \endcond
+
+  using options = tmpl::list<SubfileName, PointStride, ElementStride>;
+  static constexpr Options::String help =
+      "Observe the RMS norms of the generalized-harmonic constraints.\n"
+      "\n"
+      "Writes reduction quantities:\n"
+      " * ObservationValueTag\n"
+      " * NumberOfPoints = total number of points evaluated\n"
+      " * Norm(*) = RMS norms of the constraints (see online help details)\n"
+      "\n"
+      "The constraints are computed from the intermediates of the time\n"
+      "derivative, so this event must be listed in EventsAfterDuDt.\n"
+      "\n"
+      "Warning: Currently, only one reduction observation event can be\n"
+      "triggered at a given observation value.  Causing multiple events to\n"
+      "run at once will produce unpredictable results.";
+
+  ObserveConstraintNorms() = default;
+  ObserveConstraintNorms(const std::string& subfile_name, size_t point_stride,
+                         size_t element_stride) noexcept;
+
+  using observed_reduction_data_tags =
+      observers::make_reduction_data_tags<tmpl::list<ReductionData>>;
+
+  using argument_tags =
+      tmpl::list<ObservationValueTag, ::Tags::TimeStepId,
+                 domain::Tags::Element<Dim>, intermediates_tag,
+                 Tags::Pi<Dim, frame>, Tags::Phi<Dim, frame>,
+                 ConstraintDamping::Tags::ConstraintGamma2,
+                 Tags::GaugeH<Dim, frame>,
+                 Tags::SpacetimeDerivGaugeH<Dim, frame>>;
+
+  template <typename Metavariables, typename ArrayIndex,
+            typename ParallelComponent>
+  void operator()(const typename ObservationValueTag::type& observation_value,
+                  const TimeStepId& time_step_id, const Element<Dim>& element,
+                  const typename intermediates_tag::type& intermediates,
+                  const tnsr::aa<DataVector, Dim, frame>& pi,
+                  const tnsr::iaa<DataVector, Dim, frame>& phi,
+                  const Scalar<DataVector>& gamma2,
+                  const tnsr::a<DataVector, Dim, frame>& gauge_function,
+                  const tnsr::ab<DataVector, Dim, frame>&
+                      spacetime_deriv_gauge_function,
+                  Parallel::GlobalCache<Metavariables>& cache,
+                  const ArrayIndex& array_index,
+                  const ParallelComponent* const /*meta*/) const noexcept {
+    if (intermediates.time_step_id != time_step_id) {
+      ERROR("The intermediates of the time derivative were computed at "
+            << intermediates.time_step_id << ", but the constraints are "
+            << "observed at " << time_step_id
+            << ". ObserveConstraintNorms must be run by "
+               "Actions::RunEventsAndTriggersAfterDuDt.");
+    }
+
+    size_t number_of_points = 0;
+    LocalSquareNorms local_square_norms{};
+    if (is_selected(element.id())) {
+      const auto& temporaries = intermediates.temporaries;
+      const auto& partial_derivatives = intermediates.partial_derivatives;
+      Variables<constraint_tags> constraints{};
+      FusedConstraints<Dim>::apply(
+          make_not_null(&constraints), point_stride_,
+          get<gr::Tags::InverseSpatialMetric<Dim, frame, DataVector>>(
+              temporaries),
+          get<gr::Tags::DetSpatialMetric<DataVector>>(temporaries),
+          get<gr::Tags::InverseSpacetimeMetric<Dim, frame, DataVector>>(
+              temporaries),
+          get<gr::Tags::SpacetimeNormalVector<Dim, frame, DataVector>>(
+              temporaries),
+          get<gr::Tags::SpacetimeNormalOneForm<Dim, frame, DataVector>>(
+              temporaries),
+          get<Tags::GaugeConstraint<Dim, frame>>(temporaries),
+          get<Tags::ThreeIndexConstraint<Dim, frame>>(temporaries), pi, phi,
+          get<::Tags::deriv<Tags::Pi<Dim, frame>, tmpl::size_t<Dim>, frame>>(
+              partial_derivatives),
+          get<::Tags::deriv<Tags::Phi<Dim, frame>, tmpl::size_t<Dim>, frame>>(
+              partial_derivatives),
+          gamma2, gauge_function, spacetime_deriv_gauge_function);
+      number_of_points = constraints.number_of_grid_points();
+      tmpl::for_each<constraint_tags>(
+          [&constraints, &local_square_norms](auto tag_v) noexcept {
+            using tag = tmpl::type_from<decltype(tag_v)>;
+            double local_square_norm = 0.0;
+            for (const auto& component : get<tag>(constraints)) {
+              local_square_norm += alg::accumulate(square(component), 0.0);
+            }
+            get<ObserveConstraintNorms_detail::LocalSquareNorm<tag>>(
+                local_square_norms) = local_square_norm;
+          });
+    }
+
+    std::vector<std::string> reduction_names{
+        db::tag_name<ObservationValueTag>(), "NumberOfPoints"};
+    tmpl::for_each<constraint_tags>([&reduction_names](auto tag_v) noexcept {
+      using tag = tmpl::type_from<decltype(tag_v)>;
+      reduction_names.push_back("Norm(" + db::tag_name<tag>() + ")");
+    });
+
+    // Send data to reduction observer
+    auto& local_observer =
+        *Parallel::get_parallel_component<observers::Observer<Metavariables>>(
+             cache)
+             .ckLocalBranch();
+    Parallel::simple_action<observers::Actions::ContributeReductionData>(
+        local_observer,
+        observers::ObservationId(observation_value, subfile_path_ + ".dat"),
+        observers::ArrayComponentId{
+            std::add_pointer_t<ParallelComponent>{nullptr},
+            Parallel::ArrayIndex<ArrayIndex>(array_index)},
+        subfile_path_, reduction_names,
+        make_reduction_data(static_cast<double>(observation_value),
+                            number_of_points, std::move(local_square_norms)));
+  }
+
+  using observation_registration_tags = tmpl::list<>;
+  std::pair<observers::TypeOfObservation, observers::ObservationKey>
+  get_observation_type_and_key_for_registration() const noexcept {
+    return {observers::TypeOfObservation::Reduction,
+            observers::ObservationKey(subfile_path_ + ".dat")};
+  }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) override {
+    Event<EventRegistrars>::pup(p);
+    p | subfile_path_;
+    p | point_stride_;
+    p | element_stride_;
+  }
+
+ private:
+  bool is_selected(const ElementId<Dim>& element_id) const noexcept {
+    size_t element_index = element_id.block_id();
+    for (const auto& segment_id : element_id.segment_ids()) {
+      element_index += segment_id.index();
+    }
+    return element_index % element_stride_ == 0;
+  }
+
+  template <typename... ConstraintTags>
+  static ReductionData make_reduction_data(
+      const double observation_value, const size_t number_of_points,
+      tuples::TaggedTuple<
+          ObserveConstraintNorms_detail::LocalSquareNorm<ConstraintTags>...>&&
+          local_square_norms) noexcept {
+    return ReductionData{
+        observation_value, number_of_points,
+        std::move(
+            get<ObserveConstraintNorms_detail::LocalSquareNorm<ConstraintTags>>(
+                local_square_norms))...};
+  }
+
+  std::string subfile_path_;
+  size_t point_stride_{1};
+  size_t element_stride_{1};
+};
+
+template <size_t Dim, typename ObservationValueTag, typename EventRegistrars>
+ObserveConstraintNorms<Dim, ObservationValueTag, EventRegistrars>::
+    ObserveConstraintNorms(const std::string& subfile_name,
+                           const size_t point_stride,
+                           const size_t element_stride) noexcept
+    : subfile_path_("/" + subfile_name),
+      point_stride_(point_stride),
+      element_stride_(element_stride) {}
+
+/// \cond
+template <size_t Dim, typename ObservationValueTag, typename EventRegistrars>
+PUP::able::PUP_ID ObserveConstraintNorms<Dim, ObservationValueTag,
+                                         EventRegistrars>::my_PUP_ID =
+    0;  // NOLINT
+/// \endcond
+}  // namespace Events
+}  // namespace GeneralizedHarmonic
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <optional>
 #include <string>
 
 #include "DataStructures/DataBox/Prefixes.hpp"
@@ -10,8 +12,10 @@
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/TagsDeclarations.hpp"
 #include "Evolution/Tags.hpp"
+#include "Options/Auto.hpp"
 #include "Options/Options.hpp"
 #include "PointwiseFunctions/GeneralRelativity/TagsDeclarations.hpp"
+#include "Utilities/TMPL.hpp"
 
 class DataVector;
 
@@ -190,5 +194,39 @@ struct Group {
   static constexpr Options::String help{"Options for the GH evolution system"};
   using group = evolution::OptionTags::SystemGroup;
 };
+
+/*!
+ * \brief Number of grid points per block for the cache-blocked evaluation of
+ * the time derivative, or `None` to evaluate it over the whole element at once.
+ *
+ * \see GeneralizedHarmonic::TimeDerivative::apply_tiled
+ */
+struct TimeDerivativeBlockSize {
+  using type = Options::Auto<size_t, Options::AutoLabel::None>;
+  static constexpr Options::String help{
+      "Number of grid points per block when evaluating the time derivative "
+      "block by block, or 'None' to evaluate it over the whole element. A "
+      "multiple of 8 reproduces the unblocked result exactly."};
+  static type suggested_value() noexcept { return {}; }
+  using group = Group;
+};
 }  // namespace OptionTags
+
+namespace Tags {
+/*!
+ * \brief Number of grid points per block for the cache-blocked evaluation of
+ * the time derivative, or `std::nullopt` to evaluate it over the whole element
+ * at once.
+ */
+struct TimeDerivativeBlockSize : db::SimpleTag {
+  using type = std::optional<size_t>;
+  using option_tags =
+      tmpl::list<::GeneralizedHarmonic::OptionTags::TimeDerivativeBlockSize>;
+
+  static constexpr bool pass_metavariables = false;
+  static type create_from_options(const type& block_size) noexcept {
+    return block_size;
+  }
+};
+}  // namespace Tags
 }  // namespace GeneralizedHarmonic
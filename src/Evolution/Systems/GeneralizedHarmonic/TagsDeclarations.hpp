@@ -53,10 +53,12 @@ template <size_t SpatialDim, typename Frame>
 struct FourIndexConstraint;
 template <size_t SpatialDim, typename Frame>
 struct ConstraintEnergy;
+struct TimeDerivativeBlockSize;
 }  // namespace Tags
 
 /// \brief Input option tags for the generalized harmonic evolution system
 namespace OptionTags {
 struct Group;
+struct TimeDerivativeBlockSize;
 }  // namespace OptionTags
 }  // namespace GeneralizedHarmonic
@@ -3,10 +3,16 @@
 
 #include "Evolution/Systems/GeneralizedHarmonic/TimeDerivative.hpp"
 
+#include <algorithm>
 #include <cstddef>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "ErrorHandling/Assert.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/ConstraintDamping/Tags.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/DuDtTempTags.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/System.hpp"
@@ -24,6 +30,64 @@
 #include "Utilities/Gsl.hpp"
 
 /// \cond
+namespace {
+// Point the components of `view` at the grid points `[offset, offset + size)`
+// of the corresponding components of `tensor`. The `const_cast` is needed to
+// construct non-owning DataVectors, even though the views of the input
+// tensors are never written to.
+template <typename TensorType>
+void set_block_view(const gsl::not_null<TensorType*> view,
+                    const TensorType& tensor, const size_t offset,
+                    const size_t size) noexcept {
+  for (size_t storage_index = 0; storage_index < tensor.size();
+       ++storage_index) {
+    (*view)[storage_index].set_data_ref(
+        const_cast<double*>(tensor[storage_index].data()) +  // NOLINT
+            offset,
+        size);
+  }
+}
+
+template <size_t Dim, typename OutputTuple, typename InputTuple,
+          size_t... OutputIs, size_t... InputIs>
+void apply_tiled_impl(const size_t number_of_points_per_block,
+                      const OutputTuple& outputs, const InputTuple& inputs,
+                      std::index_sequence<OutputIs...> /*meta*/,
+                      std::index_sequence<InputIs...> /*meta*/) noexcept {
+  ASSERT(number_of_points_per_block > 0,
+         "The number of grid points per block must be positive.");
+  const size_t number_of_points = std::get<0>(inputs)[0].size();
+  const auto resize_output = [&number_of_points](auto& output) noexcept {
+    for (auto& component : *output) {
+      component.destructive_resize(number_of_points);
+    }
+    return nullptr;
+  };
+  expand_pack(resize_output(std::get<OutputIs>(outputs))...);
+
+  std::tuple<std::decay_t<decltype(*std::get<OutputIs>(outputs))>...>
+      output_views{};
+  std::tuple<std::decay_t<std::tuple_element_t<InputIs, InputTuple>>...>
+      input_views{};
+  for (size_t offset = 0; offset < number_of_points;
+       offset += number_of_points_per_block) {
+    const size_t block_size =
+        std::min(number_of_points_per_block, number_of_points - offset);
+    expand_pack(
+        (set_block_view(make_not_null(&std::get<OutputIs>(output_views)),
+                        *std::get<OutputIs>(outputs), offset, block_size),
+         nullptr)...);
+    expand_pack(
+        (set_block_view(make_not_null(&std::get<InputIs>(input_views)),
+                        std::get<InputIs>(inputs), offset, block_size),
+         nullptr)...);
+    GeneralizedHarmonic::TimeDerivative<Dim>::apply(
+        make_not_null(&std::get<OutputIs>(output_views))...,
+        std::get<InputIs>(input_views)...);
+  }
+}
+}  // namespace
+
 namespace GeneralizedHarmonic {
 template <size_t Dim>
 void TimeDerivative<Dim>::apply(
@@ -302,6 +366,147 @@ void TimeDerivative<Dim>::apply(
     }
   }
 }
+
+template <size_t Dim>
+void TimeDerivative<Dim>::apply_tiled(
+    const size_t number_of_points_per_block,
+    const gsl::not_null<tnsr::aa<DataVector, Dim>*> dt_spacetime_metric,
+    const gsl::not_null<tnsr::aa<DataVector, Dim>*> dt_pi,
+    const gsl::not_null<tnsr::iaa<DataVector, Dim>*> dt_phi,
+    const gsl::not_null<Scalar<DataVector>*> temp_gamma1,
+    const gsl::not_null<Scalar<DataVector>*> temp_gamma2,
+    const gsl::not_null<Scalar<DataVector>*> gamma1gamma2,
+    const gsl::not_null<Scalar<DataVector>*> pi_two_normals,
+    const gsl::not_null<Scalar<DataVector>*> normal_dot_gauge_constraint,
+    const gsl::not_null<Scalar<DataVector>*> gamma1_plus_1,
+    const gsl::not_null<tnsr::a<DataVector, Dim>*> pi_one_normal,
+    const gsl::not_null<tnsr::a<DataVector, Dim>*> gauge_constraint,
+    const gsl::not_null<tnsr::i<DataVector, Dim>*> phi_two_normals,
+    const gsl::not_null<tnsr::aa<DataVector, Dim>*>
+        shift_dot_three_index_constraint,
+    const gsl::not_null<tnsr::ia<DataVector, Dim>*> phi_one_normal,
+    const gsl::not_null<tnsr::aB<DataVector, Dim>*> pi_2_up,
+    const gsl::not_null<tnsr::iaa<DataVector, Dim>*> three_index_constraint,
+    const gsl::not_null<tnsr::Iaa<DataVector, Dim>*> phi_1_up,
+    const gsl::not_null<tnsr::iaB<DataVector, Dim>*> phi_3_up,
+    const gsl::not_null<tnsr::abC<DataVector, Dim>*>
+        christoffel_first_kind_3_up,
+    const gsl::not_null<Scalar<DataVector>*> lapse,
+    const gsl::not_null<tnsr::I<DataVector, Dim>*> shift,
+    const gsl::not_null<tnsr::ii<DataVector, Dim>*> spatial_metric,
+    const gsl::not_null<tnsr::II<DataVector, Dim>*> inverse_spatial_metric,
+    const gsl::not_null<Scalar<DataVector>*> det_spatial_metric,
+    const gsl::not_null<tnsr::AA<DataVector, Dim>*> inverse_spacetime_metric,
+    const gsl::not_null<tnsr::abb<DataVector, Dim>*> christoffel_first_kind,
+    const gsl::not_null<tnsr::Abb<DataVector, Dim>*> christoffel_second_kind,
+    const gsl::not_null<tnsr::a<DataVector, Dim>*> trace_christoffel,
+    const gsl::not_null<tnsr::A<DataVector, Dim>*> normal_spacetime_vector,
+    const gsl::not_null<tnsr::a<DataVector, Dim>*> normal_spacetime_one_form,
+    const gsl::not_null<tnsr::abb<DataVector, Dim>*> da_spacetime_metric,
+    const tnsr::iaa<DataVector, Dim>& d_spacetime_metric,
+    const tnsr::iaa<DataVector, Dim>& d_pi,
+    const tnsr::ijaa<DataVector, Dim>& d_phi,
+    const tnsr::aa<DataVector, Dim>& spacetime_metric,
+    const tnsr::aa<DataVector, Dim>& pi, const tnsr::iaa<DataVector, Dim>& phi,
+    const Scalar<DataVector>& gamma0, const Scalar<DataVector>& gamma1,
+    const Scalar<DataVector>& gamma2,
+    const tnsr::a<DataVector, Dim>& gauge_function,
+    const tnsr::ab<DataVector, Dim>& spacetime_deriv_gauge_function) noexcept {
+  apply_tiled_impl<Dim>(
+      number_of_points_per_block,
+      std::forward_as_tuple(dt_spacetime_metric, dt_pi, dt_phi, temp_gamma1,
+                            temp_gamma2, gamma1gamma2, pi_two_normals,
+                            normal_dot_gauge_constraint, gamma1_plus_1,
+                            pi_one_normal, gauge_constraint, phi_two_normals,
+                            shift_dot_three_index_constraint, phi_one_normal,
+                            pi_2_up, three_index_constraint, phi_1_up, phi_3_up,
+                            christoffel_first_kind_3_up, lapse, shift,
+                            spatial_metric, inverse_spatial_metric,
+                            det_spatial_metric, inverse_spacetime_metric,
+                            christoffel_first_kind, christoffel_second_kind,
+                            trace_christoffel, normal_spacetime_vector,
+                            normal_spacetime_one_form, da_spacetime_metric),
+      std::forward_as_tuple(d_spacetime_metric, d_pi, d_phi, spacetime_metric,
+                            pi, phi, gamma0, gamma1, gamma2, gauge_function,
+                            spacetime_deriv_gauge_function),
+      std::make_index_sequence<31>{}, std::make_index_sequence<11>{});
+}
+
+template <size_t Dim>
+void TimeDerivative<Dim>::apply(
+    const gsl::not_null<tnsr::aa<DataVector, Dim>*> dt_spacetime_metric,
+    const gsl::not_null<tnsr::aa<DataVector, Dim>*> dt_pi,
+    const gsl::not_null<tnsr::iaa<DataVector, Dim>*> dt_phi,
+    const gsl::not_null<Scalar<DataVector>*> temp_gamma1,
+    const gsl::not_null<Scalar<DataVector>*> temp_gamma2,
+    const gsl::not_null<Scalar<DataVector>*> gamma1gamma2,
+    const gsl::not_null<Scalar<DataVector>*> pi_two_normals,
+    const gsl::not_null<Scalar<DataVector>*> normal_dot_gauge_constraint,
+    const gsl::not_null<Scalar<DataVector>*> gamma1_plus_1,
+    const gsl::not_null<tnsr::a<DataVector, Dim>*> pi_one_normal,
+    const gsl::not_null<tnsr::a<DataVector, Dim>*> gauge_constraint,
+    const gsl::not_null<tnsr::i<DataVector, Dim>*> phi_two_normals,
+    const gsl::not_null<tnsr::aa<DataVector, Dim>*>
+        shift_dot_three_index_constraint,
+    const gsl::not_null<tnsr::ia<DataVector, Dim>*> phi_one_normal,
+    const gsl::not_null<tnsr::aB<DataVector, Dim>*> pi_2_up,
+    const gsl::not_null<tnsr::iaa<DataVector, Dim>*> three_index_constraint,
+    const gsl::not_null<tnsr::Iaa<DataVector, Dim>*> phi_1_up,
+    const gsl::not_null<tnsr::iaB<DataVector, Dim>*> phi_3_up,
+    const gsl::not_null<tnsr::abC<DataVector, Dim>*>
+        christoffel_first_kind_3_up,
+    const gsl::not_null<Scalar<DataVector>*> lapse,
+    const gsl::not_null<tnsr::I<DataVector, Dim>*> shift,
+    const gsl::not_null<tnsr::ii<DataVector, Dim>*> spatial_metric,
+    const gsl::not_null<tnsr::II<DataVector, Dim>*> inverse_spatial_metric,
+    const gsl::not_null<Scalar<DataVector>*> det_spatial_metric,
+    const gsl::not_null<tnsr::AA<DataVector, Dim>*> inverse_spacetime_metric,
+    const gsl::not_null<tnsr::abb<DataVector, Dim>*> christoffel_first_kind,
+    const gsl::not_null<tnsr::Abb<DataVector, Dim>*> christoffel_second_kind,
+    const gsl::not_null<tnsr::a<DataVector, Dim>*> trace_christoffel,
+    const gsl::not_null<tnsr::A<DataVector, Dim>*> normal_spacetime_vector,
+    const gsl::not_null<tnsr::a<DataVector, Dim>*> normal_spacetime_one_form,
+    const gsl::not_null<tnsr::abb<DataVector, Dim>*> da_spacetime_metric,
+    const tnsr::iaa<DataVector, Dim>& d_spacetime_metric,
+    const tnsr::iaa<DataVector, Dim>& d_pi,
+    const tnsr::ijaa<DataVector, Dim>& d_phi,
+    const tnsr::aa<DataVector, Dim>& spacetime_metric,
+    const tnsr::aa<DataVector, Dim>& pi, const tnsr::iaa<DataVector, Dim>& phi,
+    const Scalar<DataVector>& gamma0, const Scalar<DataVector>& gamma1,
+    const Scalar<DataVector>& gamma2,
+    const tnsr::a<DataVector, Dim>& gauge_function,
+    const tnsr::ab<DataVector, Dim>& spacetime_deriv_gauge_function,
+    const std::optional<size_t>& number_of_points_per_block) noexcept {
+  if (number_of_points_per_block.has_value()) {
+    apply_tiled(*number_of_points_per_block, dt_spacetime_metric, dt_pi, dt_phi,
+                temp_gamma1, temp_gamma2, gamma1gamma2, pi_two_normals,
+                normal_dot_gauge_constraint, gamma1_plus_1, pi_one_normal,
+                gauge_constraint, phi_two_normals,
+                shift_dot_three_index_constraint, phi_one_normal, pi_2_up,
+                three_index_constraint, phi_1_up, phi_3_up,
+                christoffel_first_kind_3_up, lapse, shift, spatial_metric,
+                inverse_spatial_metric, det_spatial_metric,
+                inverse_spacetime_metric, christoffel_first_kind,
+                christoffel_second_kind, trace_christoffel,
+                normal_spacetime_vector, normal_spacetime_one_form,
+                da_spacetime_metric, d_spacetime_metric, d_pi, d_phi,
+                spacetime_metric, pi, phi, gamma0, gamma1, gamma2,
+                gauge_function, spacetime_deriv_gauge_function);
+  } else {
+    apply(dt_spacetime_metric, dt_pi, dt_phi, temp_gamma1, temp_gamma2,
+          gamma1gamma2, pi_two_normals, normal_dot_gauge_constraint,
+          gamma1_plus_1, pi_one_normal, gauge_constraint, phi_two_normals,
+          shift_dot_three_index_constraint, phi_one_normal, pi_2_up,
+          three_index_constraint, phi_1_up, phi_3_up,
+          christoffel_first_kind_3_up, lapse, shift, spatial_metric,
+          inverse_spatial_metric, det_spatial_metric, inverse_spacetime_metric,
+          christoffel_first_kind, christoffel_second_kind, trace_christoffel,
+          normal_spacetime_vector, normal_spacetime_one_form,
+          da_spacetime_metric, d_spacetime_metric, d_pi, d_phi,
+          spacetime_metric, pi, phi, gamma0, gamma1, gamma2, gauge_function,
+          spacetime_deriv_gauge_function);
+  }
+}
 }  // namespace GeneralizedHarmonic
 
 // Explicit instantiations of structs defined in `Equations.cpp` as well as of
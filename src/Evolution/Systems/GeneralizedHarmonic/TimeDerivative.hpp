@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cstddef>
+#include <optional>
 
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/ConstraintDamping/Tags.hpp"
@@ -79,6 +80,14 @@ namespace GeneralizedHarmonic {
  * \f$\gamma_3\f$, \f$\gamma_4\f$, and \f$\gamma_5\f$ have units of inverse time
  * and control the time scales on which the constraints are damped to zero.
  *
+ * The temporaries include the gauge and three-index constraints and the
+ * inverse metrics and normal vectors. If
+ * `evolution::dg::Tags::TimeDerivativeIntermediates` is in the DataBox, they
+ * are kept there together with the partial derivatives of the evolved
+ * variables, and `GeneralizedHarmonic::Events::ObserveConstraintNorms` passes
+ * them to `GeneralizedHarmonic::FusedConstraints` to evaluate the constraints
+ * without recomputing them.
+ *
  * \note We have not coded up the constraint damping terms for \f$\gamma_3\f$,
  * \f$\gamma_4\f$, and \f$\gamma_5\f$. \f$\gamma_3\f$ was found to be essential
  * for evolutions of black strings by Pretorius and Lehner \cite Lehner2010pn.
@@ -116,7 +125,8 @@ struct TimeDerivative {
       ::GeneralizedHarmonic::ConstraintDamping::Tags::ConstraintGamma0,
       ::GeneralizedHarmonic::ConstraintDamping::Tags::ConstraintGamma1,
       ::GeneralizedHarmonic::ConstraintDamping::Tags::ConstraintGamma2,
-      Tags::GaugeH<Dim>, Tags::SpacetimeDerivGaugeH<Dim>>;
+      Tags::GaugeH<Dim>, Tags::SpacetimeDerivGaugeH<Dim>,
+      Tags::TimeDerivativeBlockSize>;
 
   static void apply(
       gsl::not_null<tnsr::aa<DataVector, Dim>*> dt_spacetime_metric,
@@ -160,5 +170,119 @@ struct TimeDerivative {
       const Scalar<DataVector>& gamma1, const Scalar<DataVector>& gamma2,
       const tnsr::a<DataVector, Dim>& gauge_function,
       const tnsr::ab<DataVector, Dim>& spacetime_deriv_gauge_function) noexcept;
+
+  /*!
+   * \brief Same as `apply`, but evaluates the right-hand side block by block
+   * over contiguous ranges of `number_of_points_per_block` grid points.
+   *
+   * \details For every block, non-owning `DataVector`s are pointed into the
+   * storage of the arguments and `apply` is invoked on the block. Since all
+   * temporaries of a block fit in cache for a suitably chosen block size, each
+   * of the many component loops in `apply` reads its operands from cache
+   * rather than streaming full-element vectors from main memory, which
+   * dominates the cost on high-resolution elements.
+   *
+   * The outputs and temporaries are resized to the number of grid points if
+   * necessary, so they may be passed in as default-constructed tensors or as
+   * references into a `Variables`. Every grid point is computed by exactly the
+   * same sequence of operations as in `apply`. The results are bit-identical
+   * to those of `apply` as long as `number_of_points_per_block` is a multiple
+   * of the SIMD width (any multiple of 8 suffices), because then the same grid
+   * points fall into the vectorized and scalar-remainder parts of each loop.
+   */
+  static void apply_tiled(
+      size_t number_of_points_per_block,
+      gsl::not_null<tnsr::aa<DataVector, Dim>*> dt_spacetime_metric,
+      gsl::not_null<tnsr::aa<DataVector, Dim>*> dt_pi,
+      gsl::not_null<tnsr::iaa<DataVector, Dim>*> dt_phi,
+      gsl::not_null<Scalar<DataVector>*> temp_gamma1,
+      gsl::not_null<Scalar<DataVector>*> temp_gamma2,
+      gsl::not_null<Scalar<DataVector>*> gamma1gamma2,
+      gsl::not_null<Scalar<DataVector>*> pi_two_normals,
+      gsl::not_null<Scalar<DataVector>*> normal_dot_gauge_constraint,
+      gsl::not_null<Scalar<DataVector>*> gamma1_plus_1,
+      gsl::not_null<tnsr::a<DataVector, Dim>*> pi_one_normal,
+      gsl::not_null<tnsr::a<DataVector, Dim>*> gauge_constraint,
+      gsl::not_null<tnsr::i<DataVector, Dim>*> phi_two_normals,
+      gsl::not_null<tnsr::aa<DataVector, Dim>*>
+          shift_dot_three_index_constraint,
+      gsl::not_null<tnsr::ia<DataVector, Dim>*> phi_one_normal,
+      gsl::not_null<tnsr::aB<DataVector, Dim>*> pi_2_up,
+      gsl::not_null<tnsr::iaa<DataVector, Dim>*> three_index_constraint,
+      gsl::not_null<tnsr::Iaa<DataVector, Dim>*> phi_1_up,
+      gsl::not_null<tnsr::iaB<DataVector, Dim>*> phi_3_up,
+      gsl::not_null<tnsr::abC<DataVector, Dim>*> christoffel_first_kind_3_up,
+      gsl::not_null<Scalar<DataVector>*> lapse,
+      gsl::not_null<tnsr::I<DataVector, Dim>*> shift,
+      gsl::not_null<tnsr::ii<DataVector, Dim>*> spatial_metric,
+      gsl::not_null<tnsr::II<DataVector, Dim>*> inverse_spatial_metric,
+      gsl::not_null<Scalar<DataVector>*> det_spatial_metric,
+      gsl::not_null<tnsr::AA<DataVector, Dim>*> inverse_spacetime_metric,
+      gsl::not_null<tnsr::abb<DataVector, Dim>*> christoffel_first_kind,
+      gsl::not_null<tnsr::Abb<DataVector, Dim>*> christoffel_second_kind,
+      gsl::not_null<tnsr::a<DataVector, Dim>*> trace_christoffel,
+      gsl::not_null<tnsr::A<DataVector, Dim>*> normal_spacetime_vector,
+      gsl::not_null<tnsr::a<DataVector, Dim>*> normal_spacetime_one_form,
+      gsl::not_null<tnsr::abb<DataVector, Dim>*> da_spacetime_metric,
+      const tnsr::iaa<DataVector, Dim>& d_spacetime_metric,
+      const tnsr::iaa<DataVector, Dim>& d_pi,
+      const tnsr::ijaa<DataVector, Dim>& d_phi,
+      const tnsr::aa<DataVector, Dim>& spacetime_metric,
+      const tnsr::aa<DataVector, Dim>& pi,
+      const tnsr::iaa<DataVector, Dim>& phi, const Scalar<DataVector>& gamma0,
+      const Scalar<DataVector>& gamma1, const Scalar<DataVector>& gamma2,
+      const tnsr::a<DataVector, Dim>& gauge_function,
+      const tnsr::ab<DataVector, Dim>& spacetime_deriv_gauge_function) noexcept;
+
+  /*!
+   * \brief Evaluates the right-hand side with `apply_tiled` if
+   * `number_of_points_per_block` holds a value and with `apply` otherwise.
+   *
+   * \details This is the overload the DG action calls. The block size is
+   * selected with the `TimeDerivativeBlockSize` input file option.
+   */
+  static void apply(
+      gsl::not_null<tnsr::aa<DataVector, Dim>*> dt_spacetime_metric,
+      gsl::not_null<tnsr::aa<DataVector, Dim>*> dt_pi,
+      gsl::not_null<tnsr::iaa<DataVector, Dim>*> dt_phi,
+      gsl::not_null<Scalar<DataVector>*> temp_gamma1,
+      gsl::not_null<Scalar<DataVector>*> temp_gamma2,
+      gsl::not_null<Scalar<DataVector>*> gamma1gamma2,
+      gsl::not_null<Scalar<DataVector>*> pi_two_normals,
+      gsl::not_null<Scalar<DataVector>*> normal_dot_gauge_constraint,
+      gsl::not_null<Scalar<DataVector>*> gamma1_plus_1,
+      gsl::not_null<tnsr::a<DataVector, Dim>*> pi_one_normal,
+      gsl::not_null<tnsr::a<DataVector, Dim>*> gauge_constraint,
+      gsl::not_null<tnsr::i<DataVector, Dim>*> phi_two_normals,
+      gsl::not_null<tnsr::aa<DataVector, Dim>*>
+          shift_dot_three_index_constraint,
+      gsl::not_null<tnsr::ia<DataVector, Dim>*> phi_one_normal,
+      gsl::not_null<tnsr::aB<DataVector, Dim>*> pi_2_up,
+      gsl::not_null<tnsr::iaa<DataVector, Dim>*> three_index_constraint,
+      gsl::not_null<tnsr::Iaa<DataVector, Dim>*> phi_1_up,
+      gsl::not_null<tnsr::iaB<DataVector, Dim>*> phi_3_up,
+      gsl::not_null<tnsr::abC<DataVector, Dim>*> christoffel_first_kind_3_up,
+      gsl::not_null<Scalar<DataVector>*> lapse,
+      gsl::not_null<tnsr::I<DataVector, Dim>*> shift,
+      gsl::not_null<tnsr::ii<DataVector, Dim>*> spatial_metric,
+      gsl::not_null<tnsr::II<DataVector, Dim>*> inverse_spatial_metric,
+      gsl::not_null<Scalar<DataVector>*> det_spatial_metric,
+      gsl::not_null<tnsr::AA<DataVector, Dim>*> inverse_spacetime_metric,
+      gsl::not_null<tnsr::abb<DataVector, Dim>*> christoffel_first_kind,
+      gsl::not_null<tnsr::Abb<DataVector, Dim>*> christoffel_second_kind,
+      gsl::not_null<tnsr::a<DataVector, Dim>*> trace_christoffel,
+      gsl::not_null<tnsr::A<DataVector, Dim>*> normal_spacetime_vector,
+      gsl::not_null<tnsr::a<DataVector, Dim>*> normal_spacetime_one_form,
+      gsl::not_null<tnsr::abb<DataVector, Dim>*> da_spacetime_metric,
+      const tnsr::iaa<DataVector, Dim>& d_spacetime_metric,
+      const tnsr::iaa<DataVector, Dim>& d_pi,
+      const tnsr::ijaa<DataVector, Dim>& d_phi,
+      const tnsr::aa<DataVector, Dim>& spacetime_metric,
+      const tnsr::aa<DataVector, Dim>& pi,
+      const tnsr::iaa<DataVector, Dim>& phi, const Scalar<DataVector>& gamma0,
+      const Scalar<DataVector>& gamma1, const Scalar<DataVector>& gamma2,
+      const tnsr::a<DataVector, Dim>& gauge_function,
+      const tnsr::ab<DataVector, Dim>& spacetime_deriv_gauge_function,
+      const std::optional<size_t>& number_of_points_per_block) noexcept;
 };
 }  // namespace GeneralizedHarmonic
@@ -10,9 +10,11 @@
 #include <utility>
 
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tags/TempTensor.hpp"
 #include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
+#include "ErrorHandling/Error.hpp"
 #include "NumericalAlgorithms/RootFinding/NewtonRaphson.hpp"
 #include "PointwiseFunctions/GeneralRelativity/IndexManipulation.hpp"
 #include "PointwiseFunctions/Hydro/Tags.hpp"
@@ -227,7 +229,7 @@ void compute_closure_impl(
             (square(e_fluid * local_zeta) - h_sqr) / square(e_pt),
             (2. * e_fluid * de_fluid_dzeta * square(local_zeta) +
              2. * square(e_fluid) * local_zeta - d_thin_dzeta * dh_sqr_dd_thin -
-             d_thin_dzeta * dh_sqr_dd_thick) /
+             d_thick_dzeta * dh_sqr_dd_thick) /
                 square(e_pt));
       };
       const double& zeta = get(*closure_factor)[s];
@@ -258,13 +260,13 @@ void compute_closure_impl(
       get(*comoving_momentum_density_normal)[s] =
           h_0_t + h_thin_t * d_thin + h_thick_t * d_thick;
       for (size_t i = 0; i < spatial_dim; i++) {
-        comoving_momentum_density_spatial->get(i) =
+        comoving_momentum_density_spatial->get(i)[s] =
             -(h_0_v + h_thin_v * d_thin + h_thick_v * d_thick) * v_m.get(i)[s] -
             (h_0_f + h_thin_f * d_thin + h_thick_f * d_thick) *
                 momentum_density.get(i)[s];
         for (size_t j = i; j < spatial_dim; j++) {
           // Optically thin part of pressure tensor
-          pressure_tensor->get(i, j) = d_thin * e_pt *
+          pressure_tensor->get(i, j)[s] = d_thin * e_pt *
                                        momentum_density.get(i)[s] *
                                        momentum_density.get(j)[s] / s_sqr_pt;
         }
@@ -281,7 +283,7 @@ void compute_closure_impl(
           ((2. * w_sqr_pt - 1.) * e_pt - 2. * w_sqr_pt * v_dot_f_pt);
       for (size_t i = 0; i < spatial_dim; i++) {
         for (size_t j = i; j < spatial_dim; j++) {
-          pressure_tensor->get(i, j) +=
+          pressure_tensor->get(i, j)[s] +=
               d_thick * (J_over_3 * (4. * w_sqr_pt * fluid_velocity.get(i)[s] *
                                          fluid_velocity.get(j)[s] +
                                      inv_spatial_metric.get(i, j)[s]) +
@@ -293,4 +295,299 @@ void compute_closure_impl(
   }
 }
 
+void compute_closure_multi_group_impl(
+    const gsl::span<const gsl::not_null<Scalar<DataVector>*>> closure_factor,
+    const gsl::span<
+        const gsl::not_null<tnsr::II<DataVector, 3, Frame::Inertial>*>>
+        pressure_tensor,
+    const gsl::span<const gsl::not_null<Scalar<DataVector>*>>
+        comoving_energy_density,
+    const gsl::span<const gsl::not_null<Scalar<DataVector>*>>
+        comoving_momentum_density_normal,
+    const gsl::span<
+        const gsl::not_null<tnsr::i<DataVector, 3, Frame::Inertial>*>>
+        comoving_momentum_density_spatial,
+    const gsl::span<const Scalar<DataVector>* const> energy_density,
+    const gsl::span<const tnsr::i<DataVector, 3, Frame::Inertial>* const>
+        momentum_density,
+    const tnsr::I<DataVector, 3, Frame::Inertial>& fluid_velocity,
+    const Scalar<DataVector>& fluid_lorentz_factor,
+    const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric,
+    const tnsr::II<DataVector, 3, Frame::Inertial>&
+        inv_spatial_metric) noexcept {
+  // The parameters are the same as in `compute_closure_impl`
+  static constexpr double avoid_divisions_by_zero = 1.e-150;
+  static constexpr double small_velocity = 1.e-15;
+  constexpr size_t spatial_dim = 3;
+  constexpr double root_find_tolerance = 1.e-6;
+  constexpr double root_find_lower_bound = 1.e-15;
+  constexpr size_t root_find_max_iterations = 50;
+  const size_t number_of_species = closure_factor.size();
+  const size_t number_of_points = get(fluid_lorentz_factor).size();
+  const size_t number_of_lanes = number_of_species * number_of_points;
+
+  // Fluid quantities at each grid point. Where the fluid velocity is small we
+  // set it to zero, which reduces the closure computed below to the v=0
+  // closure without branching on the velocity.
+  Variables<tmpl::list<::Tags::TempScalar<0>, ::Tags::TempScalar<1>,
+                       ::Tags::TempScalar<2>, ::Tags::TempI<3, 3>,
+                       ::Tags::Tempi<4, 3>, ::Tags::TempI<5, 3>,
+                       ::Tags::TempI<6, 3>>>
+      point_buffer(number_of_points);
+  DataVector& is_moving = get(get<::Tags::TempScalar<0>>(point_buffer));
+  DataVector& w_pt = get(get<::Tags::TempScalar<1>>(point_buffer));
+  DataVector& w_sqr_pt = get(get<::Tags::TempScalar<2>>(point_buffer));
+  auto& v_M = get<::Tags::TempI<3, 3>>(point_buffer);
+  auto& v_m = get<::Tags::Tempi<4, 3>>(point_buffer);
+  // S^i and the optically thick H^i of one species at a time
+  auto& s_M = get<::Tags::TempI<5, 3>>(point_buffer);
+  auto& h_thick_M = get<::Tags::TempI<6, 3>>(point_buffer);
+  w_sqr_pt = square(get(fluid_lorentz_factor));
+  is_moving = step_function(1. - 1. / w_sqr_pt - small_velocity);
+  w_sqr_pt = 1. + is_moving * (w_sqr_pt - 1.);
+  w_pt = 1. + is_moving * (get(fluid_lorentz_factor) - 1.);
+  for (size_t i = 0; i < spatial_dim; ++i) {
+    v_M.get(i) = is_moving * fluid_velocity.get(i);
+  }
+  raise_or_lower_index(make_not_null(&v_m), v_M, spatial_metric);
+
+  // Quantities at each (species, grid point) pair, or lane, stored species
+  // after species. The names follow `compute_closure_impl`.
+  Variables<tmpl::list<
+      ::Tags::TempScalar<0>, ::Tags::TempScalar<1>, ::Tags::TempScalar<2>,
+      ::Tags::TempScalar<3>, ::Tags::TempScalar<4>, ::Tags::TempScalar<5>,
+      ::Tags::TempScalar<6>, ::Tags::TempScalar<7>, ::Tags::TempScalar<8>,
+      ::Tags::TempScalar<9>, ::Tags::TempScalar<10>, ::Tags::TempScalar<11>,
+      ::Tags::TempScalar<12>, ::Tags::TempScalar<13>, ::Tags::TempScalar<14>,
+      ::Tags::TempScalar<15>, ::Tags::TempScalar<16>, ::Tags::TempScalar<17>,
+      ::Tags::TempScalar<18>, ::Tags::TempScalar<19>, ::Tags::TempScalar<20>,
+      ::Tags::TempScalar<21>, ::Tags::TempScalar<22>, ::Tags::TempScalar<23>,
+      ::Tags::TempScalar<24>, ::Tags::TempScalar<25>, ::Tags::TempScalar<26>,
+      ::Tags::TempScalar<27>, ::Tags::TempScalar<28>, ::Tags::TempScalar<29>,
+      ::Tags::TempScalar<30>>>
+      lanes(number_of_lanes);
+  DataVector& e = get(get<::Tags::TempScalar<0>>(lanes));
+  DataVector& s_sqr = get(get<::Tags::TempScalar<1>>(lanes));
+  DataVector& v_dot_f = get(get<::Tags::TempScalar<2>>(lanes));
+  DataVector& w = get(get<::Tags::TempScalar<3>>(lanes));
+  DataVector& w_sqr = get(get<::Tags::TempScalar<4>>(lanes));
+  DataVector& v_sqr = get(get<::Tags::TempScalar<5>>(lanes));
+  DataVector& j_0 = get(get<::Tags::TempScalar<6>>(lanes));
+  DataVector& j_thin = get(get<::Tags::TempScalar<7>>(lanes));
+  DataVector& j_thick = get(get<::Tags::TempScalar<8>>(lanes));
+  DataVector& h_0_t = get(get<::Tags::TempScalar<9>>(lanes));
+  DataVector& h_0_v = get(get<::Tags::TempScalar<10>>(lanes));
+  DataVector& h_0_f = get(get<::Tags::TempScalar<11>>(lanes));
+  DataVector& h_thin_t = get(get<::Tags::TempScalar<12>>(lanes));
+  const DataVector& h_thin_v = h_thin_t;
+  DataVector& h_thin_f = get(get<::Tags::TempScalar<13>>(lanes));
+  DataVector& h_thick_t = get(get<::Tags::TempScalar<14>>(lanes));
+  DataVector& h_thick_v = get(get<::Tags::TempScalar<15>>(lanes));
+  DataVector& h_thick_f = get(get<::Tags::TempScalar<16>>(lanes));
+  DataVector& h_sqr_0 = get(get<::Tags::TempScalar<17>>(lanes));
+  DataVector& h_sqr_thin = get(get<::Tags::TempScalar<18>>(lanes));
+  DataVector& h_sqr_thick = get(get<::Tags::TempScalar<19>>(lanes));
+  DataVector& h_sqr_thin_thick = get(get<::Tags::TempScalar<20>>(lanes));
+  DataVector& h_sqr_thick_thick = get(get<::Tags::TempScalar<21>>(lanes));
+  DataVector& h_sqr_thin_thin = get(get<::Tags::TempScalar<22>>(lanes));
+  DataVector& zeta = get(get<::Tags::TempScalar<23>>(lanes));
+  DataVector& zeta_new = get(get<::Tags::TempScalar<24>>(lanes));
+  DataVector& active = get(get<::Tags::TempScalar<25>>(lanes));
+  DataVector& residual = get(get<::Tags::TempScalar<26>>(lanes));
+  DataVector& d_residual_dzeta = get(get<::Tags::TempScalar<27>>(lanes));
+  DataVector& d_thin = get(get<::Tags::TempScalar<28>>(lanes));
+  DataVector& d_thick = get(get<::Tags::TempScalar<29>>(lanes));
+  DataVector& e_fluid = get(get<::Tags::TempScalar<30>>(lanes));
+
+  // Non-owning view of the lanes of one species
+  const auto species_lanes = [&number_of_points](
+                                 DataVector& lane_vector,
+                                 const size_t species) noexcept {
+    return DataVector(lane_vector.data() + species * number_of_points,
+                      number_of_points);
+  };
+
+  // Gather the moments of all species, and the fluid quantities for each of
+  // them. Lanes where the fluid velocity is small start out converged.
+  for (size_t species = 0; species < number_of_species; ++species) {
+    const auto& momentum = *momentum_density[species];
+    raise_or_lower_index(make_not_null(&s_M), momentum, inv_spatial_metric);
+    DataVector s_sqr_species = species_lanes(s_sqr, species);
+    DataVector v_dot_f_species = species_lanes(v_dot_f, species);
+    s_sqr_species = 0.;
+    v_dot_f_species = 0.;
+    for (size_t m = 0; m < spatial_dim; ++m) {
+      s_sqr_species += s_M.get(m) * momentum.get(m);
+      v_dot_f_species += v_M.get(m) * momentum.get(m);
+    }
+    species_lanes(e, species) = get(*energy_density[species]);
+    species_lanes(w, species) = w_pt;
+    species_lanes(w_sqr, species) = w_sqr_pt;
+    species_lanes(active, species) = is_moving;
+    species_lanes(zeta, species) = get(*closure_factor[species]);
+  }
+  s_sqr += step_function(avoid_divisions_by_zero - s_sqr) *
+           (avoid_divisions_by_zero - s_sqr);
+  v_sqr = 1. - 1. / w_sqr;
+
+  // Decomposition of the fluid-frame moments into parts that are independent
+  // of zeta, see `compute_closure_impl`
+  j_0 = w_sqr * (e - 2. * v_dot_f);
+  j_thin = w_sqr * e * square(v_dot_f) / s_sqr;
+  j_thick = (w_sqr - 1.) / (1. + 2. * w_sqr) *
+            (4. * w_sqr * v_dot_f + e * (3. - 2. * w_sqr));
+  h_0_t = w * (j_0 + v_dot_f - e);
+  h_0_v = w * j_0;
+  h_0_f = -w;
+  h_thin_t = w * j_thin;
+  h_thin_f = w * e * v_dot_f / s_sqr;
+  h_thick_t = w * j_thick;
+  h_thick_v = h_thick_t + w / (2. * w_sqr + 1.) *
+                              ((3. - 2. * w_sqr) * e +
+                               (2. * w_sqr - 1.) * v_dot_f);
+  h_thick_f = w * v_sqr;
+  h_sqr_0 = -square(h_0_t) + square(h_0_v) * v_sqr + square(h_0_f) * s_sqr +
+            2. * h_0_v * h_0_f * v_dot_f;
+  h_sqr_thin =
+      2. * (h_0_v * h_thin_v * v_sqr + h_0_f * h_thin_f * s_sqr +
+            h_0_v * h_thin_f * v_dot_f + h_0_f * h_thin_v * v_dot_f -
+            h_0_t * h_thin_t);
+  h_sqr_thick =
+      2. * (h_0_v * h_thick_v * v_sqr + h_0_f * h_thick_f * s_sqr +
+            h_0_v * h_thick_f * v_dot_f + h_0_f * h_thick_v * v_dot_f -
+            h_0_t * h_thick_t);
+  h_sqr_thin_thick =
+      2. * (h_thin_v * h_thick_v * v_sqr + h_thin_f * h_thick_f * s_sqr +
+            h_thin_v * h_thick_f * v_dot_f + h_thin_f * h_thick_v * v_dot_f -
+            h_thin_t * h_thick_t);
+  h_sqr_thick_thick = square(h_thick_v) * v_sqr + square(h_thick_f) * s_sqr +
+                      2. * h_thick_v * h_thick_f * v_dot_f - square(h_thick_t);
+  h_sqr_thin_thin = square(h_thin_v) * v_sqr + square(h_thin_f) * s_sqr +
+                    2. * h_thin_v * h_thin_f * v_dot_f - square(h_thin_t);
+
+  // Initial guess for root finding: the previous value if it is in range, or
+  // else the value for zero velocity, which is also the solution in the lanes
+  // where the fluid velocity is small.
+  zeta_new = sqrt(s_sqr) / e;
+  zeta += (step_function(avoid_divisions_by_zero - zeta) +
+           step_function(zeta - 1.)) *
+          (zeta_new - zeta);
+  zeta += (1. - active) * (zeta_new - zeta);
+  // Test the edge values zeta=0 and zeta=1 first
+  residual = step_function(
+      root_find_tolerance -
+      abs(h_sqr_0 + h_sqr_thick + h_sqr_thick_thick) / square(e));
+  d_residual_dzeta =
+      (1. - residual) *
+      step_function(root_find_tolerance -
+                    abs(square(j_0 + j_thin) - h_sqr_0 - h_sqr_thin -
+                        h_sqr_thin_thin) /
+                        square(e));
+  zeta += active * (d_residual_dzeta - (residual + d_residual_dzeta) * zeta);
+  active *= 1. - residual - d_residual_dzeta;
+
+  // Newton-Raphson iterations on all lanes at once. Every lane is evaluated in
+  // each iteration, but only lanes that have not converged yet are updated.
+  for (size_t iteration = 0; max(active) > 0.; ++iteration) {
+    if (iteration == root_find_max_iterations) {
+      ERROR("The M1 closure did not converge in "
+            << root_find_max_iterations << " iterations for "
+            << std::count(active.begin(), active.end(), 1.) << " of "
+            << number_of_lanes << " species and grid points.");
+    }
+    // Minerbo closure, see `minerbo_closure_function`
+    d_thin = square(zeta) * (0.6 - 0.2 * zeta + 0.6 * square(zeta));
+    d_thick = 1. - d_thin;
+    e_fluid = j_0 + j_thin * d_thin + j_thick * d_thick;
+    residual = (square(e_fluid * zeta) - h_sqr_0 - h_sqr_thick * d_thick -
+                h_sqr_thin * d_thin - h_sqr_thin_thin * square(d_thin) -
+                h_sqr_thick_thick * square(d_thick) -
+                h_sqr_thin_thick * d_thin * d_thick) /
+               square(e);
+    // The derivative of d_thin with respect to zeta is
+    // 0.6 * zeta * (2 - zeta + 4 * zeta^2), and that of d_thick is its negative
+    d_residual_dzeta =
+        (2. * e_fluid * zeta *
+             (e_fluid + (j_thin - j_thick) * square(zeta) * 0.6 *
+                            (2. - zeta + 4. * square(zeta))) -
+         0.6 * zeta * (2. - zeta + 4. * square(zeta)) *
+             (h_sqr_thin - h_sqr_thick +
+              (2. * h_sqr_thin_thin - h_sqr_thin_thick) * d_thin +
+              (h_sqr_thin_thick - 2. * h_sqr_thick_thick) * d_thick)) /
+        square(e);
+    zeta_new = zeta - residual * d_residual_dzeta /
+                          (square(d_residual_dzeta) + avoid_divisions_by_zero);
+    // Steps that leave the interval [root_find_lower_bound, 1] go half way to
+    // its boundary instead
+    zeta_new += step_function(root_find_lower_bound - zeta_new) *
+                    (0.5 * (zeta + root_find_lower_bound) - zeta_new) +
+                step_function(zeta_new - 1.) * (0.5 * (zeta + 1.) - zeta_new);
+    // Lanes that converge in this iteration
+    residual = active * step_function(root_find_tolerance * zeta_new -
+                                      abs(zeta_new - zeta));
+    zeta += active * (zeta_new - zeta);
+    active -= residual;
+  }
+
+  // Assemble the output quantities on all lanes, reusing the buffers of the
+  // root finding
+  d_thin = square(zeta) * (0.6 - 0.2 * zeta + 0.6 * square(zeta));
+  d_thick = 1. - d_thin;
+  e_fluid = j_0 + j_thin * d_thin + j_thick * d_thick;
+  DataVector& h_normal = residual;
+  h_normal = h_0_t + h_thin_t * d_thin + h_thick_t * d_thick;
+  // H_a = -h_v v_a - h_f F_a for the spatial components
+  DataVector& h_v = d_residual_dzeta;
+  h_v = h_0_v + h_thin_v * d_thin + h_thick_v * d_thick;
+  DataVector& h_f = zeta_new;
+  h_f = h_0_f + h_thin_f * d_thin + h_thick_f * d_thick;
+  // Prefactors of the optically thin and optically thick pressure tensors
+  DataVector& d_thin_e_over_s_sqr = active;
+  d_thin_e_over_s_sqr = d_thin * e / s_sqr;
+  DataVector& j_over_3 = j_0;
+  j_over_3 =
+      ((2. * w_sqr - 1.) * e - 2. * w_sqr * v_dot_f) / (2. * w_sqr + 1.);
+
+  // Scatter the results to the species
+  for (size_t species = 0; species < number_of_species; ++species) {
+    const auto& momentum = *momentum_density[species];
+    const DataVector zeta_species = species_lanes(zeta, species);
+    const DataVector e_species = species_lanes(e, species);
+    const DataVector v_dot_f_species = species_lanes(v_dot_f, species);
+    const DataVector e_fluid_species = species_lanes(e_fluid, species);
+    const DataVector h_normal_species = species_lanes(h_normal, species);
+    const DataVector h_v_species = species_lanes(h_v, species);
+    const DataVector h_f_species = species_lanes(h_f, species);
+    const DataVector d_thick_species = species_lanes(d_thick, species);
+    const DataVector d_thin_e_over_s_sqr_species =
+        species_lanes(d_thin_e_over_s_sqr, species);
+    const DataVector j_over_3_species = species_lanes(j_over_3, species);
+
+    get(*closure_factor[species]) = zeta_species;
+    get(*comoving_energy_density[species]) = e_fluid_species;
+    get(*comoving_momentum_density_normal[species]) = h_normal_species;
+    raise_or_lower_index(make_not_null(&s_M), momentum, inv_spatial_metric);
+    for (size_t i = 0; i < spatial_dim; ++i) {
+      comoving_momentum_density_spatial[species]->get(i) =
+          -h_v_species * v_m.get(i) - h_f_species * momentum.get(i);
+      h_thick_M.get(i) =
+          s_M.get(i) / w_pt +
+          v_M.get(i) * w_pt / (2. * w_sqr_pt + 1.) *
+              ((4. * w_sqr_pt + 1.) * v_dot_f_species -
+               4. * w_sqr_pt * e_species);
+    }
+    for (size_t i = 0; i < spatial_dim; ++i) {
+      for (size_t j = i; j < spatial_dim; ++j) {
+        pressure_tensor[species]->get(i, j) =
+            d_thin_e_over_s_sqr_species * momentum.get(i) * momentum.get(j) +
+            d_thick_species *
+                (j_over_3_species * (4. * w_sqr_pt * v_M.get(i) * v_M.get(j) +
+                                     inv_spatial_metric.get(i, j)) +
+                 w_pt * (h_thick_M.get(i) * v_M.get(j) +
+                         h_thick_M.get(j) * v_M.get(i)));
+      }
+    }
+  }
+}
+
 }  // namespace RadiationTransport::M1Grey::detail
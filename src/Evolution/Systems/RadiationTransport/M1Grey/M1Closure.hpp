@@ -6,6 +6,9 @@
 
 #pragma once
 
+#include <array>
+#include <cstddef>
+
 #include "DataStructures/Tensor/TypeAliases.hpp"  // IWYU pragma: keep
 #include "Evolution/Systems/RadiationTransport/M1Grey/Tags.hpp"  // IWYU pragma: keep
 #include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
@@ -39,10 +42,33 @@ void compute_closure_impl(
     const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric,
     const tnsr::II<DataVector, 3, Frame::Inertial>&
         inv_spatial_metric) noexcept;
+
+// Implementation of the M1 closure for all species at once, each entry of the
+// spans holding the moments of one species
+void compute_closure_multi_group_impl(
+    gsl::span<const gsl::not_null<Scalar<DataVector>*>> closure_factor,
+    gsl::span<const gsl::not_null<tnsr::II<DataVector, 3, Frame::Inertial>*>>
+        pressure_tensor,
+    gsl::span<const gsl::not_null<Scalar<DataVector>*>> comoving_energy_density,
+    gsl::span<const gsl::not_null<Scalar<DataVector>*>>
+        comoving_momentum_density_normal,
+    gsl::span<const gsl::not_null<tnsr::i<DataVector, 3, Frame::Inertial>*>>
+        comoving_momentum_density_spatial,
+    gsl::span<const Scalar<DataVector>* const> energy_density,
+    gsl::span<const tnsr::i<DataVector, 3, Frame::Inertial>* const>
+        momentum_density,
+    const tnsr::I<DataVector, 3, Frame::Inertial>& fluid_velocity,
+    const Scalar<DataVector>& fluid_lorentz_factor,
+    const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric,
+    const tnsr::II<DataVector, 3, Frame::Inertial>&
+        inv_spatial_metric) noexcept;
 }  // namespace detail
 
 template <typename NeutrinoSpeciesList>
 struct ComputeM1Closure;
+
+template <typename NeutrinoSpeciesList>
+struct ComputeM1ClosureMultiGroup;
 /*!
  * Compute the 2nd moment of the neutrino distribution function
  * in the inertial frame (pressure tensor) from the 0th (energy density)
@@ -153,5 +179,75 @@ struct ComputeM1Closure<tmpl::list<NeutrinoSpecies...>> {
   }
 };
 
+/*!
+ * Compute the M1 closure of all neutrino species at once.
+ *
+ * This computes the same quantities as `ComputeM1Closure`, but instead of
+ * looping over the grid points of each species in turn it treats every
+ * (species, grid point) pair as one lane of a single vector, so the
+ * root-finding for the closure factor \f$\xi\f$ runs on all lanes together in
+ * vectorized DataVector operations. Each Newton-Raphson iteration updates
+ * only the lanes that have not yet converged, and the iteration ends once
+ * all lanes have converged. The decomposition of the fluid-frame moments that
+ * is independent of \f$\xi\f$ is also computed for all lanes at once. Where
+ * the fluid velocity is small enough for `ComputeM1Closure` to use the
+ * \f$v=0\f$ closure, the velocity is set to zero in the decomposition instead
+ * of branching, which reduces it to the \f$v=0\f$ closure.
+ *
+ * Since the cost of the closure grows with the number of species, this is
+ * the closure of choice for multi-group schemes that evolve each neutrino
+ * species in several energy bins (see `neutrinos::energy_groups` and
+ * `RadiationTransport::M1Grey::MultiGroupSystem`).
+ */
+template <typename... NeutrinoSpecies>
+struct ComputeM1ClosureMultiGroup<tmpl::list<NeutrinoSpecies...>> {
+  using return_tags =
+      typename ComputeM1Closure<tmpl::list<NeutrinoSpecies...>>::return_tags;
+  using argument_tags =
+      typename ComputeM1Closure<tmpl::list<NeutrinoSpecies...>>::argument_tags;
+
+  static void apply(
+      const gsl::not_null<typename Tags::ClosureFactor<
+          NeutrinoSpecies>::type*>... closure_factor,
+      const gsl::not_null<typename Tags::TildeP<
+          Frame::Inertial, NeutrinoSpecies>::type*>... tilde_p,
+      const gsl::not_null<
+          typename Tags::TildeJ<NeutrinoSpecies>::type*>... tilde_j,
+      const gsl::not_null<
+          typename Tags::TildeHNormal<NeutrinoSpecies>::type*>... tilde_hn,
+      const gsl::not_null<typename Tags::TildeHSpatial<
+          Frame::Inertial, NeutrinoSpecies>::type*>... tilde_hi,
+      const typename Tags::TildeE<Frame::Inertial,
+                                  NeutrinoSpecies>::type&... tilde_e,
+      const typename Tags::TildeS<Frame::Inertial,
+                                  NeutrinoSpecies>::type&... tilde_s,
+      const tnsr::I<DataVector, 3>& spatial_velocity,
+      const Scalar<DataVector>& lorentz_factor,
+      const tnsr::ii<DataVector, 3>& spatial_metric,
+      const tnsr::II<DataVector, 3>& inv_spatial_metric) noexcept {
+    constexpr size_t number_of_species = sizeof...(NeutrinoSpecies);
+    const std::array<gsl::not_null<Scalar<DataVector>*>, number_of_species>
+        closure_factors{{closure_factor...}};
+    const std::array<gsl::not_null<tnsr::II<DataVector, 3>*>,
+                     number_of_species>
+        tilde_ps{{tilde_p...}};
+    const std::array<gsl::not_null<Scalar<DataVector>*>, number_of_species>
+        tilde_js{{tilde_j...}};
+    const std::array<gsl::not_null<Scalar<DataVector>*>, number_of_species>
+        tilde_hns{{tilde_hn...}};
+    const std::array<gsl::not_null<tnsr::i<DataVector, 3>*>,
+                     number_of_species>
+        tilde_his{{tilde_hi...}};
+    const std::array<const Scalar<DataVector>*, number_of_species> tilde_es{
+        {&tilde_e...}};
+    const std::array<const tnsr::i<DataVector, 3>*, number_of_species>
+        tilde_ss{{&tilde_s...}};
+    detail::compute_closure_multi_group_impl(
+        closure_factors, tilde_ps, tilde_js, tilde_hns, tilde_his, tilde_es,
+        tilde_ss, spatial_velocity, lorentz_factor, spatial_metric,
+        inv_spatial_metric);
+  }
+};
+
 }  // namespace M1Grey
 }  // namespace RadiationTransport
@@ -9,6 +9,7 @@
 #include "DataStructures/VariablesTag.hpp"
 #include "Evolution/Systems/RadiationTransport/M1Grey/Characteristics.hpp"
 #include "Evolution/Systems/RadiationTransport/M1Grey/Fluxes.hpp"
+#include "Evolution/Systems/RadiationTransport/M1Grey/M1Closure.hpp"
 #include "Evolution/Systems/RadiationTransport/M1Grey/Sources.hpp"
 #include "Evolution/Systems/RadiationTransport/M1Grey/Tags.hpp"
 #include "Evolution/Systems/RadiationTransport/M1Grey/TimeDerivativeTerms.hpp"
@@ -83,6 +84,7 @@ struct System<tmpl::list<NeutrinoSpecies...>> {
       TimeDerivativeTerms<NeutrinoSpecies...>;
   using volume_fluxes = ComputeFluxes<NeutrinoSpecies...>;
   using volume_sources = ComputeSources<NeutrinoSpecies...>;
+  using m1_closure = ComputeM1Closure<tmpl::list<NeutrinoSpecies...>>;
 
   using char_speeds_compute_tag = Tags::CharacteristicSpeedsCompute;
   using char_speeds_tag = Tags::CharacteristicSpeeds;
@@ -91,5 +93,17 @@ struct System<tmpl::list<NeutrinoSpecies...>> {
   using magnitude_tag = ::Tags::NonEuclideanMagnitude<
       Tag, gr::Tags::InverseSpatialMetric<3, Frame::Inertial, DataVector>>;
 };
+
+/*!
+ * \brief The M1 system for many neutrino species, e.g. each species in
+ * several energy bins (see `neutrinos::energy_groups`)
+ *
+ * The equations are those of `System`, but the closure of all species is
+ * computed at once by `ComputeM1ClosureMultiGroup`.
+ */
+template <typename NeutrinoSpeciesList>
+struct MultiGroupSystem : System<NeutrinoSpeciesList> {
+  using m1_closure = ComputeM1ClosureMultiGroup<NeutrinoSpeciesList>;
+};
 }  // namespace M1Grey
 }  // namespace RadiationTransport
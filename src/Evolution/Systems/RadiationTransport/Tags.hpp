@@ -5,8 +5,10 @@
 
 #include <cstddef>
 #include <string>
+#include <utility>
 
 #include "Utilities/PrettyType.hpp"
+#include "Utilities/TMPL.hpp"
 
 #define MAX_NUMBER_OF_NEUTRINO_ENERGY_BINS 12
 
@@ -31,4 +33,22 @@ std::string get_name(const U<EnergyBin>& /*species*/) noexcept {
   return pretty_type::short_name<U<EnergyBin>>() + std::to_string(EnergyBin);
 }
 
+namespace detail {
+template <template <size_t> class U, typename EnergyBins>
+struct energy_groups_impl;
+
+template <template <size_t> class U, size_t... EnergyBins>
+struct energy_groups_impl<U, std::index_sequence<EnergyBins...>> {
+  static_assert(sizeof...(EnergyBins) <= MAX_NUMBER_OF_NEUTRINO_ENERGY_BINS,
+                "Too many neutrino energy bins.");
+  using type = tmpl::list<U<EnergyBins>...>;
+};
+}  // namespace detail
+
+/// The list of the species `U` in each of the energy bins `0, 1, ...,
+/// NumberOfEnergyBins - 1`, e.g. to evolve a multi-group scheme
+template <template <size_t> class U, size_t NumberOfEnergyBins>
+using energy_groups = typename detail::energy_groups_impl<
+    U, std::make_index_sequence<NumberOfEnergyBins>>::type;
+
 }  // namespace neutrinos
@@ -35,6 +35,28 @@ template <typename T>
 constexpr bool is_analytic_solution_v =
     std::is_convertible_v<T*, MarkAsAnalyticSolution*>;
 
+// @{
+/// \ingroup AnalyticSolutionsGroup
+/// Check if the analytic solution or data `T` is marked as independent of
+/// time with a `static constexpr bool is_time_independent = true` member.
+///
+/// Quantities computed from a time-independent solution depend only on the
+/// coordinates at which it is evaluated, so they can be reused at later times.
+/// For example, `dg::Actions::ImposeDirichletBoundaryConditions` reuses the
+/// boundary data of external faces whose coordinates have not changed.
+template <typename T, typename = std::void_t<>>
+struct is_time_independent : std::false_type {};
+
+/// \cond
+template <typename T>
+struct is_time_independent<T, std::void_t<decltype(T::is_time_independent)>>
+    : std::bool_constant<T::is_time_independent> {};
+/// \endcond
+
+template <typename T>
+constexpr bool is_time_independent_v = is_time_independent<T>::value;
+// @}
+
 // @{
 /// Helper metafunction that checks if the class `T` is marked as numeric
 /// initial data.
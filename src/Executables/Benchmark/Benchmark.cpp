@@ -5,11 +5,15 @@
 #pragma GCC diagnostic ignored "-Wredundant-decls"
 #include <benchmark/benchmark.h>
 #pragma GCC diagnostic pop
+#include <cstddef>
 #include <string>
 #include <vector>
 
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Expressions/AddSubtract.hpp"
+#include "DataStructures/Tensor/Expressions/Evaluate.hpp"
+#include "DataStructures/Tensor/Expressions/TensorExpression.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Domain/CoordinateMaps/Affine.hpp"
@@ -19,10 +23,17 @@
 #include "Domain/CoordinateMaps/ProductMaps.tpp"
 #include "Domain/LogicalCoordinates.hpp"
 #include "Domain/Structure/Element.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/TimeDerivative.hpp"
+#include "Evolution/Systems/RadiationTransport/M1Grey/M1Closure.hpp"
+#include "Evolution/Systems/RadiationTransport/M1Grey/Tags.hpp"
+#include "Evolution/Systems/RadiationTransport/Tags.hpp"
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.tpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "PointwiseFunctions/MathFunctions/PowX.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
 
 // Charm looks for this function but since we build without a main function or
 // main module we just have it be empty
@@ -107,6 +118,343 @@ void bench_all_gradient(benchmark::State& state) {  // NOLINT
 BENCHMARK(bench_all_gradient);  // NOLINT
 }  // namespace
 
+namespace {
+// In this anonymous namespace the three-index constraint
+// C_{iab} = \partial_i \psi_{ab} - \Phi_{iab}, as computed in the hand-written
+// component loop of `GeneralizedHarmonic::TimeDerivative`, is compared to
+// evaluating the same equation with tensor expressions, both into a newly
+// constructed Tensor and in place into an existing Tensor.
+constexpr size_t gh_dim = 3;
+using GhTensor = tnsr::iaa<DataVector, gh_dim, Frame::Inertial>;
+
+template <typename F>
+void bench_three_index_constraint(benchmark::State& state,  // NOLINT
+                                  const F& compute) noexcept {
+  const size_t number_of_grid_points =
+      cube(static_cast<size_t>(state.range(0)));
+  GhTensor d_spacetime_metric{number_of_grid_points};
+  GhTensor phi{number_of_grid_points};
+  for (size_t i = 0; i < phi.size(); ++i) {
+    d_spacetime_metric[i] = static_cast<double>(i) + 0.5;
+    phi[i] = 2.0 * static_cast<double>(i) - 1.0;
+  }
+  GhTensor three_index_constraint{number_of_grid_points};
+  while (state.KeepRunning()) {
+    compute(make_not_null(&three_index_constraint), d_spacetime_metric, phi);
+    benchmark::DoNotOptimize(three_index_constraint);
+  }
+}
+
+// clang-tidy: don't pass be non-const reference
+void bench_three_index_constraint_loops(benchmark::State& state) {  // NOLINT
+  bench_three_index_constraint(
+      state, [](const gsl::not_null<GhTensor*> three_index_constraint,
+                const GhTensor& d_spacetime_metric,
+                const GhTensor& phi) noexcept {
+        for (size_t n = 0; n < gh_dim; ++n) {
+          for (size_t mu = 0; mu < gh_dim + 1; ++mu) {
+            for (size_t nu = mu; nu < gh_dim + 1; ++nu) {
+              three_index_constraint->get(n, mu, nu) =
+                  d_spacetime_metric.get(n, mu, nu) - phi.get(n, mu, nu);
+            }
+          }
+        }
+      });
+}
+BENCHMARK(bench_three_index_constraint_loops)  // NOLINT
+    ->Arg(4)->Arg(8)->Arg(12);
+
+// clang-tidy: don't pass be non-const reference
+void bench_three_index_constraint_te_return(  // NOLINT
+    benchmark::State& state) {
+  bench_three_index_constraint(
+      state, [](const gsl::not_null<GhTensor*> three_index_constraint,
+                const GhTensor& d_spacetime_metric,
+                const GhTensor& phi) noexcept {
+        *three_index_constraint =
+            TensorExpressions::evaluate<ti_i, ti_a, ti_b>(
+                d_spacetime_metric(ti_i, ti_a, ti_b) - phi(ti_i, ti_a, ti_b));
+      });
+}
+BENCHMARK(bench_three_index_constraint_te_return)  // NOLINT
+    ->Arg(4)->Arg(8)->Arg(12);
+
+// clang-tidy: don't pass be non-const reference
+void bench_three_index_constraint_te_in_place(  // NOLINT
+    benchmark::State& state) {
+  bench_three_index_constraint(
+      state, [](const gsl::not_null<GhTensor*> three_index_constraint,
+                const GhTensor& d_spacetime_metric,
+                const GhTensor& phi) noexcept {
+        TensorExpressions::evaluate<ti_i, ti_a, ti_b>(
+            three_index_constraint,
+            d_spacetime_metric(ti_i, ti_a, ti_b) - phi(ti_i, ti_a, ti_b));
+      });
+}
+BENCHMARK(bench_three_index_constraint_te_in_place)  // NOLINT
+    ->Arg(4)->Arg(8)->Arg(12);
+
+// The complete hand-written `GeneralizedHarmonic::TimeDerivative` on the same
+// grids, for comparison with the pieces of it evaluated above with tensor
+// expressions. The tensor expression library has no contracted products yet,
+// so the full right-hand side cannot be written as tensor expressions. The
+// inputs are a perturbed Minkowski spacetime so that the metric is invertible.
+struct GhTimeDerivativeInputs {
+  explicit GhTimeDerivativeInputs(const size_t number_of_grid_points) noexcept
+      : d_spacetime_metric{number_of_grid_points},
+        d_pi{number_of_grid_points},
+        d_phi{number_of_grid_points},
+        spacetime_metric{number_of_grid_points},
+        pi{number_of_grid_points},
+        phi{number_of_grid_points},
+        gamma0{number_of_grid_points, 1.0},
+        gamma1{number_of_grid_points, -1.0},
+        gamma2{number_of_grid_points, 1.0},
+        gauge_function{number_of_grid_points},
+        spacetime_deriv_gauge_function{number_of_grid_points} {
+    const auto fill = [&number_of_grid_points](auto& tensor,
+                                               const double scale) noexcept {
+      for (size_t i = 0; i < tensor.size(); ++i) {
+        for (size_t s = 0; s < number_of_grid_points; ++s) {
+          tensor[i][s] = scale * static_cast<double>((i + 3 * s) % 7);
+        }
+      }
+    };
+    fill(d_spacetime_metric, 1.0e-3);
+    fill(d_pi, 2.0e-3);
+    fill(d_phi, 3.0e-3);
+    fill(spacetime_metric, 1.0e-3);
+    fill(pi, 2.0e-3);
+    fill(phi, 3.0e-3);
+    fill(gauge_function, 1.0e-3);
+    fill(spacetime_deriv_gauge_function, 2.0e-3);
+    get<0, 0>(spacetime_metric) -= 1.0;
+    for (size_t i = 1; i < gh_dim + 1; ++i) {
+      spacetime_metric.get(i, i) += 1.0;
+    }
+  }
+
+  tnsr::iaa<DataVector, gh_dim> d_spacetime_metric;
+  tnsr::iaa<DataVector, gh_dim> d_pi;
+  tnsr::ijaa<DataVector, gh_dim> d_phi;
+  tnsr::aa<DataVector, gh_dim> spacetime_metric;
+  tnsr::aa<DataVector, gh_dim> pi;
+  tnsr::iaa<DataVector, gh_dim> phi;
+  Scalar<DataVector> gamma0;
+  Scalar<DataVector> gamma1;
+  Scalar<DataVector> gamma2;
+  tnsr::a<DataVector, gh_dim> gauge_function;
+  tnsr::ab<DataVector, gh_dim> spacetime_deriv_gauge_function;
+};
+
+template <bool Tiled, typename... TemporaryTags>
+void bench_gh_time_derivative_impl(benchmark::State& state,  // NOLINT
+                                   tmpl::list<TemporaryTags...> /*meta*/) {
+  const size_t number_of_grid_points =
+      cube(static_cast<size_t>(state.range(0)));
+  const GhTimeDerivativeInputs inputs{number_of_grid_points};
+  tnsr::aa<DataVector, gh_dim> dt_spacetime_metric{number_of_grid_points};
+  tnsr::aa<DataVector, gh_dim> dt_pi{number_of_grid_points};
+  tnsr::iaa<DataVector, gh_dim> dt_phi{number_of_grid_points};
+  Variables<tmpl::list<TemporaryTags...>> temporaries{number_of_grid_points};
+  const auto compute = [&state](const auto&... args) noexcept {
+    if constexpr (Tiled) {
+      GeneralizedHarmonic::TimeDerivative<gh_dim>::apply_tiled(
+          static_cast<size_t>(state.range(1)), args...);
+    } else {
+      GeneralizedHarmonic::TimeDerivative<gh_dim>::apply(args...);
+    }
+  };
+  while (state.KeepRunning()) {
+    compute(make_not_null(&dt_spacetime_metric), make_not_null(&dt_pi),
+            make_not_null(&dt_phi),
+            make_not_null(&get<TemporaryTags>(temporaries))...,
+            inputs.d_spacetime_metric, inputs.d_pi, inputs.d_phi,
+            inputs.spacetime_metric, inputs.pi, inputs.phi, inputs.gamma0,
+            inputs.gamma1, inputs.gamma2, inputs.gauge_function,
+            inputs.spacetime_deriv_gauge_function);
+    benchmark::DoNotOptimize(dt_pi);
+  }
+}
+
+// clang-tidy: don't pass be non-const reference
+void bench_gh_time_derivative(benchmark::State& state) {  // NOLINT
+  bench_gh_time_derivative_impl<false>(
+      state, GeneralizedHarmonic::TimeDerivative<gh_dim>::temporary_tags{});
+}
+BENCHMARK(bench_gh_time_derivative)  // NOLINT
+    ->Arg(4)->Arg(8)->Arg(12);
+
+// The same right-hand side evaluated block by block with
+// `GeneralizedHarmonic::TimeDerivative::apply_tiled`, as selected by the
+// `TimeDerivativeBlockSize` option. The second argument is the number of grid
+// points per block.
+// clang-tidy: don't pass be non-const reference
+void bench_gh_time_derivative_tiled(benchmark::State& state) {  // NOLINT
+  bench_gh_time_derivative_impl<true>(
+      state, GeneralizedHarmonic::TimeDerivative<gh_dim>::temporary_tags{});
+}
+BENCHMARK(bench_gh_time_derivative_tiled)  // NOLINT
+    ->Args({4, 64})
+    ->Args({8, 64})
+    ->Args({8, 256})
+    ->Args({12, 64})
+    ->Args({12, 256});
+
+// The sum L_{ba} = R_{ab} + S_{ab} of two non-symmetric rank 2 tensors, which
+// requires reordering the components on the LHS.
+using TransposeTensor = tnsr::ab<DataVector, gh_dim, Frame::Inertial>;
+
+template <typename F>
+void bench_transposed_sum(benchmark::State& state,  // NOLINT
+                          const F& compute) noexcept {
+  const size_t number_of_grid_points =
+      cube(static_cast<size_t>(state.range(0)));
+  TransposeTensor r{number_of_grid_points};
+  TransposeTensor s{number_of_grid_points};
+  for (size_t i = 0; i < r.size(); ++i) {
+    r[i] = static_cast<double>(i) + 0.5;
+    s[i] = 2.0 * static_cast<double>(i) - 1.0;
+  }
+  TransposeTensor l{number_of_grid_points};
+  while (state.KeepRunning()) {
+    compute(make_not_null(&l), r, s);
+    benchmark::DoNotOptimize(l);
+  }
+}
+
+// clang-tidy: don't pass be non-const reference
+void bench_transposed_sum_loops(benchmark::State& state) {  // NOLINT
+  bench_transposed_sum(state, [](const gsl::not_null<TransposeTensor*> l,
+                                 const TransposeTensor& r,
+                                 const TransposeTensor& s) noexcept {
+    for (size_t a = 0; a < gh_dim + 1; ++a) {
+      for (size_t b = 0; b < gh_dim + 1; ++b) {
+        l->get(b, a) = r.get(a, b) + s.get(a, b);
+      }
+    }
+  });
+}
+BENCHMARK(bench_transposed_sum_loops)  // NOLINT
+    ->Arg(4)->Arg(8)->Arg(12);
+
+// clang-tidy: don't pass be non-const reference
+void bench_transposed_sum_te_in_place(benchmark::State& state) {  // NOLINT
+  bench_transposed_sum(state, [](const gsl::not_null<TransposeTensor*> l,
+                                 const TransposeTensor& r,
+                                 const TransposeTensor& s) noexcept {
+    TensorExpressions::evaluate<ti_b, ti_a>(l, r(ti_a, ti_b) + s(ti_a, ti_b));
+  });
+}
+BENCHMARK(bench_transposed_sum_te_in_place)  // NOLINT
+    ->Arg(4)->Arg(8)->Arg(12);
+}  // namespace
+
+namespace {
+// In this anonymous namespace the M1 closure of electron neutrinos in several
+// energy groups is computed for a moving fluid, either species by species and
+// point by point with `RadiationTransport::M1Grey::ComputeM1Closure`, or for
+// all species and points at once with `ComputeM1ClosureMultiGroup`. The
+// template parameters are the closure and the number of energy groups, the
+// argument is the number of grid points per dimension. The closure factors of
+// the previous iteration serve as initial guess, as during an evolution.
+template <template <typename> class Closure, typename... Species>
+void bench_m1_closure_impl(benchmark::State& state,  // NOLINT
+                           tmpl::list<Species...> /*meta*/) {
+  using closure = Closure<tmpl::list<Species...>>;
+  const size_t number_of_grid_points =
+      cube(static_cast<size_t>(state.range(0)));
+  tnsr::I<DataVector, 3> fluid_velocity{number_of_grid_points};
+  Scalar<DataVector> lorentz_factor{number_of_grid_points, 0.};
+  tnsr::ii<DataVector, 3> spatial_metric{number_of_grid_points, 0.};
+  tnsr::II<DataVector, 3> inv_spatial_metric{number_of_grid_points, 0.};
+  for (size_t i = 0; i < 3; ++i) {
+    for (size_t s = 0; s < number_of_grid_points; ++s) {
+      fluid_velocity.get(i)[s] =
+          0.05 * static_cast<double>((i + 3 * s) % 7) + 0.01;
+    }
+    get(lorentz_factor) += square(fluid_velocity.get(i));
+    spatial_metric.get(i, i) = 1.;
+    inv_spatial_metric.get(i, i) = 1.;
+  }
+  get(lorentz_factor) = 1. / sqrt(1. - get(lorentz_factor));
+
+  Variables<tmpl::list<
+      RadiationTransport::M1Grey::Tags::TildeE<Frame::Inertial, Species>...,
+      RadiationTransport::M1Grey::Tags::TildeS<Frame::Inertial, Species>...>>
+      moments{number_of_grid_points};
+  const auto fill = [&moments, &number_of_grid_points](auto species) noexcept {
+    using species_type = decltype(species);
+    auto& energy_density =
+        get(get<RadiationTransport::M1Grey::Tags::TildeE<Frame::Inertial,
+                                                         species_type>>(
+            moments));
+    auto& momentum_density = get<
+        RadiationTransport::M1Grey::Tags::TildeS<Frame::Inertial,
+                                                 species_type>>(moments);
+    for (size_t s = 0; s < number_of_grid_points; ++s) {
+      energy_density[s] =
+          1. + 0.1 * static_cast<double>(species_type::energy_bin);
+      // Flux factors between 0 and 0.9
+      const double flux_factor =
+          0.15 * static_cast<double>((species_type::energy_bin + s) % 7);
+      for (size_t i = 0; i < 3; ++i) {
+        momentum_density.get(i)[s] =
+            flux_factor * energy_density[s] / sqrt(3.) *
+            (i == 1 ? -1. : 1.);
+      }
+    }
+  };
+  EXPAND_PACK_LEFT_TO_RIGHT(fill(Species{}));
+  Variables<typename closure::return_tags> closure_variables{
+      number_of_grid_points, -1.};
+
+  while (state.KeepRunning()) {
+    closure::apply(
+        make_not_null(
+            &get<RadiationTransport::M1Grey::Tags::ClosureFactor<Species>>(
+                closure_variables))...,
+        make_not_null(&get<RadiationTransport::M1Grey::Tags::TildeP<
+                          Frame::Inertial, Species>>(closure_variables))...,
+        make_not_null(
+            &get<RadiationTransport::M1Grey::Tags::TildeJ<Species>>(
+                closure_variables))...,
+        make_not_null(
+            &get<RadiationTransport::M1Grey::Tags::TildeHNormal<Species>>(
+                closure_variables))...,
+        make_not_null(&get<RadiationTransport::M1Grey::Tags::TildeHSpatial<
+                          Frame::Inertial, Species>>(closure_variables))...,
+        get<RadiationTransport::M1Grey::Tags::TildeE<Frame::Inertial,
+                                                     Species>>(moments)...,
+        get<RadiationTransport::M1Grey::Tags::TildeS<Frame::Inertial,
+                                                     Species>>(moments)...,
+        fluid_velocity, lorentz_factor, spatial_metric, inv_spatial_metric);
+    benchmark::DoNotOptimize(closure_variables);
+  }
+}
+
+// clang-tidy: don't pass be non-const reference
+template <template <typename> class Closure, size_t NumberOfEnergyBins>
+void bench_m1_closure(benchmark::State& state) {  // NOLINT
+  bench_m1_closure_impl<Closure>(
+      state, neutrinos::energy_groups<neutrinos::ElectronNeutrinos,
+                                      NumberOfEnergyBins>{});
+}
+
+BENCHMARK_TEMPLATE2(bench_m1_closure,  // NOLINT
+                    RadiationTransport::M1Grey::ComputeM1Closure, 1)
+    ->Arg(6)->Arg(10);
+BENCHMARK_TEMPLATE2(bench_m1_closure,  // NOLINT
+                    RadiationTransport::M1Grey::ComputeM1ClosureMultiGroup, 1)
+    ->Arg(6)->Arg(10);
+BENCHMARK_TEMPLATE2(bench_m1_closure,  // NOLINT
+                    RadiationTransport::M1Grey::ComputeM1Closure, 8)
+    ->Arg(6)->Arg(10);
+BENCHMARK_TEMPLATE2(bench_m1_closure,  // NOLINT
+                    RadiationTransport::M1Grey::ComputeM1ClosureMultiGroup, 8)
+    ->Arg(6)->Arg(10);
+}  // namespace
+
 // Ignore the warning about an extra ';' because some versions of benchmark
 // require it
 #pragma GCC diagnostic push
@@ -1,17 +1,124 @@
 // Distributed under the MIT License.
 // See LICENSE.txt for details.
 
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
+#include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/TensorData.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/File.hpp"
 #include "IO/H5/VolumeData.hpp"
+#include "Utilities/Algorithm.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+#include "Utilities/MakeString.hpp"
 
 namespace py = pybind11;
 
 namespace py_bindings {
+namespace {
+// The contiguous intervals of grid points that hold the grids `grid_names` (or
+// all grids if not given) at `observation_id`, in the order they are stored.
+// Adjacent grids are merged into a single interval.
+std::vector<std::pair<size_t, size_t>> selected_offsets_and_lengths(
+    const h5::VolumeData& volume_file, const size_t observation_id,
+    const std::optional<std::vector<std::string>>& grid_names) {
+  const auto all_grid_names = volume_file.get_grid_names(observation_id);
+  const auto all_extents = volume_file.get_extents(observation_id);
+  std::vector<std::pair<size_t, size_t>> offsets_and_lengths{};
+  size_t offset = 0;
+  for (size_t i = 0; i < all_grid_names.size(); ++i) {
+    const size_t length =
+        alg::accumulate(all_extents[i], 1_st, std::multiplies<>{});
+    if (not grid_names.has_value() or
+        alg::found(*grid_names, all_grid_names[i])) {
+      if (not offsets_and_lengths.empty() and
+          offsets_and_lengths.back().first +
+                  offsets_and_lengths.back().second ==
+              offset) {
+        offsets_and_lengths.back().second += length;
+      } else {
+        offsets_and_lengths.emplace_back(offset, length);
+      }
+    }
+    offset += length;
+  }
+  return offsets_and_lengths;
+}
+
+// Read the `tensor_components` at each of the `observation_ids` from all
+// `volume_files` into a NumPy array of shape (observations, components,
+// points). The grid points of the files are concatenated in order. The data
+// is read from disk directly into the buffer of the array, which takes
+// ownership of it, so it is never copied.
+py::array_t<double> read_tensor_components(
+    const std::vector<const h5::VolumeData*>& volume_files,
+    const std::vector<size_t>& observation_ids,
+    const std::vector<std::string>& tensor_components,
+    const std::optional<std::vector<std::string>>& grid_names) {
+  std::vector<std::vector<std::vector<std::pair<size_t, size_t>>>> selections(
+      observation_ids.size());
+  size_t number_of_points = 0;
+  for (size_t i = 0; i < observation_ids.size(); ++i) {
+    size_t number_of_points_in_observation = 0;
+    for (const auto* volume_file : volume_files) {
+      selections[i].push_back(selected_offsets_and_lengths(
+          *volume_file, observation_ids[i], grid_names));
+      for (const auto& offset_and_length : selections[i].back()) {
+        number_of_points_in_observation += offset_and_length.second;
+      }
+    }
+    if (i == 0) {
+      number_of_points = number_of_points_in_observation;
+    } else if (number_of_points_in_observation != number_of_points) {
+      throw std::runtime_error(MakeString{}
+                               << "Observation id " << observation_ids[i]
+                               << " has " << number_of_points_in_observation
+                               << " selected grid points, but observation id "
+                               << observation_ids[0] << " has "
+                               << number_of_points);
+    }
+  }
+
+  const size_t number_of_components = tensor_components.size();
+  auto buffer = std::make_unique<double[]>(  // NOLINT
+      observation_ids.size() * number_of_components * number_of_points);
+  for (size_t i = 0; i < observation_ids.size(); ++i) {
+    size_t offset_in_observation = 0;
+    for (size_t j = 0; j < volume_files.size(); ++j) {
+      if (selections[i][j].empty()) {
+        continue;
+      }
+      offset_in_observation += volume_files[j]->read_tensor_components(
+          make_not_null(buffer.get() + i * number_of_components *
+                                           number_of_points +
+                        offset_in_observation),
+          number_of_points, observation_ids[i], tensor_components,
+          selections[i][j]);
+    }
+  }
+
+  double* const data = buffer.release();
+  const py::capsule owner(data, [](void* const p) noexcept {
+    delete[] static_cast<double*>(p);  // NOLINT
+  });
+  return py::array_t<double>(
+      std::vector<size_t>{observation_ids.size(), number_of_components,
+                          number_of_points},
+      data, owner);
+}
+}  // namespace
+
 void bind_h5vol(py::module& m) {  // NOLINT
   // Wrapper for basic H5VolumeData operations
   py::class_<h5::VolumeData>(m, "H5Vol")
@@ -28,6 +135,20 @@ void bind_h5vol(py::module& m) {  // NOLINT
            py::arg("observation_id"))
       .def("get_tensor_component", &h5::VolumeData::get_tensor_component,
            py::arg("observation_id"), py::arg("tensor_component"))
+      .def(
+          "get_tensor_components",
+          [](const h5::VolumeData& volume_file,
+             const std::vector<size_t>& observation_ids,
+             const std::vector<std::string>& tensor_components,
+             const std::optional<std::vector<std::string>>& grid_names) {
+            return read_tensor_components({&volume_file}, observation_ids,
+                                          tensor_components, grid_names);
+          },
+          py::arg("observation_ids"), py::arg("tensor_components"),
+          py::arg("grid_names") = std::nullopt,
+          "Read the tensor components at the observation ids into a NumPy "
+          "array of shape (observations, components, points). If grid_names "
+          "is given, only the data of these grids is read.")
       .def("get_extents", &h5::VolumeData::get_extents,
            py::arg("observation_id"))
       .def("get_quadratures", &h5::VolumeData::get_quadratures,
@@ -36,5 +157,31 @@ void bind_h5vol(py::module& m) {  // NOLINT
   m.def("offset_and_length_for_grid", &h5::offset_and_length_for_grid,
         py::arg("grid_name"), py::arg("all_grid_names"),
         py::arg("all_extents"));
+  m.def(
+      "read_volume_data",
+      [](const std::vector<std::string>& file_names,
+         const std::string& subfile_name,
+         const std::vector<size_t>& observation_ids,
+         const std::vector<std::string>& tensor_components,
+         const std::optional<std::vector<std::string>>& grid_names) {
+        std::vector<h5::H5File<h5::AccessType::ReadOnly>> files{};
+        files.reserve(file_names.size());
+        std::vector<const h5::VolumeData*> volume_files{};
+        for (const auto& file_name : file_names) {
+          files.emplace_back(file_name);
+          volume_files.push_back(
+              &files.back().get<h5::VolumeData>(subfile_name));
+        }
+        return read_tensor_components(volume_files, observation_ids,
+                                      tensor_components, grid_names);
+      },
+      py::arg("file_names"), py::arg("subfile_name"),
+      py::arg("observation_ids"), py::arg("tensor_components"),
+      py::arg("grid_names") = std::nullopt,
+      "Read the tensor components at the observation ids from the volume data "
+      "subfile 'subfile_name' (e.g. '/element_data') of all files into a "
+      "NumPy array of shape (observations, components, points). The grid "
+      "points of the files are concatenated in the order of file_names. If "
+      "grid_names is given, only the data of these grids is read.");
 }
 }  // namespace py_bindings
@@ -4,7 +4,9 @@
 #include "IO/H5/VolumeData.hpp"
 
 #include <algorithm>
+#include <array>
 #include <boost/algorithm/string.hpp>
+#include <boost/functional/hash.hpp>
 #include <boost/iterator/transform_iterator.hpp>
 #include <hdf5.h>
 #include <memory>
@@ -19,10 +21,13 @@
 #include "ErrorHandling/ExpectsAndEnsures.hpp"
 #include "IO/Connectivity.hpp"
 #include "IO/H5/AccessType.hpp"
+#include "IO/H5/CheckH5.hpp"
 #include "IO/H5/Header.hpp"
 #include "IO/H5/Helpers.hpp"
 #include "IO/H5/SpectralIo.hpp"
+#include "IO/H5/Type.hpp"
 #include "IO/H5/Version.hpp"
+#include "IO/H5/Wrappers.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/GetOutput.hpp"
 #include "Utilities/Gsl.hpp"
@@ -33,14 +38,10 @@
 /// \cond HIDDEN_SYMBOLS
 namespace h5 {
 namespace {
-// Append the element extents and connectevity to the total extents and
-// connectivity
-void append_element_extents_and_connectivity(
-    const gsl::not_null<std::vector<size_t>*> total_extents,
-    const gsl::not_null<std::vector<int>*> total_connectivity,
-    const gsl::not_null<int*> total_points_so_far, const size_t dim,
+// Append the element extents to the total extents
+void append_element_extents(
+    const gsl::not_null<std::vector<size_t>*> total_extents, const size_t dim,
     const ExtentsAndTensorVolumeData& element) noexcept {
-  // Process the element extents
   const auto& extents = element.extents;
   if (extents.size() != dim) {
     ERROR("Trying to write data of dimensionality"
@@ -48,26 +49,42 @@ void append_element_extents_and_connectivity(
           << dim << ".");
   }
   total_extents->insert(total_extents->end(), extents.begin(), extents.end());
-  // Find the number of points in the local connectivity
-  const int element_num_points =
-      alg::accumulate(extents, 1, std::multiplies<>{});
-  // Generate the connectivity data for the element
-  // Possible optimization: local_connectivity.reserve(BLAH) if we can figure
-  // out size without computing all the connectivities.
-  const std::vector<int> connectivity = [&extents,
-                                         &total_points_so_far]() noexcept {
-    std::vector<int> local_connectivity;
+}
+
+// Compute the connectivity of all elements from their extents, using a running
+// count of the number of points so far as a global index
+std::vector<int> compute_connectivity(const std::vector<size_t>& total_extents,
+                                      const size_t dim) noexcept {
+  std::vector<int> total_connectivity{};
+  int total_points_so_far = 0;
+  for (auto iter = total_extents.begin(); iter != total_extents.end();
+       iter += static_cast<long>(dim)) {
+    const std::vector<size_t> extents(iter, iter + static_cast<long>(dim));
     for (const auto& cell : vis::detail::compute_cells(extents)) {
       for (const auto& bounding_indices : cell.bounding_indices) {
-        local_connectivity.emplace_back(*total_points_so_far +
+        total_connectivity.emplace_back(total_points_so_far +
                                         static_cast<int>(bounding_indices));
       }
     }
-    return local_connectivity;
-  }();
-  *total_points_so_far += element_num_points;
-  total_connectivity->insert(total_connectivity->end(), connectivity.begin(),
-                             connectivity.end());
+    total_points_so_far += alg::accumulate(extents, 1, std::multiplies<>{});
+  }
+  return total_connectivity;
+}
+
+// The names of the datasets that describe the topology of the grids, and that
+// are shared between observations with the same topology
+const std::array<std::string, 5>& topology_dataset_names() noexcept {
+  static const std::array<std::string, 5> names{
+      {"total_extents", "grid_names", "quadratures", "bases", "connectivity"}};
+  return names;
+}
+
+// The name of the subgroup of the VolumeData group that holds one group per
+// distinct topology. Each of these groups is named after the hash of the
+// topology and holds hard links to the topology datasets.
+const std::string& topologies_group_name() noexcept {
+  static const std::string name{"Topologies"};
+  return name;
 }
 
 // Append the name of an element to the string of grid names
@@ -161,15 +178,25 @@ void VolumeData::write_volume_data(
   }
   const auto dim =
       h5::read_value_attribute<size_t>(volume_data_group_.id(), "dimension");
-  // Extract Tensor Data one component at a time
+  // Collect the topology of the grids, i.e. everything but the tensor data
   std::vector<size_t> total_extents;
   std::string grid_names;
-  std::vector<int> total_connectivity;
   std::vector<int> quadratures;
   std::vector<int> bases;
-  // Keep a running count of the number of points so far to use as a global
-  // index for the connectivity
-  int total_points_so_far = 0;
+  for (const auto& element : elements) {
+    append_element_name(&grid_names, element);
+    // append element basis
+    alg::transform(element.basis, std::back_inserter(bases),
+                   [](const Spectral::Basis t) noexcept {
+                     return static_cast<int>(t);
+                   });
+    // append element quadraature
+    alg::transform(element.quadrature, std::back_inserter(quadratures),
+                   [](const Spectral::Quadrature t) noexcept {
+                     return static_cast<int>(t);
+                   });
+    append_element_extents(&total_extents, dim, element);
+  }
   // Loop over tensor componenents
   for (size_t i = 0; i < component_names.size(); i++) {
     std::string component_name = component_names[i];
@@ -183,23 +210,6 @@ void VolumeData::write_volume_data(
     }
     std::vector<double> contiguous_tensor_data{};
     for (const auto& element : elements) {
-      if (UNLIKELY(i == 0)) {  // True if first tensor component being accessed
-        append_element_name(&grid_names, element);
-        // append element basis
-        alg::transform(element.basis, std::back_inserter(bases),
-                       [](const Spectral::Basis t) noexcept {
-                         return static_cast<int>(t);
-                       });
-        // append element quadraature
-        alg::transform(element.quadrature, std::back_inserter(quadratures),
-                       [](const Spectral::Quadrature t) noexcept {
-                         return static_cast<int>(t);
-                       });
-
-        append_element_extents_and_connectivity(
-            &total_extents, &total_connectivity, &total_points_so_far, dim,
-            element);
-      }
       const DataVector& tensor_data_on_grid = element.tensor_components[i].data;
       contiguous_tensor_data.insert(contiguous_tensor_data.end(),
                                     tensor_data_on_grid.begin(),
@@ -210,6 +220,69 @@ void VolumeData::write_volume_data(
                    {contiguous_tensor_data.size()}, component_name);
   }  // for each component
 
+  // Write the coded quadrature and basis dictionaries. They are small
+  // attributes, so we write them for every observation.
+  const auto io_quadratures = h5_detail::allowed_quadratures();
+  std::vector<std::string> quadrature_dict(io_quadratures.size());
+  alg::transform(io_quadratures, quadrature_dict.begin(),
+                 get_output<Spectral::Quadrature>);
+  h5_detail::write_dictionary("Quadrature dictionary", quadrature_dict,
+                              observation_group);
+  const auto io_bases = h5_detail::allowed_bases();
+  std::vector<std::string> basis_dict(io_bases.size());
+  alg::transform(io_bases, basis_dict.begin(), get_output<Spectral::Basis>);
+  h5_detail::write_dictionary("Basis dictionary", basis_dict,
+                              observation_group);
+
+  // The topology datasets, in particular the connectivity, are often larger
+  // than the tensor data and rarely change between observations. They are
+  // therefore only written for the first observation with a given topology,
+  // and all later observations with the same topology hold hard links to
+  // these datasets. Since hard links are indistinguishable from datasets,
+  // readers (including h5py and XDMF) resolve them transparently. The known
+  // topologies are kept in their own subgroup rather than in attributes, so
+  // that their number is not limited by the attribute storage of the group.
+  size_t hash = boost::hash_range(grid_names.begin(), grid_names.end());
+  boost::hash_combine(hash, dim);
+  boost::hash_range(hash, total_extents.begin(), total_extents.end());
+  boost::hash_range(hash, quadratures.begin(), quadratures.end());
+  boost::hash_range(hash, bases.begin(), bases.end());
+  const std::string topology_name = std::to_string(hash);
+  detail::OpenGroup topologies_group(
+      volume_data_group_.id(), topologies_group_name(), AccessType::ReadWrite);
+  const htri_t topology_exists =
+      H5Lexists(topologies_group.id(), topology_name.c_str(), h5p_default());
+  CHECK_H5(topology_exists,
+           "Failed to look up topology '" << topology_name << "'");
+  if (topology_exists > 0) {
+    detail::OpenGroup source_group(topologies_group.id(), topology_name,
+                                   AccessType::ReadOnly);
+    // Guard against hash collisions by comparing the cheap parts of the
+    // topology. The connectivity follows from the extents. On a collision the
+    // topology is written to the observation group without being shared.
+    const auto source_grid_names =
+        h5::read_data<1, std::vector<char>>(source_group.id(), "grid_names");
+    if (std::equal(grid_names.begin(), grid_names.end(),
+                   source_grid_names.begin(), source_grid_names.end()) and
+        h5::read_data<1, std::vector<size_t>>(source_group.id(),
+                                              "total_extents") ==
+            total_extents and
+        h5::read_data<1, std::vector<int>>(source_group.id(), "quadratures") ==
+            quadratures and
+        h5::read_data<1, std::vector<int>>(source_group.id(), "bases") ==
+            bases) {
+      for (const auto& dataset_name : topology_dataset_names()) {
+        CHECK_H5(H5Lcreate_hard(source_group.id(), dataset_name.c_str(),
+                                observation_group.id(), dataset_name.c_str(),
+                                h5p_default(), h5p_default()),
+                 "Failed to link dataset '" << dataset_name << "' of topology "
+                                            << topology_name << " into "
+                                            << path);
+      }
+      return;
+    }
+  }
+
   // Write the grid extents contiguously, the first `dim` belong to the
   // First grid, the second `dim` belong to the second grid, and so on,
   // Ordering is `x, y, z, ... `
@@ -220,29 +293,32 @@ void VolumeData::write_volume_data(
   std::vector<char> grid_names_as_chars(grid_names.begin(), grid_names.end());
   h5::write_data(observation_group.id(), grid_names_as_chars,
                  {grid_names_as_chars.size()}, "grid_names");
-  // Write the coded quadrature, along with the dictionary
-  const auto io_quadratures = h5_detail::allowed_quadratures();
-  std::vector<std::string> quadrature_dict(io_quadratures.size());
-  alg::transform(io_quadratures, quadrature_dict.begin(),
-                 get_output<Spectral::Quadrature>);
-  h5_detail::write_dictionary("Quadrature dictionary", quadrature_dict,
-                              observation_group);
   h5::write_data(observation_group.id(), quadratures, {quadratures.size()},
                  "quadratures");
-  // Write the coded basis, along with the dictionary
-  const auto io_bases = h5_detail::allowed_bases();
-  std::vector<std::string> basis_dict(io_bases.size());
-  alg::transform(io_bases, basis_dict.begin(), get_output<Spectral::Basis>);
-  h5_detail::write_dictionary("Basis dictionary", basis_dict,
-                              observation_group);
   h5::write_data(observation_group.id(), bases, {bases.size()}, "bases");
   // Write the Connectivity
+  const std::vector<int> total_connectivity =
+      compute_connectivity(total_extents, dim);
   h5::write_data(observation_group.id(), total_connectivity,
                  {total_connectivity.size()}, "connectivity");
+
+  if (topology_exists == 0) {
+    detail::OpenGroup topology_group(topologies_group.id(), topology_name,
+                                     AccessType::ReadWrite);
+    for (const auto& dataset_name : topology_dataset_names()) {
+      CHECK_H5(H5Lcreate_hard(observation_group.id(), dataset_name.c_str(),
+                              topology_group.id(), dataset_name.c_str(),
+                              h5p_default(), h5p_default()),
+               "Failed to link dataset '" << dataset_name << "' of " << path
+                                          << " into topology "
+                                          << topology_name);
+    }
+  }
 }
 
 std::vector<size_t> VolumeData::list_observation_ids() const noexcept {
-  const auto names = get_group_names(volume_data_group_.id(), "");
+  auto names = get_group_names(volume_data_group_.id(), "");
+  names.erase(alg::remove(names, topologies_group_name()), names.end());
   const auto helper = [](const std::string& s) noexcept {
     return std::stoul(s.substr(std::string("ObservationId").size()));
   };
@@ -327,6 +403,81 @@ DataVector VolumeData::get_tensor_component(
   }
 }
 
+size_t VolumeData::read_tensor_components(
+    const gsl::not_null<double*> data, const size_t row_stride,
+    const size_t observation_id,
+    const std::vector<std::string>& tensor_components,
+    const std::vector<std::pair<size_t, size_t>>& offsets_and_lengths)
+    const noexcept {
+  const std::string path = "ObservationId" + std::to_string(observation_id);
+  detail::OpenGroup observation_group(volume_data_group_.id(), path,
+                                      AccessType::ReadOnly);
+  size_t number_of_points = 0;
+  for (const auto& offset_and_length : offsets_and_lengths) {
+    number_of_points += offset_and_length.second;
+  }
+  if (not offsets_and_lengths.empty() and number_of_points == 0) {
+    return 0;
+  }
+  for (size_t i = 0; i < tensor_components.size(); ++i) {
+    const hid_t dataset_id =
+        h5::open_dataset(observation_group.id(), tensor_components[i]);
+    const hid_t dataspace_id = h5::open_dataspace(dataset_id);
+    if (H5Sget_simple_extent_ndims(dataspace_id) != 1) {
+      ERROR("Can only read tensor components stored as rank 1 datasets, but '"
+            << tensor_components[i] << "' in " << path << " has rank "
+            << H5Sget_simple_extent_ndims(dataspace_id));
+    }
+    if (offsets_and_lengths.empty()) {
+      hsize_t size = 0;
+      H5Sget_simple_extent_dims(dataspace_id, &size, nullptr);
+      number_of_points = static_cast<size_t>(size);
+    }
+    if (number_of_points > row_stride) {
+      ERROR("Reading " << number_of_points << " grid points of '"
+                       << tensor_components[i]
+                       << "' but the row stride is only " << row_stride);
+    }
+    const auto read_points = [&dataset_id, &dataspace_id, &path,
+                              &tensor_components, &i](
+                                 double* const destination,
+                                 const hsize_t length) noexcept {
+      const hid_t memspace_id = H5Screate_simple(1, &length, &length);
+      CHECK_H5(memspace_id, "Failed to create memory space");
+      CHECK_H5(H5Dread(dataset_id, h5_type<double>(), memspace_id,
+                       dataspace_id, h5::h5p_default(), destination),
+               "Failed to read tensor component '" << tensor_components[i]
+                                                   << "' in " << path);
+      CHECK_H5(H5Sclose(memspace_id), "Failed to close memory space");
+    };
+    if (offsets_and_lengths.empty()) {
+      read_points(data.get() + i * row_stride, number_of_points);
+    } else {
+      // A union of hyperslabs would be read in the order of the grid points in
+      // the file, so we read each interval separately to store them in the
+      // order they were requested.
+      size_t points_so_far = 0;
+      for (const auto& [offset, length] : offsets_and_lengths) {
+        if (length == 0) {
+          continue;
+        }
+        const hsize_t start = offset;
+        const hsize_t count = length;
+        CHECK_H5(H5Sselect_hyperslab(dataspace_id, H5S_SELECT_SET, &start,
+                                     nullptr, &count, nullptr),
+                 "Failed to select the grid points [" << offset << ", "
+                                                      << offset + length
+                                                      << ")");
+        read_points(data.get() + i * row_stride + points_so_far, count);
+        points_so_far += length;
+      }
+    }
+    h5::close_dataspace(dataspace_id);
+    h5::close_dataset(dataset_id);
+  }
+  return number_of_points;
+}
+
 std::vector<std::vector<size_t>> VolumeData::get_extents(
     const size_t observation_id) const noexcept {
   const std::string path = "ObservationId" + std::to_string(observation_id);
@@ -10,11 +10,13 @@
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "ErrorHandling/Error.hpp"
 #include "IO/H5/Object.hpp"
 #include "IO/H5/OpenGroup.hpp"
+#include "Utilities/Gsl.hpp"
 
 /// \cond
 class DataVector;
@@ -60,6 +62,17 @@ namespace h5 {
  * `h5::offset_and_length_for_grid` function to compute the offset into the
  * contiguous dataset that corresponds to a particular grid.
  *
+ * The topology of the grids, i.e. their names, extents, bases, quadratures and
+ * connectivity, is only written for the first observation with that topology.
+ * Later observations with the same topology hold HDF5 hard links to the
+ * datasets of the first one, so the topology of a fixed-mesh simulation is
+ * stored once per file. Hard links are indistinguishable from the datasets
+ * they refer to, so all readers see the same layout for every observation.
+ * The known topologies are kept in the `Topologies` subgroup of the subfile,
+ * which holds one group of hard links per topology, named after its hash.
+ * Code that iterates over the observations in the subfile must skip this
+ * subgroup, as `list_observation_ids()` does.
+ *
  * \warning Currently the topology of the grids is assumed to be tensor products
  * of lines, i.e. lines, quadrilaterals, and hexahedrons. However, this can be
  * extended in the future. If support for more topologies is required, please
@@ -132,6 +145,29 @@ class VolumeData : public h5::Object {
       size_t observation_id,
       const std::string& tensor_component) const noexcept;
 
+  /*!
+   * \brief Read the tensor components with names `tensor_components` at
+   * observation id `observation_id` directly into `data`, without any
+   * intermediate copies.
+   *
+   * \details The data of the `i`-th tensor component is written to
+   * `data + i * row_stride`. Only the grid points in the contiguous intervals
+   * `offsets_and_lengths` (see `h5::offset_and_length_for_grid`) are read, or
+   * all grid points if `offsets_and_lengths` is empty. The intervals are read
+   * one at a time and stored one after another in the order they are given,
+   * not in the order they appear in the file. This allows reading only some
+   * grids of a large file, and reading the data of several observations or
+   * files into a single buffer.
+   *
+   * \returns the number of grid points read per tensor component, which must
+   * not exceed `row_stride`
+   */
+  size_t read_tensor_components(
+      gsl::not_null<double*> data, size_t row_stride, size_t observation_id,
+      const std::vector<std::string>& tensor_components,
+      const std::vector<std::pair<size_t, size_t>>& offsets_and_lengths)
+      const noexcept;
+
   /// Read the extents of all the grids stored in the file at the observation id
   /// `observation_id`
   std::vector<std::vector<size_t>> get_extents(
@@ -112,17 +112,39 @@ struct RegisterEventsWithObservers {
         std::pair<observers::TypeOfObservation, observers::ObservationKey>>
         type_of_observation_and_observation_key_pairs;
 
+    const auto register_events =
+        [&box, &type_of_observation_and_observation_key_pairs](
+            const auto& events) noexcept {
+          for (const auto& event : events) {
+            if (auto obs_type_and_obs_key =
+                    get_registration_observation_type_and_key(*event, box);
+                obs_type_and_obs_key.has_value()) {
+              type_of_observation_and_observation_key_pairs.push_back(
+                  *obs_type_and_obs_key);
+            }
+          }
+        };
+
     const auto& triggers_and_events =
         db::get<::Tags::EventsAndTriggersBase>(box);
     for (const auto& trigger_and_events :
          triggers_and_events.events_and_triggers()) {
-      for (const auto& event : trigger_and_events.second) {
-        if (auto obs_type_and_obs_key =
-                get_registration_observation_type_and_key(*event, box);
-            obs_type_and_obs_key.has_value()) {
-          type_of_observation_and_observation_key_pairs.push_back(
-              *obs_type_and_obs_key);
-        }
+      register_events(trigger_and_events.second);
+    }
+    if constexpr (db::tag_is_retrievable_v<::Tags::EventsAtDenseTimesBase,
+                                           db::DataBox<DbTagList>>) {
+      for (const auto& times_and_events :
+           db::get<::Tags::EventsAtDenseTimesBase>(box).events_at_times()) {
+        register_events(times_and_events.second);
+      }
+    }
+    if constexpr (db::tag_is_retrievable_v<
+                      ::Tags::EventsAndTriggersAfterDuDtBase,
+                      db::DataBox<DbTagList>>) {
+      for (const auto& trigger_and_events :
+           db::get<::Tags::EventsAndTriggersAfterDuDtBase>(box)
+               .events_and_triggers()) {
+        register_events(trigger_and_events.second);
       }
     }
 
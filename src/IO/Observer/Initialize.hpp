@@ -17,6 +17,8 @@ namespace Actions {
 namespace detail {
 template <class Tag>
 using reduction_data_to_reduction_names = typename Tag::names_tag;
+template <class Tag>
+using reduction_data_to_reduction_slots = typename Tag::slots_tag;
 }  // namespace detail
 /*!
  * \brief Initializes the DataBox on the observer parallel component
@@ -78,7 +80,10 @@ struct InitializeWriter {
       typename Metavariables::observed_reduction_data_tags,
       tmpl::transform<
           typename Metavariables::observed_reduction_data_tags,
-          tmpl::bind<detail::reduction_data_to_reduction_names, tmpl::_1>>>;
+          tmpl::bind<detail::reduction_data_to_reduction_names, tmpl::_1>>,
+      tmpl::transform<
+          typename Metavariables::observed_reduction_data_tags,
+          tmpl::bind<detail::reduction_data_to_reduction_slots, tmpl::_1>>>;
   using compute_tags = tmpl::list<>;
 
   using return_tag_list = tmpl::append<simple_tags, compute_tags>;
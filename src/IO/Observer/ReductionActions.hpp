@@ -4,9 +4,11 @@
 #pragma once
 
 #include <cstddef>
+#include <limits>
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -18,6 +20,7 @@
 #include "IO/H5/File.hpp"
 #include "IO/Observer/ArrayComponentId.hpp"
 #include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/ReductionContributionSlots.hpp"
 #include "IO/Observer/Tags.hpp"
 #include "Parallel/ArrayIndex.hpp"
 #include "Parallel/GlobalCache.hpp"
@@ -186,6 +189,13 @@ namespace ThreadedActions {
 /*!
  * \brief Gathers all the reduction data from all processing elements/cores on a
  * node.
+ *
+ * \details Each contribution claims a slot in
+ * observers::ReductionContributionSlots while holding the node lock and then
+ * stores its data in the slot without holding any lock. The last contribution
+ * combines the data of all slots and sends it to `WriteReductionData`. The node
+ * lock is therefore still taken once per contribution, but only for the
+ * bookkeeping, not while the reduction data is moved or combined.
  */
 struct CollectReductionDataOnNode {
  public:
@@ -203,10 +213,8 @@ struct CollectReductionDataOnNode {
                     Parallel::ReductionData<ReductionDatums...>&&
                         received_reduction_data) noexcept {
     if constexpr (tmpl::list_contains_v<
-                      DbTagsList, Tags::ReductionData<ReductionDatums...>> and
-                  tmpl::list_contains_v<DbTagsList, Tags::ReductionDataNames<
-                                                        ReductionDatums...>> and
-                  tmpl::list_contains_v<DbTagsList, Tags::ReductionDataLock>) {
+                      DbTagsList,
+                      Tags::ReductionDataSlots<ReductionDatums...>>) {
       // The below gymnastics with pointers is done in order to minimize the
       // time spent locking the entire node, which is necessary because the
       // DataBox does not allow any functions calls, both get and mutate, during
@@ -214,41 +222,29 @@ struct CollectReductionDataOnNode {
       // consistent state throughout mutation. Here, however, we need to be
       // reasonable efficient in parallel and so we manually guarantee that
       // consistent state. To this end, we create pointers and assign to them
-      // the data in the DataBox which is guaranteed to be pointer stable. The
-      // data itself is guaranteed to be stable inside the ReductionDataLock.
-      std::unordered_map<observers::ObservationId,
-                         Parallel::ReductionData<ReductionDatums...>>*
-          reduction_data = nullptr;
-      std::unordered_map<ObservationId, std::vector<std::string>>*
-          reduction_names_map = nullptr;
-      std::unordered_map<observers::ObservationId,
-                         std::unordered_set<ArrayComponentId>>*
-          reduction_observers_contributed = nullptr;
-      Parallel::NodeLock* reduction_data_lock = nullptr;
-      size_t observations_registered_with_id =
-          std::numeric_limits<size_t>::max();
+      // the data in the DataBox which is guaranteed to be pointer stable.
+      //
+      // Inside the node lock we only do the bookkeeping needed to claim a slot
+      // for our data. The data is then moved into the slot without holding any
+      // lock, so contributions from different cores do not serialize on a
+      // shared lock, and the last contributor combines all slots at once.
+      observers::ReductionContributionSlots<ReductionDatums...>* slots =
+          nullptr;
+      size_t slot = std::numeric_limits<size_t>::max();
 
       node_lock->lock();
-      db::mutate<Tags::ReductionData<ReductionDatums...>,
-                 Tags::ReductionDataNames<ReductionDatums...>,
-                 Tags::ContributorsOfReductionData, Tags::ReductionDataLock>(
+      db::mutate<Tags::ReductionDataSlots<ReductionDatums...>,
+                 Tags::ContributorsOfReductionData>(
           make_not_null(&box),
-          [&reduction_data, &reduction_names_map,
-           &reduction_observers_contributed, &reduction_data_lock,
-           &observation_id, &observer_group_id,
-           &observations_registered_with_id](
+          [&slots, &slot, &observation_id, &observer_group_id](
               const gsl::not_null<std::unordered_map<
                   observers::ObservationId,
-                  Parallel::ReductionData<ReductionDatums...>>*>
-                  reduction_data_ptr,
-              const gsl::not_null<
-                  std::unordered_map<ObservationId, std::vector<std::string>>*>
-                  reduction_names_map_ptr,
+                  observers::ReductionContributionSlots<ReductionDatums...>>*>
+                  slots_map,
               const gsl::not_null<
                   std::unordered_map<observers::ObservationId,
                                      std::unordered_set<ArrayComponentId>>*>
-                  reduction_observers_contributed_ptr,
-              const gsl::not_null<Parallel::NodeLock*> reduction_data_lock_ptr,
+                  reduction_observers_contributed,
               const std::unordered_map<ObservationKey,
                                        std::unordered_set<ArrayComponentId>>&
                   observations_registered) noexcept {
@@ -261,104 +257,70 @@ struct CollectReductionDataOnNode {
                     << " was not registered for the observation id "
                     << observation_id);
             }
-            reduction_data = &*reduction_data_ptr;
-            reduction_names_map = &*reduction_names_map_ptr;
-            reduction_observers_contributed =
-                &*reduction_observers_contributed_ptr;
-            reduction_data_lock = &*reduction_data_lock_ptr;
-            observations_registered_with_id =
-                observations_registered.at(key).size();
+            auto& contributed_group_ids =
+                (*reduction_observers_contributed)[observation_id];
+            if (UNLIKELY(not contributed_group_ids.insert(observer_group_id)
+                                 .second)) {
+              ERROR("Already received reduction data to observation id "
+                    << observation_id << " from array component id "
+                    << observer_group_id);
+            }
+            slots = &slots_map
+                         ->try_emplace(observation_id,
+                                       registered_group_ids.size())
+                         .first->second;
+            slot = slots->claim_slot();
           },
           db::get<Tags::ExpectedContributorsForObservations>(box));
       node_lock->unlock();
 
-      ASSERT(
-          observations_registered_with_id != std::numeric_limits<size_t>::max(),
-          "Failed to set observations_registered_with_id when mutating the "
-          "DataBox. This is a bug in the code.");
-
-      // Now that we've retrieved pointers to the data in the DataBox we wish to
-      // manipulate, lock the data and manipulate it.
-      reduction_data_lock->lock();
-      auto& contributed_group_ids =
-          (*reduction_observers_contributed)[observation_id];
-
-      if (UNLIKELY(contributed_group_ids.find(observer_group_id) !=
-                   contributed_group_ids.end())) {
-        ERROR("Already received reduction data to observation id "
-              << observation_id << " from array component id "
-              << observer_group_id);
-      }
-      contributed_group_ids.insert(observer_group_id);
-
-      if (reduction_data->find(observation_id) == reduction_data->end()) {
-        // This Action has been called for the first time,
-        // so all we need to do is move the input data to the
-        // reduction_data in the DataBox.
-        reduction_data->operator[](observation_id) =
-            std::move(received_reduction_data);
-      } else {
-        // This Action is being called at least the second time
-        // (but not the final time if on node 0).
-        reduction_data->at(observation_id)
-            .combine(std::move(received_reduction_data));
-      }
+      ASSERT(slots != nullptr and slot != std::numeric_limits<size_t>::max(),
+             "Failed to claim a slot when mutating the DataBox. This is a bug "
+             "in the code.");
 
       if (UNLIKELY(reduction_names.empty())) {
         ERROR(
             "The reduction names, which is a std::vector of the names of "
             "the columns in the file, must be non-empty.");
       }
-      if (auto current_names = reduction_names_map->find(observation_id);
-          current_names == reduction_names_map->end()) {
-        reduction_names_map->emplace(observation_id,
-                                     std::move(reduction_names));
-      } else if (UNLIKELY(current_names->second != reduction_names)) {
-        ERROR(
-            "The reduction names passed in must match the currently "
-            "known reduction names.");
+      if (not slots->fill_slot(slot, std::move(reduction_names),
+                               std::move(received_reduction_data))) {
+        return;
       }
 
-      // Check if we have received all reduction data from the Observer
-      // group. If so we reduce to node 0 for writing to disk. We use a bool
-      // `send_data` to allow us to defer the send call until after we've
-      // unlocked the lock.
-      bool send_data = false;
-      if (reduction_observers_contributed->at(observation_id).size() ==
-          observations_registered_with_id) {
-        send_data = true;
-        // We intentionally move the data out of the map and erase it
-        // before call `WriteReductionData` since if the call to
-        // `WriteReductionData` is inlined and we erase data from the maps
-        // afterward we would lose data.
-        reduction_names =
-            std::move(reduction_names_map->operator[](observation_id));
-        received_reduction_data =
-            std::move(reduction_data->operator[](observation_id));
-        reduction_observers_contributed->erase(observation_id);
-        reduction_data->erase(observation_id);
-        reduction_names_map->erase(observation_id);
-      }
-      reduction_data_lock->unlock();
+      // We are the last contributor, so all other contributors are done with
+      // the slots and we can combine them and erase the entries. We erase the
+      // data before calling `WriteReductionData` since the call may be inlined.
+      auto [combined_names, combined_data] = slots->combine();
+      node_lock->lock();
+      db::mutate<Tags::ReductionDataSlots<ReductionDatums...>,
+                 Tags::ContributorsOfReductionData>(
+          make_not_null(&box),
+          [&observation_id](
+              const gsl::not_null<std::unordered_map<
+                  observers::ObservationId,
+                  observers::ReductionContributionSlots<ReductionDatums...>>*>
+                  slots_map,
+              const gsl::not_null<
+                  std::unordered_map<observers::ObservationId,
+                                     std::unordered_set<ArrayComponentId>>*>
+                  reduction_observers_contributed) noexcept {
+            slots_map->erase(observation_id);
+            reduction_observers_contributed->erase(observation_id);
+          });
+      node_lock->unlock();
 
-      if (send_data) {
-        Parallel::threaded_action<WriteReductionData>(
-            Parallel::get_parallel_component<ObserverWriter<Metavariables>>(
-                cache)[0],
-            observation_id, static_cast<size_t>(Parallel::my_node()),
-            subfile_name,
-            // NOLINTNEXTLINE(bugprone-use-after-move)
-            std::move(reduction_names), std::move(received_reduction_data));
-      }
+      Parallel::threaded_action<WriteReductionData>(
+          Parallel::get_parallel_component<ObserverWriter<Metavariables>>(
+              cache)[0],
+          observation_id, static_cast<size_t>(Parallel::my_node()),
+          subfile_name, std::move(combined_names), std::move(combined_data));
     } else {
       (void)node_lock;
       (void)observer_group_id;
-      ERROR("Could not find one of the tags: "
-            << pretty_type::get_name<Tags::ReductionData<ReductionDatums...>>()
-            << ' '
+      ERROR("Could not find the tag "
             << pretty_type::get_name<
-                   Tags::ReductionDataNames<ReductionDatums...>>()
-            << " or Tags::ReductionDataLock");
+                   Tags::ReductionDataSlots<ReductionDatums...>>());
     }
   }
 };
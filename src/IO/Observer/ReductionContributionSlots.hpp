@@ -0,0 +1,139 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <pup.h>
+#include <pup_stl.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ErrorHandling/Assert.hpp"
+#include "ErrorHandling/Error.hpp"
+#include "Parallel/PupStlCpp17.hpp"
+#include "Parallel/Reduction.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/StdHelpers.hpp"
+
+namespace observers {
+/*!
+ * \ingroup ObserversGroup
+ * \brief Storage for the reduction data contributed by the `Observer`s on one
+ * node at a single `ObservationId`.
+ *
+ * \details Every contributor claims its own slot with `claim_slot()` while
+ * holding the node lock (which is needed anyway to access the DataBox of the
+ * `ObserverWriter`), and then moves its data into that slot with `fill_slot()`
+ * without holding any lock. Exactly one contributor, the last one to fill its
+ * slot, has `fill_slot()` return `true` and then calls `combine()`. Thus
+ * contributions from different cores never wait on each other while their data
+ * is stored, and the data is combined once per node by a single thread.
+ *
+ * The slots are allocated when the first contributor arrives and are never
+ * resized, so a contributor may fill its slot while other contributors claim
+ * slots for this or other observations.
+ *
+ * \note This does not make the collection lock-free: the node lock is still
+ * taken once per contribution to look up (or create) the slots for the
+ * `ObservationId` and to claim a slot, and once more by the last contributor
+ * to erase the slots. Only moving the data into the slots and combining it are
+ * done without the lock. A new object is created for every `ObservationId`, so
+ * slots are never reused across observations.
+ */
+template <typename... ReductionDatums>
+class ReductionContributionSlots {
+ public:
+  using reduction_data = Parallel::ReductionData<ReductionDatums...>;
+
+  ReductionContributionSlots() = default;
+  explicit ReductionContributionSlots(
+      const size_t number_of_contributors) noexcept
+      : slots_(number_of_contributors) {}
+  ReductionContributionSlots(const ReductionContributionSlots&) = delete;
+  ReductionContributionSlots& operator=(const ReductionContributionSlots&) =
+      delete;
+  /// Moving is only safe while no contributor is filling a slot.
+  ReductionContributionSlots(ReductionContributionSlots&& rhs) noexcept
+      : next_slot_(rhs.next_slot_),
+        number_of_filled_slots_(
+            rhs.number_of_filled_slots_.load(std::memory_order_acquire)),
+        slots_(std::move(rhs.slots_)) {}
+  ReductionContributionSlots& operator=(
+      ReductionContributionSlots&& rhs) noexcept {
+    next_slot_ = rhs.next_slot_;
+    number_of_filled_slots_.store(
+        rhs.number_of_filled_slots_.load(std::memory_order_acquire),
+        std::memory_order_release);
+    slots_ = std::move(rhs.slots_);
+    return *this;
+  }
+  ~ReductionContributionSlots() = default;
+
+  /// Claim the next free slot. Must be called while holding the node lock.
+  size_t claim_slot() noexcept {
+    ASSERT(next_slot_ < slots_.size(),
+           "Received more contributions (" << next_slot_ + 1
+                                           << ") than were expected ("
+                                           << slots_.size() << ").");
+    return next_slot_++;
+  }
+
+  /// Store the contribution in the claimed `slot`. Returns `true` if this was
+  /// the last slot to be filled.
+  bool fill_slot(const size_t slot, std::vector<std::string>&& names,
+                 reduction_data&& data) noexcept {
+    ASSERT(slot < slots_.size(), "Slot " << slot << " is out of bounds.");
+    ASSERT(not slots_[slot].has_value(), "Slot " << slot << " is filled.");
+    slots_[slot].emplace(std::move(names), std::move(data));
+    // The release makes our slot visible to the last contributor, and the
+    // acquire makes all other slots visible to us if we are the last one.
+    return number_of_filled_slots_.fetch_add(1, std::memory_order_acq_rel) +
+               1 ==
+           slots_.size();
+  }
+
+  /// Combine the data of all slots, which must all have been filled, and
+  /// return the reduction names together with the combined data.
+  std::pair<std::vector<std::string>, reduction_data> combine() noexcept {
+    ASSERT(number_of_filled_slots_.load(std::memory_order_acquire) ==
+               slots_.size(),
+           "Not all slots have been filled.");
+    auto result = std::move(*slots_[0]);
+    for (size_t slot = 1; slot < slots_.size(); ++slot) {
+      auto& [names, data] = *slots_[slot];
+      if (UNLIKELY(names != result.first)) {
+        using ::operator<<;
+        ERROR("The reduction names passed in must match the currently known "
+              "reduction names. Expected "
+              << result.first << " but received " << names);
+      }
+      result.second.combine(std::move(data));
+    }
+    return result;
+  }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) noexcept {
+    p | next_slot_;
+    size_t number_of_filled_slots =
+        number_of_filled_slots_.load(std::memory_order_acquire);
+    p | number_of_filled_slots;
+    if (p.isUnpacking()) {
+      number_of_filled_slots_.store(number_of_filled_slots,
+                                    std::memory_order_release);
+    }
+    p | slots_;
+  }
+
+ private:
+  size_t next_slot_{0};
+  std::atomic<size_t> number_of_filled_slots_{0};
+  std::vector<
+      std::optional<std::pair<std::vector<std::string>, reduction_data>>>
+      slots_{};
+};
+}  // namespace observers
@@ -18,6 +18,7 @@
 #include "DataStructures/Tensor/TensorData.hpp"
 #include "IO/Observer/ArrayComponentId.hpp"
 #include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/ReductionContributionSlots.hpp"
 #include "Options/Options.hpp"
 #include "Parallel/NodeLock.hpp"
 #include "Parallel/Reduction.hpp"
@@ -108,6 +109,8 @@ struct TensorData : db::SimpleTag {
 /// \cond
 template <class... ReductionDatums>
 struct ReductionDataNames;
+template <class... ReductionDatums>
+struct ReductionDataSlots;
 /// \endcond
 
 /// Reduction data to be written to disk.
@@ -121,6 +124,7 @@ struct ReductionData : db::SimpleTag {
   using type = std::unordered_map<observers::ObservationId,
                                   Parallel::ReductionData<ReductionDatums...>>;
   using names_tag = ReductionDataNames<ReductionDatums...>;
+  using slots_tag = ReductionDataSlots<ReductionDatums...>;
 };
 
 /// Names of the reduction data to be written to disk.
@@ -131,6 +135,19 @@ struct ReductionDataNames : db::SimpleTag {
   using data_tag = ReductionData<ReductionDatums...>;
 };
 
+/// The per-node slots into which the `Observer`s on the node store their
+/// reduction data before it is combined and sent for writing.
+///
+/// See observers::ReductionContributionSlots for details.
+template <class... ReductionDatums>
+struct ReductionDataSlots : db::SimpleTag {
+  using type =
+      std::unordered_map<observers::ObservationId,
+                         observers::ReductionContributionSlots<
+                             ReductionDatums...>>;
+  using data_tag = ReductionData<ReductionDatums...>;
+};
+
 /// Node lock used when needing to read/write to H5 files on disk.
 ///
 /// The reason for only having one lock for all files is that we currently don't
@@ -13,6 +13,7 @@
 #include "Domain/Tags.hpp"
 #include "ErrorHandling/Assert.hpp"
 #include "Evolution/TypeTraits.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Tags.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
 #include "PointwiseFunctions/AnalyticSolutions/Tags.hpp"
@@ -54,6 +55,13 @@ namespace Actions {
 /// - Removes: nothing
 /// - Modifies:
 ///      - External<typename system::variables_tag>
+///      - Tags::ExternalBoundaryDataCoordinates<volume_dim> (if present)
+///
+/// If the boundary condition is time-independent (see
+/// `evolution::is_time_independent`) and the DataBox holds
+/// `Tags::ExternalBoundaryDataCoordinates`, the boundary data is only
+/// computed when the coordinates of an external face change, and is reused
+/// otherwise.
 ///
 /// \see ReceiveDataForFluxes
 template <typename Metavariables>
@@ -95,6 +103,65 @@ struct ImposeDirichletBoundaryConditions {
   }
 
  private:
+  // Set the exterior variables on every external face with
+  // `set_boundary_vars(vars, boundary_coords)`. If the boundary condition is
+  // time-independent, the boundary data is reused and only recomputed on faces
+  // whose coordinates changed since it was last computed, e.g. because the mesh
+  // or the coordinate map changed.
+  template <size_t VolumeDim, typename DbTags, typename SetBoundaryVars>
+  static void set_exterior_vars(
+      const gsl::not_null<db::DataBox<DbTags>*> box,
+      const SetBoundaryVars& set_boundary_vars) noexcept {
+    using exterior_vars_tag = domain::Tags::Interface<
+        domain::Tags::BoundaryDirectionsExterior<VolumeDim>,
+        typename Metavariables::system::variables_tag>;
+    using exterior_coords_tag = domain::Tags::Interface<
+        domain::Tags::BoundaryDirectionsExterior<VolumeDim>,
+        domain::Tags::Coordinates<VolumeDim, Frame::Inertial>>;
+    using cached_coords_tag =
+        ::Tags::ExternalBoundaryDataCoordinates<VolumeDim>;
+    if constexpr (evolution::is_time_independent_v<
+                      typename Metavariables::boundary_condition_tag::type> and
+                  db::tag_is_retrievable_v<cached_coords_tag,
+                                           db::DataBox<DbTags>>) {
+      db::mutate<exterior_vars_tag, cached_coords_tag>(
+          box,
+          [&set_boundary_vars](
+              const gsl::not_null<typename exterior_vars_tag::type*>
+                  external_bdry_vars,
+              const gsl::not_null<typename cached_coords_tag::type*>
+                  cached_coords,
+              const typename exterior_coords_tag::type&
+                  boundary_coords) noexcept {
+            for (auto& [direction, vars] : *external_bdry_vars) {
+              const auto& coords = boundary_coords.at(direction);
+              const auto cached_coords_on_face = cached_coords->find(direction);
+              if (cached_coords_on_face != cached_coords->end() and
+                  cached_coords_on_face->second == coords) {
+                continue;
+              }
+              set_boundary_vars(make_not_null(&vars), coords);
+              (*cached_coords)[direction] = coords;
+            }
+          },
+          db::get<exterior_coords_tag>(*box));
+    } else {
+      db::mutate<exterior_vars_tag>(
+          box,
+          [&set_boundary_vars](
+              const gsl::not_null<typename exterior_vars_tag::type*>
+                  external_bdry_vars,
+              const typename exterior_coords_tag::type&
+                  boundary_coords) noexcept {
+            for (auto& [direction, vars] : *external_bdry_vars) {
+              set_boundary_vars(make_not_null(&vars),
+                                boundary_coords.at(direction));
+            }
+          },
+          db::get<exterior_coords_tag>(*box));
+    }
+  }
+
   template <size_t VolumeDim, typename DbTags>
   static std::tuple<db::DataBox<DbTags>&&> apply_impl(
       db::DataBox<DbTags>& box,
@@ -112,29 +179,17 @@ struct ImposeDirichletBoundaryConditions {
         "for conservative systems are implemented");
 
     // Apply the boundary condition
-    db::mutate_apply<tmpl::list<domain::Tags::Interface<
-                         domain::Tags::BoundaryDirectionsExterior<VolumeDim>,
-                         typename system::variables_tag>>,
-                     tmpl::list<>>(
-        [](const gsl::not_null<typename domain::Tags::Interface<
-               domain::Tags::BoundaryDirectionsExterior<VolumeDim>,
-               typename system::variables_tag>::type*>
-               external_bdry_vars,
-           const double time, const auto& boundary_condition,
-           const auto& boundary_coords) noexcept {
-          for (auto& external_direction_and_vars : *external_bdry_vars) {
-            auto& direction = external_direction_and_vars.first;
-            auto& vars = external_direction_and_vars.second;
-            vars.assign_subset(boundary_condition.variables(
-                boundary_coords.at(direction), time,
-                typename system::variables_tag::type::tags_list{}));
-          }
-        },
-        make_not_null(&box), db::get<::Tags::Time>(box),
-        get<typename Metavariables::boundary_condition_tag>(cache),
-        db::get<domain::Tags::Interface<
-            domain::Tags::BoundaryDirectionsExterior<VolumeDim>,
-            domain::Tags::Coordinates<VolumeDim, Frame::Inertial>>>(box));
+    const double time = db::get<::Tags::Time>(box);
+    const auto& boundary_condition =
+        get<typename Metavariables::boundary_condition_tag>(cache);
+    set_exterior_vars<VolumeDim>(
+        make_not_null(&box),
+        [&boundary_condition, &time](const auto vars,
+                                     const auto& boundary_coords) noexcept {
+          vars->assign_subset(boundary_condition.variables(
+              boundary_coords, time,
+              typename system::variables_tag::type::tags_list{}));
+        });
 
     return std::forward_as_tuple(std::move(box));
   }
@@ -170,35 +225,22 @@ struct ImposeDirichletBoundaryConditions {
         "for conservative systems are implemented");
 
     // Apply the boundary condition
-    db::mutate_apply<tmpl::list<domain::Tags::Interface<
-                         domain::Tags::BoundaryDirectionsExterior<VolumeDim>,
-                         typename system::variables_tag>>,
-                     tmpl::list<>>(
-        [](const gsl::not_null<typename domain::Tags::Interface<
-               domain::Tags::BoundaryDirectionsExterior<VolumeDim>,
-               typename system::variables_tag>::type*>
-               external_bdry_vars,
-           const double time, const auto& boundary_condition,
-           const auto& boundary_coords) noexcept {
-          for (auto& external_direction_and_vars : *external_bdry_vars) {
-            auto& direction = external_direction_and_vars.first;
-            auto& vars = external_direction_and_vars.second;
-
-            apply_impl_helper_conservative_from_primitive(
-                make_not_null(&vars),
-                boundary_condition.variables(
-                    boundary_coords.at(direction), time,
-                    typename system::conservative_from_primitive::
-                        argument_tags{}),
-                typename system::conservative_from_primitive::return_tags{},
-                tmpl::list<system>{});
-          }
-        },
-        make_not_null(&box), db::get<::Tags::Time>(box),
-        get<typename Metavariables::boundary_condition_tag>(cache),
-        db::get<domain::Tags::Interface<
-            domain::Tags::BoundaryDirectionsExterior<VolumeDim>,
-            domain::Tags::Coordinates<VolumeDim, Frame::Inertial>>>(box));
+    const double time = db::get<::Tags::Time>(box);
+    const auto& boundary_condition =
+        get<typename Metavariables::boundary_condition_tag>(cache);
+    set_exterior_vars<VolumeDim>(
+        make_not_null(&box),
+        [&boundary_condition, &time](const auto vars,
+                                     const auto& boundary_coords) noexcept {
+          apply_impl_helper_conservative_from_primitive(
+              vars,
+              boundary_condition.variables(
+                  boundary_coords, time,
+                  typename system::conservative_from_primitive::
+                      argument_tags{}),
+              typename system::conservative_from_primitive::return_tags{},
+              tmpl::list<system>{});
+        });
 
     return std::forward_as_tuple(std::move(box));
   }
@@ -123,6 +123,75 @@ struct FirstOrderSchemeLts {
       const NumericalFlux& normal_dot_numerical_flux_computer,
       const typename time_stepper_tag::type::element_type& time_stepper,
       const TimeDelta& time_step) noexcept {
+    add_boundary_contributions(
+        variables, all_mortar_data, volume_mesh, mortar_meshes, mortar_sizes,
+        normal_dot_numerical_flux_computer,
+        [&time_stepper, &time_step](const auto& coupling,
+                                    const auto mortar_data) noexcept {
+          return time_stepper.compute_boundary_delta(coupling, mortar_data,
+                                                     time_step);
+        });
+  }
+
+  /*!
+   * \brief Add the boundary contributions to the `variables_tag` at a time
+   * inside the current step, computed by dense output from the boundary
+   * histories on the mortars.
+   *
+   * \details This is the counterpart of `TimeStepper::dense_update_u` for
+   * the boundary terms, so that the variables at `time` are given by the
+   * variables at the start of the step, updated by dense output from both the
+   * volume history and from this mutator. It must be applied before the
+   * boundary contributions of the step are applied by the
+   * `FirstOrderSchemeLts` itself, which discards the history that is no longer
+   * needed after the step.
+   */
+  struct DenseOutput {
+    using return_tags = tmpl::list<variables_tag>;
+    using argument_tags = tmpl::list<
+        ::Tags::Mortars<mortar_data_tag, Dim>, domain::Tags::Mesh<Dim>,
+        ::Tags::Mortars<domain::Tags::Mesh<Dim - 1>, Dim>,
+        ::Tags::Mortars<::Tags::MortarSize<Dim - 1>, Dim>,
+        NumericalFluxComputerTag, time_stepper_tag>;
+
+    static void apply(
+        const gsl::not_null<typename variables_tag::type*> variables,
+        const typename ::Tags::Mortars<mortar_data_tag, Dim>::type&
+            all_mortar_data,
+        const Mesh<Dim>& volume_mesh,
+        const typename ::Tags::Mortars<domain::Tags::Mesh<Dim - 1>, Dim>::type&
+            mortar_meshes,
+        const typename ::Tags::Mortars<::Tags::MortarSize<Dim - 1>, Dim>::type&
+            mortar_sizes,
+        const NumericalFlux& normal_dot_numerical_flux_computer,
+        const typename time_stepper_tag::type::element_type& time_stepper,
+        const double time) noexcept {
+      add_boundary_contributions(
+          variables, make_not_null(&all_mortar_data), volume_mesh,
+          mortar_meshes, mortar_sizes, normal_dot_numerical_flux_computer,
+          [&time_stepper, &time](const auto& coupling,
+                                 const auto mortar_data) noexcept {
+            return time_stepper.boundary_dense_output(coupling, *mortar_data,
+                                                      time);
+          });
+    }
+  };
+
+ private:
+  // Adds the boundary contribution of each mortar to the `variables`, where
+  // `compute_delta` computes the lifted contribution from the coupling and the
+  // boundary history of the mortar.
+  template <typename AllMortarData, typename ComputeDelta>
+  static void add_boundary_contributions(
+      const gsl::not_null<typename variables_tag::type*> variables,
+      const gsl::not_null<AllMortarData*> all_mortar_data,
+      const Mesh<Dim>& volume_mesh,
+      const typename ::Tags::Mortars<domain::Tags::Mesh<Dim - 1>, Dim>::type&
+          mortar_meshes,
+      const typename ::Tags::Mortars<::Tags::MortarSize<Dim - 1>, Dim>::type&
+          mortar_sizes,
+      const NumericalFlux& normal_dot_numerical_flux_computer,
+      const ComputeDelta& compute_delta) noexcept {
     // Iterate over all mortars
     for (auto& mortar_id_and_data : *all_mortar_data) {
       // Retrieve mortar data
@@ -150,8 +219,8 @@ struct FirstOrderSchemeLts {
             extent_perpendicular_to_face, face_mesh, mortar_mesh, mortar_size);
       };
 
-      const auto lifted_data = time_stepper.compute_boundary_delta(
-          coupling, make_not_null(&mortar_data), time_step);
+      const auto lifted_data =
+          compute_delta(coupling, make_not_null(&mortar_data));
 
       // Add the flux contribution to the volume data
       add_slice_to_data(variables, lifted_data, volume_mesh.extents(),
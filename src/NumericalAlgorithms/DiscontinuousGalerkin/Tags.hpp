@@ -12,12 +12,18 @@
 
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataBox/TagName.hpp"
+#include "DataStructures/Tensor/TypeAliases.hpp"
 #include "Domain/Structure/Direction.hpp"  // IWYU pragma: keep
+#include "Domain/Structure/DirectionMap.hpp"
 #include "Domain/Structure/ElementId.hpp"  // IWYU pragma: keep
 #include "NumericalAlgorithms/DiscontinuousGalerkin/SimpleMortarData.hpp"
 #include "NumericalAlgorithms/Spectral/Projection.hpp"
 #include "Options/Options.hpp"
 
+/// \cond
+class DataVector;
+/// \endcond
+
 /// Functionality related to discontinuous Galerkin schemes
 namespace dg {}
 
@@ -48,6 +54,18 @@ template <size_t Dim>
 struct MortarSize : db::SimpleTag {
   using type = std::array<Spectral::MortarSize, Dim>;
 };
+
+/// \ingroup DataBoxTagsGroup
+/// \ingroup DiscontinuousGalerkinGroup
+/// The inertial coordinates on the external boundaries at which the Dirichlet
+/// boundary data currently held in the DataBox was computed. Only faces whose
+/// boundary data can be reused are present.
+///
+/// \see dg::Actions::ImposeDirichletBoundaryConditions
+template <size_t Dim>
+struct ExternalBoundaryDataCoordinates : db::SimpleTag {
+  using type = DirectionMap<Dim, tnsr::I<DataVector, Dim>>;
+};
 }  // namespace Tags
 
 namespace OptionTags {
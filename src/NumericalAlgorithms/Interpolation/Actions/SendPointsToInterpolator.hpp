@@ -7,6 +7,7 @@
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "NumericalAlgorithms/Interpolation/InterpolationTargetDetail.hpp"
+#include "NumericalAlgorithms/Interpolation/Tags.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
 #include "Utilities/Gsl.hpp"
@@ -18,6 +19,10 @@ namespace Actions {
 /// \brief Sets up points on an `InterpolationTarget` at a new `temporal_id`
 /// and sends these points to an `Interpolator`.
 ///
+/// If `InterpolationTargetTag::compute_target_points` has a
+/// `prepare_for_temporal_id` function, it is called before the points are
+/// computed for the first time at `temporal_id`.
+///
 /// Uses:
 /// - DataBox:
 ///   - `domain::Tags::Domain<3>`
@@ -29,6 +34,7 @@ namespace Actions {
 ///   - `Tags::IndicesOfFilledInterpPoints`
 ///   - `Tags::IndicesOfInvalidInterpPoints`
 ///   - `Tags::InterpolatedVars<InterpolationTargetTag, TemporalId>`
+///   - any tags modified by `prepare_for_temporal_id`
 ///
 /// For requirements on InterpolationTargetTag, see InterpolationTarget
 template <typename InterpolationTargetTag>
@@ -42,6 +48,21 @@ struct SendPointsToInterpolator {
                     Parallel::GlobalCache<Metavariables>& cache,
                     const ArrayIndex& /*array_index*/,
                     const TemporalId& temporal_id) noexcept {
+    using compute_target_points =
+        typename InterpolationTargetTag::compute_target_points;
+    if constexpr (InterpolationTarget_detail::
+                      is_prepare_for_temporal_id_callable_v<
+                          compute_target_points,
+                          gsl::not_null<db::DataBox<DbTags>*>, TemporalId>) {
+      // Only when the points at this temporal_id are computed for the first
+      // time, not when they are recomputed (e.g. by a horizon finder).
+      if (db::get<Tags::InterpolatedVars<InterpolationTargetTag, TemporalId>>(
+              box)
+              .count(temporal_id) == 0) {
+        compute_target_points::prepare_for_temporal_id(make_not_null(&box),
+                                                       temporal_id);
+      }
+    }
     auto coords = InterpolationTarget_detail::block_logical_coords<
         InterpolationTargetTag>(box, tmpl::type_<Metavariables>{}, temporal_id);
     InterpolationTarget_detail::set_up_interpolation<InterpolationTargetTag>(
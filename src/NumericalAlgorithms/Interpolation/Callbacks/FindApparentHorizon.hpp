@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <utility>
 
 #include "ApparentHorizons/FastFlow.hpp"
@@ -14,6 +15,7 @@
 #include "ErrorHandling/Error.hpp"
 #include "Informer/Tags.hpp"
 #include "Informer/Verbosity.hpp"
+#include "NumericalAlgorithms/Interpolation/InterpolationTargetApparentHorizon.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
 #include "Parallel/Printf.hpp"
@@ -70,14 +72,26 @@ namespace callbacks {
 ///   - `::gr::Tags::SpatialChristoffelSecondKind<3,Frame>`
 ///   - `::ah::Tags::FastFlow`
 ///   - `StrahlkorperTags::Strahlkorper<Frame>`
+/// - GlobalCache:
+///   - `intrp::Tags::ApparentHorizon<InterpolationTargetTag, Frame>`
 ///
 /// Modifies:
 /// - DataBox:
 ///   - `::ah::Tags::FastFlow`
 ///   - `StrahlkorperTags::Strahlkorper<Frame>`
+///   - `::ah::Tags::PreviousStrahlkorpers<Frame>`
 ///
 /// This is an InterpolationTargetTag::post_interpolation_callback;
 /// see InterpolationTarget for a description of InterpolationTargetTag.
+///
+/// \note Every FastFlow iteration after the first sends the points of the
+/// prolonged surface to the `Interpolator` and waits for the interpolated
+/// variables. A mode in which the elements near the horizon send their volume
+/// data to the target once per find, so that later iterations interpolate on
+/// the target, is not implemented. It needs a new element-to-target data path
+/// and is left to a separate change. Until then, the time-extrapolated
+/// initial guess (see `ah::Tags::PreviousStrahlkorpers`) is what reduces the
+/// number of iterations, and so of round trips.
 template <typename InterpolationTargetTag, typename Frame>
 struct FindApparentHorizon {
   using observation_types = typename InterpolationTargetTag::
@@ -232,16 +246,30 @@ struct FindApparentHorizon {
     InterpolationTargetTag::post_horizon_find_callback::apply(*box, *cache,
                                                               temporal_id);
 
-    // Prepare for finding horizon at a new time.
-    // For now, the initial guess for the new
-    // horizon is the result of the old one, so we don't need
-    // to modify the strahlkorper.
-    // Eventually we will hold more than one previous guess and
-    // will do time-extrapolation to set the next guess.
-    db::mutate<::ah::Tags::FastFlow>(
-        box, [](const gsl::not_null<::FastFlow*> fast_flow) noexcept {
+    // Prepare for finding horizon at a new time.  The initial guess for
+    // the new horizon is extrapolated in time from the last few horizons
+    // (see TargetPoints::ApparentHorizon::prepare_for_temporal_id).
+    const size_t number_of_previous_horizons =
+        Parallel::get<Tags::ApparentHorizon<InterpolationTargetTag, Frame>>(
+            *cache)
+            .number_of_previous_horizons;
+    db::mutate<::ah::Tags::FastFlow, ::ah::Tags::PreviousStrahlkorpers<Frame>>(
+        box,
+        [&number_of_previous_horizons, &temporal_id](
+            const gsl::not_null<::FastFlow*> fast_flow,
+            const gsl::not_null<
+                typename ::ah::Tags::PreviousStrahlkorpers<Frame>::type*>
+                previous_strahlkorpers,
+            const Strahlkorper<Frame>& strahlkorper) noexcept {
           fast_flow->reset_for_next_find();
-        });
+          previous_strahlkorpers->emplace_back(
+              temporal_id.substep_time().value(), strahlkorper);
+          while (previous_strahlkorpers->size() >
+                 number_of_previous_horizons) {
+            previous_strahlkorpers->pop_front();
+          }
+        },
+        db::get<StrahlkorperTags::Strahlkorper<Frame>>(*box));
     // We return true because we are now done with all the volume data
     // at this temporal_id, so we want it cleaned up.
     return true;
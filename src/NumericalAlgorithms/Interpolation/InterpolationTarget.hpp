@@ -64,7 +64,16 @@ namespace intrp {
 ///      compute tags in `compute_tags`.  If `compute_target_points` has
 ///      an `initialize` function, it must also have a type alias
 ///      `initialization_tags` which is a `tmpl::list` of the tags that are
-///      added by `initialize`.
+///      added by `initialize`. `compute_target_points` can also
+///      (optionally) have a function
+///```
+///   static void prepare_for_temporal_id(
+///       const gsl::not_null<db::DataBox<DbTags>*>,
+///       const Metavariables::temporal_id::type&) noexcept;
+///```
+///      that mutates the `DataBox` before the target points are computed
+///      for the first time at a `temporal_id` (e.g. to extrapolate a trial
+///      surface in time).
 /// - post_interpolation_callback:
 ///      A struct with a type alias `const_global_cache_tags` (listing tags that
 ///      should be read from option parsing), with a type alias
@@ -107,6 +116,14 @@ namespace intrp {
 /// - interpolating_component (used only if not `is_sequential`):
 ///      A type alias for the component that will be interpolating to the
 ///      interpolation target.
+/// - number_of_parallel_chunks (optional):
+///      A `static constexpr size_t` giving the number of chunks into which the
+///      target points are split when they are located in the Domain, and the
+///      interpolated variables when the received data is assembled. The
+///      chunks are processed by the PEs of the node with
+///      `Parallel::parallel_for`, which removes the serial bottleneck for
+///      targets with many points, e.g. high-resolution apparent horizons. If
+///      omitted, the InterpolationTarget does this work on its own PE.
 ///
 /// `Metavariables` must contain the following type aliases:
 /// - interpolator_source_vars:
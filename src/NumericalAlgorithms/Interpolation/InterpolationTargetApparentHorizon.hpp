@@ -5,6 +5,7 @@
 
 #include <cstddef>
 
+#include "ApparentHorizons/ExtrapolateStrahlkorper.hpp"
 #include "ApparentHorizons/FastFlow.hpp"
 #include "ApparentHorizons/Strahlkorper.hpp"
 #include "ApparentHorizons/Tags.hpp"
@@ -18,6 +19,7 @@
 #include "Options/Options.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "ParallelAlgorithms/Initialization/MutateAssign.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Requires.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
@@ -63,14 +65,25 @@ struct ApparentHorizon {
     static constexpr Options::String help = {"Verbosity"};
     using type = ::Verbosity;
   };
-  using options = tmpl::list<InitialGuess, FastFlow, Verbosity>;
+  struct NumberOfPreviousHorizons {
+    static constexpr Options::String help = {
+        "Number of previously found horizons from which the initial guess at "
+        "a new time is extrapolated. With 1 the last horizon is the guess."};
+    using type = size_t;
+    static type suggested_value() noexcept { return 1; }
+    static type lower_bound() noexcept { return 1; }
+    static type upper_bound() noexcept { return 4; }
+  };
+  using options =
+      tmpl::list<InitialGuess, FastFlow, Verbosity, NumberOfPreviousHorizons>;
   static constexpr Options::String help = {
       "Provide an initial guess for the apparent horizon surface\n"
       "(Strahlkorper) and apparent-horizon-finding-algorithm (FastFlow)\n"
       "options."};
 
   ApparentHorizon(Strahlkorper<Frame> initial_guess_in, ::FastFlow fast_flow_in,
-                  ::Verbosity verbosity_in) noexcept;
+                  ::Verbosity verbosity_in,
+                  size_t number_of_previous_horizons_in) noexcept;
 
   ApparentHorizon() = default;
   ApparentHorizon(const ApparentHorizon& /*rhs*/) = default;
@@ -85,6 +98,7 @@ struct ApparentHorizon {
   Strahlkorper<Frame> initial_guess{};
   ::FastFlow fast_flow{};
   ::Verbosity verbosity{::Verbosity::Quiet};
+  size_t number_of_previous_horizons{1};
 };
 
 template <typename Frame>
@@ -135,6 +149,8 @@ namespace TargetPoints {
 ///   than the Strahlkorper in the DataBox, as needed for horizon finding.
 /// - It uses a `FastFlow` in the DataBox.
 /// - It has different options (including those for `FastFlow`).
+/// - The trial surface at a new `temporal_id` is extrapolated in time from
+///   the previously found horizons in `ah::Tags::PreviousStrahlkorpers`.
 ///
 /// For requirements on InterpolationTargetTag, see InterpolationTarget
 template <typename InterpolationTargetTag, typename Frame>
@@ -144,13 +160,15 @@ struct ApparentHorizon {
   using initialization_tags =
       tmpl::append<StrahlkorperTags::items_tags<Frame>,
                    tmpl::list<::ah::Tags::FastFlow,
-                              logging::Tags::Verbosity<InterpolationTargetTag>>,
+                              logging::Tags::Verbosity<InterpolationTargetTag>,
+                              ::ah::Tags::PreviousStrahlkorpers<Frame>>,
                    StrahlkorperTags::compute_items_tags<Frame>>;
   using is_sequential = std::true_type;
 
   using simple_tags =
       tmpl::push_back<StrahlkorperTags::items_tags<Frame>, ::ah::Tags::FastFlow,
-                      logging::Tags::Verbosity<InterpolationTargetTag>>;
+                      logging::Tags::Verbosity<InterpolationTargetTag>,
+                      ::ah::Tags::PreviousStrahlkorpers<Frame>>;
   using compute_tags = typename StrahlkorperTags::compute_items_tags<Frame>;
 
   template <typename DbTags, typename Metavariables>
@@ -164,7 +182,29 @@ struct ApparentHorizon {
     // Put Strahlkorper and its ComputeItems, FastFlow,
     // and verbosity into a new DataBox.
     Initialization::mutate_assign<simple_tags>(
-        box, options.initial_guess, options.fast_flow, options.verbosity);
+        box, options.initial_guess, options.fast_flow, options.verbosity,
+        typename ::ah::Tags::PreviousStrahlkorpers<Frame>::type{});
+  }
+
+  template <typename DbTags, typename TemporalId>
+  static void prepare_for_temporal_id(
+      const gsl::not_null<db::DataBox<DbTags>*> box,
+      const TemporalId& temporal_id) noexcept {
+    if (db::get<::ah::Tags::PreviousStrahlkorpers<Frame>>(*box).empty()) {
+      // Keep the initial guess.
+      return;
+    }
+    db::mutate<StrahlkorperTags::Strahlkorper<Frame>>(
+        box,
+        [&temporal_id](
+            const gsl::not_null<::Strahlkorper<Frame>*> strahlkorper,
+            const typename ::ah::Tags::PreviousStrahlkorpers<Frame>::type&
+                previous_strahlkorpers) noexcept {
+          extrapolate_strahlkorper_in_time(strahlkorper,
+                                           temporal_id.substep_time().value(),
+                                           previous_strahlkorpers);
+        },
+        db::get<::ah::Tags::PreviousStrahlkorpers<Frame>>(*box));
   }
 
   template <typename Metavariables, typename DbTags, typename TemporalId>
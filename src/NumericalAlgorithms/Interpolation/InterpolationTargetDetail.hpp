@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 #include <unordered_set>
@@ -10,12 +11,16 @@
 #include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/IdPair.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/VariablesTag.hpp"
 #include "Domain/BlockLogicalCoordinates.hpp"
+#include "Domain/Structure/BlockId.hpp"
 #include "Domain/Tags.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
+#include "Parallel/ParallelFor.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Literals.hpp"
 #include "Utilities/Requires.hpp"
@@ -87,6 +92,25 @@ auto apply_callback(
   return true;
 }
 
+CREATE_HAS_STATIC_MEMBER_VARIABLE(number_of_parallel_chunks)
+CREATE_HAS_STATIC_MEMBER_VARIABLE_V(number_of_parallel_chunks)
+
+/// The number of chunks into which the points of an InterpolationTarget are
+/// split when they are located in the Domain and when the received
+/// interpolated variables are assembled. This is
+/// `InterpolationTargetTag::number_of_parallel_chunks` if that member exists,
+/// and one otherwise.
+template <typename InterpolationTargetTag>
+constexpr size_t number_of_parallel_chunks() noexcept {
+  if constexpr (has_number_of_parallel_chunks_v<InterpolationTargetTag>) {
+    static_assert(InterpolationTargetTag::number_of_parallel_chunks > 0,
+                  "An InterpolationTarget needs at least one chunk.");
+    return InterpolationTargetTag::number_of_parallel_chunks;
+  } else {
+    return 1;
+  }
+}
+
 CREATE_HAS_STATIC_MEMBER_VARIABLE(fill_invalid_points_with)
 CREATE_HAS_STATIC_MEMBER_VARIABLE_V(fill_invalid_points_with)
 
@@ -357,6 +381,11 @@ void add_received_variables(
         // size (but could contain garbage, since below we are filling it).
         const size_t npts_dest = vars_dest.number_of_grid_points();
         const size_t nvars = vars_dest.number_of_independent_components;
+        // The points to copy, as pairs of the index of the source and of the
+        // point in the source. They are selected first so that the copies of
+        // the variables, which are independent, can be split among the PEs of
+        // the node.
+        std::vector<std::pair<size_t, size_t>> accepted_points{};
         for (size_t j = 0; j < global_offsets.size(); ++j) {
           const size_t npts_src = global_offsets[j].size();
           for (size_t i = 0; i < npts_src; ++i) {
@@ -374,16 +403,60 @@ void add_received_variables(
             if ((*indices_of_filled)[temporal_id]
                     .insert(global_offsets[j][i])
                     .second) {
-              for (size_t v = 0; v < nvars; ++v) {
-                // clang-tidy: no pointer arithmetic
-                vars_dest.data()[global_offsets[j][i] +    // NOLINT
-                                 v * npts_dest] =          // NOLINT
-                    vars_src[j].data()[i + v * npts_src];  // NOLINT
-              }
+              accepted_points.emplace_back(j, i);
             }
           }
         }
+        Parallel::parallel_for(
+            nvars, number_of_parallel_chunks<InterpolationTargetTag>(),
+            [&accepted_points, &global_offsets, &npts_dest, &vars_dest,
+             &vars_src](const size_t first_var,
+                        const size_t last_var) noexcept {
+              for (size_t v = first_var; v < last_var; ++v) {
+                for (const auto& [j, i] : accepted_points) {
+                  // clang-tidy: no pointer arithmetic
+                  vars_dest.data()[global_offsets[j][i] +  // NOLINT
+                                   v * npts_dest] =        // NOLINT
+                      vars_src[j]
+                          .data()[i + v * global_offsets[j].size()];  // NOLINT
+                }
+              }
+            });
+      });
+}
+
+/// Computes the block logical coordinates of `points`, splitting the points
+/// into `number_of_chunks` contiguous ranges that are located by the PEs of
+/// the node with `Parallel::parallel_for`.
+///
+/// Locating a point requires inverting the map of (up to) every Block, so
+/// for dense surfaces this dominates the cost of sending points to the
+/// Interpolator. Each chunk calls `::block_logical_coordinates` on a
+/// non-owning view of its range of `points` and writes into its own range of
+/// the result, so the result is identical to that of a single call.
+template <size_t VolumeDim, typename Frame>
+auto block_logical_coordinates_in_chunks(
+    const Domain<VolumeDim>& domain,
+    const tnsr::I<DataVector, VolumeDim, Frame>& points,
+    const size_t number_of_chunks) noexcept {
+  const size_t number_of_points = get<0>(points).size();
+  std::vector<boost::optional<
+      IdPair<domain::BlockId, tnsr::I<double, VolumeDim, ::Frame::Logical>>>>
+      result(number_of_points);
+  Parallel::parallel_for(
+      number_of_points, number_of_chunks,
+      [&domain, &points, &result](const size_t begin,
+                                  const size_t end) noexcept {
+        tnsr::I<DataVector, VolumeDim, Frame> chunk_points{};
+        for (size_t d = 0; d < VolumeDim; ++d) {
+          make_const_view(make_not_null(&std::as_const(chunk_points.get(d))),
+                          points.get(d), begin, end - begin);
+        }
+        auto chunk_result = ::block_logical_coordinates(domain, chunk_points);
+        std::move(chunk_result.begin(), chunk_result.end(),
+                  result.begin() + static_cast<std::ptrdiff_t>(begin));
       });
+  return result;
 }
 
 /// Computes the block logical coordinates of an InterpolationTarget.
@@ -403,9 +476,11 @@ auto block_logical_coords(const db::DataBox<DbTags>& box,
                           const TemporalId& temporal_id) noexcept {
   const auto& domain =
       db::get<domain::Tags::Domain<Metavariables::volume_dim>>(box);
-  return ::block_logical_coordinates(
-      domain, InterpolationTargetTag::compute_target_points::points(
-                  box, meta, temporal_id));
+  return block_logical_coordinates_in_chunks(
+      domain,
+      InterpolationTargetTag::compute_target_points::points(box, meta,
+                                                            temporal_id),
+      number_of_parallel_chunks<InterpolationTargetTag>());
 }
 
 /// This is a version of block_logical_coords for when the coords
@@ -416,8 +491,9 @@ auto block_logical_coords(const db::DataBox<DbTags>& box,
                           const tmpl::type_<Metavariables>& meta) noexcept {
   const auto& domain =
       db::get<domain::Tags::Domain<Metavariables::volume_dim>>(box);
-  return ::block_logical_coordinates(
-      domain, InterpolationTargetTag::compute_target_points::points(box, meta));
+  return block_logical_coordinates_in_chunks(
+      domain, InterpolationTargetTag::compute_target_points::points(box, meta),
+      number_of_parallel_chunks<InterpolationTargetTag>());
 }
 
 /// Initializes InterpolationTarget's variables storage and lists of indices
@@ -481,5 +557,7 @@ void set_up_interpolation(
 
 CREATE_IS_CALLABLE(should_interpolate)
 CREATE_IS_CALLABLE_V(should_interpolate)
+CREATE_IS_CALLABLE(prepare_for_temporal_id)
+CREATE_IS_CALLABLE_V(prepare_for_temporal_id)
 }  // namespace InterpolationTarget_detail
 }  // namespace intrp
@@ -24,6 +24,8 @@ template <size_t Dim>
 class Mesh;
 
 namespace domain {
+template <size_t Dim, typename TargetFrame>
+class SeparableInverseJacobian;
 namespace Tags {
 template <size_t Dim>
 struct Mesh;
@@ -150,6 +152,23 @@ auto partial_derivatives(
         inverse_jacobian) noexcept
     -> Variables<db::wrap_tags_in<Tags::deriv, DerivativeTags,
                                   tmpl::size_t<Dim>, DerivativeFrame>>;
+
+/// \brief Compute the partial derivatives with a separable map, where
+/// \f$\partial_i u = (\partial\xi^i/\partial x^i) \partial_{\xi^i} u\f$
+/// (no sum).
+///
+/// This avoids the contraction with the full inverse Jacobian and reads the
+/// one-dimensional factors of `inverse_jacobian` instead of `Dim * Dim`
+/// volume `DataVector`s.
+template <typename DerivativeTags, typename VariableTags, size_t Dim,
+          typename DerivativeFrame>
+void partial_derivatives(
+    gsl::not_null<Variables<db::wrap_tags_in<
+        Tags::deriv, DerivativeTags, tmpl::size_t<Dim>, DerivativeFrame>>*>
+        du,
+    const Variables<VariableTags>& u, const Mesh<Dim>& mesh,
+    const domain::SeparableInverseJacobian<Dim, DerivativeFrame>&
+        inverse_jacobian) noexcept;
 // @}
 
 namespace Tags {
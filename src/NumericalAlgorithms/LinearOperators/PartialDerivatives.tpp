@@ -8,9 +8,12 @@
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
 #include "DataStructures/Matrix.hpp"
 #include "DataStructures/Transpose.hpp"
 #include "DataStructures/Variables.hpp"
+#include "Domain/SeparableInverseJacobian.hpp"
+#include "ErrorHandling/Assert.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Utilities/Algorithm.hpp"
@@ -107,6 +110,51 @@ void partial_derivatives_impl(
     }
   }
 }
+
+// With a separable map each derivative is the logical derivative scaled by a
+// factor that only varies along one dimension, so we loop over the grid in
+// blocks in which the factor is constant along the fastest-varying dimensions.
+template <typename DerivativeTags, size_t Dim, typename DerivativeFrame>
+void partial_derivatives_impl(
+    const gsl::not_null<Variables<db::wrap_tags_in<
+        Tags::deriv, DerivativeTags, tmpl::size_t<Dim>, DerivativeFrame>>*>
+        du,
+    const std::array<const double*, Dim>& logical_partial_derivatives_of_u,
+    const domain::SeparableInverseJacobian<Dim, DerivativeFrame>&
+        inverse_jacobian) noexcept {
+  constexpr size_t number_of_independent_components =
+      Variables<DerivativeTags>::number_of_independent_components;
+  double* pdu = du->data();
+  const size_t num_grid_points = du->number_of_grid_points();
+  const Index<Dim>& extents = inverse_jacobian.extents();
+  ASSERT(extents.product() == num_grid_points,
+         "The separable inverse Jacobian has "
+             << extents.product() << " grid points, but the variables have "
+             << num_grid_points);
+
+  for (size_t component_index = 0;
+       component_index < number_of_independent_components; ++component_index) {
+    size_t stride = 1;
+    for (size_t deriv_index = 0; deriv_index < Dim; ++deriv_index) {
+      const double* const factor = inverse_jacobian.factor(deriv_index).data();
+      const size_t extent = extents[deriv_index];
+      // clang-tidy: no pointer arithmetic
+      const double* logical_du =
+          gsl::at(logical_partial_derivatives_of_u, deriv_index) +  // NOLINT
+          component_index * num_grid_points;
+      const size_t number_of_blocks = num_grid_points / (stride * extent);
+      for (size_t block = 0; block < number_of_blocks; ++block) {
+        for (size_t j = 0; j < extent; ++j) {
+          const double f = factor[j];  // NOLINT
+          for (size_t i = 0; i < stride; ++i) {
+            *(pdu++) = f * *(logical_du++);  // NOLINT
+          }
+        }
+      }
+      stride *= extent;
+    }
+  }
+}
 }  // namespace partial_derivatives_detail
 
 template <typename DerivativeTags, typename VariableTags, size_t Dim>
@@ -221,6 +269,51 @@ void partial_derivatives(
       inverse_jacobian);
 }
 
+template <typename DerivativeTags, typename VariableTags, size_t Dim,
+          typename DerivativeFrame>
+void partial_derivatives(
+    const gsl::not_null<Variables<db::wrap_tags_in<
+        Tags::deriv, DerivativeTags, tmpl::size_t<Dim>, DerivativeFrame>>*>
+        du,
+    const Variables<VariableTags>& u, const Mesh<Dim>& mesh,
+    const domain::SeparableInverseJacobian<Dim, DerivativeFrame>&
+        inverse_jacobian) noexcept {
+  auto& partial_derivatives_of_u = *du;
+  // For mutating compute items we must set the size.
+  if (UNLIKELY(partial_derivatives_of_u.number_of_grid_points() !=
+               mesh.number_of_grid_points())) {
+    partial_derivatives_of_u.initialize(mesh.number_of_grid_points());
+  }
+
+  // clang-tidy: cppcoreguidelines-no-malloc
+  // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+  std::unique_ptr<double[], decltype(&free)> logical_derivs_data(
+      static_cast<double*>(
+          malloc(Dim * u.number_of_grid_points() *  // NOLINT
+                 Variables<DerivativeTags>::number_of_independent_components *
+                 sizeof(double))),
+      &free);
+  std::array<double*, Dim> logical_derivs{};
+  for (size_t i = 0; i < Dim; ++i) {
+    gsl::at(logical_derivs, i) =
+        &(logical_derivs_data
+              [i * u.number_of_grid_points() *
+               Variables<DerivativeTags>::number_of_independent_components]);
+  }
+  partial_derivatives_detail::LogicalImpl<
+      Dim, VariableTags, DerivativeTags>::apply(make_not_null(&logical_derivs),
+                                                &partial_derivatives_of_u, u,
+                                                mesh);
+
+  std::array<const double*, Dim> const_logical_derivs{};
+  for (size_t i = 0; i < Dim; ++i) {
+    gsl::at(const_logical_derivs, i) = gsl::at(logical_derivs, i);
+  }
+  partial_derivatives_detail::partial_derivatives_impl<DerivativeTags>(
+      make_not_null(&partial_derivatives_of_u), const_logical_derivs,
+      inverse_jacobian);
+}
+
 template <typename DerivativeTags, typename VariableTags, size_t Dim,
           typename DerivativeFrame>
 Variables<db::wrap_tags_in<Tags::deriv, DerivativeTags, tmpl::size_t<Dim>,
@@ -2,16 +2,23 @@
 // See LICENSE.txt for details.
 
 /// \file
-/// Declares function RootFinder::newton_raphson
+/// Declares functions RootFinder::newton_raphson and
+/// RootFinder::safeguarded_newton_raphson
 
 #pragma once
 
+#include <algorithm>
 #include <boost/math/tools/roots.hpp>
+#include <cmath>
+#include <cstddef>
 #include <functional>
 #include <limits>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
+#include "ErrorHandling/Assert.hpp"
 #include "ErrorHandling/Exceptions.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/MakeString.hpp"
 
 namespace RootFinder {
@@ -117,4 +124,104 @@ DataVector newton_raphson(const Function& f, const DataVector& initial_guess,
   return result_vector;
 }
 
+/*!
+ * \ingroup NumericalAlgorithmsGroup
+ * \brief Finds the roots of the function `f` on all elements of a `DataVector`
+ * at once with a safeguarded Newton-Raphson method.
+ *
+ * In contrast to the `DataVector` overload of `RootFinder::newton_raphson`,
+ * which solves each element in turn, `f` is evaluated on all elements in one
+ * call. `f` is a unary invokable that takes a `const DataVector&` and returns
+ * a `std::pair<DataVector, DataVector>` holding the function values and
+ * derivatives, so the function evaluations can be vectorized. The root of each
+ * element must be bracketed by `lower_bound` and `upper_bound`. The bracket of
+ * each element shrinks as the iteration proceeds, and a Newton step that would
+ * leave the bracket is replaced by a bisection step, so every bracketed root
+ * is found.
+ *
+ * On input `x` holds the initial guesses, which must lie within the brackets.
+ * An element has converged once its last step was smaller than
+ * `absolute_tolerance + relative_tolerance * abs(x)`.
+ *
+ * \returns For each element, whether it has converged. Elements where `f` has
+ * the same sign on both bounds, or that don't converge within
+ * `max_iterations` iterations, are `false` and hold the last iterate.
+ */
+template <typename Function>
+std::vector<bool> safeguarded_newton_raphson(
+    const gsl::not_null<DataVector*> x, const Function& f,
+    DataVector lower_bound, DataVector upper_bound,
+    const double absolute_tolerance, const double relative_tolerance,
+    const size_t max_iterations = 100) noexcept {
+  const size_t num_points = x->size();
+  ASSERT(lower_bound.size() == num_points and
+             upper_bound.size() == num_points,
+         "The bounds must have the same size as the initial guess, but have "
+             << lower_bound.size() << " and " << upper_bound.size()
+             << " instead of " << num_points);
+  std::vector<bool> converged(num_points, false);
+  // Elements that are done iterating, either because they have converged or
+  // because their root isn't bracketed
+  std::vector<bool> done(num_points, false);
+  size_t num_done = 0;
+  // We only need the signs of `f` at the lower bound to update the brackets
+  const DataVector f_at_lower_bound = f(lower_bound).first;
+  {
+    const DataVector f_at_upper_bound = f(upper_bound).first;
+    for (size_t i = 0; i < num_points; ++i) {
+      if (f_at_lower_bound[i] == 0.0 or f_at_upper_bound[i] == 0.0) {
+        (*x)[i] = f_at_lower_bound[i] == 0.0 ? lower_bound[i] : upper_bound[i];
+        converged[i] = true;
+        done[i] = true;
+        ++num_done;
+      } else if ((f_at_lower_bound[i] > 0.0) == (f_at_upper_bound[i] > 0.0)) {
+        done[i] = true;
+        ++num_done;
+      }
+    }
+  }
+
+  for (size_t iteration = 0;
+       iteration < max_iterations and num_done < num_points; ++iteration) {
+    const auto [values, derivatives] = f(*x);
+    for (size_t i = 0; i < num_points; ++i) {
+      if (done[i]) {
+        continue;
+      }
+      if (values[i] == 0.0) {
+        converged[i] = true;
+        done[i] = true;
+        ++num_done;
+        continue;
+      }
+      // Shrink the bracket to the side of the current iterate that still
+      // contains the root
+      if ((values[i] > 0.0) == (f_at_lower_bound[i] > 0.0)) {
+        lower_bound[i] = (*x)[i];
+      } else {
+        upper_bound[i] = (*x)[i];
+      }
+      const double bracket_min = std::min(lower_bound[i], upper_bound[i]);
+      const double bracket_max = std::max(lower_bound[i], upper_bound[i]);
+      double next_x = 0.5 * (lower_bound[i] + upper_bound[i]);
+      if (derivatives[i] != 0.0) {
+        const double newton_x = (*x)[i] - values[i] / derivatives[i];
+        if (newton_x > bracket_min and newton_x < bracket_max) {
+          next_x = newton_x;
+        }
+      }
+      const double step = std::abs(next_x - (*x)[i]);
+      (*x)[i] = next_x;
+      if (step <= absolute_tolerance + relative_tolerance * std::abs(next_x) or
+          bracket_max - bracket_min <=
+              absolute_tolerance + relative_tolerance * std::abs(next_x)) {
+        converged[i] = true;
+        done[i] = true;
+        ++num_done;
+      }
+    }
+  }
+  return converged;
+}
+
 }  // namespace RootFinder
@@ -13,12 +13,14 @@
 #include "DataStructures/SpinWeighted.hpp"
 #include "DataStructures/Tags/TempTensor.hpp"
 #include "DataStructures/TempBuffer.hpp"  // IWYU pragma: keep
+#include "ErrorHandling/Assert.hpp"
 #include "NumericalAlgorithms/Spectral/ComplexDataView.hpp"
 #include "NumericalAlgorithms/Spectral/SwshCoefficients.hpp"
 #include "NumericalAlgorithms/Spectral/SwshCollocation.hpp"
 #include "NumericalAlgorithms/Spectral/SwshSettings.hpp"
 #include "NumericalAlgorithms/Spectral/SwshTags.hpp"
 #include "NumericalAlgorithms/Spectral/SwshTransform.hpp"
+#include "NumericalAlgorithms/Spectral/SwshTransformPlan.hpp"
 #include "Utilities/ForceInline.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
@@ -126,59 +128,6 @@ struct dispatch_to_compute_coefficients_of_derivative {
   }
 };
 
-// Helper function for dealing with the parameter packs in the utilities which
-// evaluate several spin-weighted derivatives at once. The `apply` function of
-// this struct locates the like-spin set of paired modes and nodes, and calls
-// the member function of `SwshTransform` or `InverseSwshTransform` to perform
-// the spin-weighted transform. This function is a friend of both
-// `SwshTransform` and `InverseSwshTransform` to gain access to the private
-// `apply_to_vectors`.
-// The calling code will pass as tuples a superset of the quantities to be
-// transformed, in the same order as the tags provided to `TagList`. The
-// `modal_tuple` must be the storage destinations of the transforms in the
-// same order as the `nodal_tuple`. The set of nodal tags to be transformed are
-// the `TransformTags...` determined by the `SwshTransform` or
-// `InverseSwshTransform`. The reason for using `tuple`s rather than
-// `TaggedTuple`s or similar is to pass around spin-weighted vectors directly,
-// rather than `Scalar`s, which allows for more condensed forwarding code.
-template <typename Transform, typename TagList>
-struct dispatch_to_transform;
-
-template <ComplexRepresentation Representation, typename... TransformTags,
-          typename TagList>
-struct dispatch_to_transform<
-    SwshTransform<tmpl::list<TransformTags...>, Representation>, TagList> {
-  template <typename... ModalTypes, typename... NodalTypes>
-  static void apply(const gsl::not_null<std::tuple<ModalTypes...>*> modal_tuple,
-                    const std::tuple<NodalTypes...>& nodal_tuple,
-                    const size_t l_max,
-                    const size_t number_of_radial_points) noexcept {
-    SwshTransform<tmpl::list<TransformTags...>, Representation>::
-        apply_to_vectors(
-            get<tmpl::index_of<TagList, TransformTags>::value>(*modal_tuple)...,
-            get<tmpl::index_of<TagList, TransformTags>::value>(nodal_tuple)...,
-            l_max, number_of_radial_points);
-  }
-};
-
-template <ComplexRepresentation Representation, typename... TransformTags,
-          typename TagList>
-struct dispatch_to_transform<
-    InverseSwshTransform<tmpl::list<TransformTags...>, Representation>,
-    TagList> {
-  template <typename... NodalTypes, typename... ModalTypes>
-  static void apply(const gsl::not_null<std::tuple<NodalTypes...>*> nodal_tuple,
-                    const std::tuple<ModalTypes...>& modal_tuple,
-                    const size_t l_max,
-                    const size_t number_of_radial_points) noexcept {
-    InverseSwshTransform<tmpl::list<TransformTags...>, Representation>::
-        apply_to_vectors(
-            get<tmpl::index_of<TagList, TransformTags>::value>(*nodal_tuple)...,
-            *get<tmpl::index_of<TagList, TransformTags>::value>(modal_tuple)...,
-            l_max, number_of_radial_points);
-  }
-};
-
 // template 'implementation' for the DataBox mutate-compatible interface to
 // spin-weighted derivative evaluation. This impl version is needed to have easy
 // access to the `UniqueDifferentiatedFromTagList` as a parameter pack
@@ -233,22 +182,18 @@ struct AngularDerivativesImpl<tmpl::list<DerivativeTags...>,
       const typename UniqueDifferentiatedFromTags::type::type&... inputs,
       const size_t l_max, const size_t number_of_radial_points) noexcept {
     // perform the forward transform on the minimal set of input nodal
-    // quantities to obtain all of the requested derivatives
-    using ForwardTransformList =
-        make_transform_list_from_derivative_tags<Representation,
-                                                 tmpl::list<DerivativeTags...>>;
-
-    tmpl::for_each<ForwardTransformList>(
-        [&number_of_radial_points, &l_max, &inputs...,
-         &transform_of_inputs...](auto transform_v) noexcept {
-          using transform = typename decltype(transform_v)::type;
-          auto input_transforms = std::make_tuple(transform_of_inputs...);
-          dispatch_to_transform<transform,
-                                tmpl::list<UniqueDifferentiatedFromTags...>>::
-              apply(make_not_null(&input_transforms),
-                    std::forward_as_tuple(inputs...), l_max,
-                    number_of_radial_points);
-        });
+    // quantities to obtain all of the requested derivatives. The transforms
+    // are collected in a plan so that all of those of equal spin weight are
+    // performed in a single libsharp job. The plan is shared by all of the
+    // angular derivatives evaluated on this thread, so its metadata and
+    // buffers are only set up once for each `l_max`.
+    auto& transform_plan = cached_transform_plan<Representation>(l_max);
+    ASSERT(transform_plan.number_of_pending_transforms() == 0,
+           "The cached transform plan must be empty before it is used to "
+           "compute angular derivatives.");
+    EXPAND_PACK_LEFT_TO_RIGHT(
+        transform_plan.add_transform(transform_of_inputs, inputs));
+    transform_plan.execute();
 
     // apply the modal derivative factors and place the result in the
     // `transform_of_derivatives`
@@ -261,21 +206,9 @@ struct AngularDerivativesImpl<tmpl::list<DerivativeTags...>,
 
     // perform the inverse transform on the derivative results, placing the
     // result in the nodal `derivatives` passed by pointer.
-    using InverseTransformList =
-        make_inverse_transform_list<Representation,
-                                    tmpl::list<DerivativeTags...>>;
-
-    tmpl::for_each<InverseTransformList>([&number_of_radial_points, &l_max,
-                                          &derivatives...,
-                                          &transform_of_derivatives...](
-                                             auto transform_v) noexcept {
-      using transform = typename decltype(transform_v)::type;
-      auto derivative_tuple = std::make_tuple(derivatives...);
-      dispatch_to_transform<transform, tmpl::list<DerivativeTags...>>::apply(
-          make_not_null(&derivative_tuple),
-          std::make_tuple(transform_of_derivatives...), l_max,
-          number_of_radial_points);
-    });
+    EXPAND_PACK_LEFT_TO_RIGHT(transform_plan.add_inverse_transform(
+        derivatives, *transform_of_derivatives));
+    transform_plan.execute();
   }
 };
 
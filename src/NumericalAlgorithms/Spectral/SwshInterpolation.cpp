@@ -19,6 +19,7 @@
 #include "NumericalAlgorithms/Spectral/SwshCoefficients.hpp"
 #include "NumericalAlgorithms/Spectral/SwshCollocation.hpp"
 #include "NumericalAlgorithms/Spectral/SwshTransform.hpp"
+#include "Parallel/ParallelFor.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/StaticCache.hpp"
@@ -332,9 +333,10 @@ const ClenshawRecurrenceConstants<Spin>& cached_clenshaw_factors(
 }
 
 SwshInterpolator::SwshInterpolator(const DataVector& theta,
-                                   const DataVector& phi,
-                                   const size_t l_max) noexcept
+                                   const DataVector& phi, const size_t l_max,
+                                   const size_t number_of_chunks) noexcept
     : l_max_{l_max},
+      number_of_chunks_{number_of_chunks},
       raw_libsharp_coefficient_buffer_{
           size_of_libsharp_coefficient_vector(l_max)},
       raw_goldberg_coefficient_buffer_{square(l_max + 1)} {
@@ -357,6 +359,26 @@ SwshInterpolator::SwshInterpolator(const DataVector& theta,
   }
 }
 
+SwshInterpolator::SwshInterpolator(const SwshInterpolator& parent,
+                                   const size_t offset,
+                                   const size_t size) noexcept
+    : l_max_{parent.l_max_} {
+  make_const_view(make_not_null(&cos_theta_), parent.cos_theta_, offset, size);
+  make_const_view(make_not_null(&sin_theta_), parent.sin_theta_, offset, size);
+  make_const_view(make_not_null(&cos_theta_over_two_),
+                  parent.cos_theta_over_two_, offset, size);
+  make_const_view(make_not_null(&sin_theta_over_two_),
+                  parent.sin_theta_over_two_, offset, size);
+  cos_m_phi_ = std::vector<DataVector>(parent.cos_m_phi_.size());
+  sin_m_phi_ = std::vector<DataVector>(parent.sin_m_phi_.size());
+  for (size_t m = 0; m < cos_m_phi_.size(); ++m) {
+    make_const_view(make_not_null(&cos_m_phi_[m]), parent.cos_m_phi_[m],
+                    offset, size);
+    make_const_view(make_not_null(&sin_m_phi_[m]), parent.sin_m_phi_[m],
+                    offset, size);
+  }
+}
+
 template <int Spin>
 void SwshInterpolator::interpolate(
     const gsl::not_null<SpinWeighted<ComplexDataVector, Spin>*> interpolated,
@@ -367,6 +389,21 @@ void SwshInterpolator::interpolate(
          "SwshInterpolator. The SwshInterpolator must be constructed with the "
          "angular coordinates to perform interpolation.");
   interpolated->destructive_resize(cos_theta_.size());
+  if (number_of_chunks_ > 1) {
+    // each chunk sums into its own part of `interpolated`
+    Parallel::parallel_for(
+        cos_theta_.size(), number_of_chunks_,
+        [this, &interpolated, &goldberg_modes](const size_t begin,
+                                               const size_t end) noexcept {
+          const SwshInterpolator chunk_interpolator{*this, begin, end - begin};
+          SpinWeighted<ComplexDataVector, Spin> interpolated_chunk;
+          interpolated_chunk.set_data_ref(interpolated->data().data() + begin,
+                                          end - begin);
+          chunk_interpolator.interpolate(make_not_null(&interpolated_chunk),
+                                         goldberg_modes);
+        });
+    return;
+  }
   interpolated->data() = 0.0;
 
   // used only if s=0;
@@ -612,6 +649,7 @@ void SwshInterpolator::clenshaw_sum(
 
 void SwshInterpolator::pup(PUP::er& p) noexcept {
   p | l_max_;
+  p | number_of_chunks_;
   p | cos_theta_;
   p | sin_theta_;
   p | cos_theta_over_two_;
@@ -98,6 +98,13 @@ class SpinWeightedSphericalHarmonic {
  * called on several different coefficients or collocation sets, and of
  * different spin-weights.
  *
+ * The Clenshaw sum is independent for each target point. If the interpolator
+ * is constructed with `number_of_chunks` larger than one, the target points
+ * are split into that many contiguous chunks, which `Parallel::parallel_for`
+ * shares among the PEs of the node. Every point goes through the same
+ * operations for any number of chunks, so the results agree up to the
+ * roundoff of differently vectorized loops.
+ *
  * Recurrence constants
  * --------------------
  * This utility obtains the Clenshaw interpolation constants from a
@@ -241,7 +248,7 @@ class SwshInterpolator {
   ~SwshInterpolator() noexcept = default;
 
   SwshInterpolator(const DataVector& theta, const DataVector& phi,
-                   size_t l_max) noexcept;
+                   size_t l_max, size_t number_of_chunks = 1) noexcept;
 
   /*!
    * \brief Perform the Clenshaw recurrence sum, returning by pointer
@@ -359,7 +366,13 @@ class SwshInterpolator {
   void pup(PUP::er& p) noexcept;  // NOLINT
 
  private:
+  // An interpolator over the `size` target points of `parent` starting at
+  // `offset`, whose point-dependent caches are views into those of `parent`.
+  SwshInterpolator(const SwshInterpolator& parent, size_t offset,
+                   size_t size) noexcept;
+
   size_t l_max_ = 0;
+  size_t number_of_chunks_ = 1;
   DataVector cos_theta_;
   DataVector sin_theta_;
   DataVector cos_theta_over_two_;
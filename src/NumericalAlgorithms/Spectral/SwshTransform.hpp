@@ -116,11 +116,6 @@ void inverse_swsh_transform_impl(
     std::index_sequence<Is...> /*meta*/,
     gsl::not_null<SpinWeighted<ComplexDataVector, Spin>*> first_collocation,
     const NodalThenModalTypes&... collocations_then_coefficients) noexcept;
-
-// forward declaration for friend specification of helper from
-// `SwshDerivatives.hpp`
-template <typename Transform, typename FullTagList>
-struct dispatch_to_transform;
 }  // namespace detail
 
 /*!
@@ -453,10 +448,6 @@ struct SwshTransform<tmpl::list<TransformTags...>, Representation> {
       gsl::not_null<SpinWeighted<ComplexModalVector, FriendSpin>*>,
       const CoefficientThenCollocationTypes&...) noexcept;
 
-  // friend declaration for helper function from `SwshDerivatives.hpp`
-  template <typename Transform, typename FullTagList>
-  friend struct detail::dispatch_to_transform;
-
  private:
   static void apply_to_vectors(
       const gsl::not_null<typename Tags::SwshTransform<
@@ -537,10 +528,6 @@ struct InverseSwshTransform<tmpl::list<TransformTags...>, Representation> {
       gsl::not_null<SpinWeighted<ComplexDataVector, FriendSpin>*>,
       const CollocationThenCoefficientTypes&...) noexcept;
 
-  // friend declaration for helper function from `SwshDerivatives.hpp`
-  template <typename Transform, typename FullTagList>
-  friend struct detail::dispatch_to_transform;
-
  private:
   static void apply_to_vectors(
       const gsl::not_null<typename TransformTags::type::type*>... collocations,
@@ -0,0 +1,144 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "NumericalAlgorithms/Spectral/SwshTransformPlan.hpp"
+
+#include <complex>
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+#include "DataStructures/ComplexDataVector.hpp"
+#include "DataStructures/ComplexModalVector.hpp"
+#include "NumericalAlgorithms/Spectral/ComplexDataView.hpp"
+#include "NumericalAlgorithms/Spectral/SwshCoefficients.hpp"
+#include "NumericalAlgorithms/Spectral/SwshCollocation.hpp"
+#include "NumericalAlgorithms/Spectral/SwshTransform.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace Spectral {
+namespace Swsh {
+
+template <ComplexRepresentation Representation>
+SwshTransformPlan<Representation>::SwshTransformPlan(
+    const size_t l_max) noexcept
+    : l_max_{l_max},
+      collocation_metadata_{
+          &cached_collocation_metadata<Representation>(l_max)},
+      alm_info_{cached_coefficients_metadata(l_max).get_sharp_alm_info()} {}
+
+template <ComplexRepresentation Representation>
+void SwshTransformPlan<Representation>::execute() noexcept {
+  const size_t number_of_angular_points =
+      number_of_swsh_collocation_points(l_max_);
+
+  // Assembles the libsharp pointers for all of the transforms of a single
+  // spin weight and direction and executes them as a single job set. The
+  // views are reserved up front so that the pointers into them remain valid.
+  const auto execute_transforms =
+      [this, &number_of_angular_points](
+          const gsl::not_null<transform_list*> transforms,
+          const sharp_jobtype& jobtype, const int spin) noexcept {
+        size_t number_of_spheres = 0;
+        for (const auto& coefficients_and_collocation : *transforms) {
+          number_of_spheres +=
+              coefficients_and_collocation.second->size() /
+              number_of_angular_points;
+        }
+        views_.clear();
+        views_.reserve(number_of_spheres);
+        collocation_data_.clear();
+        collocation_data_.reserve(2 * number_of_spheres);
+        coefficient_data_.clear();
+        coefficient_data_.reserve(2 * number_of_spheres);
+        for (const auto& coefficients_and_collocation : *transforms) {
+          // the inverse transform does not use the input collocation data, so
+          // the conjugation for negative spin is only needed for the forward
+          // transform
+          detail::append_libsharp_collocation_pointers(
+              make_not_null(&collocation_data_), make_not_null(&views_),
+              make_not_null(coefficients_and_collocation.second), l_max_,
+              jobtype == SHARP_ALM2MAP or spin >= 0);
+          detail::append_libsharp_coefficient_pointers(
+              make_not_null(&coefficient_data_),
+              make_not_null(coefficients_and_collocation.first), l_max_);
+        }
+        // libsharp considers two arrays per transform when spin is not zero.
+        detail::execute_libsharp_transform_set(
+            jobtype, spin, make_not_null(&coefficient_data_),
+            make_not_null(&collocation_data_),
+            make_not_null(collocation_metadata_), alm_info_,
+            (spin == 0 ? 2 : 1) * number_of_spheres);
+        if (spin < 0) {
+          for (auto& view : views_) {
+            view.conjugate();
+          }
+        }
+        if (jobtype == SHARP_ALM2MAP) {
+          for (auto& view : views_) {
+            view.copy_back_to_source();
+          }
+        }
+        transforms->clear();
+      };
+
+  for (int spin = -2; spin <= 2; ++spin) {
+    if (not gsl::at(forward_transforms_, spin + 2).empty()) {
+      execute_transforms(make_not_null(&gsl::at(forward_transforms_, spin + 2)),
+                         SHARP_MAP2ALM, spin);
+    }
+  }
+  for (int spin = -2; spin <= 2; ++spin) {
+    if (not gsl::at(inverse_transforms_, spin + 2).empty()) {
+      execute_transforms(make_not_null(&gsl::at(inverse_transforms_, spin + 2)),
+                         SHARP_ALM2MAP, spin);
+    }
+  }
+}
+
+template <ComplexRepresentation Representation>
+size_t SwshTransformPlan<Representation>::number_of_pending_transforms()
+    const noexcept {
+  const size_t number_of_angular_points =
+      number_of_swsh_collocation_points(l_max_);
+  const size_t number_of_coefficients =
+      size_of_libsharp_coefficient_vector(l_max_);
+  size_t result = 0;
+  for (size_t i = 0; i < 5; ++i) {
+    for (const auto& coefficients_and_collocation :
+         gsl::at(forward_transforms_, i)) {
+      result += coefficients_and_collocation.second->size() /
+                number_of_angular_points;
+    }
+    for (const auto& coefficients_and_collocation :
+         gsl::at(inverse_transforms_, i)) {
+      result +=
+          coefficients_and_collocation.first->size() / number_of_coefficients;
+    }
+  }
+  return result;
+}
+
+template <ComplexRepresentation Representation>
+SwshTransformPlan<Representation>& cached_transform_plan(
+    const size_t l_max) noexcept {
+  thread_local std::unordered_map<size_t, SwshTransformPlan<Representation>>
+      plans{};
+  return plans.try_emplace(l_max, l_max).first->second;
+}
+
+#define GET_REPRESENTATION(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATION(r, data)                                \
+  template class SwshTransformPlan<GET_REPRESENTATION(data)>; \
+  template SwshTransformPlan<GET_REPRESENTATION(data)>&       \
+  cached_transform_plan<GET_REPRESENTATION(data)>(size_t) noexcept;
+
+GENERATE_INSTANTIATIONS(INSTANTIATION, (ComplexRepresentation::Interleaved,
+                                        ComplexRepresentation::RealsThenImags))
+
+#undef INSTANTIATION
+#undef GET_REPRESENTATION
+}  // namespace Swsh
+}  // namespace Spectral
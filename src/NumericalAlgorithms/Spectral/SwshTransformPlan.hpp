@@ -0,0 +1,168 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <sharp_cxx.h>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/ComplexDataVector.hpp"
+#include "DataStructures/ComplexModalVector.hpp"
+#include "DataStructures/SpinWeighted.hpp"
+#include "ErrorHandling/Assert.hpp"
+#include "NumericalAlgorithms/Spectral/ComplexDataView.hpp"
+#include "NumericalAlgorithms/Spectral/SwshCoefficients.hpp"
+#include "NumericalAlgorithms/Spectral/SwshCollocation.hpp"
+#include "NumericalAlgorithms/Spectral/SwshTransform.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace Spectral {
+namespace Swsh {
+
+/*!
+ * \ingroup SwshGroup
+ * \brief Collects a set of forward and inverse spin-weighted spherical
+ * harmonic transforms at a single angular resolution and performs them with as
+ * few libsharp jobs as possible.
+ *
+ * \details Each call to `Spectral::Swsh::swsh_transform` or
+ * `Spectral::Swsh::inverse_swsh_transform` issues its own libsharp job set, so
+ * code that transforms several quantities of different spin weights one at a
+ * time (e.g. all of the Bondi quantities on the CCE worldtube) pays the
+ * per-job overhead of libsharp for each quantity. Instead, the transforms may
+ * be registered with `add_transform()` and `add_inverse_transform()`, and are
+ * only performed by `execute()`, which issues a single libsharp job set for
+ * each combination of spin weight and direction, containing every radial slice
+ * of every quantity registered with that spin weight and direction. The
+ * libsharp geometry and \f$a_{\ell m}\f$ metadata are retrieved once when the
+ * plan is constructed. When libsharp is built with OpenMP support, it
+ * parallelizes each job over the transforms it contains, so the larger jobs
+ * also make better use of its threading.
+ *
+ * The number of radial points of each quantity is inferred from the size of
+ * its input, so quantities with different numbers of radial points may be
+ * collected in the same plan. The outputs are resized when the transform is
+ * added, but are only filled by `execute()`, after which the plan is empty and
+ * may be reused. The buffers of libsharp pointers are kept between executions,
+ * so a reused plan does not allocate once it has seen its largest job (see
+ * `cached_transform_plan()`).
+ *
+ * \warning The transforms collected in a plan are performed in an unspecified
+ * order, so the output of one transform must not be used as the input of
+ * another transform in the same plan, and each input may be registered only
+ * once. As for `Spectral::Swsh::swsh_transform`, the collocation data passed
+ * to `add_transform()` is taken by const reference but can be temporarily
+ * altered in-place during `execute()`, and is returned to its original state
+ * by the end of `execute()`. All inputs and outputs must remain valid until
+ * `execute()` is called.
+ */
+template <
+    ComplexRepresentation Representation = ComplexRepresentation::Interleaved>
+class SwshTransformPlan {
+ public:
+  explicit SwshTransformPlan(size_t l_max) noexcept;
+
+  /// Register the forward transform of `collocation` to `coefficients`.
+  template <int Spin>
+  void add_transform(
+      gsl::not_null<SpinWeighted<ComplexModalVector, Spin>*> coefficients,
+      const SpinWeighted<ComplexDataVector, Spin>& collocation) noexcept;
+
+  /// Register the inverse transform of `coefficients` to `collocation`.
+  template <int Spin>
+  void add_inverse_transform(
+      gsl::not_null<SpinWeighted<ComplexDataVector, Spin>*> collocation,
+      const SpinWeighted<ComplexModalVector, Spin>& coefficients) noexcept;
+
+  /// Perform all of the transforms registered since the plan was constructed
+  /// or last executed.
+  void execute() noexcept;
+
+  size_t l_max() const noexcept { return l_max_; }
+
+  /// The number of transforms (one per radial slice of each registered
+  /// quantity) waiting for `execute()`.
+  size_t number_of_pending_transforms() const noexcept;
+
+ private:
+  // the transforms are binned by spin weight, with index `Spin + 2`, because
+  // libsharp can only perform a single spin weight in each job
+  using transform_list =
+      std::vector<std::pair<ComplexModalVector*, ComplexDataVector*>>;
+
+  size_t l_max_;
+  const CollocationMetadata<Representation>* collocation_metadata_;
+  const sharp_alm_info* alm_info_;
+  std::array<transform_list, 5> forward_transforms_{};
+  std::array<transform_list, 5> inverse_transforms_{};
+  std::vector<detail::ComplexDataView<Representation>> views_{};
+  std::vector<double*> collocation_data_{};
+  std::vector<std::complex<double>*> coefficient_data_{};
+};
+
+/*!
+ * \ingroup SwshGroup
+ * \brief A `SwshTransformPlan` at `l_max` that is reused by every caller on the
+ * current thread.
+ *
+ * \details This is the plan used by `Spectral::Swsh::AngularDerivatives` and
+ * `Spectral::Swsh::angular_derivatives`, so that all of the angular derivatives
+ * of a CCE step (e.g. those of `Cce::mutate_all_swsh_derivatives_for_tag` and
+ * of the gauge transforms) share its metadata and buffers. The plan is only
+ * shared within a thread, so no locking is needed, and callers must `execute()`
+ * every transform they add before another caller can use the plan.
+ */
+template <ComplexRepresentation Representation>
+SwshTransformPlan<Representation>& cached_transform_plan(size_t l_max) noexcept;
+
+template <ComplexRepresentation Representation>
+template <int Spin>
+void SwshTransformPlan<Representation>::add_transform(
+    const gsl::not_null<SpinWeighted<ComplexModalVector, Spin>*> coefficients,
+    const SpinWeighted<ComplexDataVector, Spin>& collocation) noexcept {
+  static_assert(Spin >= -2 and Spin <= 2,
+                "libsharp only supports spin weights from -2 to 2.");
+  const size_t number_of_angular_points =
+      number_of_swsh_collocation_points(l_max_);
+  ASSERT(collocation.size() % number_of_angular_points == 0,
+         "The collocation data of size "
+             << collocation.size()
+             << " is not a whole number of spheres at l_max " << l_max_);
+  coefficients->destructive_resize(size_of_libsharp_coefficient_vector(l_max_) *
+                                   (collocation.size() /
+                                    number_of_angular_points));
+  // clang-tidy: const-cast, object is temporarily modified and returned to
+  // original state
+  gsl::at(forward_transforms_, Spin + 2).emplace_back(
+      &coefficients->data(),
+      &const_cast<ComplexDataVector&>(collocation.data()));  // NOLINT
+}
+
+template <ComplexRepresentation Representation>
+template <int Spin>
+void SwshTransformPlan<Representation>::add_inverse_transform(
+    const gsl::not_null<SpinWeighted<ComplexDataVector, Spin>*> collocation,
+    const SpinWeighted<ComplexModalVector, Spin>& coefficients) noexcept {
+  static_assert(Spin >= -2 and Spin <= 2,
+                "libsharp only supports spin weights from -2 to 2.");
+  const size_t number_of_coefficients =
+      size_of_libsharp_coefficient_vector(l_max_);
+  ASSERT(coefficients.size() % number_of_coefficients == 0,
+         "The coefficient data of size "
+             << coefficients.size()
+             << " is not a whole number of spheres at l_max " << l_max_);
+  collocation->destructive_resize(number_of_swsh_collocation_points(l_max_) *
+                                  (coefficients.size() /
+                                   number_of_coefficients));
+  // clang-tidy: const-cast, libsharp requires non-const pointers, but the
+  // coefficients are not altered by the inverse transform
+  gsl::at(inverse_transforms_, Spin + 2).emplace_back(
+      &const_cast<ComplexModalVector&>(coefficients.data()),  // NOLINT
+      &collocation->data());
+}
+}  // namespace Swsh
+}  // namespace Spectral
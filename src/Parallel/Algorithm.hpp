@@ -252,6 +252,17 @@ class AlgorithmImpl<ParallelComponent, tmpl::list<PhaseDepActionListsPack...>>
                     ReceiveDataType&& t,
                     bool enable_if_disabled = false) noexcept;
 
+  /// \brief Store data in the Inbox without executing the algorithm
+  ///
+  /// This allows a sender on the same processing element to hand off its data
+  /// without serializing it through Charm++, and to defer executing the
+  /// algorithm by invoking the `perform_algorithm` entry method through the
+  /// proxy (see `Parallel::receive_data`).
+  template <typename ReceiveTag, typename ReceiveDataType>
+  void insert_into_inbox(typename ReceiveTag::temporal_id instance,
+                         ReceiveDataType&& t,
+                         bool enable_if_disabled = false) noexcept;
+
   // @{
   /// Start evaluating the algorithm until the is_ready function of an Action
   /// returns false, or an Action returns with `terminate` set to `true`
@@ -521,6 +532,18 @@ void AlgorithmImpl<ParallelComponent, tmpl::list<PhaseDepActionListsPack...>>::
                  const bool enable_if_disabled) noexcept {
   (void)Parallel::charmxx::RegisterReceiveData<ParallelComponent,
                                                ReceiveTag>::registrar;
+  insert_into_inbox<ReceiveTag>(std::move(instance),
+                                std::forward<ReceiveDataType>(t),
+                                enable_if_disabled);
+  perform_algorithm();
+}
+
+template <typename ParallelComponent, typename... PhaseDepActionListsPack>
+template <typename ReceiveTag, typename ReceiveDataType>
+void AlgorithmImpl<ParallelComponent, tmpl::list<PhaseDepActionListsPack...>>::
+    insert_into_inbox(typename ReceiveTag::temporal_id instance,
+                      ReceiveDataType&& t,
+                      const bool enable_if_disabled) noexcept {
   try {
     if constexpr (std::is_same_v<Parallel::NodeLock, decltype(node_lock_)>) {
       node_lock_.lock();
@@ -538,7 +561,6 @@ void AlgorithmImpl<ParallelComponent, tmpl::list<PhaseDepActionListsPack...>>::
     ERROR("Fatal error: Unexpected exception caught in receive_data: "
           << e.what());
   }
-  perform_algorithm();
 }
 
 template <typename ParallelComponent, typename... PhaseDepActionListsPack>
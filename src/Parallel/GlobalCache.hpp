@@ -97,6 +97,13 @@ using get_component_if_mocked = tmpl::front<tmpl::type_from<tmpl::conditional_t<
 /// `mutable_cache_item_is_ready`, `mutate`, and `get`.
 /// Accordingly, most documentation of `MutableGlobalCache` is provided
 /// in the relevant `GlobalCache` member functions.
+///
+/// Each core holds its own copy of the mutable items, so `mutate` is
+/// delivered to every core (see `GlobalCache::mutate`) and runs on the core
+/// that owns the copy. Thus an item is never mutated while another thread
+/// holds a reference to it, at the cost of one copy per core. Large data
+/// that does not change should therefore be placed in the
+/// `const_global_cache_tags` instead.
 template <typename Metavariables>
 class MutableGlobalCache : public CBase_MutableGlobalCache<Metavariables> {
  public:
@@ -267,6 +274,17 @@ void MutableGlobalCache<Metavariables>::pup(PUP::er& p) noexcept {
 /// `Metavariables::component_list` with the same tag with which they
 /// were inserted into the GlobalCache.  References to non-const items
 /// in the GlobalCache are not added to the db::DataBox.
+///
+/// \par Memory layout
+/// The GlobalCache is a Charm++ nodegroup, so the const items (e.g. the
+/// `Domain` with its block maps, or analytic solutions) are stored once per
+/// node and are shared read-only by all cores of the node. `Parallel::get`
+/// returns a reference into the branch of the node it is called on, so no
+/// copies are made and no locking is needed to read const items. The
+/// constructor message holding the const items is likewise sent once per
+/// node. The mutable items are instead held by the `MutableGlobalCache`
+/// group once per core, which keeps their mutation free of data races (see
+/// `MutableGlobalCache`).
 template <typename Metavariables>
 class GlobalCache : public CBase_GlobalCache<Metavariables> {
   using parallel_component_tag_list = tmpl::transform<
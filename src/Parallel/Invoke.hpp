@@ -42,6 +42,15 @@ struct has_ckLocal_method<T, std::void_t<decltype(std::declval<T>().ckLocal())>>
  *
  * If the algorithm was previously disabled, set `enable_if_disabled` to true to
  * enable the algorithm on the parallel component.
+ *
+ * If the receiver lives on the same processing element as the caller, the data
+ * is moved directly into its inbox without being serialized by Charm++.
+ *
+ * \note Receivers on other processing elements of the same node still receive
+ * the data through Charm++, which serializes it. `ckLocal()` only finds
+ * receivers on the calling processing element, and the inboxes of array
+ * elements are not locked, so inserting into them from another thread would
+ * race with the algorithm of the receiver.
  */
 template <
     typename ReceiveTag, typename Proxy, typename ReceiveDataType,
@@ -50,12 +59,20 @@ void receive_data(Proxy&& proxy, typename ReceiveTag::temporal_id temporal_id,
                   ReceiveDataType&& receive_data,
                   const bool enable_if_disabled = false) noexcept {
   auto* obj = proxy.ckLocal();
-  // Only elide the Charm++ RTS if the object is local and if we won't blow the
-  // stack by having too many recursive function calls.
+  // Only evaluate the algorithm inline if the object is local and if we won't
+  // blow the stack by having too many recursive function calls.
   if (obj != nullptr and not detail::max_inline_entry_methods_reached()) {
     obj->template receive_data<ReceiveTag>(
         std::move(temporal_id), std::forward<ReceiveDataType>(receive_data),
         enable_if_disabled);
+  } else if (obj != nullptr) {
+    // The object is local, so we still hand off the data directly (avoiding
+    // serializing and copying it) and only go through the Charm++ RTS to
+    // evaluate the algorithm, which unwinds the stack.
+    obj->template insert_into_inbox<ReceiveTag>(
+        std::move(temporal_id), std::forward<ReceiveDataType>(receive_data),
+        enable_if_disabled);
+    proxy.perform_algorithm();
   } else {
     proxy.template receive_data<ReceiveTag>(
         std::move(temporal_id), std::forward<ReceiveDataType>(receive_data),
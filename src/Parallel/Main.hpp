@@ -21,6 +21,7 @@
 #include "Parallel/Exit.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
+#include "Parallel/ParallelFor.hpp"
 #include "Parallel/Printf.hpp"
 #include "Parallel/TypeTraits.hpp"
 #include "Utilities/Formaline.hpp"
@@ -100,6 +101,7 @@ class Main : public CBase_Main<Metavariables> {
 template <typename Metavariables>
 Main<Metavariables>::Main(CkArgMsg* msg) noexcept {
   Informer::print_startup_info(msg);
+  Parallel::initialize_parallel_for();
 
   /// \todo detail::register_events_to_trace();
 
@@ -0,0 +1,19 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Parallel/ParallelFor.hpp"
+
+#include <charm++.h>
+
+#if CMK_SMP
+#include <CkLoopAPI.h>
+#endif  // CMK_SMP
+
+namespace Parallel {
+void initialize_parallel_for() noexcept {
+#if CMK_SMP
+  // Use the existing PEs of each node rather than spawning threads
+  CkLoop_Init(-1);
+#endif  // CMK_SMP
+}
+}  // namespace Parallel
@@ -0,0 +1,82 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines function Parallel::parallel_for
+
+#pragma once
+
+#include <algorithm>
+#include <charm++.h>
+#include <cstddef>
+
+#if CMK_SMP
+#include <CkLoopAPI.h>
+#endif  // CMK_SMP
+
+namespace Parallel {
+/// \cond
+namespace detail {
+template <typename Function>
+void parallel_for_chunk(const int first, const int last, void* /*result*/,
+                        const int /*param_num*/, void* param) noexcept {
+  // CkLoop hands out inclusive ranges
+  (*static_cast<const Function*>(param))(static_cast<size_t>(first),
+                                         static_cast<size_t>(last) + 1);
+}
+}  // namespace detail
+/// \endcond
+
+/*!
+ * \ingroup ParallelGroup
+ * \brief Split the index range `[0, size)` into at most `number_of_chunks`
+ * contiguous chunks and invoke `function(begin, end)` on each chunk, letting
+ * the PEs of the calling node work on the chunks.
+ *
+ * \details In an SMP build the chunks are scheduled by Charm++'s CkLoop library
+ * onto the PEs of the node, so the work stays visible to the runtime's
+ * scheduler, tracing and load balancer instead of competing with it for cores.
+ * The calling PE works on chunks too, and the function returns only once every
+ * chunk has been processed. In a non-SMP build each PE is its own process, so
+ * there are no idle cores to share and the calling PE processes the chunks one
+ * after another. The same happens if the node has a single PE. Either way
+ * `function` sees the same kind of partition, so code that depends on the
+ * chunking is exercised by serial runs and unit tests too. If
+ * `number_of_chunks` or `size` is smaller than two, `function(0, size)` is
+ * called once.
+ *
+ * The chunks handed to `function` never overlap, so `function` may write into
+ * disjoint parts of a shared buffer without synchronization, but it must not
+ * mutate any other shared state.
+ *
+ * CkLoop must have been initialized with `Parallel::initialize_parallel_for`,
+ * which `Parallel::Main` and the unit test driver do at startup.
+ */
+template <typename Function>
+void parallel_for(const size_t size, const size_t number_of_chunks,
+                  const Function& function) noexcept {
+  const size_t chunks = std::min(number_of_chunks, size);
+  if (chunks < 2) {
+    function(size_t{0}, size);
+    return;
+  }
+#if CMK_SMP
+  if (CkMyNodeSize() > 1) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    CkLoop_Parallelize(detail::parallel_for_chunk<Function>, 1,
+                       const_cast<Function*>(&function),
+                       static_cast<int>(chunks), 0,
+                       static_cast<int>(size) - 1);
+    return;
+  }
+#endif  // CMK_SMP
+  for (size_t chunk = 0; chunk < chunks; ++chunk) {
+    function(chunk * size / chunks, (chunk + 1) * size / chunks);
+  }
+}
+
+/// \ingroup ParallelGroup
+/// Initialize the CkLoop library used by `Parallel::parallel_for`. Must be
+/// called once from the main chare's constructor.
+void initialize_parallel_for() noexcept;
+}  // namespace Parallel
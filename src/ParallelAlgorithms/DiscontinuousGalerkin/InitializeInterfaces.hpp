@@ -12,6 +12,7 @@
 #include "Domain/FaceNormal.hpp"
 #include "Domain/InterfaceComputeTags.hpp"
 #include "Domain/Tags.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Tags.hpp"
 #include "ParallelAlgorithms/Initialization/MutateAssign.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
@@ -88,6 +89,8 @@ struct vars_tag<System, std::void_t<typename System::variables_tag>> {
 /// - Adds:
 ///   * `Tags::Interface<Tags::BoundaryDirectionsExterior<volume_dim>,
 ///   variables_tag>` (as a simple tag)
+///   * `Tags::ExternalBoundaryDataCoordinates<volume_dim>` (empty, with the
+///   exterior variables)
 ///   * `face_tags<Tags::InternalDirections<Dim>>`
 ///   * `face_tags<Tags::BoundaryDirectionsInterior<Dim>>`
 ///   * `face_tags<Tags::BoundaryDirectionsExterior<Dim>>`
@@ -193,9 +196,11 @@ struct InitializeInterfaces {
               tmpl::pin<domain::Tags::BoundaryDirectionsExterior<dim>>>>>>;
 
  public:
-  using simple_tags =
-      tmpl::conditional_t<AddExteriorVariables, tmpl::list<exterior_vars_tag>,
-                          tmpl::list<>>;
+  using simple_tags = tmpl::conditional_t<
+      AddExteriorVariables,
+      tmpl::list<exterior_vars_tag,
+                 ::Tags::ExternalBoundaryDataCoordinates<dim>>,
+      tmpl::list<>>;
 
   using compute_tags = tmpl::push_front<
    tmpl::append<face_tags<domain::Tags::InternalDirections<dim>>,
@@ -222,7 +227,8 @@ struct InitializeInterfaces {
                 mesh.slice_away(direction.dimension()).number_of_grid_points()};
       }
       ::Initialization::mutate_assign<simple_tags>(
-          make_not_null(&box), std::move(exterior_boundary_vars));
+          make_not_null(&box), std::move(exterior_boundary_vars),
+          typename ::Tags::ExternalBoundaryDataCoordinates<dim>::type{});
       return std::make_tuple(std::move(box));
     } else {
       return std::make_tuple(std::move(box));
@@ -0,0 +1,56 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <tuple>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Tags.hpp"
+#include "Time/Tags.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace Actions {
+/// \ingroup ActionsGroup
+/// \ingroup EventsAndTriggersGroup
+/// \brief Run the events and triggers that need the time derivative of the
+/// current substep
+///
+/// This action must be placed directly after
+/// `evolution::dg::Actions::ComputeTimeDerivative`, so that the events can use
+/// the buffers that action stores in
+/// `evolution::dg::Tags::TimeDerivativeIntermediates`. Unlike
+/// `Actions::RunEventsAndTriggers`, which runs before the time derivative is
+/// computed, the events are not run during self-start.
+///
+/// Uses:
+/// - GlobalCache: the EventsAndTriggersAfterDuDtBase tag, as required by
+///   events and triggers
+/// - DataBox:
+///   - Tags::TimeStepId
+///   - as required by events and triggers
+///
+/// DataBox changes:
+/// - Adds: nothing
+/// - Removes: nothing
+/// - Modifies: nothing
+struct RunEventsAndTriggersAfterDuDt {
+  template <typename DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static auto apply(db::DataBox<DbTags>& box,
+                    tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& array_index, const ActionList /*meta*/,
+                    const ParallelComponent* const component) noexcept {
+    if (db::get<::Tags::TimeStepId>(box).slab_number() >= 0) {
+      Parallel::get<Tags::EventsAndTriggersAfterDuDtBase>(cache).run_events(
+          box, cache, array_index, component);
+    }
+
+    return std::forward_as_tuple(std::move(box));
+  }
+};
+}  // namespace Actions
@@ -0,0 +1,201 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Tags.hpp"
+#include "Time/Tags.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Time/TimeSteppers/TimeStepper.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/NoSuchType.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace Actions {
+namespace RunEventsAtDenseTimes_detail {
+template <typename PrimitiveFromConservative>
+struct primitive_tags {
+  using type = typename PrimitiveFromConservative::return_tags;
+};
+
+template <>
+struct primitive_tags<NoSuchType> {
+  using type = tmpl::list<>;
+};
+}  // namespace RunEventsAtDenseTimes_detail
+
+/// \ingroup ActionsGroup
+/// \ingroup EventsAndTriggersGroup
+/// \ingroup TimeGroup
+/// \brief Run the events at the times inside the current step
+///
+/// For each time of the `EventsAtDenseTimes` falling inside the current step,
+/// the evolved variables and `Tags::Time` are set to their values at that time,
+/// with the variables computed by dense output from the time stepper history,
+/// and the events of that time are run. The variables and the time are
+/// restored afterwards. The step sequence is therefore independent of the
+/// observation schedule, and no `StepChoosers::StepToTimes` is needed to
+/// observe at the requested times.
+///
+/// A step covers the times after its start up to and including its end, so a
+/// time on the boundary between two steps is observed once, by the step
+/// ending there, and the final time of an evolution is observed. The first
+/// step of the evolution (the first step of slab 0) also covers its start.
+///
+/// The dense output of a step is only available once all substeps of the step
+/// have been taken, so this action must be placed after the time stepper data
+/// of the substep has been recorded and before `Actions::UpdateU`. It does
+/// nothing on all but the last substep of a step, and during self-start.
+///
+/// With local time-stepping, the boundary coupling to the neighbors is not
+/// part of the volume history, so it is added by the `DenseOutput` mutator of
+/// the `Metavariables::boundary_scheme` (see
+/// `dg::FirstOrderScheme::FirstOrderSchemeLts::DenseOutput`). The action must
+/// then be placed before the boundary scheme is applied, since the boundary
+/// scheme discards the boundary history it no longer needs, and the evolved
+/// variables still hold their values at the start of the step.
+///
+/// For systems with primitive variables, the mutator
+/// `PrimitiveFromConservative` must be passed. It is applied after the
+/// evolved variables are set to each time, so that the events observe the
+/// primitive variables at that time, and the primitive variables (the
+/// `return_tags` of the mutator) are restored afterwards.
+///
+/// \warning Only the variables_tag, `Tags::Time` and the primitive variables
+/// are set to the observed time. Compute tags depending on them are recomputed
+/// by the DataBox, but any other simple tag holds its value at the current
+/// substep, so events must not depend on other simple tags derived from the
+/// evolved variables. The dense output is also not limited, so observations of
+/// systems using a limiter may differ from the limited solution at the step
+/// boundaries.
+///
+/// Uses:
+/// - GlobalCache: the EventsAtDenseTimesBase tag, as required by the events
+/// - DataBox:
+///   - variables_tag (either the provided `VariablesTag` or the
+///   `system::variables_tag` if none is provided)
+///   - Tags::HistoryEvolvedVariables<variables_tag>
+///   - Tags::Time
+///   - Tags::TimeStep
+///   - Tags::TimeStepId
+///   - Tags::TimeStepper<>
+///   - with local time-stepping, as required by the `DenseOutput` of the
+///   boundary scheme
+///   - as required by `PrimitiveFromConservative`
+///   - as required by the events
+///
+/// DataBox changes:
+/// - Adds: nothing
+/// - Removes: nothing
+/// - Modifies: nothing (variables_tag, Tags::Time and the primitive variables
+///   are modified while the events run and restored afterwards)
+template <typename VariablesTag = NoSuchType,
+          typename PrimitiveFromConservative = NoSuchType>
+struct RunEventsAtDenseTimes {
+  template <typename DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static std::tuple<db::DataBox<DbTags>&&> apply(
+      db::DataBox<DbTags>& box, tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ArrayIndex& array_index, const ActionList /*meta*/,
+      const ParallelComponent* const component) noexcept {
+    static_assert(
+        not Metavariables::system::has_primitive_and_conservative_vars or
+            not std::is_same_v<PrimitiveFromConservative, NoSuchType>,
+        "RunEventsAtDenseTimes needs the PrimitiveFromConservative mutator "
+        "for systems with primitive variables, to compute them at the "
+        "observed times.");
+    using variables_tag =
+        tmpl::conditional_t<std::is_same_v<VariablesTag, NoSuchType>,
+                            typename Metavariables::system::variables_tag,
+                            VariablesTag>;
+    using history_tag = Tags::HistoryEvolvedVariables<variables_tag>;
+    using primitive_tags = typename RunEventsAtDenseTimes_detail::
+        primitive_tags<PrimitiveFromConservative>::type;
+
+    const auto& time_step_id = db::get<Tags::TimeStepId>(box);
+    const auto& time_stepper = db::get<Tags::TimeStepper<>>(box);
+    if (time_step_id.slab_number() < 0 or
+        time_step_id.substep() + 1 != time_stepper.number_of_substeps()) {
+      return std::forward_as_tuple(std::move(box));
+    }
+
+    const auto& events_at_dense_times =
+        Parallel::get<Tags::EventsAtDenseTimesBase>(cache);
+    const Time& step_start = time_step_id.step_time();
+    const Time step_end = step_start + db::get<Tags::TimeStep>(box);
+    const bool is_first_step =
+        time_step_id.slab_number() == 0 and
+        (time_step_id.time_runs_forward() ? step_start.is_at_slab_start()
+                                          : step_start.is_at_slab_end());
+    const auto times = events_at_dense_times.times_in_step(
+        step_start.value(), step_end.value(), is_first_step);
+    if (times.empty()) {
+      return std::forward_as_tuple(std::move(box));
+    }
+
+    const double time_at_substep = db::get<Tags::Time>(box);
+    auto variables_at_substep = db::get<variables_tag>(box);
+    tuples::tagged_tuple_from_typelist<primitive_tags> primitives_at_substep{};
+    tmpl::for_each<primitive_tags>(
+        [&box, &primitives_at_substep](auto tag_v) noexcept {
+          using tag = tmpl::type_from<decltype(tag_v)>;
+          get<tag>(primitives_at_substep) = db::get<tag>(box);
+        });
+    for (const double time : times) {
+      db::mutate<variables_tag, Tags::Time>(
+          make_not_null(&box),
+          [&time, &variables_at_substep](
+              const gsl::not_null<typename variables_tag::type*> vars,
+              const gsl::not_null<double*> box_time,
+              const typename history_tag::type& history,
+              const auto& stepper) noexcept {
+            *vars = variables_at_substep;
+            stepper.dense_update_u(vars, history, time);
+            *box_time = time;
+          },
+          db::get<history_tag>(box), time_stepper);
+      if constexpr (Metavariables::local_time_stepping) {
+        db::mutate_apply<
+            typename Metavariables::boundary_scheme::DenseOutput>(
+            make_not_null(&box), time);
+      }
+      if constexpr (not std::is_same_v<PrimitiveFromConservative,
+                                       NoSuchType>) {
+        db::mutate_apply<PrimitiveFromConservative>(make_not_null(&box));
+      }
+      events_at_dense_times.run_events(box, cache, array_index, component,
+                                       time);
+    }
+    db::mutate<variables_tag, Tags::Time>(
+        make_not_null(&box),
+        [&time_at_substep, &variables_at_substep](
+            const gsl::not_null<typename variables_tag::type*> vars,
+            const gsl::not_null<double*> box_time) noexcept {
+          *vars = std::move(variables_at_substep);
+          *box_time = time_at_substep;
+        });
+    tmpl::for_each<primitive_tags>(
+        [&box, &primitives_at_substep](auto tag_v) noexcept {
+          using tag = tmpl::type_from<decltype(tag_v)>;
+          db::mutate<tag>(
+              make_not_null(&box),
+              [&primitives_at_substep](
+                  const gsl::not_null<typename tag::type*> primitive) noexcept {
+                *primitive = std::move(get<tag>(primitives_at_substep));
+              });
+        });
+
+    return std::forward_as_tuple(std::move(box));
+  }
+};
+}  // namespace Actions
@@ -0,0 +1,139 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <pup.h>  // IWYU pragma: keep
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Options/Options.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"  // IWYU pragma: keep // for option parsing
+#include "Time/TimeSequence.hpp"  // IWYU pragma: keep // for option parsing
+
+/// \cond
+namespace Parallel {
+template <typename Metavariables>
+class GlobalCache;
+}  // namespace Parallel
+namespace db {
+template <typename TagsList>
+class DataBox;
+}  // namespace db
+/// \endcond
+
+/// \ingroup EventsAndTriggersGroup
+/// \ingroup TimeGroup
+/// \brief Class that runs events at the times of time sequences, which need
+/// not coincide with the boundaries of time steps.
+///
+/// \details The events are run by `Actions::RunEventsAtDenseTimes`, which
+/// evaluates the evolved variables at each of the `times_in_step()` by dense
+/// output from the time stepper history. Unlike `Triggers::Times`, this does
+/// not require the steps to land on the requested times, so the step sequence
+/// is independent of the observation schedule.
+template <typename EventRegistrars>
+class EventsAtDenseTimes {
+ public:
+  using event_type = Event<EventRegistrars>;
+  using Storage = std::unordered_map<std::unique_ptr<TimeSequence<double>>,
+                                     std::vector<std::unique_ptr<event_type>>>;
+
+  EventsAtDenseTimes() = default;
+  explicit EventsAtDenseTimes(Storage events_at_times) noexcept
+      : events_at_times_(std::move(events_at_times)) {}
+
+  /// The times of all the sequences in the step from `step_start` to
+  /// `step_end`, ordered in the direction of evolution and without
+  /// duplicates.
+  ///
+  /// The end of the step is included, so that a time at the boundary between
+  /// two steps is found in the step ending there, and the end of the final
+  /// step of an evolution is observed. The start of the step is only
+  /// included if `include_step_start` is set, which should be done for the
+  /// first step of an evolution, as no earlier step has found its start.
+  std::vector<double> times_in_step(
+      const double step_start, const double step_end,
+      const bool include_step_start) const noexcept {
+    std::vector<double> result{};
+    const bool time_runs_forward = step_end > step_start;
+    for (const auto& times_and_events : events_at_times_) {
+      const auto& times = *times_and_events.first;
+      const auto nearby_times = times.times_near(step_start);
+      std::optional<double> time{};
+      if (time_runs_forward) {
+        time = nearby_times[1] and
+                       (*nearby_times[1] > step_start or
+                        (include_step_start and *nearby_times[1] == step_start))
+                   ? nearby_times[1]
+                   : nearby_times[2];
+        while (time and *time <= step_end) {
+          result.push_back(*time);
+          time = times.times_near(*time)[2];
+        }
+      } else {
+        time = nearby_times[1] and
+                       (*nearby_times[1] < step_start or
+                        (include_step_start and *nearby_times[1] == step_start))
+                   ? nearby_times[1]
+                   : nearby_times[0];
+        while (time and *time >= step_end) {
+          result.push_back(*time);
+          time = times.times_near(*time)[0];
+        }
+      }
+    }
+    if (time_runs_forward) {
+      std::sort(result.begin(), result.end());
+    } else {
+      std::sort(result.begin(), result.end(), std::greater<>{});
+    }
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+  }
+
+  /// Run the events of all the sequences containing `time`, which must be
+  /// one of the `times_in_step()`. The `box` must hold the state at `time`.
+  template <typename DbTags, typename Metavariables, typename ArrayIndex,
+            typename Component>
+  void run_events(const db::DataBox<DbTags>& box,
+                  Parallel::GlobalCache<Metavariables>& cache,
+                  const ArrayIndex& array_index, const Component* component,
+                  const double time) const noexcept {
+    for (const auto& times_and_events : events_at_times_) {
+      const auto nearest_time = times_and_events.first->times_near(time)[1];
+      if (nearest_time and *nearest_time == time) {
+        for (const auto& event : times_and_events.second) {
+          event->run(box, cache, array_index, component);
+        }
+      }
+    }
+  }
+
+  // clang-tidy: google-runtime-references
+  void pup(PUP::er& p) noexcept {  // NOLINT
+    p | events_at_times_;
+  }
+
+  const Storage& events_at_times() const noexcept { return events_at_times_; }
+
+ private:
+  // The unique pointer contents *must* be treated as const everywhere
+  // in order to make the const global cache behave sanely.  They are
+  // only non-const to make pup work.
+  Storage events_at_times_;
+};
+
+template <typename EventRegistrars>
+struct Options::create_from_yaml<EventsAtDenseTimes<EventRegistrars>> {
+  using type = EventsAtDenseTimes<EventRegistrars>;
+  template <typename Metavariables>
+  static type create(const Options::Option& options) {
+    return type(options.parse_as<typename type::Storage>());
+  }
+};
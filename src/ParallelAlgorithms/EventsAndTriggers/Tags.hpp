@@ -10,6 +10,7 @@
 #include "Options/Options.hpp"
 #include "Parallel/Serialize.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/EventsAndTriggers.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/EventsAtDenseTimes.hpp"
 
 namespace OptionTags {
 /// \ingroup OptionTagsGroup
@@ -44,6 +45,48 @@ struct EventsAndTriggers {
   // pretty_type::short_name().
   static std::string name() noexcept { return "EventsAndTriggers"; }
 };
+
+/// \ingroup OptionTagsGroup
+/// \ingroup EventsAndTriggersGroup
+/// Contains the events to run at times inside of time steps
+///
+/// In yaml this is specified as a map of time sequences to lists of events:
+/// \code{.yaml}
+/// EventsAtDenseTimes:
+///   ? EvenlySpaced:
+///       Interval: 0.1
+///       Offset: 0.0
+///   : - Event1:
+///         OptionsForEvent1
+/// \endcode
+template <typename EventRegistrars>
+struct EventsAtDenseTimes {
+  using type = ::EventsAtDenseTimes<EventRegistrars>;
+  static constexpr Options::String help =
+      "Events to run at times inside of time steps";
+  static std::string name() noexcept { return "EventsAtDenseTimes"; }
+};
+
+/// \ingroup OptionTagsGroup
+/// \ingroup EventsAndTriggersGroup
+/// Contains the events and triggers to run after the time derivative has been
+/// computed
+///
+/// In yaml this is specified in the same way as `EventsAndTriggers`:
+/// \code{.yaml}
+/// EventsAfterDuDt:
+///   ? TriggerA:
+///       OptionsForTriggerA
+///   : - Event1:
+///         OptionsForEvent1
+/// \endcode
+template <typename EventRegistrars, typename TriggerRegistrars>
+struct EventsAndTriggersAfterDuDt {
+  using type = ::EventsAndTriggers<EventRegistrars, TriggerRegistrars>;
+  static constexpr Options::String help =
+      "Events to run at triggers after the time derivative is computed";
+  static std::string name() noexcept { return "EventsAfterDuDt"; }
+};
 }  // namespace OptionTags
 
 namespace Tags {
@@ -64,4 +107,42 @@ struct EventsAndTriggers : EventsAndTriggersBase, db::SimpleTag {
     return deserialize<type>(serialize<type>(events_and_triggers).data());
   }
 };
+
+/// \cond
+struct EventsAtDenseTimesBase : db::BaseTag {};
+/// \endcond
+
+/// \ingroup EventsAndTriggersGroup
+/// Contains the events to run at times inside of time steps
+template <typename EventRegistrars>
+struct EventsAtDenseTimes : EventsAtDenseTimesBase, db::SimpleTag {
+  using type = ::EventsAtDenseTimes<EventRegistrars>;
+  using option_tags =
+      tmpl::list<::OptionTags::EventsAtDenseTimes<EventRegistrars>>;
+
+  static constexpr bool pass_metavariables = false;
+  static type create_from_options(const type& events_at_times) noexcept {
+    return deserialize<type>(serialize<type>(events_at_times).data());
+  }
+};
+
+/// \cond
+struct EventsAndTriggersAfterDuDtBase : db::BaseTag {};
+/// \endcond
+
+/// \ingroup EventsAndTriggersGroup
+/// Contains the events and triggers to run after the time derivative has been
+/// computed
+template <typename EventRegistrars, typename TriggerRegistrars>
+struct EventsAndTriggersAfterDuDt : EventsAndTriggersAfterDuDtBase,
+                                    db::SimpleTag {
+  using type = ::EventsAndTriggers<EventRegistrars, TriggerRegistrars>;
+  using option_tags = tmpl::list<::OptionTags::EventsAndTriggersAfterDuDt<
+      EventRegistrars, TriggerRegistrars>>;
+
+  static constexpr bool pass_metavariables = false;
+  static type create_from_options(const type& events_and_triggers) noexcept {
+    return deserialize<type>(serialize<type>(events_and_triggers).data());
+  }
+};
 }  // namespace Tags
@@ -60,6 +60,10 @@ namespace LinearSolver::cg {
  * flag if the `Convergence::Tags::Criteria` are met.
  * 5. `UpdateOperand` (on elements): Update \f$p\f$.
  *
+ * The relative residual of the `Convergence::Tags::Criteria` can be relaxed
+ * by the `LinearSolver::Tags::ForcingTerm` in the DataBox of the elements,
+ * e.g. when a nonlinear solver solves its linearizations inexactly.
+ *
  * \see Gmres for a linear solver that can invert nonsymmetric operators
  * \f$A\f$.
  */
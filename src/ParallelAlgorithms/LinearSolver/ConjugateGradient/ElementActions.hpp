@@ -78,11 +78,20 @@ struct PrepareSolve {
     // Perform global reduction to compute initial residual magnitude square for
     // residual monitor
     const auto& residual = get<residual_tag>(box);
+    // A nonlinear solver may have set a forcing term to relax the relative
+    // residual of this solve
+    double forcing_term = 0.;
+    if constexpr (db::tag_is_retrievable_v<
+                      LinearSolver::Tags::ForcingTerm<fields_tag>,
+                      db::DataBox<DbTagsList>>) {
+      forcing_term = get<LinearSolver::Tags::ForcingTerm<fields_tag>>(box);
+    }
     Parallel::contribute_to_reduction<
         InitializeResidual<FieldsTag, OptionsGroup, ParallelComponent>>(
         Parallel::ReductionData<
-            Parallel::ReductionDatum<double, funcl::Plus<>>>{
-            inner_product(residual, residual)},
+            Parallel::ReductionDatum<double, funcl::Plus<>>,
+            Parallel::ReductionDatum<double, funcl::AssertEqual<>>>{
+            inner_product(residual, residual), forcing_term},
         Parallel::get_parallel_component<ParallelComponent>(cache)[array_index],
         Parallel::get_parallel_component<
             ResidualMonitor<Metavariables, FieldsTag, OptionsGroup>>(cache));
@@ -78,10 +78,12 @@ struct InitializeResidualMonitor {
   using initial_residual_magnitude_tag =
       ::Tags::Initial<LinearSolver::Tags::Magnitude<
           db::add_tag_prefix<LinearSolver::Tags::Residual, fields_tag>>>;
+  using forcing_term_tag = LinearSolver::Tags::ForcingTerm<fields_tag>;
 
  public:
-  using simple_tags =
-      tmpl::list<residual_square_tag, initial_residual_magnitude_tag>;
+  using simple_tags = tmpl::list<residual_square_tag,
+                                 initial_residual_magnitude_tag,
+                                 forcing_term_tag>;
   using compute_tags = tmpl::list<>;
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
             typename ArrayIndex, typename ActionList,
@@ -95,6 +97,7 @@ struct InitializeResidualMonitor {
     // The `InitializeResidual` action populates these tags with initial values
     Initialization::mutate_assign<simple_tags>(
         make_not_null(&box), std::numeric_limits<double>::signaling_NaN(),
+        std::numeric_limits<double>::signaling_NaN(),
         std::numeric_limits<double>::signaling_NaN());
     return std::make_tuple(std::move(box), true);
   }
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <tuple>
 #include <utility>
@@ -43,6 +44,7 @@ struct InitializeResidual {
   using initial_residual_magnitude_tag =
       ::Tags::Initial<LinearSolver::Tags::Magnitude<
           db::add_tag_prefix<LinearSolver::Tags::Residual, fields_tag>>>;
+  using forcing_term_tag = LinearSolver::Tags::ForcingTerm<fields_tag>;
 
  public:
   template <typename ParallelComponent, typename DbTagsList,
@@ -53,26 +55,35 @@ struct InitializeResidual {
   static void apply(db::DataBox<DbTagsList>& box,
                     Parallel::GlobalCache<Metavariables>& cache,
                     const ArrayIndex& /*array_index*/,
-                    const double residual_square) noexcept {
+                    const double residual_square,
+                    const double forcing_term) noexcept {
     constexpr size_t iteration_id = 0;
     const double residual_magnitude = sqrt(residual_square);
 
-    db::mutate<residual_square_tag, initial_residual_magnitude_tag>(
+    db::mutate<residual_square_tag, initial_residual_magnitude_tag,
+               forcing_term_tag>(
         make_not_null(&box),
-        [residual_square, residual_magnitude](
+        [residual_square, residual_magnitude, forcing_term](
             const gsl::not_null<double*> local_residual_square,
-            const gsl::not_null<double*> initial_residual_magnitude) noexcept {
+            const gsl::not_null<double*> initial_residual_magnitude,
+            const gsl::not_null<double*> local_forcing_term) noexcept {
           *local_residual_square = residual_square;
           *initial_residual_magnitude = residual_magnitude;
+          *local_forcing_term = forcing_term;
         });
 
     LinearSolver::observe_detail::contribute_to_reduction_observer<
         OptionsGroup>(iteration_id, residual_magnitude, cache);
 
-    // Determine whether the linear solver has converged
+    // Determine whether the linear solver has converged. A forcing term set by
+    // a nonlinear solver can relax the relative residual.
+    auto convergence_criteria =
+        get<Convergence::Tags::Criteria<OptionsGroup>>(box);
+    convergence_criteria.relative_residual =
+        std::max(convergence_criteria.relative_residual, forcing_term);
     Convergence::HasConverged has_converged{
-        get<Convergence::Tags::Criteria<OptionsGroup>>(box), iteration_id,
-        residual_magnitude, residual_magnitude};
+        convergence_criteria, iteration_id, residual_magnitude,
+        residual_magnitude};
 
     // Do some logging
     if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(cache) >=
@@ -130,6 +141,7 @@ struct UpdateResidual {
   using initial_residual_magnitude_tag =
       ::Tags::Initial<LinearSolver::Tags::Magnitude<
           db::add_tag_prefix<LinearSolver::Tags::Residual, fields_tag>>>;
+  using forcing_term_tag = LinearSolver::Tags::ForcingTerm<fields_tag>;
 
  public:
   template <typename ParallelComponent, typename DbTagsList,
@@ -161,10 +173,14 @@ struct UpdateResidual {
     LinearSolver::observe_detail::contribute_to_reduction_observer<
         OptionsGroup>(completed_iterations, residual_magnitude, cache);
 
-    // Determine whether the linear solver has converged
+    // Determine whether the linear solver has converged. A forcing term set by
+    // a nonlinear solver can relax the relative residual.
+    auto convergence_criteria =
+        get<Convergence::Tags::Criteria<OptionsGroup>>(box);
+    convergence_criteria.relative_residual = std::max(
+        convergence_criteria.relative_residual, get<forcing_term_tag>(box));
     Convergence::HasConverged has_converged{
-        get<Convergence::Tags::Criteria<OptionsGroup>>(box),
-        completed_iterations, residual_magnitude,
+        convergence_criteria, completed_iterations, residual_magnitude,
         get<initial_residual_magnitude_tag>(box)};
 
     // Do some logging
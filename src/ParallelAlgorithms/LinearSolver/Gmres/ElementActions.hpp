@@ -80,11 +80,22 @@ struct PrepareSolve {
         get<source_tag>(box), get<operator_applied_to_fields_tag>(box),
         get<fields_tag>(box));
 
+    // A nonlinear solver may have set a forcing term to relax the relative
+    // residual of this solve
+    double forcing_term = 0.;
+    if constexpr (db::tag_is_retrievable_v<
+                      LinearSolver::Tags::ForcingTerm<fields_tag>,
+                      db::DataBox<DbTagsList>>) {
+      forcing_term = get<LinearSolver::Tags::ForcingTerm<fields_tag>>(box);
+    }
+
     Parallel::contribute_to_reduction<InitializeResidualMagnitude<
         FieldsTag, OptionsGroup, ParallelComponent>>(
         Parallel::ReductionData<
-            Parallel::ReductionDatum<double, funcl::Plus<>, funcl::Sqrt<>>>{
-            inner_product(get<operand_tag>(box), get<operand_tag>(box))},
+            Parallel::ReductionDatum<double, funcl::Plus<>, funcl::Sqrt<>>,
+            Parallel::ReductionDatum<double, funcl::AssertEqual<>>>{
+            inner_product(get<operand_tag>(box), get<operand_tag>(box)),
+            forcing_term},
         Parallel::get_parallel_component<ParallelComponent>(cache)[array_index],
         Parallel::get_parallel_component<
             ResidualMonitor<Metavariables, FieldsTag, OptionsGroup>>(cache));
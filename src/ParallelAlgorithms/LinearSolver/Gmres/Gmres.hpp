@@ -77,6 +77,10 @@ namespace LinearSolver::gmres {
  * the new orthogonal vector and normalize. Use the residual vector and the set
  * of orthogonal vectors to determine the solution \f$x\f$.
  *
+ * The relative residual of the `Convergence::Tags::Criteria` can be relaxed
+ * by the `LinearSolver::Tags::ForcingTerm` in the DataBox of the elements,
+ * e.g. when a nonlinear solver solves its linearizations inexactly.
+ *
  * \see ConjugateGradient for a linear solver that is more efficient when the
  * linear operator \f$A\f$ is symmetric.
  */
@@ -77,10 +77,12 @@ struct InitializeResidualMonitor {
           db::add_tag_prefix<LinearSolver::Tags::Residual, fields_tag>>>;
   using orthogonalization_history_tag =
       LinearSolver::Tags::OrthogonalizationHistory<fields_tag>;
+  using forcing_term_tag = LinearSolver::Tags::ForcingTerm<fields_tag>;
 
  public:
   using simple_tags =
-      tmpl::list<initial_residual_magnitude_tag, orthogonalization_history_tag>;
+      tmpl::list<initial_residual_magnitude_tag, orthogonalization_history_tag,
+                 forcing_term_tag>;
   using compute_tags = tmpl::list<>;
 
   template <typename DbTagsList, typename... InboxTags, typename ArrayIndex,
@@ -94,8 +96,10 @@ struct InitializeResidualMonitor {
                     const ParallelComponent* const /*meta*/) noexcept {
     // The `InitializeResidualMagnitude` action populates these tags
     // with initial values
-    Initialization::mutate_assign<tmpl::list<initial_residual_magnitude_tag>>(
-        make_not_null(&box), std::numeric_limits<double>::signaling_NaN());
+    Initialization::mutate_assign<
+        tmpl::list<initial_residual_magnitude_tag, forcing_term_tag>>(
+        make_not_null(&box), std::numeric_limits<double>::signaling_NaN(),
+        std::numeric_limits<double>::signaling_NaN());
     return std::make_tuple(std::move(box), true);
   }
 };
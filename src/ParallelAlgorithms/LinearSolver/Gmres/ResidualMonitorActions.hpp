@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <tuple>
 #include <utility>
@@ -42,6 +43,7 @@ struct InitializeResidualMagnitude {
           db::add_tag_prefix<LinearSolver::Tags::Residual, fields_tag>>>;
   using orthogonalization_history_tag =
       LinearSolver::Tags::OrthogonalizationHistory<fields_tag>;
+  using forcing_term_tag = LinearSolver::Tags::ForcingTerm<fields_tag>;
 
  public:
   template <typename ParallelComponent, typename DbTagsList,
@@ -52,23 +54,31 @@ struct InitializeResidualMagnitude {
   static void apply(db::DataBox<DbTagsList>& box,
                     Parallel::GlobalCache<Metavariables>& cache,
                     const ArrayIndex& /*array_index*/,
-                    const double residual_magnitude) noexcept {
+                    const double residual_magnitude,
+                    const double forcing_term) noexcept {
     constexpr size_t iteration_id = 0;
 
-    db::mutate<initial_residual_magnitude_tag>(
+    db::mutate<initial_residual_magnitude_tag, forcing_term_tag>(
         make_not_null(&box),
-        [residual_magnitude](
-            const gsl::not_null<double*> initial_residual_magnitude) noexcept {
+        [residual_magnitude, forcing_term](
+            const gsl::not_null<double*> initial_residual_magnitude,
+            const gsl::not_null<double*> local_forcing_term) noexcept {
           *initial_residual_magnitude = residual_magnitude;
+          *local_forcing_term = forcing_term;
         });
 
     LinearSolver::observe_detail::contribute_to_reduction_observer<
         OptionsGroup>(iteration_id, residual_magnitude, cache);
 
-    // Determine whether the linear solver has already converged
+    // Determine whether the linear solver has already converged. A forcing
+    // term set by a nonlinear solver can relax the relative residual.
+    auto convergence_criteria =
+        get<Convergence::Tags::Criteria<OptionsGroup>>(box);
+    convergence_criteria.relative_residual =
+        std::max(convergence_criteria.relative_residual, forcing_term);
     Convergence::HasConverged has_converged{
-        get<Convergence::Tags::Criteria<OptionsGroup>>(box), iteration_id,
-        residual_magnitude, residual_magnitude};
+        convergence_criteria, iteration_id, residual_magnitude,
+        residual_magnitude};
 
     // Do some logging
     if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(cache) >=
@@ -102,6 +112,7 @@ struct StoreOrthogonalization {
           db::add_tag_prefix<LinearSolver::Tags::Residual, fields_tag>>>;
   using orthogonalization_history_tag =
       LinearSolver::Tags::OrthogonalizationHistory<fields_tag>;
+  using forcing_term_tag = LinearSolver::Tags::ForcingTerm<fields_tag>;
 
  public:
   template <typename ParallelComponent, typename DbTagsList,
@@ -180,10 +191,14 @@ struct StoreOrthogonalization {
     LinearSolver::observe_detail::contribute_to_reduction_observer<
         OptionsGroup>(completed_iterations, residual_magnitude, cache);
 
-    // Determine whether the linear solver has converged
+    // Determine whether the linear solver has converged. A forcing term set by
+    // a nonlinear solver can relax the relative residual.
+    auto convergence_criteria =
+        get<Convergence::Tags::Criteria<OptionsGroup>>(box);
+    convergence_criteria.relative_residual = std::max(
+        convergence_criteria.relative_residual, get<forcing_term_tag>(box));
     Convergence::HasConverged has_converged{
-        get<Convergence::Tags::Criteria<OptionsGroup>>(box),
-        completed_iterations, residual_magnitude,
+        convergence_criteria, completed_iterations, residual_magnitude,
         get<initial_residual_magnitude_tag>(box)};
 
     // Do some logging
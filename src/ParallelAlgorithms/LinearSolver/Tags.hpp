@@ -120,6 +120,30 @@ struct Magnitude : db::PrefixTag, db::SimpleTag {
   using tag = Tag;
 };
 
+/*!
+ * \brief The relative residual that the linear solve for `Tag` must reach at
+ * least
+ *
+ * \details A nonlinear solver that solves linearizations of its problem sets
+ * this _forcing term_ in the DataBox of the elements to adapt the accuracy of
+ * each linear solve to the progress of the nonlinear solve (see
+ * `NonlinearSolver::newton_raphson::next_forcing_term`). The linear solve has
+ * converged by its relative residual once it falls below the forcing term or
+ * the relative residual of the `Convergence::Tags::Criteria`, whichever is
+ * larger. A forcing term of zero leaves the convergence criteria unchanged.
+ * Linear solvers that support forcing terms use the value in the DataBox if it
+ * is present.
+ */
+template <typename Tag>
+struct ForcingTerm : db::PrefixTag, db::SimpleTag {
+  static std::string name() noexcept {
+    // Add "Linear" prefix to abbreviate the namespace for uniqueness
+    return "LinearForcingTerm(" + db::tag_name<Tag>() + ")";
+  }
+  using type = double;
+  using tag = Tag;
+};
+
 /*!
  * \brief The prefix for tags related to an orthogonalization procedure
  */
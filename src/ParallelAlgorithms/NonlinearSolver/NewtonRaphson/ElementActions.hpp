@@ -68,6 +68,7 @@ struct InitializeElement {
       db::add_tag_prefix<NonlinearSolver::Tags::Correction, fields_tag>;
   using globalization_fields_tag =
       db::add_tag_prefix<NonlinearSolver::Tags::Globalization, fields_tag>;
+  using forcing_term_tag = LinearSolver::Tags::ForcingTerm<correction_tag>;
 
  public:
   using simple_tags =
@@ -77,7 +78,7 @@ struct InitializeElement {
                  NonlinearSolver::Tags::Globalization<
                      Convergence::Tags::IterationId<OptionsGroup>>,
                  NonlinearSolver::Tags::StepLength<OptionsGroup>,
-                 globalization_fields_tag>;
+                 globalization_fields_tag, forcing_term_tag>;
   using compute_tags = tmpl::list<
       NonlinearSolver::Tags::ResidualCompute<fields_tag, source_tag>>;
 
@@ -94,10 +95,11 @@ struct InitializeElement {
         tmpl::list<Convergence::Tags::IterationId<OptionsGroup>,
                    NonlinearSolver::Tags::Globalization<
                        Convergence::Tags::IterationId<OptionsGroup>>,
-                   NonlinearSolver::Tags::StepLength<OptionsGroup>>>(
+                   NonlinearSolver::Tags::StepLength<OptionsGroup>,
+                   forcing_term_tag>>(
         make_not_null(&box), std::numeric_limits<size_t>::max(),
         std::numeric_limits<size_t>::max(),
-        std::numeric_limits<double>::signaling_NaN());
+        std::numeric_limits<double>::signaling_NaN(), 0.);
     return std::make_tuple(std::move(box));
   }
 };
@@ -160,6 +162,11 @@ struct PrepareSolve {
 // converged.
 template <typename FieldsTag, typename OptionsGroup, typename Label>
 struct ReceiveInitialHasConverged {
+ private:
+  using correction_tag =
+      db::add_tag_prefix<NonlinearSolver::Tags::Correction, FieldsTag>;
+
+ public:
   using inbox_tags = tmpl::list<Tags::GlobalizationResult<OptionsGroup>>;
 
   template <typename DbTags, typename... InboxTags, typename Metavariables,
@@ -186,17 +193,21 @@ struct ReceiveInitialHasConverged {
         tuples::get<Tags::GlobalizationResult<OptionsGroup>>(inboxes)
             .extract(db::get<Convergence::Tags::IterationId<OptionsGroup>>(box))
             .mapped());
-    ASSERT(
-        std::holds_alternative<Convergence::HasConverged>(globalization_result),
-        "No globalization should occur for the initial residual. This is a "
-        "bug, so please file an issue.");
-    auto& has_converged = get<Convergence::HasConverged>(globalization_result);
-
-    db::mutate<Convergence::Tags::HasConverged<OptionsGroup>>(
+    using step_result_type = std::tuple<Convergence::HasConverged, double>;
+    ASSERT(std::holds_alternative<step_result_type>(globalization_result),
+           "No globalization should occur for the initial residual. This is a "
+           "bug, so please file an issue.");
+    auto& step_result = get<step_result_type>(globalization_result);
+
+    db::mutate<Convergence::Tags::HasConverged<OptionsGroup>,
+               LinearSolver::Tags::ForcingTerm<correction_tag>>(
         make_not_null(&box),
-        [&has_converged](const gsl::not_null<Convergence::HasConverged*>
-                             local_has_converged) noexcept {
-          *local_has_converged = std::move(has_converged);
+        [&step_result](
+            const gsl::not_null<Convergence::HasConverged*>
+                local_has_converged,
+            const gsl::not_null<double*> forcing_term) noexcept {
+          *local_has_converged = std::move(get<0>(step_result));
+          *forcing_term = get<1>(step_result);
         });
 
     // Skip steps entirely if the solve has already converged
@@ -395,6 +406,11 @@ struct ContributeToResidualMagnitudeReduction {
 // `PerformStep` to try again with the updated step length.
 template <typename FieldsTag, typename OptionsGroup, typename Label>
 struct Globalize {
+ private:
+  using correction_tag =
+      db::add_tag_prefix<NonlinearSolver::Tags::Correction, FieldsTag>;
+
+ public:
   using const_global_cache_tags =
       tmpl::list<logging::Tags::Verbosity<OptionsGroup>>;
   using inbox_tags = tmpl::list<Tags::GlobalizationResult<OptionsGroup>>;
@@ -455,13 +471,18 @@ struct Globalize {
     }
 
     // At this point globalization is complete, so we proceed with the algorithm
-    auto& has_converged = get<Convergence::HasConverged>(globalization_result);
+    auto& step_result = get<std::tuple<Convergence::HasConverged, double>>(
+        globalization_result);
 
-    db::mutate<Convergence::Tags::HasConverged<OptionsGroup>>(
+    db::mutate<Convergence::Tags::HasConverged<OptionsGroup>,
+               LinearSolver::Tags::ForcingTerm<correction_tag>>(
         make_not_null(&box),
-        [&has_converged](const gsl::not_null<Convergence::HasConverged*>
-                             local_has_converged) noexcept {
-          *local_has_converged = std::move(has_converged);
+        [&step_result](
+            const gsl::not_null<Convergence::HasConverged*>
+                local_has_converged,
+            const gsl::not_null<double*> forcing_term) noexcept {
+          *local_has_converged = std::move(get<0>(step_result));
+          *forcing_term = get<1>(step_result);
         });
 
     constexpr size_t this_action_index =
@@ -0,0 +1,42 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "ParallelAlgorithms/NonlinearSolver/NewtonRaphson/ForcingTerm.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "ErrorHandling/Assert.hpp"
+
+namespace NonlinearSolver::newton_raphson {
+
+double next_forcing_term(const double prev_forcing_term,
+                         const double residual_magnitude,
+                         const double prev_residual_magnitude,
+                         const double residual_tolerance,
+                         const double max_forcing_term, const double gamma,
+                         const double alpha) noexcept {
+  ASSERT(prev_residual_magnitude > 0.,
+         "The previous residual magnitude must be positive, but is "
+             << prev_residual_magnitude);
+  ASSERT(max_forcing_term > 0. and max_forcing_term < 1.,
+         "The maximum forcing term must be in (0, 1), but is "
+             << max_forcing_term);
+  double forcing_term =
+      gamma * pow(residual_magnitude / prev_residual_magnitude, alpha);
+  // Don't let the forcing term decrease too quickly
+  const double forcing_term_safeguard = gamma * pow(prev_forcing_term, alpha);
+  if (forcing_term_safeguard > 0.1) {
+    forcing_term = std::max(forcing_term, forcing_term_safeguard);
+  }
+  forcing_term = std::min(forcing_term, max_forcing_term);
+  // Don't oversolve the final step
+  if (residual_magnitude > 0.) {
+    forcing_term = std::min(
+        max_forcing_term,
+        std::max(forcing_term, 0.5 * residual_tolerance / residual_magnitude));
+  }
+  return forcing_term;
+}
+
+}  // namespace NonlinearSolver::newton_raphson
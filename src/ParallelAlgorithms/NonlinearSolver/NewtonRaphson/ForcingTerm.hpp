@@ -0,0 +1,45 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+namespace NonlinearSolver::newton_raphson {
+/*!
+ * \brief Find the forcing term for the next linear solve of an inexact Newton
+ * method
+ *
+ * The forcing term \f$\eta_k\f$ is the relative residual to which the
+ * linearized problem in Newton-Raphson step \f$k\f$ is solved, i.e. the linear
+ * solve for the correction \f$\delta x_k\f$ stops once
+ * \f$|r_k - \frac{\delta A_\mathrm{nonlinear}}{\delta x}(x_k)\delta x_k| \leq
+ * \eta_k |r_k|\f$ (see `NonlinearSolver::newton_raphson::NewtonRaphson`). Far
+ * from the solution the linearization is a poor model of the nonlinear
+ * problem, so solving it accurately is wasted effort. This function implements
+ * "Choice 2" of \cite EisenstatWalker1996, which relates the forcing term to
+ * the reduction of the nonlinear residual in the previous step:
+ *
+ * \f{equation}
+ * \eta_k = \gamma \left(\frac{|r_k|}{|r_{k-1}|}\right)^\alpha
+ * \text{.}
+ * \f}
+ *
+ * The forcing term is safeguarded as follows:
+ *
+ * - It decreases no faster than \f$\gamma\eta_{k-1}^\alpha\f$ when that
+ *   quantity exceeds 0.1, so a single good step doesn't trigger an
+ *   unnecessarily accurate linear solve \cite EisenstatWalker1996.
+ * - It is no larger than the `max_forcing_term` \f$\eta_\mathrm{max}\f$.
+ * - It is no smaller than \f$\tau / (2|r_k|)\f$, where \f$\tau\f$ is the
+ *   `residual_tolerance` that the nonlinear solve must reach, so the final
+ *   linear solve doesn't reduce the residual far below that tolerance (see
+ *   e.g. Kelley, "Iterative Methods for Linear and Nonlinear Equations",
+ *   Sec. 6.3).
+ *
+ * The default parameters \f$\gamma=0.9\f$ and \f$\alpha=2\f$ are the values
+ * recommended in \cite EisenstatWalker1996.
+ */
+double next_forcing_term(double prev_forcing_term, double residual_magnitude,
+                         double prev_residual_magnitude,
+                         double residual_tolerance, double max_forcing_term,
+                         double gamma = 0.9, double alpha = 2.) noexcept;
+}  // namespace NonlinearSolver::newton_raphson
@@ -66,6 +66,21 @@ namespace newton_raphson {
  * line-search globalization, such as a trust-region globalization or more
  * sophisticated nonlinear preconditioning techniques (see e.g. \cite Brune2015
  * for an overview), are not currently implemented.
+ *
+ * \par Inexact Newton:
+ * Far from the solution the linearization is a poor model of the nonlinear
+ * problem, so solving it to the linear solver's convergence criteria in every
+ * step wastes linear solver iterations. When the
+ * `NonlinearSolver::OptionTags::MaxForcingTerm` is set, the linearized problem
+ * in each step is only solved to the relative residual
+ * \f$\eta_k\f$ (the _forcing term_) that
+ * `NonlinearSolver::newton_raphson::next_forcing_term` computes from the
+ * history of the nonlinear residual \cite EisenstatWalker1996. The forcing term
+ * is passed to the linear solver in the
+ * `LinearSolver::Tags::ForcingTerm<linear_solver_fields_tag>`, so the linear
+ * solver must support forcing terms (see e.g. `LinearSolver::gmres::Gmres`).
+ * The forcing terms are reported along with the residuals of the nonlinear
+ * solver.
  */
 template <typename Metavariables, typename FieldsTag, typename OptionsGroup,
           typename SourceTag =
@@ -38,7 +38,8 @@ struct ResidualMonitor {
       tmpl::list<logging::Tags::Verbosity<OptionsGroup>,
                  Convergence::Tags::Criteria<OptionsGroup>,
                  NonlinearSolver::Tags::SufficientDecrease<OptionsGroup>,
-                 NonlinearSolver::Tags::MaxGlobalizationSteps<OptionsGroup>>;
+                 NonlinearSolver::Tags::MaxGlobalizationSteps<OptionsGroup>,
+                 NonlinearSolver::Tags::MaxForcingTerm<OptionsGroup>>;
   using metavariables = Metavariables;
   using phase_dependent_action_list = tmpl::list<
       Parallel::PhaseActions<
@@ -78,13 +79,15 @@ struct InitializeResidualMonitor {
       ::Tags::Initial<LinearSolver::Tags::Magnitude<residual_tag>>;
   using prev_residual_magnitude_square_tag =
       NonlinearSolver::Tags::Globalization<residual_magnitude_square_tag>;
+  using forcing_term_tag = LinearSolver::Tags::ForcingTerm<
+      db::add_tag_prefix<NonlinearSolver::Tags::Correction, fields_tag>>;
 
  public:
   using simple_tags =
       db::AddSimpleTags<residual_magnitude_square_tag,
                         initial_residual_magnitude_tag,
                         NonlinearSolver::Tags::StepLength<OptionsGroup>,
-                        prev_residual_magnitude_square_tag>;
+                        prev_residual_magnitude_square_tag, forcing_term_tag>;
   using compute_tags = tmpl::list<>;
 
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
@@ -100,6 +103,7 @@ struct InitializeResidualMonitor {
         make_not_null(&box), std::numeric_limits<double>::signaling_NaN(),
         std::numeric_limits<double>::signaling_NaN(),
         std::numeric_limits<double>::signaling_NaN(),
+        std::numeric_limits<double>::signaling_NaN(),
         std::numeric_limits<double>::signaling_NaN());
     return std::make_tuple(std::move(box), true);
   }
@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <tuple>
 #include <variant>
 
 #include "DataStructures/DataBox/DataBox.hpp"
@@ -15,6 +16,8 @@
 #include "Parallel/Info.hpp"
 #include "Parallel/Invoke.hpp"
 #include "Parallel/Printf.hpp"
+#include "ParallelAlgorithms/LinearSolver/Tags.hpp"
+#include "ParallelAlgorithms/NonlinearSolver/NewtonRaphson/ForcingTerm.hpp"
 #include "ParallelAlgorithms/NonlinearSolver/NewtonRaphson/LineSearch.hpp"
 #include "ParallelAlgorithms/NonlinearSolver/NewtonRaphson/Tags/InboxTags.hpp"
 #include "ParallelAlgorithms/NonlinearSolver/Observe.hpp"
@@ -43,6 +46,8 @@ struct CheckResidualMagnitude {
       ::Tags::Initial<LinearSolver::Tags::Magnitude<residual_tag>>;
   using prev_residual_magnitude_square_tag =
       NonlinearSolver::Tags::Globalization<residual_magnitude_square_tag>;
+  using forcing_term_tag = LinearSolver::Tags::ForcingTerm<
+      db::add_tag_prefix<NonlinearSolver::Tags::Correction, fields_tag>>;
 
   template <typename ParallelComponent, typename DataBox,
             typename Metavariables, typename ArrayIndex, typename... Args>
@@ -69,9 +74,13 @@ struct CheckResidualMagnitude {
                          const double step_length) noexcept {
     const double residual_magnitude = sqrt(next_residual_magnitude_square);
 
+    // The forcing term of this iteration is the one the linearized problem was
+    // solved with
     NonlinearSolver::observe_detail::contribute_to_reduction_observer<
         OptionsGroup>(iteration_id, globalization_iteration_id,
-                      residual_magnitude, step_length, cache);
+                      residual_magnitude, step_length,
+                      iteration_id == 0 ? 0. : get<forcing_term_tag>(box),
+                      cache);
 
     if (UNLIKELY(iteration_id == 0)) {
       db::mutate<initial_residual_magnitude_tag>(
@@ -152,7 +161,8 @@ struct CheckResidualMagnitude {
           Parallel::receive_data<Tags::GlobalizationResult<OptionsGroup>>(
               Parallel::get_parallel_component<BroadcastTarget>(cache),
               iteration_id,
-              std::variant<double, Convergence::HasConverged>{
+              std::variant<double,
+                           std::tuple<Convergence::HasConverged, double>>{
                   next_step_length});
           return;
         } else if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(box) >=
@@ -169,11 +179,37 @@ struct CheckResidualMagnitude {
       }    // sufficient decrease condition
     }      // initial iteration
 
-    db::mutate<residual_magnitude_square_tag>(
-        make_not_null(&box), [next_residual_magnitude_square](
-                                 const gsl::not_null<double*>
-                                     local_residual_magnitude_square) noexcept {
+    // Choose the forcing term for the linear solve of the next step, i.e. the
+    // relative residual to which the linearized problem is solved. See
+    // `NonlinearSolver::newton_raphson::next_forcing_term` for details. A
+    // forcing term of zero solves the linearized problem to the convergence
+    // criteria of the linear solver.
+    const auto& max_forcing_term =
+        get<NonlinearSolver::Tags::MaxForcingTerm<OptionsGroup>>(box);
+    double forcing_term = 0.;
+    if (max_forcing_term.has_value()) {
+      if (UNLIKELY(iteration_id == 0)) {
+        forcing_term = *max_forcing_term;
+      } else {
+        const auto& convergence_criteria =
+            get<Convergence::Tags::Criteria<OptionsGroup>>(box);
+        forcing_term = NonlinearSolver::newton_raphson::next_forcing_term(
+            get<forcing_term_tag>(box), residual_magnitude,
+            sqrt(get<residual_magnitude_square_tag>(box)),
+            std::max(convergence_criteria.absolute_residual,
+                     convergence_criteria.relative_residual *
+                         get<initial_residual_magnitude_tag>(box)),
+            *max_forcing_term);
+      }
+    }
+
+    db::mutate<residual_magnitude_square_tag, forcing_term_tag>(
+        make_not_null(&box),
+        [next_residual_magnitude_square, forcing_term](
+            const gsl::not_null<double*> local_residual_magnitude_square,
+            const gsl::not_null<double*> local_forcing_term) noexcept {
           *local_residual_magnitude_square = next_residual_magnitude_square;
+          *local_forcing_term = forcing_term;
         });
 
     // At this point, the iteration is complete. We proceed with logging and
@@ -197,6 +233,14 @@ struct CheckResidualMagnitude {
                          iteration_id, residual_magnitude);
       }
     }
+    if (UNLIKELY(max_forcing_term.has_value() and not has_converged and
+                 get<logging::Tags::Verbosity<OptionsGroup>>(box) >=
+                     ::Verbosity::Verbose)) {
+      Parallel::printf("Nonlinear solver '" + Options::name<OptionsGroup>() +
+                           "' iteration %zu solves the linearized problem to "
+                           "relative residual %e.\n",
+                       iteration_id + 1, forcing_term);
+    }
     if (UNLIKELY(has_converged and get<logging::Tags::Verbosity<OptionsGroup>>(
                                        box) >= ::Verbosity::Quiet)) {
       if (UNLIKELY(iteration_id == 0)) {
@@ -214,9 +258,9 @@ struct CheckResidualMagnitude {
 
     Parallel::receive_data<Tags::GlobalizationResult<OptionsGroup>>(
         Parallel::get_parallel_component<BroadcastTarget>(cache), iteration_id,
-        std::variant<double, Convergence::HasConverged>(
+        std::variant<double, std::tuple<Convergence::HasConverged, double>>(
             // NOLINTNEXTLINE(performance-move-const-arg)
-            std::move(has_converged)));
+            std::make_tuple(std::move(has_converged), forcing_term)));
   }
 };
 
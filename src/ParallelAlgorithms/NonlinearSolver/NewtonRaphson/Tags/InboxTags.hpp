@@ -17,12 +17,16 @@
 
 namespace NonlinearSolver::newton_raphson::detail::Tags {
 
+// Holds either the step length of the next globalization step or, once the
+// step is complete, whether the solve has converged along with the forcing term
+// for the linear solve of the next step
 template <typename OptionsGroup>
 struct GlobalizationResult
     : Parallel::InboxInserters::Value<GlobalizationResult<OptionsGroup>> {
   using temporal_id = size_t;
-  using type =
-      std::map<temporal_id, std::variant<double, Convergence::HasConverged>>;
+  using type = std::map<
+      temporal_id,
+      std::variant<double, std::tuple<Convergence::HasConverged, double>>>;
 };
 
 }  // namespace NonlinearSolver::newton_raphson::detail::Tags
@@ -29,6 +29,8 @@ using reduction_data = Parallel::ReductionData<
     // Residual
     Parallel::ReductionDatum<double, funcl::AssertEqual<>>,
     // Step length
+    Parallel::ReductionDatum<double, funcl::AssertEqual<>>,
+    // Forcing term
     Parallel::ReductionDatum<double, funcl::AssertEqual<>>>;
 
 template <typename OptionsGroup>
@@ -45,11 +47,15 @@ struct Registration {
 
 /*!
  * \brief Contributes data from the residual monitor to the reduction observer
+ *
+ * The `forcing_term` is the relative residual to which the linearized problem
+ * of the iteration was solved, or zero if the linear solve was not relaxed.
  */
 template <typename OptionsGroup, typename Metavariables>
 void contribute_to_reduction_observer(
     const size_t iteration_id, const size_t globalization_iteration_id,
     const double residual_magnitude, const double step_length,
+    const double forcing_term,
     Parallel::GlobalCache<Metavariables>& cache) noexcept {
   const auto observation_id = observers::ObservationId(
       iteration_id, pretty_type::get_name<OptionsGroup>());
@@ -62,9 +68,9 @@ void contribute_to_reduction_observer(
       static_cast<size_t>(Parallel::my_node()),
       std::string{"/" + Options::name<OptionsGroup>() + "Residuals"},
       std::vector<std::string>{"Iteration", "GlobalizationStep", "Residual",
-                               "StepLength"},
+                               "StepLength", "ForcingTerm"},
       reduction_data{iteration_id, globalization_iteration_id,
-                     residual_magnitude, step_length});
+                     residual_magnitude, step_length, forcing_term});
 }
 
 }  // namespace NonlinearSolver::observe_detail
@@ -7,10 +7,13 @@
 #pragma once
 
 #include <cstddef>
+#include <optional>
 #include <string>
 
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Tag.hpp"
+#include "ErrorHandling/Error.hpp"
+#include "Options/Auto.hpp"
 #include "Options/Options.hpp"
 #include "Utilities/Gsl.hpp"
 
@@ -90,6 +93,27 @@ struct MaxGlobalizationSteps {
   using group = OptionsGroup;
 };
 
+/*!
+ * \brief The largest relative residual to which the linearized problem is
+ * solved in a step of the nonlinear solver
+ *
+ * When this option is set, the accuracy of each linear solve of an inexact
+ * Newton method is adapted to the progress of the nonlinear solve by means of
+ * the forcing terms described in
+ * `NonlinearSolver::newton_raphson::next_forcing_term`. The forcing terms never
+ * exceed this value. Set to `None` to solve all linearized problems to the
+ * convergence criteria of the linear solver.
+ */
+template <typename OptionsGroup>
+struct MaxForcingTerm {
+  using type = Options::Auto<double, Options::AutoLabel::None>;
+  static constexpr Options::String help = {
+      "Largest relative residual of the linearized solves, or 'None' to solve "
+      "them to the convergence criteria of the linear solver"};
+  static type suggested_value() noexcept { return {}; }
+  using group = OptionsGroup;
+};
+
 }  // namespace OptionTags
 
 namespace Tags {
@@ -235,6 +259,30 @@ struct MaxGlobalizationSteps : db::SimpleTag {
   static type create_from_options(const type& option) { return option; }
 };
 
+/*!
+ * \brief The largest relative residual to which the linearized problem is
+ * solved in a step of the nonlinear solver, or `std::nullopt` if the forcing
+ * terms are disabled
+ *
+ * \see `NonlinearSolver::OptionTags::MaxForcingTerm`
+ */
+template <typename OptionsGroup>
+struct MaxForcingTerm : db::SimpleTag {
+  static std::string name() noexcept {
+    return "MaxForcingTerm(" + Options::name<OptionsGroup>() + ")";
+  }
+  using type = std::optional<double>;
+  static constexpr bool pass_metavariables = false;
+  using option_tags = tmpl::list<OptionTags::MaxForcingTerm<OptionsGroup>>;
+  static type create_from_options(const type& option) {
+    if (option.has_value() and (*option <= 0. or *option >= 1.)) {
+      ERROR("The 'MaxForcingTerm' must be in the interval (0, 1) but is "
+            << *option);
+    }
+    return option;
+  }
+};
+
 /// Prefix indicating the `Tag` is related to the globalization procedure
 template <typename Tag>
 struct Globalization : db::PrefixTag, db::SimpleTag {
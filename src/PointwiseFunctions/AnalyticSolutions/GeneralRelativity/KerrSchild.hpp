@@ -231,6 +231,9 @@ class KerrSchild : public MarkAsAnalyticSolution {
   using options = tmpl::list<Mass, Spin, Center>;
   static constexpr Options::String help{
       "Black hole in Kerr-Schild coordinates"};
+  /// Kerr-Schild coordinates are adapted to the stationary Killing vector of
+  /// the black hole, so none of the variables depend on time.
+  static constexpr bool is_time_independent = true;
 
   KerrSchild(double mass, Spin::type dimensionless_spin, Center::type center,
              const Options::Context& context = {});
@@ -41,6 +41,8 @@ class Minkowski : public MarkAsAnalyticSolution {
   static constexpr Options::String help{
       "Minkowski solution to Einstein's Equations"};
   static constexpr size_t volume_dim = Dim;
+  /// Flat space in Cartesian coordinates, so all variables are constant.
+  static constexpr bool is_time_independent = true;
 
   Minkowski() = default;
   Minkowski(const Minkowski& /*rhs*/) noexcept = default;
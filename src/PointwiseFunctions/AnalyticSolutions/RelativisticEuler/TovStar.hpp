@@ -141,6 +141,9 @@ class TovStar : public MarkAsAnalyticSolution {
       "A static, spherically-symmetric star found by solving the \n"
       "Tolman-Oppenheimer-Volkoff (TOV) equations, with a given central \n"
       "density and polytropic fluid."};
+  /// The star is static, so neither the fluid nor the metric variables
+  /// depend on time.
+  static constexpr bool is_time_independent = true;
 
   TovStar() = default;
   TovStar(const TovStar& /*rhs*/) = delete;
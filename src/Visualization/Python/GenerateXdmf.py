@@ -35,7 +35,8 @@ def generate_xdmf(file_prefix, output, subfile_name, start_time, stop_time,
                                                  h5files[0][0].keys()))
     temporal_ids_and_values = [(x,
                                 element_data.get(x).attrs['observation_value'])
-                               for x in element_data.keys()]
+                               for x in element_data.keys()
+                               if x.startswith('ObservationId')]
     temporal_ids_and_values.sort(key=lambda x: x[1])
 
     xdmf_output = "<?xml version=\"1.0\" ?>\n" \
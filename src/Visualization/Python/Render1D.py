@@ -126,7 +126,8 @@ def print_var_names(files, subfile_name):
 
     h5files = get_h5_files(files)
     volfile = h5files[0][subfile_name]
-    obs_id_0 = next(iter(volfile))
+    obs_id_0 = next(obs_id for obs_id in volfile
+                    if obs_id.startswith('ObservationId'))
     variables = list(volfile[obs_id_0].keys())
     variables.remove("connectivity")
     variables.remove("InertialCoordinates_x")
@@ -155,7 +156,8 @@ def get_data(files, subfile_name, var_name):
     volfiles = [h5file[subfile_name] for h5file in h5files]
     # Get a list of times from the first vol file
     ids_times = [(obs_id, volfiles[0][obs_id].attrs['observation_value'])
-                 for obs_id in volfiles[0].keys()]
+                 for obs_id in volfiles[0].keys()
+                 if obs_id.startswith('ObservationId')]
     ids_times.sort(key=lambda pair: pair[1])
     for obs_id, local_time in ids_times:
         local_coords = []
@@ -13,6 +13,7 @@
 #include "ApparentHorizons/ComputeItems.hpp"  // IWYU pragma: keep
 #include "ApparentHorizons/FastFlow.hpp"
 #include "ApparentHorizons/Strahlkorper.hpp"
+#include "ApparentHorizons/Tags.hpp"
 #include "ApparentHorizons/YlmSpherepack.hpp"
 #include "DataStructures/DataBox/DataBox.hpp"  // IWYU pragma: keep
 #include "DataStructures/DataBox/Prefixes.hpp"
@@ -245,7 +246,7 @@ void test_apparent_horizon(const gsl::not_null<size_t*> test_horizon_called,
   // The initial guess for the horizon search is a sphere of radius 2.8M.
   intrp::OptionHolders::ApparentHorizon<Frame::Inertial> apparent_horizon_opts(
       Strahlkorper<Frame::Inertial>{l_max, 2.8, {{0.0, 0.0, 0.0}}}, FastFlow{},
-      Verbosity::Verbose);
+      Verbosity::Verbose, 3);
 
   // The test finds an apparent horizon for a Schwarzschild or Kerr
   // metric with M=1.  We choose a spherical shell domain extending
@@ -391,6 +392,16 @@ void test_apparent_horizon(const gsl::not_null<size_t*> test_horizon_called,
 
   // Make sure function was called twice.
   CHECK(*test_horizon_called == 2);
+
+  // Both horizons are kept for extrapolating the next initial guess.
+  const auto& previous_strahlkorpers = ActionTesting::get_databox_tag<
+      target_component, ah::Tags::PreviousStrahlkorpers<Frame::Inertial>>(
+      runner, 0);
+  REQUIRE(previous_strahlkorpers.size() == 2);
+  CHECK(previous_strahlkorpers.front().first ==
+        first_temporal_id.substep_time().value());
+  CHECK(previous_strahlkorpers.back().first ==
+        second_temporal_id.substep_time().value());
 }
 
 SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.ApparentHorizonFinder",
@@ -0,0 +1,71 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <deque>
+#include <utility>
+
+#include "ApparentHorizons/ExtrapolateStrahlkorper.hpp"
+#include "ApparentHorizons/SpherepackIterator.hpp"
+#include "ApparentHorizons/Strahlkorper.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/IndexType.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+// A surface whose coefficients are quadratic in time.
+Strahlkorper<Frame::Inertial> make_strahlkorper(
+    const double time, const size_t l_max = 6,
+    const std::array<double, 3>& center = {{0.1, 0.2, 0.3}}) noexcept {
+  const Strahlkorper<Frame::Inertial> sphere(l_max, l_max, 2.0, center);
+  auto coefs = sphere.coefficients();
+  for (SpherepackIterator it(l_max, l_max); it; ++it) {
+    coefs[it()] += (0.01 * time + 0.002 * time * time) /
+                   static_cast<double>(it.l() + 1);
+  }
+  return Strahlkorper<Frame::Inertial>(std::move(coefs), sphere);
+}
+
+void check_extrapolation(
+    const std::deque<std::pair<double, Strahlkorper<Frame::Inertial>>>&
+        previous_strahlkorpers,
+    const double time,
+    const Strahlkorper<Frame::Inertial>& expected) noexcept {
+  Strahlkorper<Frame::Inertial> strahlkorper{};
+  extrapolate_strahlkorper_in_time(make_not_null(&strahlkorper), time,
+                                   previous_strahlkorpers);
+  CHECK(strahlkorper.l_max() == expected.l_max());
+  CHECK(strahlkorper.m_max() == expected.m_max());
+  CHECK(strahlkorper.center() == expected.center());
+  CHECK_ITERABLE_APPROX(strahlkorper.coefficients(), expected.coefficients());
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.ApparentHorizons.ExtrapolateStrahlkorper",
+                  "[ApparentHorizons][Unit]") {
+  std::deque<std::pair<double, Strahlkorper<Frame::Inertial>>>
+      previous_strahlkorpers{};
+
+  // A single surface is copied.
+  previous_strahlkorpers.emplace_back(1.0, make_strahlkorper(1.0));
+  check_extrapolation(previous_strahlkorpers, 1.5, make_strahlkorper(1.0));
+
+  // Three surfaces determine the quadratic exactly.
+  previous_strahlkorpers.emplace_back(1.5, make_strahlkorper(1.5));
+  previous_strahlkorpers.emplace_back(2.5, make_strahlkorper(2.5));
+  check_extrapolation(previous_strahlkorpers, 3.0, make_strahlkorper(3.0));
+  check_extrapolation(previous_strahlkorpers, 2.0, make_strahlkorper(2.0));
+
+  // Surfaces with a different resolution or center than the newest one are
+  // not used.
+  previous_strahlkorpers.emplace_front(0.5, make_strahlkorper(0.5, 4));
+  check_extrapolation(previous_strahlkorpers, 3.0, make_strahlkorper(3.0));
+  const std::array<double, 3> new_center{{0.0, 0.0, 0.0}};
+  previous_strahlkorpers.emplace_back(3.0,
+                                      make_strahlkorper(3.0, 6, new_center));
+  check_extrapolation(previous_strahlkorpers, 3.5,
+                      make_strahlkorper(3.0, 6, new_center));
+}
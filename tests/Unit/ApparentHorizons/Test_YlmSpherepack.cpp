@@ -3,6 +3,7 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstddef>
@@ -11,6 +12,7 @@
 #include <utility>
 #include <vector>
 
+#include "ApparentHorizons/SpherepackIterator.hpp"
 #include "ApparentHorizons/YlmSpherepack.hpp"
 #include "ApparentHorizons/YlmSpherepackHelper.hpp"
 #include "DataStructures/DataVector.hpp"
@@ -56,6 +58,71 @@ void test_prolong_restrict() {
   }
 }
 
+void test_for_fields(const size_t l_max, const size_t m_max) {
+  const YlmSpherepack ylm_spherepack(l_max, m_max);
+  const size_t physical_size = ylm_spherepack.physical_size();
+  const size_t spectral_size = ylm_spherepack.spectral_size();
+  const auto& theta = ylm_spherepack.theta_points();
+  const auto& phi = ylm_spherepack.phi_points();
+
+  const std::array<DataVector, 3> u{
+      {YlmTestFunctions::FuncA{}.func(theta, phi),
+       YlmTestFunctions::FuncB{}.func(theta, phi),
+       YlmTestFunctions::FuncC{}.func(theta, phi)}};
+  DataVector fields(3 * physical_size);
+  for (size_t k = 0; k < 3; ++k) {
+    std::copy(gsl::at(u, k).begin(), gsl::at(u, k).end(),
+              fields.begin() + k * physical_size);
+  }
+
+  const auto u_spec = ylm_spherepack.phys_to_spec_for_fields(fields);
+  const auto u_test = ylm_spherepack.spec_to_phys_for_fields(u_spec);
+  CHECK_ITERABLE_APPROX(u_test, fields);
+  const auto du = ylm_spherepack.gradient_for_fields(fields);
+  CHECK(get<0>(du).size() == fields.size());
+  const auto lap_u = ylm_spherepack.scalar_laplacian_for_fields(fields);
+  CHECK(lap_u.size() == fields.size());
+
+  for (size_t k = 0; k < 3; ++k) {
+    const DataVector expected_spec =
+        ylm_spherepack.phys_to_spec(gsl::at(u, k));
+    const DataVector spec_k(const_cast<double*>(u_spec.data()) +  // NOLINT
+                                k * spectral_size,
+                            spectral_size);
+    for (SpherepackIterator it(l_max, m_max); it; ++it) {
+      CHECK(spec_k[it()] == approx(expected_spec[it()]));
+    }
+
+    const auto expected_du = ylm_spherepack.gradient(gsl::at(u, k));
+    for (size_t d = 0; d < 2; ++d) {
+      const DataVector du_k(const_cast<double*>(du.get(d).data()) +  // NOLINT
+                                k * physical_size,
+                            physical_size);
+      CHECK_ITERABLE_APPROX(du_k, expected_du.get(d));
+    }
+
+    const DataVector lap_u_k(const_cast<double*>(lap_u.data()) +  // NOLINT
+                                 k * physical_size,
+                             physical_size);
+    CHECK_ITERABLE_APPROX(lap_u_k,
+                          ylm_spherepack.scalar_laplacian(gsl::at(u, k)));
+  }
+
+  // A single field is forwarded to the unbatched transforms
+  const DataVector single_field(const_cast<double*>(fields.data()),  // NOLINT
+                                physical_size);
+  CHECK_ITERABLE_APPROX(
+      ylm_spherepack.spec_to_phys_for_fields(
+          ylm_spherepack.phys_to_spec_for_fields(single_field)),
+      gsl::at(u, 0));
+  CHECK_ITERABLE_APPROX(
+      get<1>(ylm_spherepack.gradient_for_fields(single_field)),
+      get<1>(ylm_spherepack.gradient(gsl::at(u, 0))));
+  CHECK_ITERABLE_APPROX(
+      ylm_spherepack.scalar_laplacian_for_fields(single_field),
+      ylm_spherepack.scalar_laplacian(gsl::at(u, 0)));
+}
+
 void test_loop_over_offset(
     const size_t l_max, const size_t m_max, const size_t physical_stride,
     const YlmTestFunctions::ScalarFunctionWithDerivs& func) {
@@ -632,6 +699,8 @@ SPECTRE_TEST_CASE("Unit.ApparentHorizons.YlmSpherepack",
   }
 
   test_prolong_restrict();
+  test_for_fields(10, 10);
+  test_for_fields(11, 10);
 
   YlmSpherepack s(4, 4);
   test_copy_semantics(s);
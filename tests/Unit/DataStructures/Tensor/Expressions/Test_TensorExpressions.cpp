@@ -8,6 +8,7 @@
 #include "DataStructures/Tensor/Expressions/Evaluate.hpp"
 #include "DataStructures/Tensor/Expressions/TensorExpression.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "ErrorHandling/Error.hpp"
 #include "Helpers/DataStructures/Tensor/Expressions/ComputeRhsTensorIndexRank0TestHelpers.hpp"
 #include "Helpers/DataStructures/Tensor/Expressions/ComputeRhsTensorIndexRank1TestHelpers.hpp"
 #include "Helpers/DataStructures/Tensor/Expressions/ComputeRhsTensorIndexRank2TestHelpers.hpp"
@@ -18,6 +19,8 @@
 #include "Helpers/DataStructures/Tensor/Expressions/EvaluateRank2TestHelpers.hpp"
 #include "Helpers/DataStructures/Tensor/Expressions/EvaluateRank3TestHelpers.hpp"
 #include "Helpers/DataStructures/Tensor/Expressions/EvaluateRank4TestHelpers.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
 
 SPECTRE_TEST_CASE("Unit.DataStructures.Tensor.Expression.Evaluate",
                   "[DataStructures][Unit]") {
@@ -248,6 +251,103 @@ SPECTRE_TEST_CASE("Unit.DataStructures.Tensor.Expression.Evaluate",
       ti_F, ti_A, ti_C, ti_D>();
 }
 
+SPECTRE_TEST_CASE("Unit.DataStructures.Tensor.Expression.EvaluateInPlace",
+                  "[DataStructures][Unit]") {
+  // Rank 0: double
+  const Tensor<double> scalar_1{{{2.5}}};
+  const Tensor<double> scalar_2{{{-0.75}}};
+  Tensor<double> lhs_scalar{};
+  TensorExpressions::evaluate(make_not_null(&lhs_scalar),
+                              scalar_1() + scalar_2());
+  CHECK(get(lhs_scalar) == 1.75);
+
+  // Rank 3: DataVector, with a reordering of the indices on the LHS
+  const size_t used_for_size = 5;
+  tnsr::iaa<DataVector, 3, Frame::Inertial> d_psi(used_for_size);
+  tnsr::iaa<DataVector, 3, Frame::Inertial> phi(used_for_size);
+  for (size_t i = 0; i < d_psi.size(); ++i) {
+    for (size_t s = 0; s < used_for_size; ++s) {
+      d_psi[i][s] = 1.5 * static_cast<double>(i) + static_cast<double>(s);
+      phi[i][s] = 0.25 * static_cast<double>(i * s) - 2.0;
+    }
+  }
+  tnsr::iaa<DataVector, 3, Frame::Inertial> constraint(used_for_size);
+  const double* const data_before_evaluate = get<0, 0, 0>(constraint).data();
+  TensorExpressions::evaluate<ti_i, ti_a, ti_b>(
+      make_not_null(&constraint),
+      d_psi(ti_i, ti_a, ti_b) - phi(ti_i, ti_a, ti_b));
+  // The LHS components have the correct size, so nothing is reallocated
+  CHECK(get<0, 0, 0>(constraint).data() == data_before_evaluate);
+
+  Tensor<DataVector, Symmetry<2, 2, 1>,
+         index_list<SpacetimeIndex<3, UpLo::Lo, Frame::Inertial>,
+                    SpacetimeIndex<3, UpLo::Lo, Frame::Inertial>,
+                    SpatialIndex<3, UpLo::Lo, Frame::Inertial>>>
+      reordered_constraint{};
+  TensorExpressions::evaluate<ti_a, ti_b, ti_i>(
+      make_not_null(&reordered_constraint),
+      d_psi(ti_i, ti_a, ti_b) - phi(ti_i, ti_a, ti_b));
+  for (size_t i = 0; i < 3; ++i) {
+    for (size_t a = 0; a < 4; ++a) {
+      for (size_t b = 0; b < 4; ++b) {
+        const DataVector expected = d_psi.get(i, a, b) - phi.get(i, a, b);
+        CHECK(constraint.get(i, a, b) == expected);
+        CHECK(reordered_constraint.get(a, b, i) == expected);
+      }
+    }
+  }
+
+  // Contraction: DataVector
+  tnsr::Ij<DataVector, 3, Frame::Inertial> mixed(used_for_size);
+  for (size_t i = 0; i < mixed.size(); ++i) {
+    mixed[i] = DataVector(used_for_size, static_cast<double>(i) + 0.5);
+  }
+  Scalar<DataVector> trace{};
+  TensorExpressions::evaluate(make_not_null(&trace), mixed(ti_I, ti_i));
+  CHECK(get(trace) == DataVector(used_for_size, 0.5 + 4.5 + 8.5));
+
+  // Several blocks of grid points, the last one only partially filled
+  const size_t many_points =
+      2 * TensorExpressions::detail::evaluate_block_size + 3;
+  tnsr::ab<DataVector, 3, Frame::Inertial> r(many_points);
+  tnsr::ab<DataVector, 3, Frame::Inertial> s(many_points);
+  for (size_t i = 0; i < r.size(); ++i) {
+    for (size_t p = 0; p < many_points; ++p) {
+      r[i][p] = static_cast<double>(i) + 0.5 * static_cast<double>(p);
+      s[i][p] = 3.0 * static_cast<double>(i) - static_cast<double>(p);
+    }
+  }
+  tnsr::ab<DataVector, 3, Frame::Inertial> transposed_sum{};
+  TensorExpressions::evaluate<ti_b, ti_a>(make_not_null(&transposed_sum),
+                                          r(ti_a, ti_b) + s(ti_a, ti_b));
+  for (size_t a = 0; a < 4; ++a) {
+    for (size_t b = 0; b < 4; ++b) {
+      CHECK(transposed_sum.get(b, a) == r.get(a, b) + s.get(a, b));
+    }
+  }
+
+  // Aliasing of the LHS tensor in the RHS expression
+  CHECK((d_psi(ti_i, ti_a, ti_b) - phi(ti_i, ti_a, ti_b))
+            .is_aliased(&phi));
+  CHECK_FALSE((d_psi(ti_i, ti_a, ti_b) - phi(ti_i, ti_a, ti_b))
+                  .is_aliased(&constraint));
+  CHECK(mixed(ti_I, ti_i).is_aliased(&mixed));
+}
+
+// [[OutputRegex, The LHS Tensor must not appear in the RHS tensor expression]]
+[[noreturn]] SPECTRE_TEST_CASE(
+    "Unit.DataStructures.Tensor.Expression.EvaluateInPlaceAliased",
+    "[DataStructures][Unit]") {
+  ASSERTION_TEST();
+#ifdef SPECTRE_DEBUG
+  tnsr::ab<DataVector, 3, Frame::Inertial> lhs(5_st, 1.0);
+  const tnsr::ab<DataVector, 3, Frame::Inertial> rhs(5_st, 2.0);
+  TensorExpressions::evaluate<ti_b, ti_a>(make_not_null(&lhs),
+                                          lhs(ti_a, ti_b) + rhs(ti_a, ti_b));
+  ERROR("Failed to trigger ASSERT in an assertion test");
+#endif
+}
+
 SPECTRE_TEST_CASE("Unit.DataStructures.Tensor.Expression.ComputeRhsTensorIndex",
                   "[DataStructures][Unit]") {
   // Rank 0: double
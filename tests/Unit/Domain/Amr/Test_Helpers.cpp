@@ -5,6 +5,7 @@
 
 #include <array>
 #include <cstddef>
+#include <vector>
 
 #include "Domain/Amr/Flag.hpp"
 #include "Domain/Amr/Helpers.hpp"
@@ -126,12 +127,55 @@ void test_has_potential_sibling() {
   CHECK_FALSE(
       amr::has_potential_sibling(element_id_3d, Direction<3>::upper_zeta()));
 }
+
+void test_ids_of_children_and_parent() noexcept {
+  const ElementId<1> element_id_1d{0, {{SegmentId(2, 3)}}};
+  CHECK(amr::ids_of_children(element_id_1d, {{amr::Flag::Split}}) ==
+        std::vector<ElementId<1>>{ElementId<1>{0, {{SegmentId(3, 6)}}},
+                                  ElementId<1>{0, {{SegmentId(3, 7)}}}});
+  CHECK(amr::ids_of_children(element_id_1d, {{amr::Flag::DoNothing}}) ==
+        std::vector<ElementId<1>>{element_id_1d});
+  CHECK(amr::id_of_parent(element_id_1d, {{amr::Flag::Join}}) ==
+        ElementId<1>{0, {{SegmentId(1, 1)}}});
+  CHECK(amr::id_of_parent(element_id_1d, {{amr::Flag::IncreaseResolution}}) ==
+        element_id_1d);
+
+  const ElementId<2> element_id_2d{1, {{SegmentId(3, 5), SegmentId(1, 1)}}};
+  CHECK(amr::ids_of_children(element_id_2d,
+                             {{amr::Flag::Split, amr::Flag::Split}}) ==
+        std::vector<ElementId<2>>{
+            ElementId<2>{1, {{SegmentId(4, 10), SegmentId(2, 2)}}},
+            ElementId<2>{1, {{SegmentId(4, 11), SegmentId(2, 2)}}},
+            ElementId<2>{1, {{SegmentId(4, 10), SegmentId(2, 3)}}},
+            ElementId<2>{1, {{SegmentId(4, 11), SegmentId(2, 3)}}}});
+  CHECK(amr::ids_of_children(element_id_2d,
+                             {{amr::Flag::DoNothing, amr::Flag::Split}}) ==
+        std::vector<ElementId<2>>{
+            ElementId<2>{1, {{SegmentId(3, 5), SegmentId(2, 2)}}},
+            ElementId<2>{1, {{SegmentId(3, 5), SegmentId(2, 3)}}}});
+  CHECK(
+      amr::id_of_parent(element_id_2d, {{amr::Flag::Join, amr::Flag::Join}}) ==
+      ElementId<2>{1, {{SegmentId(2, 2), SegmentId(0, 0)}}});
+
+  const ElementId<3> element_id_3d{
+      7, {{SegmentId(5, 15), SegmentId(2, 0), SegmentId(4, 6)}}};
+  const std::array<amr::Flag, 3> split_flags{
+      {amr::Flag::Split, amr::Flag::DecreaseResolution, amr::Flag::Split}};
+  const auto children_3d = amr::ids_of_children(element_id_3d, split_flags);
+  CHECK(children_3d.size() == 4);
+  const std::array<amr::Flag, 3> join_flags{
+      {amr::Flag::Join, amr::Flag::DecreaseResolution, amr::Flag::Join}};
+  for (const auto& child_id : children_3d) {
+    CHECK(amr::id_of_parent(child_id, join_flags) == element_id_3d);
+  }
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Domain.Amr.Helpers", "[Domain][Unit]") {
   test_desired_refinement_levels();
   test_desired_refinement_levels_of_neighbor();
   test_has_potential_sibling();
+  test_ids_of_children_and_parent();
 }
 
 // [[OutputRegex, Undefined amr::Flag in dimension]]
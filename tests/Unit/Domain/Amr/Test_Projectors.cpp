@@ -0,0 +1,142 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <unordered_map>
+#include <utility>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/Amr/Flag.hpp"
+#include "Domain/Amr/Helpers.hpp"
+#include "Domain/Amr/Projectors.hpp"
+#include "Domain/LogicalCoordinates.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Literals.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MakeArray.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+struct Var : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+
+// A polynomial of degree three in each dimension, evaluated in the logical
+// coordinates of the Element with ElementId `parent_id` at the logical
+// coordinates of the Element with ElementId `element_id` and Mesh `mesh`.
+template <size_t Dim>
+Variables<tmpl::list<Var>> polynomial(
+    const Mesh<Dim>& mesh, const ElementId<Dim>& element_id,
+    const ElementId<Dim>& parent_id) noexcept {
+  auto coords = logical_coordinates(mesh);
+  for (size_t d = 0; d < Dim; ++d) {
+    const auto& segment = gsl::at(element_id.segment_ids(), d);
+    if (segment != gsl::at(parent_id.segment_ids(), d)) {
+      coords.get(d) =
+          0.5 * (coords.get(d) + (segment.index() % 2 == 0 ? -1.0 : 1.0));
+    }
+  }
+  Variables<tmpl::list<Var>> result(mesh.number_of_grid_points(), 1.0);
+  for (size_t d = 0; d < Dim; ++d) {
+    get(get<Var>(result)) *=
+        (d + 1.0) * cube(coords.get(d)) - coords.get(d) + 0.5;
+  }
+  return result;
+}
+
+template <size_t Dim>
+void test_projectors() noexcept {
+  CAPTURE(Dim);
+  const Mesh<Dim> parent_mesh(4, Spectral::Basis::Legendre,
+                              Spectral::Quadrature::GaussLobatto);
+  const ElementId<Dim> parent_id{0};
+  const auto parent_vars = polynomial(parent_mesh, parent_id, parent_id);
+
+  // p-refinement: increasing the resolution is exact, and decreasing it
+  // afterwards recovers the original data.
+  const auto increase_flags = make_array<Dim>(amr::Flag::IncreaseResolution);
+  const auto increased_mesh = amr::new_mesh(parent_mesh, increase_flags);
+  CHECK(increased_mesh ==
+        Mesh<Dim>(5, Spectral::Basis::Legendre,
+                  Spectral::Quadrature::GaussLobatto));
+  const auto increased_vars = amr::project(parent_vars, parent_mesh, parent_id,
+                                           increased_mesh, parent_id);
+  CHECK_VARIABLES_APPROX(increased_vars,
+                         polynomial(increased_mesh, parent_id, parent_id));
+  CHECK(amr::new_mesh(increased_mesh,
+                      make_array<Dim>(amr::Flag::DecreaseResolution)) ==
+        parent_mesh);
+  CHECK_VARIABLES_APPROX(amr::project(increased_vars, increased_mesh,
+                                      parent_id, parent_mesh, parent_id),
+                         parent_vars);
+
+  // h-refinement: splitting is exact, and joining the children afterwards
+  // recovers the original data.
+  const auto split_flags = make_array<Dim>(amr::Flag::Split);
+  CHECK(amr::new_mesh(parent_mesh, split_flags) == parent_mesh);
+  std::unordered_map<ElementId<Dim>,
+                     std::pair<Mesh<Dim>, Variables<tmpl::list<Var>>>>
+      children_data{};
+  for (const auto& child_id : amr::ids_of_children(parent_id, split_flags)) {
+    CAPTURE(child_id);
+    CHECK(amr::id_of_parent(child_id, make_array<Dim>(amr::Flag::Join)) ==
+          parent_id);
+    auto child_vars = amr::project(parent_vars, parent_mesh, parent_id,
+                                   parent_mesh, child_id);
+    CHECK_VARIABLES_APPROX(child_vars,
+                           polynomial(parent_mesh, child_id, parent_id));
+    children_data.emplace(child_id,
+                          std::make_pair(parent_mesh, std::move(child_vars)));
+  }
+  CHECK(children_data.size() == two_to_the(Dim));
+  CHECK_VARIABLES_APPROX(
+      amr::project_from_children(parent_mesh, parent_id, children_data),
+      parent_vars);
+
+  // Combined h- and p-refinement: the polynomial is resolved on all meshes,
+  // so splitting and joining are exact also when the number of grid points
+  // changes at the same time.
+  for (const auto& [coarse_extents, fine_extents] :
+       {std::make_pair(6_st, 4_st), std::make_pair(5_st, 4_st),
+        std::make_pair(4_st, 6_st)}) {
+    CAPTURE(coarse_extents);
+    CAPTURE(fine_extents);
+    const Mesh<Dim> coarse_mesh(coarse_extents, Spectral::Basis::Legendre,
+                                Spectral::Quadrature::GaussLobatto);
+    const Mesh<Dim> fine_mesh(fine_extents, Spectral::Basis::Legendre,
+                              Spectral::Quadrature::GaussLobatto);
+    const auto coarse_vars = polynomial(coarse_mesh, parent_id, parent_id);
+    children_data.clear();
+    for (const auto& child_id :
+         amr::ids_of_children(parent_id, split_flags)) {
+      CAPTURE(child_id);
+      auto child_vars = amr::project(coarse_vars, coarse_mesh, parent_id,
+                                     fine_mesh, child_id);
+      CHECK_VARIABLES_APPROX(child_vars,
+                             polynomial(fine_mesh, child_id, parent_id));
+      children_data.emplace(child_id,
+                            std::make_pair(fine_mesh, std::move(child_vars)));
+    }
+    CHECK_VARIABLES_APPROX(
+        amr::project_from_children(coarse_mesh, parent_id, children_data),
+        coarse_vars);
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Domain.Amr.Projectors", "[Domain][Unit]") {
+  test_projectors<1>();
+  test_projectors<2>();
+  test_projectors<3>();
+}
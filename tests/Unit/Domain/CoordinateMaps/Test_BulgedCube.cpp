@@ -47,6 +47,12 @@ void test_bulged_cube_fail() {
     CHECK_ITERABLE_APPROX(map(map.inverse(test_mapped_point5).get()),
                           test_mapped_point5);
   }
+
+  test_batch_inverse_map(
+      map, std::array<DataVector, 3>{{DataVector{3.0, 2.0, 4.0, 2.0, 3.0, 1.0},
+                                      DataVector{3.0, 2.0, 0.0, 2.0, 0.0, 0.5},
+                                      DataVector{3.0, 2.01, 0.0, 2.0, 0.0,
+                                                 -0.2}}});
 }
 
 void test_bulged_cube(bool with_equiangular_map) {
@@ -97,6 +103,9 @@ void test_bulged_cube(bool with_equiangular_map) {
   test_inverse_map(map, test_point2);
   test_inverse_map(map, test_point3);
   test_inverse_map(map, test_point4);
+
+  test_batch_inverse_map(map, map(test_points));
+  test_batch_inverse_map(map, map(test_points2));
 }
 }  // namespace
 
@@ -31,7 +31,9 @@
 #include "Domain/CoordinateMaps/TimeDependent/CubicScale.hpp"
 #include "Domain/CoordinateMaps/TimeDependent/ProductMaps.hpp"
 #include "Domain/CoordinateMaps/TimeDependent/ProductMaps.tpp"
+#include "Domain/CoordinateMaps/TimeDependent/Rotation.hpp"
 #include "Domain/CoordinateMaps/TimeDependent/Translation.hpp"
+#include "Domain/CoordinateMaps/TimeDependentHelpers.hpp"
 #include "Domain/CoordinateMaps/Wedge2D.hpp"
 #include "Domain/CoordinateMaps/Wedge3D.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
@@ -1132,6 +1134,18 @@ void test_time_dependent_map() {
       *(time_dependent_map_second.inverse(tnsr_double_inertial_2, final_time,
                                           functions_of_time)),
       tnsr_double_logical);
+  {
+    const auto [logical_first, is_valid_first] =
+        time_dependent_map_first.inverse(tnsr_datavector_inertial_1,
+                                         final_time, functions_of_time);
+    CHECK(is_valid_first == std::vector<bool>(3, true));
+    CHECK_ITERABLE_APPROX(logical_first, tnsr_datavector_logical);
+    const auto [logical_second, is_valid_second] =
+        time_dependent_map_second.inverse(tnsr_datavector_inertial_2,
+                                          final_time, functions_of_time);
+    CHECK(is_valid_second == std::vector<bool>(3, true));
+    CHECK_ITERABLE_APPROX(logical_second, tnsr_datavector_logical);
+  }
 
   CHECK(time_dependent_map_first
             .jacobian(tnsr_double_logical, final_time, functions_of_time)
@@ -1225,6 +1239,35 @@ void test_time_dependent_map() {
               DataVector{tnsr_datavector_logical.get(0).size(),
                          1.5 * velocity[velocity.size() - 1]}});
   }
+  {
+    // The Jacobians of both maps are spatially uniform, so this evaluates them
+    // once and applies them to all points.
+    static_assert(domain::is_jacobian_spatially_uniform_v<
+                      CoordinateMaps::TimeDependent::Translation> and
+                      domain::is_jacobian_spatially_uniform_v<
+                          domain::CoordinateMaps::Affine>,
+                  "Expected the Translation and Affine maps to have spatially "
+                  "uniform Jacobians.");
+    const auto coords_jacs_velocity =
+        time_dependent_map_second.coords_frame_velocity_jacobians(
+            tnsr_datavector_logical, final_time, functions_of_time);
+    CHECK(std::get<0>(coords_jacs_velocity) ==
+          time_dependent_map_second(tnsr_datavector_logical, final_time,
+                                    functions_of_time));
+    CHECK(std::get<1>(coords_jacs_velocity) ==
+          time_dependent_map_second.inv_jacobian(
+              tnsr_datavector_logical, final_time, functions_of_time));
+    CHECK(std::get<2>(coords_jacs_velocity) ==
+          time_dependent_map_second.jacobian(tnsr_datavector_logical,
+                                             final_time, functions_of_time));
+    const auto velocity =
+        functions_of_time.at("Translation")->func_and_deriv(final_time)[1];
+    // The translation is applied last, so its velocity is not rescaled
+    CHECK(std::get<3>(coords_jacs_velocity) ==
+          tnsr::I<DataVector, 1, Frame::Inertial>{
+              DataVector{tnsr_datavector_logical.get(0).size(),
+                         velocity[velocity.size() - 1]}});
+  }
 }
 
 void test_push_back() {
@@ -1459,6 +1502,181 @@ void test_coords_frame_velocity_jacobians() noexcept {
               functions_of_time)) == expected_velocity);
   }
 }
+
+// Maps with spatially uniform Jacobians are evaluated at a single point. Check
+// the Jacobians of map chains that mix them with a map whose Jacobian varies in
+// space against the pointwise products of the Jacobians of the maps.
+void test_spatially_uniform_jacobians() noexcept {
+  INFO("Spatially uniform Jacobians");
+  using Affine3D =
+      CoordinateMaps::ProductOf3Maps<CoordinateMaps::Affine,
+                                     CoordinateMaps::Affine,
+                                     CoordinateMaps::Affine>;
+  static_assert(domain::is_jacobian_spatially_uniform_v<Affine3D>,
+                "Expected the product of Affine maps to have a spatially "
+                "uniform Jacobian.");
+  static_assert(
+      not domain::is_jacobian_spatially_uniform_v<CoordinateMaps::Wedge3D>,
+      "Expected the Wedge3D map to have a spatially varying Jacobian.");
+  const Affine3D affine{CoordinateMaps::Affine{-1.0, 1.0, -0.8, 0.9},
+                        CoordinateMaps::Affine{-1.0, 1.0, -0.7, 0.6},
+                        CoordinateMaps::Affine{-1.0, 1.0, -0.9, 0.8}};
+  const CoordinateMaps::Wedge3D wedge{0.2, 4.0, OrientationMap<3>{},
+                                      0.0, 1.0, true};
+  const std::array<DataVector, 3> source_points{
+      {DataVector{-1.0, -0.3, 0.0, 0.4, 1.0},
+       DataVector{0.5, -0.7, 0.0, 0.9, 1.0},
+       DataVector{0.2, 0.9, 0.0, -0.6, -1.0}}};
+  const tnsr::I<DataVector, 3, Frame::Logical> source_tensor{source_points};
+
+  const auto check = [&source_points, &source_tensor](
+                         const auto& map1, const auto& map2) noexcept {
+    const auto map =
+        make_coordinate_map<Frame::Logical, Frame::Grid>(map1, map2);
+    const auto expected_jac = compose_jacobians(map1, map2, source_points);
+    const auto expected_inv_jac =
+        compose_inv_jacobians(map1, map2, source_points);
+    CHECK_ITERABLE_APPROX(map.jacobian(source_tensor), expected_jac);
+    CHECK_ITERABLE_APPROX(map.inv_jacobian(source_tensor), expected_inv_jac);
+    const auto coords_jacs_velocity = map.coords_frame_velocity_jacobians(
+        source_tensor, 0.0,
+        std::unordered_map<
+            std::string,
+            std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>{});
+    CHECK_ITERABLE_APPROX(std::get<1>(coords_jacs_velocity),
+                          expected_inv_jac);
+    CHECK_ITERABLE_APPROX(std::get<2>(coords_jacs_velocity), expected_jac);
+
+    // The Jacobians of no points are empty
+    const tnsr::I<DataVector, 3, Frame::Logical> no_points{};
+    CHECK(get<0, 0>(map.jacobian(no_points)).size() == 0);
+    CHECK(get<0, 0>(map.inv_jacobian(no_points)).size() == 0);
+  };
+  check(affine, wedge);
+  check(wedge, affine);
+}
+
+// The first map of a chain is also evaluated at a single point if its Jacobian
+// is spatially uniform. Check the single-map chains that the
+// UniformTranslation and UniformRotationAboutZAxis time dependences create
+// against the pointwise Jacobians of the maps.
+void test_single_spatially_uniform_map() noexcept {
+  INFO("Single map with a spatially uniform Jacobian");
+  using Translation = CoordinateMaps::TimeDependent::Translation;
+  using Translation3D =
+      CoordinateMaps::TimeDependent::ProductOf3Maps<Translation, Translation,
+                                                    Translation>;
+  using RotationAboutZAxis = CoordinateMaps::TimeDependent::ProductOf2Maps<
+      CoordinateMaps::TimeDependent::Rotation<2>, CoordinateMaps::Identity<1>>;
+  static_assert(domain::is_jacobian_spatially_uniform_v<Translation3D> and
+                    domain::is_jacobian_spatially_uniform_v<RotationAboutZAxis>,
+                "Expected the translation and the rotation about the z-axis "
+                "to have spatially uniform Jacobians.");
+
+  const double time = 1.3;
+  using Polynomial = domain::FunctionsOfTime::PiecewisePolynomial<2>;
+  std::unordered_map<std::string,
+                     std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>
+      functions_of_time{};
+  for (const std::string& name :
+       {std::string{"TranslationX"}, std::string{"TranslationY"},
+        std::string{"TranslationZ"}, std::string{"Rotation"}}) {
+    functions_of_time[name] = std::make_unique<Polynomial>(
+        0.0, std::array<DataVector, 3>{{{0.1}, {0.7}, {-0.4}}}, 10.0);
+  }
+  const Translation3D translation{Translation{"TranslationX"},
+                                  Translation{"TranslationY"},
+                                  Translation{"TranslationZ"}};
+  const RotationAboutZAxis rotation{
+      CoordinateMaps::TimeDependent::Rotation<2>{"Rotation"},
+      CoordinateMaps::Identity<1>{}};
+
+  const std::array<DataVector, 3> source_points{
+      {DataVector{-1.0, -0.3, 0.0, 0.4, 1.0},
+       DataVector{0.5, -0.7, 0.0, 0.9, 1.0},
+       DataVector{0.2, 0.9, 0.0, -0.6, -1.0}}};
+  const tnsr::I<DataVector, 3, Frame::Grid> source_tensor{source_points};
+
+  const auto check = [&functions_of_time, &source_points, &source_tensor,
+                      &time](const auto& the_map) noexcept {
+    const auto map =
+        make_coordinate_map<Frame::Grid, Frame::Inertial>(the_map);
+    const auto expected_jac =
+        the_map.jacobian(source_points, time, functions_of_time);
+    const auto expected_inv_jac =
+        the_map.inv_jacobian(source_points, time, functions_of_time);
+    const auto expected_frame_velocity =
+        the_map.frame_velocity(source_points, time, functions_of_time);
+    const auto jac = map.jacobian(source_tensor, time, functions_of_time);
+    const auto inv_jac =
+        map.inv_jacobian(source_tensor, time, functions_of_time);
+    const auto coords_jacs_velocity = map.coords_frame_velocity_jacobians(
+        source_tensor, time, functions_of_time);
+    for (size_t i = 0; i < 3; ++i) {
+      CHECK_ITERABLE_APPROX(std::get<3>(coords_jacs_velocity).get(i),
+                            gsl::at(expected_frame_velocity, i));
+      for (size_t j = 0; j < 3; ++j) {
+        CHECK_ITERABLE_APPROX(jac.get(i, j), expected_jac.get(i, j));
+        CHECK_ITERABLE_APPROX(inv_jac.get(i, j), expected_inv_jac.get(i, j));
+        CHECK_ITERABLE_APPROX(std::get<1>(coords_jacs_velocity).get(i, j),
+                              expected_inv_jac.get(i, j));
+        CHECK_ITERABLE_APPROX(std::get<2>(coords_jacs_velocity).get(i, j),
+                              expected_jac.get(i, j));
+      }
+    }
+
+    // A single point and no points
+    const tnsr::I<double, 3, Frame::Grid> single_point{{{0.4, 0.9, -0.6}}};
+    const auto single_jac =
+        map.jacobian(single_point, time, functions_of_time);
+    for (size_t i = 0; i < 3; ++i) {
+      for (size_t j = 0; j < 3; ++j) {
+        CHECK(single_jac.get(i, j) == approx(expected_jac.get(i, j)[3]));
+      }
+    }
+    const tnsr::I<DataVector, 3, Frame::Grid> no_points{};
+    CHECK(get<0, 0>(map.jacobian(no_points, time, functions_of_time))
+              .size() == 0);
+    CHECK(get<0, 0>(map.inv_jacobian(no_points, time, functions_of_time))
+              .size() == 0);
+  };
+  check(translation);
+  check(rotation);
+}
+
+void test_batch_inverse() noexcept {
+  INFO("Batch inverse");
+  const auto map = make_coordinate_map_base<Frame::Logical, Frame::Inertial>(
+      CoordinateMaps::BulgedCube{0.5 * sqrt(3.0), 0.3, true},
+      CoordinateMaps::SpecialMobius{0.2});
+  const tnsr::I<DataVector, 3, Frame::Logical> logical_points{
+      {{DataVector{-1.0, 0.3, 0.0, 1.0}, DataVector{0.5, -0.7, 0.0, 1.0},
+        DataVector{0.2, 0.9, 0.0, -1.0}}}};
+  const auto mapped_points = (*map)(logical_points);
+  // The last point is outside the unit sphere, where the SpecialMobius map
+  // is not invertible
+  tnsr::I<DataVector, 3, Frame::Inertial> inertial_points(5_st, 0.9);
+  for (size_t d = 0; d < 3; ++d) {
+    for (size_t s = 0; s < 4; ++s) {
+      inertial_points.get(d)[s] = mapped_points.get(d)[s];
+    }
+  }
+
+  const auto [source_points, is_valid] = map->inverse(inertial_points);
+  CHECK(is_valid == std::vector<bool>{true, true, true, true, false});
+  for (size_t s = 0; s < 5; ++s) {
+    tnsr::I<double, 3, Frame::Inertial> inertial_point{};
+    for (size_t d = 0; d < 3; ++d) {
+      inertial_point.get(d) = inertial_points.get(d)[s];
+    }
+    const auto expected_source_point = map->inverse(inertial_point);
+    REQUIRE(is_valid[s] == static_cast<bool>(expected_source_point));
+    for (size_t d = 0; d < 3 and is_valid[s]; ++d) {
+      CHECK(source_points.get(d)[s] == approx(logical_points.get(d)[s]));
+      CHECK(source_points.get(d)[s] == approx(expected_source_point->get(d)));
+    }
+  }
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Domain.CoordinateMap", "[Domain][Unit]") {
@@ -1473,5 +1691,8 @@ SPECTRE_TEST_CASE("Unit.Domain.CoordinateMap", "[Domain][Unit]") {
   test_push_back();
   test_jacobian_is_time_dependent();
   test_coords_frame_velocity_jacobians();
+  test_spatially_uniform_jacobians();
+  test_single_spatially_uniform_map();
+  test_batch_inverse();
 }
 }  // namespace domain
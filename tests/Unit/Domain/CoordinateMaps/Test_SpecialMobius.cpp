@@ -10,6 +10,7 @@
 #include <pup.h>
 #include <random>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/CoordinateMaps/SpecialMobius.hpp"
 #include "ErrorHandling/Error.hpp"
@@ -87,6 +88,12 @@ void test_map() {
   // Since |mu|<1, this point also has x outside [-1,1].
   const std::array<double, 3> bad_point{{-1.0 / mu, 0.0, 0.0}};
   CHECK_FALSE(static_cast<bool>(special_mobius_map.inverse(bad_point)));
+
+  test_batch_inverse_map(
+      special_mobius_map,
+      std::array<DataVector, 3>{{DataVector{-1.0 / mu, 1.0, 0.3, 0.0, 0.8},
+                                 DataVector{0.0, 0.0, -0.2, 0.0, 0.6},
+                                 DataVector{0.0, 0.0, 0.5, 0.0, 0.6}}});
 }
 
 void test_large_mu() {
@@ -65,6 +65,21 @@ struct TimeIndepJac {
   tnsr::Ij<tt::remove_cvref_wrap_t<T>, Dim, Frame::NoFrame> jacobian(
       const std::array<T, Dim>& source_coords) const noexcept;
 };
+
+struct UniformJac {
+  static constexpr bool jacobian_is_spatially_uniform = true;
+};
+struct NonUniformJac {
+  static constexpr bool jacobian_is_spatially_uniform = false;
+};
+struct SeparableJac {
+  static constexpr size_t dim = 2;
+  static constexpr bool jacobian_is_separable = true;
+};
+struct NonSeparableJac {
+  static constexpr size_t dim = 1;
+  static constexpr bool jacobian_is_separable = false;
+};
 }  // namespace
 
 namespace domain {
@@ -146,4 +161,24 @@ static_assert(not is_jacobian_time_dependent_v<TimeIndepJac<3>, DataVector>,
               "Failed testing is_jacobian_time_dependent_t");
 static_assert(not is_jacobian_time_dependent_v<TimeIndepJac<3>, double>,
               "Failed testing is_jacobian_time_dependent_t");
+
+static_assert(is_jacobian_spatially_uniform_v<UniformJac>,
+              "Failed testing is_jacobian_spatially_uniform_v");
+static_assert(is_jacobian_spatially_uniform_v<const UniformJac&>,
+              "Failed testing is_jacobian_spatially_uniform_v");
+static_assert(not is_jacobian_spatially_uniform_v<NonUniformJac>,
+              "Failed testing is_jacobian_spatially_uniform_v");
+static_assert(not is_jacobian_spatially_uniform_v<TimeIndepJac<1>>,
+              "Failed testing is_jacobian_spatially_uniform_v");
+
+static_assert(is_jacobian_separable_v<SeparableJac>,
+              "Failed testing is_jacobian_separable_v");
+static_assert(is_jacobian_separable_v<const SeparableJac&>,
+              "Failed testing is_jacobian_separable_v");
+static_assert(not is_jacobian_separable_v<NonSeparableJac>,
+              "Failed testing is_jacobian_separable_v");
+static_assert(not is_jacobian_separable_v<TimeIndepJac<1>>,
+              "Failed testing is_jacobian_separable_v");
+static_assert(not is_jacobian_separable_v<TimeIndepJac<2>>,
+              "Failed testing is_jacobian_separable_v");
 }  // namespace domain
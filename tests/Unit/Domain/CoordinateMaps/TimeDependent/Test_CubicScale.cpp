@@ -103,6 +103,10 @@ void test_boundaries() {
           static_cast<bool>(scale_map.inverse(mapped_point, t, f_of_t_list)));
       CHECK_ITERABLE_APPROX(
           scale_map.inverse(mapped_point, t, f_of_t_list).get(), point_xi);
+      test_batch_inverse_map(
+          scale_map,
+          std::array<DataVector, 1>{{{mapped_point[0], -mapped_point[0]}}}, t,
+          f_of_t_list);
       t += dt;
     }
   };
@@ -214,6 +218,16 @@ void test(const bool linear_expansion) {
         }
       }
 
+      // Check the batched inverse at the mapped point, half-way to the
+      // origin, at the origin and outside the outer boundary
+      auto target_points = make_array<Dim>(DataVector(4, 0.0));
+      for (size_t i = 0; i < Dim; ++i) {
+        gsl::at(target_points, i)[0] = gsl::at(mapped_point, i);
+        gsl::at(target_points, i)[1] = 0.5 * gsl::at(mapped_point, i);
+        gsl::at(target_points, i)[3] = 1.1 * outer_boundary;
+      }
+      test_batch_inverse_map(scale_map, target_points, t, f_of_t_list);
+
       test_jacobian(scale_map, point_xi, t, f_of_t_list);
       test_inv_jacobian(scale_map, point_xi, t, f_of_t_list);
       test_frame_velocity(scale_map, point_xi, t, f_of_t_list);
@@ -0,0 +1,182 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <optional>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/EagerMath/Determinant.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/CoordinateMaps/Affine.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.tpp"
+#include "Domain/CoordinateMaps/Equiangular.hpp"
+#include "Domain/CoordinateMaps/Identity.hpp"
+#include "Domain/CoordinateMaps/ProductMaps.hpp"
+#include "Domain/CoordinateMaps/ProductMaps.tpp"
+#include "Domain/CoordinateMaps/Wedge3D.hpp"
+#include "Domain/ElementMap.hpp"
+#include "Domain/LogicalCoordinates.hpp"
+#include "Domain/SeparableInverseJacobian.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/OrientationMap.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace domain {
+namespace {
+using Affine = CoordinateMaps::Affine;
+using Equiangular = CoordinateMaps::Equiangular;
+
+template <size_t Dim>
+void test_separable_map(const ElementMap<Dim, Frame::Inertial>& element_map,
+                        const Mesh<Dim>& mesh) {
+  CHECK(element_map.is_separable());
+  const SeparableInverseJacobian<Dim, Frame::Inertial> separable_inv_jac{
+      element_map, mesh};
+  CHECK(separable_inv_jac.extents() == mesh.extents());
+  for (size_t d = 0; d < Dim; ++d) {
+    CHECK(separable_inv_jac.factor(d).size() == mesh.extents(d));
+  }
+
+  const auto expected_inv_jac =
+      element_map.inv_jacobian(logical_coordinates(mesh));
+  CHECK_ITERABLE_APPROX(separable_inv_jac.inverse_jacobian(),
+                        expected_inv_jac);
+  CHECK_ITERABLE_APPROX(separable_inv_jac.determinant(),
+                        determinant(expected_inv_jac));
+
+  test_serialization(separable_inv_jac);
+  CHECK_FALSE(separable_inv_jac !=
+              serialize_and_deserialize(separable_inv_jac));
+
+  std::optional<SeparableInverseJacobian<Dim, Frame::Inertial>> computed{};
+  using compute_tag = Tags::SeparableInverseJacobianCompute<
+      Tags::ElementMap<Dim, Frame::Inertial>>;
+  compute_tag::function(make_not_null(&computed), element_map, mesh);
+  REQUIRE(computed.has_value());
+  CHECK(*computed == separable_inv_jac);
+}
+
+void test_1d() {
+  const ElementId<1> element_id{0, {{SegmentId{2, 1}}}};
+  const Mesh<1> mesh{5, Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto};
+  test_separable_map(
+      ElementMap<1, Frame::Inertial>{
+          element_id, make_coordinate_map_base<Frame::Logical, Frame::Inertial>(
+                          Affine{-1.0, 1.0, 2.0, 5.0})},
+      mesh);
+}
+
+void test_2d() {
+  const ElementId<2> element_id{0, {{SegmentId{2, 3}, SegmentId{1, 0}}}};
+  const Mesh<2> mesh{{{4, 6}},
+                     Spectral::Basis::Legendre,
+                     Spectral::Quadrature::Gauss};
+  test_separable_map(
+      ElementMap<2, Frame::Inertial>{
+          element_id,
+          make_coordinate_map_base<Frame::Logical, Frame::Inertial>(
+              CoordinateMaps::ProductOf2Maps<Affine, Equiangular>{
+                  Affine{-1.0, 1.0, -0.3, 0.7},
+                  Equiangular{-1.0, 1.0, 0.3, 0.55}})},
+      mesh);
+}
+
+void test_3d() {
+  const ElementId<3> element_id{
+      0, {{SegmentId{2, 3}, SegmentId{1, 0}, SegmentId{0, 0}}}};
+  const Mesh<3> mesh{{{3, 4, 5}},
+                     Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto};
+  // A composition of separable maps is separable
+  test_separable_map(
+      ElementMap<3, Frame::Inertial>{
+          element_id,
+          make_coordinate_map_base<Frame::Logical, Frame::Inertial>(
+              CoordinateMaps::ProductOf3Maps<Equiangular, Affine, Equiangular>{
+                  Equiangular{-1.0, 1.0, -0.3, 0.7},
+                  Affine{-1.0, 1.0, 0.3, 0.55},
+                  Equiangular{-1.0, 1.0, 2.3, 2.8}},
+              CoordinateMaps::ProductOf3Maps<Affine, Affine, Affine>{
+                  Affine{-0.3, 0.7, 0.0, 1.0}, Affine{0.3, 0.55, -1.0, 2.0},
+                  Affine{2.3, 2.8, 2.3, 3.8}})},
+      mesh);
+
+  // A spherical shell is not separable
+  const ElementMap<3, Frame::Inertial> wedge_map{
+      element_id, make_coordinate_map_base<Frame::Logical, Frame::Inertial>(
+                      CoordinateMaps::Wedge3D{2.0, 4.0, OrientationMap<3>{},
+                                              1.0, 1.0, true})};
+  CHECK_FALSE(wedge_map.is_separable());
+  std::optional<SeparableInverseJacobian<3, Frame::Inertial>> computed{};
+  using compute_tag = Tags::SeparableInverseJacobianCompute<
+      Tags::ElementMap<3, Frame::Inertial>>;
+  compute_tag::function(make_not_null(&computed), wedge_map, mesh);
+  CHECK_FALSE(computed.has_value());
+}
+
+void test_element_to_inertial() {
+  const ElementId<2> element_id{0, {{SegmentId{2, 3}, SegmentId{1, 0}}}};
+  const Mesh<2> mesh{{{4, 6}},
+                     Spectral::Basis::Legendre,
+                     Spectral::Quadrature::Gauss};
+  const ElementMap<2, Frame::Grid> element_map{
+      element_id, make_coordinate_map_base<Frame::Logical, Frame::Grid>(
+                      CoordinateMaps::ProductOf2Maps<Affine, Equiangular>{
+                          Affine{-1.0, 1.0, -0.3, 0.7},
+                          Equiangular{-1.0, 1.0, 0.3, 0.55}})};
+  const std::optional<SeparableInverseJacobian<2, Frame::Grid>>
+      logical_to_grid{std::in_place, element_map, mesh};
+  using compute_tag = Tags::ElementToInertialSeparableInverseJacobian<2>;
+
+  // A static mesh reuses the logical to grid factors
+  std::optional<SeparableInverseJacobian<2, Frame::Inertial>> computed{};
+  compute_tag::function(
+      make_not_null(&computed), logical_to_grid,
+      *make_coordinate_map_base<Frame::Grid, Frame::Inertial>(
+          CoordinateMaps::Identity<2>{}));
+  REQUIRE(computed.has_value());
+  CHECK(computed->extents() == mesh.extents());
+  CHECK_ITERABLE_APPROX(
+      computed->inverse_jacobian(),
+      element_map.inv_jacobian(logical_coordinates(mesh)));
+  CHECK(*computed ==
+        SeparableInverseJacobian<2, Frame::Inertial>{
+            mesh.extents(), {{logical_to_grid->factor(0),
+                              logical_to_grid->factor(1)}}});
+
+  // A grid to inertial map that is not the identity disables the compressed
+  // form, as does an element that is not separable
+  compute_tag::function(
+      make_not_null(&computed), logical_to_grid,
+      *make_coordinate_map_base<Frame::Grid, Frame::Inertial>(
+          CoordinateMaps::ProductOf2Maps<Affine, Affine>{
+              Affine{-1.0, 1.0, -2.0, 2.0}, Affine{-1.0, 1.0, -1.0, 1.0}}));
+  CHECK_FALSE(computed.has_value());
+  computed = SeparableInverseJacobian<2, Frame::Inertial>{
+      mesh.extents(), {{logical_to_grid->factor(0),
+                        logical_to_grid->factor(1)}}};
+  compute_tag::function(
+      make_not_null(&computed), std::nullopt,
+      *make_coordinate_map_base<Frame::Grid, Frame::Inertial>(
+          CoordinateMaps::Identity<2>{}));
+  CHECK_FALSE(computed.has_value());
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Domain.SeparableInverseJacobian", "[Unit][Domain]") {
+  test_1d();
+  test_2d();
+  test_3d();
+  test_element_to_inertial();
+}
+}  // namespace domain
@@ -0,0 +1,13 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include "Evolution/DgSubcell/ActiveGrid.hpp"
+#include "Utilities/GetOutput.hpp"
+
+SPECTRE_TEST_CASE("Unit.Evolution.Subcell.ActiveGrid",
+                  "[Evolution][Unit]") {
+  CHECK(get_output(evolution::dg::subcell::ActiveGrid::Dg) == "Dg");
+  CHECK(get_output(evolution::dg::subcell::ActiveGrid::Subcell) == "Subcell");
+}
@@ -0,0 +1,31 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+
+#include "Evolution/DgSubcell/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+
+SPECTRE_TEST_CASE("Unit.Evolution.Subcell.Mesh", "[Evolution][Unit]") {
+  using evolution::dg::subcell::fd::mesh;
+  CHECK(mesh(Mesh<1>{4, Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto}) ==
+        Mesh<1>{7, Spectral::Basis::FiniteDifference,
+                Spectral::Quadrature::CellCentered});
+  CHECK(mesh(Mesh<2>{{{3, 5}},
+                     Spectral::Basis::Legendre,
+                     Spectral::Quadrature::Gauss}) ==
+        Mesh<2>{{{5, 9}},
+                Spectral::Basis::FiniteDifference,
+                Spectral::Quadrature::CellCentered});
+  CHECK(mesh(Mesh<3>{{{2, 3, 4}},
+                     Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto}) ==
+        Mesh<3>{{{3, 5, 7}},
+                Spectral::Basis::FiniteDifference,
+                Spectral::Quadrature::CellCentered});
+}
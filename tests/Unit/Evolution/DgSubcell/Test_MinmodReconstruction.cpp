@@ -0,0 +1,69 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
+#include "Evolution/DgSubcell/MinmodReconstruction.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+void test_1d() noexcept {
+  using evolution::dg::subcell::fd::reconstruction::minmod;
+  const Index<1> extents{4};
+  DataVector lower_side{};
+  DataVector upper_side{};
+
+  // Linear data is reconstructed exactly
+  minmod(make_not_null(&lower_side), make_not_null(&upper_side),
+         DataVector{0.0, 1.0, 2.0, 3.0}, DataVector{-2.0, -1.0},
+         DataVector{4.0, 5.0}, extents, 0);
+  const DataVector expected_linear{-0.5, 0.5, 1.5, 2.5, 3.5};
+  CHECK_ITERABLE_APPROX(lower_side, expected_linear);
+  CHECK_ITERABLE_APPROX(upper_side, expected_linear);
+
+  // A discontinuity is not smeared out and doesn't produce new extrema
+  minmod(make_not_null(&lower_side), make_not_null(&upper_side),
+         DataVector{0.0, 0.0, 1.0, 1.0}, DataVector{0.0, 0.0},
+         DataVector{1.0, 1.0}, extents, 0);
+  CHECK_ITERABLE_APPROX(lower_side, (DataVector{0.0, 0.0, 0.0, 1.0, 1.0}));
+  CHECK_ITERABLE_APPROX(upper_side, (DataVector{0.0, 0.0, 1.0, 1.0, 1.0}));
+
+  // A local extremum is flattened
+  minmod(make_not_null(&lower_side), make_not_null(&upper_side),
+         DataVector{0.0, 2.0, 1.0, 1.0}, DataVector{0.0, 0.0},
+         DataVector{1.0, 1.0}, extents, 0);
+  CHECK_ITERABLE_APPROX(lower_side, (DataVector{0.0, 0.0, 2.0, 1.0, 1.0}));
+  CHECK_ITERABLE_APPROX(upper_side, (DataVector{0.0, 2.0, 1.0, 1.0, 1.0}));
+}
+
+void test_2d() noexcept {
+  using evolution::dg::subcell::fd::reconstruction::minmod;
+  // Two components of linear data u = i + 10 j and 2 u, reconstructed in the
+  // second dimension
+  const Index<2> extents{2, 3};
+  const DataVector volume_vars{0.0,  1.0,  10.0, 11.0, 20.0, 21.0,
+                               0.0,  2.0,  20.0, 22.0, 40.0, 42.0};
+  const DataVector lower_ghost_vars{-20.0, -19.0, -10.0, -9.0,
+                                    -40.0, -38.0, -20.0, -18.0};
+  const DataVector upper_ghost_vars{30.0, 31.0, 40.0, 41.0,
+                                    60.0, 62.0, 80.0, 82.0};
+  DataVector lower_side{};
+  DataVector upper_side{};
+  minmod(make_not_null(&lower_side), make_not_null(&upper_side), volume_vars,
+         lower_ghost_vars, upper_ghost_vars, extents, 1);
+  const DataVector expected{-5.0, -4.0, 5.0,  6.0,  15.0, 16.0, 25.0, 26.0,
+                            -10.0, -8.0, 10.0, 12.0, 30.0, 32.0, 50.0, 52.0};
+  CHECK_ITERABLE_APPROX(lower_side, expected);
+  CHECK_ITERABLE_APPROX(upper_side, expected);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Evolution.Subcell.MinmodReconstruction",
+                  "[Evolution][Unit]") {
+  test_1d();
+  test_2d();
+}
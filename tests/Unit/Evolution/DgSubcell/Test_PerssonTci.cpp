@@ -0,0 +1,61 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/LogicalCoordinates.hpp"
+#include "Evolution/DgSubcell/PerssonTci.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+
+namespace {
+template <size_t Dim>
+void test_persson_tci(const Spectral::Quadrature quadrature) noexcept {
+  CAPTURE(Dim);
+  CAPTURE(quadrature);
+  using evolution::dg::subcell::persson_tci;
+  const Mesh<Dim> dg_mesh{5, Spectral::Basis::Legendre, quadrature};
+  const auto logical_coords = logical_coordinates(dg_mesh);
+  const DataVector& x = get<0>(logical_coords);
+  const double alpha = 4.0;
+
+  // A polynomial of lower degree than the mesh has no highest modes
+  DataVector smooth_u = 1.0 + x + 0.1 * square(x);
+  for (size_t d = 1; d < Dim; ++d) {
+    smooth_u += 0.3 * logical_coords.get(d);
+  }
+  CHECK_FALSE(persson_tci(smooth_u, dg_mesh, alpha, 1));
+
+  // A discontinuity puts substantial power into the highest modes
+  DataVector step_u(x.size(), 0.0);
+  for (size_t i = 0; i < x.size(); ++i) {
+    if (x[i] > 0.3) {
+      step_u[i] = 1.0;
+    }
+  }
+  CHECK(persson_tci(step_u, dg_mesh, alpha, 1));
+  // ...unless the threshold is very permissive
+  CHECK_FALSE(persson_tci(step_u, dg_mesh, 0.5, 1));
+
+  // A cubic only has power in the second-highest mode
+  const DataVector cubic_u = 1.0 + x * x * x;
+  CHECK_FALSE(persson_tci(cubic_u, dg_mesh, alpha, 1));
+  CHECK(persson_tci(cubic_u, dg_mesh, alpha, 2));
+
+  // A vanishing solution is never troubled
+  CHECK_FALSE(persson_tci(DataVector(x.size(), 0.0), dg_mesh, alpha, 1));
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Evolution.Subcell.PerssonTci", "[Evolution][Unit]") {
+  for (const auto quadrature :
+       {Spectral::Quadrature::Gauss, Spectral::Quadrature::GaussLobatto}) {
+    test_persson_tci<1>(quadrature);
+    test_persson_tci<2>(quadrature);
+    test_persson_tci<3>(quadrature);
+  }
+}
@@ -0,0 +1,159 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <random>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/LogicalCoordinates.hpp"
+#include "ErrorHandling/Error.hpp"
+#include "Evolution/DgSubcell/Matrices.hpp"
+#include "Evolution/DgSubcell/Mesh.hpp"
+#include "Evolution/DgSubcell/Projection.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "NumericalAlgorithms/LinearOperators/DefiniteIntegral.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+struct Var1 : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+
+template <size_t Dim>
+struct Var2 : db::SimpleTag {
+  using type = tnsr::I<DataVector, Dim, Frame::Inertial>;
+};
+
+// A polynomial of degree `degree` in each dimension, so it is represented
+// exactly on a DG mesh with `degree + 1` points
+template <size_t Dim>
+DataVector polynomial(const tnsr::I<DataVector, Dim, Frame::Logical>& x,
+                      const size_t degree) noexcept {
+  DataVector result(get<0>(x).size(), 1.0);
+  for (size_t d = 0; d < Dim; ++d) {
+    result *= pow(x.get(d), degree) + 0.5 * x.get(d) + 1.0;
+  }
+  return result;
+}
+
+// The exact average of `polynomial` over the subcells
+template <size_t Dim>
+DataVector polynomial_average(
+    const tnsr::I<DataVector, Dim, Frame::Logical>& cell_centers,
+    const double half_width, const size_t degree) noexcept {
+  DataVector result(get<0>(cell_centers).size(), 1.0);
+  for (size_t d = 0; d < Dim; ++d) {
+    const DataVector& center = cell_centers.get(d);
+    result *= (pow(center + half_width, degree + 1) -
+               pow(center - half_width, degree + 1)) /
+                  (2.0 * half_width * (degree + 1)) +
+              0.5 * center + 1.0;
+  }
+  return result;
+}
+
+template <size_t Dim>
+void test_projection(const gsl::not_null<std::mt19937*> gen,
+                     const size_t num_points,
+                     const Spectral::Quadrature quadrature) noexcept {
+  CAPTURE(Dim);
+  CAPTURE(num_points);
+  CAPTURE(quadrature);
+  namespace fd = evolution::dg::subcell::fd;
+  const Mesh<Dim> dg_mesh{num_points, Spectral::Basis::Legendre, quadrature};
+  const Mesh<Dim> subcell_mesh = fd::mesh(dg_mesh);
+  const double half_width = 1.0 / subcell_mesh.extents(0);
+  const auto dg_coords = logical_coordinates(dg_mesh);
+  const auto subcell_coords = logical_coordinates(subcell_mesh);
+  Approx custom_approx = Approx::custom().epsilon(1.0e-12).scale(1.0);
+
+  // Projecting a polynomial gives its exact subcell averages, and the
+  // reconstruction undoes the projection
+  const DataVector dg_u = polynomial(dg_coords, num_points - 1);
+  const DataVector subcell_u = fd::project(dg_u, dg_mesh);
+  CHECK_ITERABLE_CUSTOM_APPROX(
+      subcell_u, polynomial_average(subcell_coords, half_width, num_points - 1),
+      custom_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(fd::reconstruct(subcell_u, dg_mesh), dg_u,
+                               custom_approx);
+  CHECK(definite_integral(dg_u, dg_mesh) ==
+        custom_approx(pow(2.0 * half_width, Dim) * sum(subcell_u)));
+
+  // The reconstruction of arbitrary subcell data is conservative
+  std::uniform_real_distribution<> dist(-1.0, 1.0);
+  const auto random_subcell_u = make_with_random_values<DataVector>(
+      gen, make_not_null(&dist), subcell_u);
+  DataVector reconstructed_u{};
+  fd::reconstruct(make_not_null(&reconstructed_u), random_subcell_u, dg_mesh);
+  CHECK(definite_integral(reconstructed_u, dg_mesh) ==
+        custom_approx(pow(2.0 * half_width, Dim) * sum(random_subcell_u)));
+
+  // The tensor product matrices are the 1d matrices
+  const auto projection_matrices = fd::projection_matrices(dg_mesh);
+  const auto reconstruction_matrices = fd::reconstruction_matrices(dg_mesh);
+  for (size_t d = 0; d < Dim; ++d) {
+    CHECK(&gsl::at(projection_matrices, d).get() ==
+          &fd::projection_matrix(dg_mesh.slice_through(d)));
+    CHECK(&gsl::at(reconstruction_matrices, d).get() ==
+          &fd::reconstruction_matrix(dg_mesh.slice_through(d)));
+  }
+
+  // Variables are projected component by component
+  using vars_type = Variables<tmpl::list<Var1, Var2<Dim>>>;
+  vars_type dg_vars(dg_mesh.number_of_grid_points());
+  get(get<Var1>(dg_vars)) = dg_u;
+  for (size_t d = 0; d < Dim; ++d) {
+    get<Var2<Dim>>(dg_vars).get(d) = (d + 2.0) * dg_u;
+  }
+  const vars_type subcell_vars = fd::project(dg_vars, dg_mesh);
+  CHECK_ITERABLE_CUSTOM_APPROX(get(get<Var1>(subcell_vars)), subcell_u,
+                               custom_approx);
+  for (size_t d = 0; d < Dim; ++d) {
+    CHECK_ITERABLE_CUSTOM_APPROX(get<Var2<Dim>>(subcell_vars).get(d),
+                                 DataVector((d + 2.0) * subcell_u),
+                                 custom_approx);
+  }
+  vars_type reconstructed_vars{};
+  fd::reconstruct(make_not_null(&reconstructed_vars), subcell_vars, dg_mesh);
+  CHECK_VARIABLES_CUSTOM_APPROX(reconstructed_vars, dg_vars, custom_approx);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Evolution.Subcell.Projection", "[Evolution][Unit]") {
+  MAKE_GENERATOR(gen);
+  for (const auto quadrature :
+       {Spectral::Quadrature::Gauss, Spectral::Quadrature::GaussLobatto}) {
+    for (size_t num_points = 2; num_points <= 6; ++num_points) {
+      test_projection<1>(make_not_null(&gen), num_points, quadrature);
+      test_projection<2>(make_not_null(&gen), num_points, quadrature);
+      test_projection<3>(make_not_null(&gen), num_points, quadrature);
+    }
+  }
+  // The highest supported resolution is still well conditioned
+  test_projection<1>(
+      make_not_null(&gen),
+      Spectral::maximum_number_of_points<Spectral::Basis::Legendre>,
+      Spectral::Quadrature::GaussLobatto);
+}
+
+// [[OutputRegex, The DG mesh must have at least two points]]
+[[noreturn]] SPECTRE_TEST_CASE("Unit.Evolution.Subcell.Projection.OnePoint",
+                               "[Evolution][Unit]") {
+  ASSERTION_TEST();
+#ifdef SPECTRE_DEBUG
+  evolution::dg::subcell::fd::projection_matrix(Mesh<1>{
+      1, Spectral::Basis::Legendre, Spectral::Quadrature::Gauss});
+  ERROR("Failed to trigger ASSERT in an assertion test");
+#endif
+}
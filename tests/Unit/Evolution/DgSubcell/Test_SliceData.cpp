@@ -0,0 +1,91 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
+#include "Domain/Structure/Direction.hpp"
+#include "Evolution/DgSubcell/SliceData.hpp"
+
+namespace {
+// Volume data where each value encodes its component and grid point
+DataVector make_volume_data(const size_t number_of_points,
+                            const size_t number_of_components) noexcept {
+  DataVector volume_data(number_of_components * number_of_points);
+  for (size_t component = 0; component < number_of_components; ++component) {
+    for (size_t i = 0; i < number_of_points; ++i) {
+      volume_data[component * number_of_points + i] = 100.0 * component + i;
+    }
+  }
+  return volume_data;
+}
+
+// The expected slice for the grid points `point_indices` of each component
+std::vector<double> expected_slice(const std::vector<size_t>& point_indices,
+                                   const size_t number_of_components) noexcept {
+  std::vector<double> result{};
+  for (size_t component = 0; component < number_of_components; ++component) {
+    for (const size_t i : point_indices) {
+      result.push_back(100.0 * component + i);
+    }
+  }
+  return result;
+}
+
+void test_1d() noexcept {
+  const Index<1> extents{5};
+  const auto sliced = evolution::dg::subcell::slice_data(
+      make_volume_data(extents.product(), 2), extents, 2,
+      {Direction<1>::lower_xi(), Direction<1>::upper_xi()});
+  CHECK(sliced.size() == 2);
+  CHECK(sliced.at(Direction<1>::lower_xi()) == expected_slice({0, 1}, 2));
+  CHECK(sliced.at(Direction<1>::upper_xi()) == expected_slice({3, 4}, 2));
+}
+
+void test_2d() noexcept {
+  const Index<2> extents{3, 4};
+  const DataVector volume_data = make_volume_data(extents.product(), 2);
+  const auto sliced = evolution::dg::subcell::slice_data(
+      volume_data, extents, 2,
+      {Direction<2>::lower_xi(), Direction<2>::upper_xi(),
+       Direction<2>::lower_eta(), Direction<2>::upper_eta()});
+  CHECK(sliced.size() == 4);
+  CHECK(sliced.at(Direction<2>::lower_xi()) ==
+        expected_slice({0, 1, 3, 4, 6, 7, 9, 10}, 2));
+  CHECK(sliced.at(Direction<2>::upper_xi()) ==
+        expected_slice({1, 2, 4, 5, 7, 8, 10, 11}, 2));
+  CHECK(sliced.at(Direction<2>::lower_eta()) ==
+        expected_slice({0, 1, 2, 3, 4, 5}, 2));
+  CHECK(sliced.at(Direction<2>::upper_eta()) ==
+        expected_slice({6, 7, 8, 9, 10, 11}, 2));
+
+  // Only the requested directions are sliced
+  const auto sliced_upper_eta = evolution::dg::subcell::slice_data(
+      volume_data, extents, 1, {Direction<2>::upper_eta()});
+  CHECK(sliced_upper_eta.size() == 1);
+  CHECK(sliced_upper_eta.at(Direction<2>::upper_eta()) ==
+        expected_slice({9, 10, 11}, 2));
+}
+
+void test_3d() noexcept {
+  const Index<3> extents{2, 2, 3};
+  const auto sliced = evolution::dg::subcell::slice_data(
+      make_volume_data(extents.product(), 1), extents, 1,
+      {Direction<3>::upper_xi(), Direction<3>::lower_zeta()});
+  CHECK(sliced.size() == 2);
+  CHECK(sliced.at(Direction<3>::upper_xi()) ==
+        expected_slice({1, 3, 5, 7, 9, 11}, 1));
+  CHECK(sliced.at(Direction<3>::lower_zeta()) ==
+        expected_slice({0, 1, 2, 3}, 1));
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Evolution.Subcell.SliceData", "[Evolution][Unit]") {
+  test_1d();
+  test_2d();
+  test_3d();
+}
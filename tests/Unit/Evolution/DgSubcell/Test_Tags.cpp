@@ -0,0 +1,16 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include "Evolution/DgSubcell/Tags.hpp"
+#include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
+
+SPECTRE_TEST_CASE("Unit.Evolution.Subcell.Tags", "[Evolution][Unit]") {
+  TestHelpers::db::test_simple_tag<evolution::dg::subcell::Tags::ActiveGrid>(
+      "ActiveGrid");
+  TestHelpers::db::test_simple_tag<evolution::dg::subcell::Tags::Mesh<1>>(
+      "Subcell(Mesh)");
+  TestHelpers::db::test_simple_tag<evolution::dg::subcell::Tags::Mesh<3>>(
+      "Subcell(Mesh)");
+}
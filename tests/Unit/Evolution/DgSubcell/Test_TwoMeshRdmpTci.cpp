@@ -0,0 +1,72 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <vector>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Evolution/DgSubcell/TwoMeshRdmpTci.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+struct Var1 : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+
+struct Var2 : db::SimpleTag {
+  using type = tnsr::I<DataVector, 2, Frame::Inertial>;
+};
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Evolution.Subcell.TwoMeshRdmpTci",
+                  "[Evolution][Unit]") {
+  using evolution::dg::subcell::rdmp_max_min;
+  using evolution::dg::subcell::two_mesh_rdmp_tci;
+  using vars_type = Variables<tmpl::list<Var1, Var2>>;
+  vars_type dg_vars(4);
+  vars_type subcell_vars(7);
+  get(get<Var1>(dg_vars)) = DataVector{1.0, 2.0, 3.0, 4.0};
+  get<0>(get<Var2>(dg_vars)) = DataVector{-1.0, 0.0, 1.0, 0.5};
+  get<1>(get<Var2>(dg_vars)) = DataVector{10.0, 10.0, 10.0, 10.0};
+  get(get<Var1>(subcell_vars)) =
+      DataVector{0.5, 1.5, 2.0, 2.5, 3.0, 3.5, 4.0};
+  get<0>(get<Var2>(subcell_vars)) =
+      DataVector{-1.0, -0.5, 0.0, 0.5, 1.5, 0.5, 0.5};
+  get<1>(get<Var2>(subcell_vars)) =
+      DataVector{10.0, 10.0, 10.0, 10.0, 10.0, 10.0, 10.0};
+
+  // The extrema are taken over both meshes
+  const auto [max_of_vars, min_of_vars] =
+      rdmp_max_min(dg_vars, subcell_vars);
+  CHECK(max_of_vars == std::vector<double>{4.0, 1.5, 10.0});
+  CHECK(min_of_vars == std::vector<double>{0.5, -1.0, 10.0});
+
+  const double delta0 = 1.0e-7;
+  const double epsilon = 1.0e-3;
+  // A solution within its own bounds is admissible
+  CHECK_FALSE(two_mesh_rdmp_tci(dg_vars, subcell_vars, max_of_vars,
+                                min_of_vars, delta0, epsilon));
+  // ...and so is a small overshoot within the relaxation
+  // delta = epsilon * (max - min)
+  CHECK_FALSE(two_mesh_rdmp_tci(dg_vars, subcell_vars, {3.999, 1.5, 10.0},
+                                min_of_vars, delta0, epsilon));
+  // An overshoot of the maximum beyond the relaxation is troubled, even if it
+  // occurs only on the subcells
+  CHECK(two_mesh_rdmp_tci(dg_vars, subcell_vars, {4.0, 1.0, 10.0},
+                          min_of_vars, delta0, epsilon));
+  // An undershoot of the minimum is troubled
+  CHECK(two_mesh_rdmp_tci(dg_vars, subcell_vars, max_of_vars,
+                          {1.0, -1.0, 10.0}, delta0, epsilon));
+  // A constant component is only allowed to change by delta0
+  CHECK_FALSE(two_mesh_rdmp_tci(dg_vars, subcell_vars,
+                                {4.0, 1.5, 10.0 - 0.5 * delta0},
+                                {0.5, -1.0, 10.0 - 0.5 * delta0}, delta0,
+                                epsilon));
+  CHECK(two_mesh_rdmp_tci(dg_vars, subcell_vars,
+                          {4.0, 1.5, 10.0 - 2.0 * delta0},
+                          {0.5, -1.0, 10.0 - 2.0 * delta0}, delta0, epsilon));
+}
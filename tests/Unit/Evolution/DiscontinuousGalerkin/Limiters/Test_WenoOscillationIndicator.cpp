@@ -3,7 +3,9 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <cstddef>
 #include <string>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
@@ -13,6 +15,7 @@
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/GetOutput.hpp"
+#include "Utilities/Gsl.hpp"
 
 namespace {
 
@@ -99,6 +102,37 @@ void test_oscillation_indicator_2d() noexcept {
       mesh);
   const double expected3 = 3178. / 9.;
   CHECK(indicator3 == approx(expected3));
+
+  // Compute the indicators of several functions at once. The indicator is
+  // quadratic in the data and independent of its mean.
+  DataVector all_data(3 * mesh.number_of_grid_points());
+  for (size_t i = 0; i < mesh.number_of_grid_points(); ++i) {
+    all_data[i] = data[i];
+    all_data[i + mesh.number_of_grid_points()] = 2. * data[i] + 1.e6;
+    all_data[i + 2 * mesh.number_of_grid_points()] = 3.;
+  }
+  std::vector<double> indicators{};
+  Limiters::Weno_detail::oscillation_indicators(
+      make_not_null(&indicators),
+      Limiters::Weno_detail::DerivativeWeight::Unity, all_data, mesh);
+  CHECK(indicators.size() == 3);
+  CHECK(indicators[0] == approx(expected));
+  CHECK(indicators[1] == approx(4. * expected));
+  CHECK(indicators[2] == approx(0.));
+
+  // A different mesh on which the data is represented exactly gives the same
+  // result.
+  const Mesh<2> other_mesh({{5, 4}}, Spectral::Basis::Legendre,
+                           Spectral::Quadrature::Gauss);
+  const auto other_coords = logical_coordinates(other_mesh);
+  const DataVector& other_x = get<0>(other_coords);
+  const DataVector& other_y = get<1>(other_coords);
+  const auto other_data =
+      DataVector{square(other_x) + cube(other_y) - 2.5 * other_x * other_y +
+                 square(other_x) * other_y};
+  CHECK(Limiters::Weno_detail::oscillation_indicator(
+            Limiters::Weno_detail::DerivativeWeight::Unity, other_data,
+            other_mesh) == approx(expected));
 }
 
 void test_oscillation_indicator_3d() noexcept {
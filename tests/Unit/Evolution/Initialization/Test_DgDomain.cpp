@@ -27,6 +27,7 @@
 #include "Domain/Domain.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
 #include "Domain/FunctionsOfTime/PiecewisePolynomial.hpp"
+#include "Domain/SeparableInverseJacobian.hpp"
 #include "Domain/Tags.hpp"
 #include "Domain/TagsTimeDependent.hpp"
 #include "Evolution/Initialization/DgDomain.hpp"
@@ -275,6 +276,25 @@ void test() noexcept {
               domain::Tags::InverseJacobian<Dim, Frame::Logical, Frame::Grid>>(
               runner, self_id) == expected_logical_to_grid_inv_jacobian);
 
+    // The affine element map is separable, but the moving mesh is not the
+    // identity, so only the compressed logical to grid inverse Jacobian is
+    // available
+    const auto& separable_logical_to_grid_inv_jacobian =
+        ActionTesting::get_databox_tag<
+            component,
+            domain::Tags::SeparableInverseJacobian<Dim, Frame::Grid>>(runner,
+                                                                      self_id);
+    REQUIRE(separable_logical_to_grid_inv_jacobian.has_value());
+    CHECK_ITERABLE_APPROX(
+        separable_logical_to_grid_inv_jacobian->inverse_jacobian(),
+        expected_logical_to_grid_inv_jacobian);
+    CHECK_FALSE(
+        ActionTesting::get_databox_tag<
+            component,
+            domain::Tags::SeparableInverseJacobian<Dim, Frame::Inertial>>(
+            runner, self_id)
+            .has_value());
+
     const InverseJacobian<DataVector, Dim, Frame::Grid, Frame::Inertial>
         expected_inv_jacobian_grid_to_inertial =
             grid_to_inertial_map.inv_jacobian(expected_grid_coords, time,
@@ -479,6 +499,18 @@ void test() noexcept {
             runner, self_id)),
         expected_logical_to_inertial_det_inv_jacobian);
 
+    // Without a moving mesh the compressed inverse Jacobian of the affine map
+    // is available in the inertial frame, and is used for volume derivatives
+    const auto& separable_logical_to_inertial_inv_jacobian =
+        ActionTesting::get_databox_tag<
+            component,
+            domain::Tags::SeparableInverseJacobian<Dim, Frame::Inertial>>(
+            runner, self_id);
+    REQUIRE(separable_logical_to_inertial_inv_jacobian.has_value());
+    CHECK_ITERABLE_APPROX(
+        separable_logical_to_inertial_inv_jacobian->inverse_jacobian(),
+        expected_logical_to_inertial_inv_jacobian);
+
     CHECK_FALSE(static_cast<bool>(
         ActionTesting::get_databox_tag<component,
                                        domain::Tags::MeshVelocity<Dim>>(
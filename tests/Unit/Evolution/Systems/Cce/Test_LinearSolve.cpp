@@ -15,6 +15,7 @@
 #include "Helpers/DataStructures/MakeWithRandomValues.hpp"
 #include "Helpers/Evolution/Systems/Cce/CceComputationTestHelpers.hpp"
 #include "NumericalAlgorithms/Spectral/SwshCollocation.hpp"
+#include "Utilities/Literals.hpp"
 #include "Utilities/VectorAlgebra.hpp"
 
 namespace Cce {
@@ -125,13 +126,13 @@ auto create_box_for_bondi_integration(
   return db::create<db::AddSimpleTags<
       integration_variables_tag, Tags::BoundaryValue<BondiValueTag>,
       integration_modes_variables_tag, Tags::LMax, Tags::NumberOfRadialPoints,
-      Tags::OneMinusY>>(
+      Tags::NumberOfAngularChunks, Tags::OneMinusY>>(
       typename integration_variables_tag::type{number_of_grid_points},
       typename Tags::BoundaryValue<BondiValueTag>::type{
           Spectral::Swsh::number_of_swsh_collocation_points(l_max)},
       typename integration_modes_variables_tag::type{
           number_of_radial_polynomials},
-      l_max, number_of_radial_grid_points,
+      l_max, number_of_radial_grid_points, 1_st,
       Scalar<SpinWeighted<ComplexDataVector, 0>>{number_of_grid_points});
 }
 
@@ -470,6 +471,23 @@ void test_pole_integration_with_linear_operator(
   CHECK_ITERABLE_CUSTOM_APPROX(expected,
                                get(db::get<BondiValueTag>(box)).data(),
                                numerical_differentiation_approximation);
+
+  // splitting the angular points into chunks must not change the result. The
+  // chunks are processed one after another when no other PE is available, so
+  // this runs the per-chunk solves even in a serial test.
+  const ComplexDataVector single_chunk_result =
+      get(db::get<BondiValueTag>(box)).data();
+  for (const size_t number_of_angular_chunks : {2_st, 3_st}) {
+    db::mutate<Tags::NumberOfAngularChunks>(
+        make_not_null(&box),
+        [&number_of_angular_chunks](
+            const gsl::not_null<size_t*> local_number_of_chunks) noexcept {
+          *local_number_of_chunks = number_of_angular_chunks;
+        });
+    db::mutate_apply<RadialIntegrateBondi<Tags::BoundaryValue, BondiValueTag>>(
+        make_not_null(&box));
+    CHECK(get(db::get<BondiValueTag>(box)).data() == single_chunk_result);
+  }
 }
 
 SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.LinearSolve", "[Unit][Cce]") {
@@ -41,6 +41,8 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.OptionTags", "[Unit][Cce]") {
   TestHelpers::db::test_simple_tag<Cce::Tags::LMax>("LMax");
   TestHelpers::db::test_simple_tag<Cce::Tags::NumberOfRadialPoints>(
       "NumberOfRadialPoints");
+  TestHelpers::db::test_simple_tag<Cce::Tags::NumberOfAngularChunks>(
+      "NumberOfAngularChunks");
   TestHelpers::db::test_simple_tag<Cce::Tags::ObservationLMax>(
       "ObservationLMax");
   TestHelpers::db::test_simple_tag<Cce::Tags::FilterLMax>("FilterLMax");
@@ -77,6 +79,9 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.OptionTags", "[Unit][Cce]") {
   CHECK(
       TestHelpers::test_creation<size_t, Cce::OptionTags::NumberOfRadialPoints>(
           "3") == 3_st);
+  CHECK(TestHelpers::test_creation<size_t,
+                                   Cce::OptionTags::NumberOfAngularChunks>(
+            "4") == 4_st);
   CHECK(TestHelpers::test_creation<double, Cce::OptionTags::ExtractionRadius>(
             "100.0") == 100.0);
   CHECK(TestHelpers::test_creation<std::optional<double>,
@@ -136,6 +141,7 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.OptionTags", "[Unit][Cce]") {
 
   CHECK(Cce::Tags::LMax::create_from_options(8u) == 8u);
   CHECK(Cce::Tags::NumberOfRadialPoints::create_from_options(6u) == 6u);
+  CHECK(Cce::Tags::NumberOfAngularChunks::create_from_options(4u) == 4u);
 
   CHECK(Cce::Tags::StartTimeFromFile::create_from_options(
             std::optional<double>{}, "OptionTagsTestCceR0100.h5", false) ==
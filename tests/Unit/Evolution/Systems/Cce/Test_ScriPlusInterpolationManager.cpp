@@ -71,6 +71,9 @@ void test_interpolate_quadratic() {
       interpolation_manager.insert_target_time(i * 0.1);
     }
     while (interpolation_manager.first_time_is_ready_to_interpolate()) {
+      // splitting the points into chunks must not change the result
+      CHECK(interpolation_manager.interpolate_first_time(3).second ==
+            interpolation_manager.interpolate_first_time().second);
       const auto interpolation_result =
           interpolation_manager.interpolate_and_pop_first_time();
       comparison_lhs = interpolation_result.second;
@@ -129,6 +132,11 @@ void test_interpolate_quadratic() {
     }
     while (multiplication_interpolation_manager
                .first_time_is_ready_to_interpolate()) {
+      // splitting the points into chunks must not change the result
+      CHECK(
+          multiplication_interpolation_manager.interpolate_first_time(3)
+              .second ==
+          multiplication_interpolation_manager.interpolate_first_time().second);
       const auto interpolation_result =
           multiplication_interpolation_manager.interpolate_and_pop_first_time();
       comparison_lhs = interpolation_result.second;
@@ -185,6 +193,9 @@ void test_interpolate_quadratic() {
     }
     while (
         derivative_interpolation_manager.first_time_is_ready_to_interpolate()) {
+      // splitting the points into chunks must not change the result
+      CHECK(derivative_interpolation_manager.interpolate_first_time(3).second ==
+            derivative_interpolation_manager.interpolate_first_time().second);
       const auto interpolation_result =
           derivative_interpolation_manager.interpolate_and_pop_first_time();
       comparison_lhs = interpolation_result.second;
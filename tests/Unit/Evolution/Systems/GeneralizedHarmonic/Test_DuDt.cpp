@@ -5,6 +5,7 @@
 
 #include <array>
 #include <cstddef>
+#include <optional>
 #include <random>
 
 #include "DataStructures/DataVector.hpp"
@@ -13,7 +14,9 @@
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/ConstraintDamping/Tags.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/Constraints.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/DuDtTempTags.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/FusedConstraints.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/TimeDerivative.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "Helpers/DataStructures/MakeWithRandomValues.hpp"
@@ -33,6 +36,7 @@
 #include "PointwiseFunctions/GeneralRelativity/SpacetimeNormalVector.hpp"
 #include "PointwiseFunctions/GeneralRelativity/SpatialMetric.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
 
 // IWYU pragma: no_forward_declare Tensor
 
@@ -456,6 +460,170 @@ void test_reference_impl_against_spec() noexcept {
   CHECK(dt_phi.get(2, 3, 3)[1] == approx(-42638.998279054998420));
 }
 
+// Check that the tiled evaluation, selected through the overload the DG action
+// calls, reproduces the untiled results exactly, including the temporaries
+// stored in the buffer. For the tiled evaluation the outputs are passed in
+// empty to also test that `apply_tiled` sizes them.
+template <size_t Dim, typename... BufferTags>
+void test_tiled_time_derivative(
+    const tnsr::aa<DataVector, Dim>& expected_dt_spacetime_metric,
+    const tnsr::aa<DataVector, Dim>& expected_dt_pi,
+    const tnsr::iaa<DataVector, Dim>& expected_dt_phi,
+    const Variables<tmpl::list<BufferTags...>>& expected_buffer,
+    const tnsr::iaa<DataVector, Dim>& d_spacetime_metric,
+    const tnsr::iaa<DataVector, Dim>& d_pi,
+    const tnsr::ijaa<DataVector, Dim>& d_phi,
+    const tnsr::aa<DataVector, Dim>& spacetime_metric,
+    const tnsr::aa<DataVector, Dim>& pi, const tnsr::iaa<DataVector, Dim>& phi,
+    const Scalar<DataVector>& gamma0, const Scalar<DataVector>& gamma1,
+    const Scalar<DataVector>& gamma2,
+    const tnsr::a<DataVector, Dim>& gauge_function,
+    const tnsr::ab<DataVector, Dim>& spacetime_deriv_gauge_function) noexcept {
+  for (const std::optional<size_t>& number_of_points_per_block :
+       std::array<std::optional<size_t>, 4>{{std::nullopt, 8, 16, 64}}) {
+    CAPTURE(number_of_points_per_block.value_or(0));
+    // Only the tiled evaluation sizes the outputs
+    const size_t output_size = number_of_points_per_block.has_value()
+                                   ? 0
+                                   : expected_buffer.number_of_grid_points();
+    tnsr::aa<DataVector, Dim> dt_spacetime_metric{output_size};
+    tnsr::aa<DataVector, Dim> dt_pi{output_size};
+    tnsr::iaa<DataVector, Dim> dt_phi{output_size};
+    Variables<tmpl::list<BufferTags...>> buffer(
+        expected_buffer.number_of_grid_points());
+    GeneralizedHarmonic::TimeDerivative<Dim>::apply(
+        make_not_null(&dt_spacetime_metric), make_not_null(&dt_pi),
+        make_not_null(&dt_phi), make_not_null(&get<BufferTags>(buffer))...,
+        d_spacetime_metric, d_pi, d_phi, spacetime_metric, pi, phi, gamma0,
+        gamma1, gamma2, gauge_function, spacetime_deriv_gauge_function,
+        number_of_points_per_block);
+    CHECK(dt_spacetime_metric == expected_dt_spacetime_metric);
+    CHECK(dt_pi == expected_dt_pi);
+    CHECK(dt_phi == expected_dt_phi);
+    CHECK(buffer == expected_buffer);
+  }
+}
+
+// Check that the constraints computed from the temporaries of the time
+// derivative agree with those computed from scratch, on all grid points and on
+// a subsample of them.
+template <size_t Dim, typename... BufferTags>
+void test_fused_constraints(
+    const Variables<tmpl::list<BufferTags...>>& buffer,
+    const tnsr::iaa<DataVector, Dim>& d_spacetime_metric,
+    const tnsr::iaa<DataVector, Dim>& d_pi,
+    const tnsr::ijaa<DataVector, Dim>& d_phi,
+    const tnsr::aa<DataVector, Dim>& spacetime_metric,
+    const tnsr::aa<DataVector, Dim>& pi, const tnsr::iaa<DataVector, Dim>& phi,
+    const Scalar<DataVector>& gamma2,
+    const tnsr::a<DataVector, Dim>& gauge_function,
+    const tnsr::ab<DataVector, Dim>& spacetime_deriv_gauge_function) noexcept {
+  using frame = Frame::Inertial;
+  using fused_constraints = GeneralizedHarmonic::FusedConstraints<Dim>;
+  const size_t number_of_points = get(gamma2).size();
+
+  const auto [det_spatial_metric, inverse_spatial_metric] =
+      determinant_and_inverse(gr::spatial_metric(spacetime_metric));
+  const auto shift = gr::shift(spacetime_metric, inverse_spatial_metric);
+  const auto lapse = gr::lapse(shift, spacetime_metric);
+  const auto inverse_spacetime_metric =
+      gr::inverse_spacetime_metric(lapse, shift, inverse_spatial_metric);
+  const auto normal_vector = gr::spacetime_normal_vector(lapse, shift);
+  const auto normal_one_form =
+      gr::spacetime_normal_one_form<Dim, frame>(lapse);
+  tnsr::ia<DataVector, Dim> d_gauge_function(number_of_points);
+  for (size_t i = 0; i < Dim; ++i) {
+    for (size_t a = 0; a < Dim + 1; ++a) {
+      d_gauge_function.get(i, a) = spacetime_deriv_gauge_function.get(i + 1, a);
+    }
+  }
+
+  Variables<typename fused_constraints::constraint_tags> expected(
+      number_of_points);
+  get<GeneralizedHarmonic::Tags::GaugeConstraint<Dim, frame>>(expected) =
+      GeneralizedHarmonic::gauge_constraint(
+          gauge_function, normal_one_form, normal_vector,
+          inverse_spatial_metric, inverse_spacetime_metric, pi, phi);
+  get<GeneralizedHarmonic::Tags::ThreeIndexConstraint<Dim, frame>>(expected) =
+      GeneralizedHarmonic::three_index_constraint(d_spacetime_metric, phi);
+  const auto& three_index_constraint =
+      get<GeneralizedHarmonic::Tags::ThreeIndexConstraint<Dim, frame>>(
+          expected);
+  get<GeneralizedHarmonic::Tags::TwoIndexConstraint<Dim, frame>>(expected) =
+      GeneralizedHarmonic::two_index_constraint(
+          d_gauge_function, normal_one_form, normal_vector,
+          inverse_spatial_metric, inverse_spacetime_metric, pi, phi, d_pi,
+          d_phi, gamma2, three_index_constraint);
+  get<GeneralizedHarmonic::Tags::FConstraint<Dim, frame>>(expected) =
+      GeneralizedHarmonic::f_constraint(
+          gauge_function, d_gauge_function, normal_one_form, normal_vector,
+          inverse_spatial_metric, inverse_spacetime_metric, pi, phi, d_pi,
+          d_phi, gamma2, three_index_constraint);
+  if constexpr (Dim == 3) {
+    get<GeneralizedHarmonic::Tags::FourIndexConstraint<Dim, frame>>(expected) =
+        GeneralizedHarmonic::four_index_constraint(d_phi);
+    get<GeneralizedHarmonic::Tags::ConstraintEnergy<Dim, frame>>(expected) =
+        GeneralizedHarmonic::constraint_energy(
+            get<GeneralizedHarmonic::Tags::GaugeConstraint<Dim, frame>>(
+                expected),
+            get<GeneralizedHarmonic::Tags::FConstraint<Dim, frame>>(expected),
+            get<GeneralizedHarmonic::Tags::TwoIndexConstraint<Dim, frame>>(
+                expected),
+            three_index_constraint,
+            get<GeneralizedHarmonic::Tags::FourIndexConstraint<Dim, frame>>(
+                expected),
+            inverse_spatial_metric, det_spatial_metric);
+  }
+
+  const auto compute_constraints = [&](const auto constraints,
+                                       const size_t point_stride) noexcept {
+    fused_constraints::apply(
+        constraints, point_stride,
+        get<gr::Tags::InverseSpatialMetric<Dim, frame, DataVector>>(buffer),
+        get<gr::Tags::DetSpatialMetric<DataVector>>(buffer),
+        get<gr::Tags::InverseSpacetimeMetric<Dim, frame, DataVector>>(buffer),
+        get<gr::Tags::SpacetimeNormalVector<Dim, frame, DataVector>>(buffer),
+        get<gr::Tags::SpacetimeNormalOneForm<Dim, frame, DataVector>>(buffer),
+        get<GeneralizedHarmonic::Tags::GaugeConstraint<Dim, frame>>(buffer),
+        get<GeneralizedHarmonic::Tags::ThreeIndexConstraint<Dim, frame>>(
+            buffer),
+        pi, phi, d_pi, d_phi, gamma2, gauge_function,
+        spacetime_deriv_gauge_function);
+  };
+
+  Variables<typename fused_constraints::constraint_tags> constraints{};
+  compute_constraints(make_not_null(&constraints), 1);
+  CHECK_VARIABLES_APPROX(constraints, expected);
+
+  const size_t point_stride = 2;
+  compute_constraints(make_not_null(&constraints), point_stride);
+  Variables<typename fused_constraints::constraint_tags> expected_subsampled(
+      (number_of_points + point_stride - 1) / point_stride);
+  tmpl::for_each<typename fused_constraints::constraint_tags>(
+      [&expected, &expected_subsampled, &point_stride](auto tag_v) noexcept {
+        using tag = tmpl::type_from<decltype(tag_v)>;
+        get<tag>(expected_subsampled) =
+            GeneralizedHarmonic::FusedConstraints_detail::subsample(
+                get<tag>(expected), point_stride);
+      });
+  CHECK_VARIABLES_APPROX(constraints, expected_subsampled);
+
+  // Request only some constraints, including the constraint energy, which
+  // then computes the other constraints it needs internally.
+  using some_constraint_tags = tmpl::conditional_t<
+      Dim == 3,
+      tmpl::list<GeneralizedHarmonic::Tags::TwoIndexConstraint<Dim, frame>,
+                 GeneralizedHarmonic::Tags::ConstraintEnergy<Dim, frame>>,
+      tmpl::list<GeneralizedHarmonic::Tags::TwoIndexConstraint<Dim, frame>>>;
+  Variables<some_constraint_tags> some_constraints{};
+  compute_constraints(make_not_null(&some_constraints), 1);
+  tmpl::for_each<some_constraint_tags>(
+      [&expected, &some_constraints](auto tag_v) noexcept {
+        using tag = tmpl::type_from<decltype(tag_v)>;
+        CHECK_ITERABLE_APPROX(get<tag>(some_constraints), get<tag>(expected));
+      });
+}
+
 template <size_t Dim, typename Generator>
 void test_compute_dudt(const gsl::not_null<Generator*> generator) noexcept {
   std::uniform_real_distribution<> distribution(0.1, 1.0);
@@ -672,6 +840,14 @@ void test_compute_dudt(const gsl::not_null<Generator*> generator) noexcept {
   CHECK_ITERABLE_APPROX(expected_dt_spacetime_metric, dt_spacetime_metric);
   CHECK_ITERABLE_APPROX(expected_dt_pi, dt_pi);
   CHECK_ITERABLE_APPROX(expected_dt_phi, dt_phi);
+
+  test_tiled_time_derivative(dt_spacetime_metric, dt_pi, dt_phi, buffer,
+                             d_spacetime_metric, d_pi, d_phi, spacetime_metric,
+                             pi, phi, gamma0, gamma1, gamma2, gauge_function,
+                             spacetime_deriv_gauge_function);
+  test_fused_constraints(buffer, d_spacetime_metric, d_pi, d_phi,
+                         spacetime_metric, pi, phi, gamma2, gauge_function,
+                         spacetime_deriv_gauge_function);
 }
 }  // namespace
 
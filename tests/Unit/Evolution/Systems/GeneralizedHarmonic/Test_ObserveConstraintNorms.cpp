@@ -0,0 +1,298 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataBox/TagName.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/Structure/Element.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+#include "Domain/Tags.hpp"
+#include "Evolution/DiscontinuousGalerkin/TimeDerivativeIntermediates.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/ConstraintDamping/Tags.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/FusedConstraints.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/ObserveConstraintNorms.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/System.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/Tags.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "IO/Observer/Actions/RegisterEvents.hpp"
+#include "IO/Observer/ArrayComponentId.hpp"
+#include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "NumericalAlgorithms/LinearOperators/PartialDerivatives.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"  // IWYU pragma: keep
+#include "Parallel/Reduction.hpp"
+#include "Parallel/RegisterDerivedClassesWithCharm.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
+#include "Time/Slab.hpp"
+#include "Time/Tags.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Numeric.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace observers::Actions {
+struct ContributeReductionData;
+}  // namespace observers::Actions
+
+namespace {
+constexpr size_t dim = 3;
+using frame = Frame::Inertial;
+
+struct ObservationTimeTag : db::SimpleTag {
+  using type = double;
+};
+
+struct MockContributeReductionData {
+  struct Results {
+    observers::ObservationId observation_id;
+    std::string subfile_name;
+    std::vector<std::string> reduction_names;
+    double time;
+    size_t number_of_grid_points;
+    std::vector<double> norms;
+  };
+  static Results results;
+
+  template <typename ParallelComponent, typename... DbTags,
+            typename Metavariables, typename ArrayIndex, typename... Ts>
+  static void apply(db::DataBox<tmpl::list<DbTags...>>& /*box*/,
+                    Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const observers::ObservationId& observation_id,
+                    observers::ArrayComponentId /*sender_array_id*/,
+                    const std::string& subfile_name,
+                    const std::vector<std::string>& reduction_names,
+                    Parallel::ReductionData<Ts...>&& reduction_data) noexcept {
+    results.observation_id = observation_id;
+    results.subfile_name = subfile_name;
+    results.reduction_names = reduction_names;
+    results.time = std::get<0>(reduction_data.data());
+    results.number_of_grid_points = std::get<1>(reduction_data.data());
+    results.norms.clear();
+    tmpl::for_each<tmpl::range<size_t, 2, sizeof...(Ts)>>(
+        [&reduction_data](const auto index_v) noexcept {
+          constexpr size_t index = tmpl::type_from<decltype(index_v)>::value;
+          results.norms.push_back(std::get<index>(reduction_data.data()));
+        });
+  }
+};
+
+MockContributeReductionData::Results MockContributeReductionData::results{};
+
+template <typename Metavariables>
+struct ElementComponent {
+  using component_being_mocked = void;
+
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = int;
+  using phase_dependent_action_list =
+      tmpl::list<Parallel::PhaseActions<typename Metavariables::Phase,
+                                        Metavariables::Phase::Initialization,
+                                        tmpl::list<>>>;
+};
+
+template <typename Metavariables>
+struct MockObserverComponent {
+  using component_being_mocked = observers::Observer<Metavariables>;
+  using replace_these_simple_actions =
+      tmpl::list<observers::Actions::ContributeReductionData>;
+  using with_these_simple_actions = tmpl::list<MockContributeReductionData>;
+
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = int;
+  using phase_dependent_action_list =
+      tmpl::list<Parallel::PhaseActions<typename Metavariables::Phase,
+                                        Metavariables::Phase::Initialization,
+                                        tmpl::list<>>>;
+};
+
+struct Metavariables {
+  using component_list = tmpl::list<ElementComponent<Metavariables>,
+                                    MockObserverComponent<Metavariables>>;
+  enum class Phase { Initialization, Testing, Exit };
+};
+
+template <typename ObserveEvent>
+void test_observe(const std::unique_ptr<ObserveEvent> observe,
+                  const size_t point_stride,
+                  const size_t element_stride) noexcept {
+  using element_component = ElementComponent<Metavariables>;
+  using observer_component = MockObserverComponent<Metavariables>;
+  using intermediates_tag = evolution::dg::Tags::TimeDerivativeIntermediates<
+      GeneralizedHarmonic::System<dim>>;
+  using constraint_tags =
+      typename GeneralizedHarmonic::FusedConstraints<dim>::constraint_tags;
+
+  MAKE_GENERATOR(generator);
+  // Positive values keep the square root of the determinant of the spatial
+  // metric in the constraint energy finite.
+  std::uniform_real_distribution<> dist(0.1, 1.0);
+  const size_t num_points = 5;
+  const DataVector used_for_size(num_points);
+  const double observation_time = 2.0;
+  const Slab slab(1.0, 3.0);
+  const TimeStepId time_step_id(true, 4, slab.start() + slab.duration() / 2);
+
+  typename intermediates_tag::type intermediates{};
+  intermediates.time_step_id = time_step_id;
+  intermediates.temporaries = make_with_random_values<
+      std::decay_t<decltype(intermediates.temporaries)>>(
+      make_not_null(&generator), make_not_null(&dist), used_for_size);
+  intermediates.partial_derivatives = make_with_random_values<
+      std::decay_t<decltype(intermediates.partial_derivatives)>>(
+      make_not_null(&generator), make_not_null(&dist), used_for_size);
+  const auto pi = make_with_random_values<tnsr::aa<DataVector, dim>>(
+      make_not_null(&generator), make_not_null(&dist), used_for_size);
+  const auto phi = make_with_random_values<tnsr::iaa<DataVector, dim>>(
+      make_not_null(&generator), make_not_null(&dist), used_for_size);
+  const auto gamma2 = make_with_random_values<Scalar<DataVector>>(
+      make_not_null(&generator), make_not_null(&dist), used_for_size);
+  const auto gauge_function = make_with_random_values<tnsr::a<DataVector, dim>>(
+      make_not_null(&generator), make_not_null(&dist), used_for_size);
+  const auto spacetime_deriv_gauge_function =
+      make_with_random_values<tnsr::ab<DataVector, dim>>(
+          make_not_null(&generator), make_not_null(&dist), used_for_size);
+
+  Variables<constraint_tags> expected_constraints{};
+  GeneralizedHarmonic::FusedConstraints<dim>::apply(
+      make_not_null(&expected_constraints), point_stride,
+      get<gr::Tags::InverseSpatialMetric<dim, frame, DataVector>>(
+          intermediates.temporaries),
+      get<gr::Tags::DetSpatialMetric<DataVector>>(intermediates.temporaries),
+      get<gr::Tags::InverseSpacetimeMetric<dim, frame, DataVector>>(
+          intermediates.temporaries),
+      get<gr::Tags::SpacetimeNormalVector<dim, frame, DataVector>>(
+          intermediates.temporaries),
+      get<gr::Tags::SpacetimeNormalOneForm<dim, frame, DataVector>>(
+          intermediates.temporaries),
+      get<GeneralizedHarmonic::Tags::GaugeConstraint<dim, frame>>(
+          intermediates.temporaries),
+      get<GeneralizedHarmonic::Tags::ThreeIndexConstraint<dim, frame>>(
+          intermediates.temporaries),
+      pi, phi,
+      get<::Tags::deriv<GeneralizedHarmonic::Tags::Pi<dim, frame>,
+                        tmpl::size_t<dim>, frame>>(
+          intermediates.partial_derivatives),
+      get<::Tags::deriv<GeneralizedHarmonic::Tags::Phi<dim, frame>,
+                        tmpl::size_t<dim>, frame>>(
+          intermediates.partial_derivatives),
+      gamma2, gauge_function, spacetime_deriv_gauge_function);
+
+  ActionTesting::MockRuntimeSystem<Metavariables> runner{{}};
+  ActionTesting::emplace_component<element_component>(make_not_null(&runner),
+                                                      0);
+  ActionTesting::emplace_component<observer_component>(&runner, 0);
+
+  // The sum of the block id and the segment indices of the first element is 2
+  // and that of the second element is 3.
+  const std::array<ElementId<dim>, 2> element_ids{
+      {ElementId<dim>{1, {{SegmentId{1, 0}, SegmentId{1, 1}, SegmentId{0, 0}}}},
+       ElementId<dim>{1,
+                      {{SegmentId{1, 1}, SegmentId{1, 1}, SegmentId{0, 0}}}}}};
+  for (const auto& element_id : element_ids) {
+    CAPTURE(element_id);
+    const bool is_selected =
+        (element_id == element_ids[0] and 2 % element_stride == 0) or
+        (element_id == element_ids[1] and 3 % element_stride == 0);
+    const auto box = db::create<db::AddSimpleTags<
+        ObservationTimeTag, Tags::TimeStepId, domain::Tags::Element<dim>,
+        intermediates_tag, GeneralizedHarmonic::Tags::Pi<dim, frame>,
+        GeneralizedHarmonic::Tags::Phi<dim, frame>,
+        GeneralizedHarmonic::ConstraintDamping::Tags::ConstraintGamma2,
+        GeneralizedHarmonic::Tags::GaugeH<dim, frame>,
+        GeneralizedHarmonic::Tags::SpacetimeDerivGaugeH<dim, frame>>>(
+        observation_time, time_step_id, Element<dim>{element_id, {}},
+        intermediates, pi, phi, gamma2, gauge_function,
+        spacetime_deriv_gauge_function);
+
+    const auto ids_to_register =
+        observers::get_registration_observation_type_and_key(*observe, box);
+    CHECK(ids_to_register->first == observers::TypeOfObservation::Reduction);
+    CHECK(ids_to_register->second ==
+          observers::ObservationKey("/constraints.dat"));
+
+    observe->run(box, runner.cache(), 0,
+                 std::add_pointer_t<element_component>{});
+    runner.template invoke_queued_simple_action<observer_component>(0);
+    CHECK(runner.template is_simple_action_queue_empty<observer_component>(0));
+
+    const auto& results = MockContributeReductionData::results;
+    CHECK(results.observation_id.value() == observation_time);
+    CHECK(results.subfile_name == "/constraints");
+    CHECK(results.reduction_names[0] == "ObservationTimeTag");
+    CHECK(results.time == observation_time);
+    CHECK(results.reduction_names[1] == "NumberOfPoints");
+    CHECK(results.number_of_grid_points ==
+          (is_selected ? expected_constraints.number_of_grid_points() : 0));
+    REQUIRE(results.norms.size() == tmpl::size<constraint_tags>::value);
+    CHECK(results.reduction_names.size() == results.norms.size() + 2);
+
+    size_t index = 0;
+    tmpl::for_each<constraint_tags>([&expected_constraints, &index,
+                                     &is_selected,
+                                     &results](auto tag_v) noexcept {
+      using tag = tmpl::type_from<decltype(tag_v)>;
+      double expected = 0.0;
+      if (is_selected) {
+        for (const auto& component : get<tag>(expected_constraints)) {
+          // The rest of the RMS calculation is done later by the writer.
+          expected += alg::accumulate(square(component), 0.0);
+        }
+      }
+      CHECK(results.reduction_names[index + 2] ==
+            "Norm(" + db::tag_name<tag>() + ")");
+      CHECK(results.norms[index] == approx(expected));
+      ++index;
+    });
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE(
+    "Unit.Evolution.Systems.GeneralizedHarmonic.ObserveConstraintNorms",
+    "[Unit][Evolution]") {
+  using EventType = Event<tmpl::list<
+      GeneralizedHarmonic::Events::Registrars::ObserveConstraintNorms<
+          dim, ObservationTimeTag>>>;
+  test_observe(std::make_unique<
+                   GeneralizedHarmonic::Events::ObserveConstraintNorms<
+                       dim, ObservationTimeTag>>("constraints", 1, 1),
+               1, 1);
+  test_observe(std::make_unique<
+                   GeneralizedHarmonic::Events::ObserveConstraintNorms<
+                       dim, ObservationTimeTag>>("constraints", 2, 2),
+               2, 2);
+
+  INFO("create/serialize");
+  Parallel::register_derived_classes_with_charm<EventType>();
+  const auto factory_event = TestHelpers::test_factory_creation<EventType>(
+      "ObserveConstraintNorms:\n"
+      "  SubfileName: constraints\n"
+      "  PointStride: 3\n"
+      "  ElementStride: 3");
+  auto serialized_event = serialize_and_deserialize(factory_event);
+  test_observe(std::move(serialized_event), 3, 3);
+}
@@ -5,6 +5,7 @@
 
 #include <array>
 #include <cstddef>
+#include <type_traits>
 #include <utility>
 
 #include "DataStructures/DataVector.hpp"
@@ -13,19 +14,20 @@
 #include "DataStructures/Tensor/EagerMath/Magnitude.hpp"
 #include "DataStructures/Tensor/IndexType.hpp"  // IWYU pragma: keep
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
 #include "Evolution/Systems/RadiationTransport/M1Grey/M1Closure.hpp"
+#include "Evolution/Systems/RadiationTransport/M1Grey/System.hpp"
 #include "Evolution/Systems/RadiationTransport/Tags.hpp"  // IWYU pragma: keep
+#include "Framework/TestHelpers.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 
-/// Test M1 closure function
-SPECTRE_TEST_CASE("Evolution.Systems.RadiationTransport.M1Grey.M1Closure",
-                  "[Unit][M1Grey]") {
+namespace {
+template <typename Closure>
+void test_closure_limits() {
   const DataVector used_for_size(5);
-  RadiationTransport::M1Grey::ComputeM1Closure<
-      tmpl::list<neutrinos::ElectronNeutrinos<0>>>
-      closure;
+  Closure closure;
   // Create variables
   // Input
   Scalar<DataVector> energy_density(used_for_size);
@@ -98,3 +100,129 @@ SPECTRE_TEST_CASE("Evolution.Systems.RadiationTransport.M1Grey.M1Closure",
   CHECK_ITERABLE_CUSTOM_APPROX(get(closure_factor), expected_xi1,
                                custom_approx);
 }
+
+template <typename... Species>
+void test_multi_group_closure(tmpl::list<Species...> /*meta*/) {
+  // Points 0 and 1 are (almost) at rest, so the closure for zero velocity
+  // applies to them
+  const DataVector speed{0., 1.e-9, 0.1, 0.2, 0.3, 0.4};
+  const size_t number_of_points = speed.size();
+  tnsr::I<DataVector, 3, Frame::Inertial> fluid_velocity(number_of_points);
+  tnsr::ii<DataVector, 3, Frame::Inertial> spatial_metric(number_of_points);
+  for (size_t m = 0; m < 3; m++) {
+    fluid_velocity.get(m) = speed * (m + 1.) / 3.;
+    spatial_metric.get(m, m) = 1. + 0.1 * m * m;
+    for (size_t n = m + 1; n < 3; n++) {
+      spatial_metric.get(m, n) = 0.1 * (m + n);
+    }
+  }
+  const auto inv_spatial_metric =
+      determinant_and_inverse(spatial_metric).second;
+  const Scalar<DataVector> fluid_lorentz_factor{
+      1. / sqrt(1. - get(dot_product(fluid_velocity, fluid_velocity,
+                                     spatial_metric)))};
+
+  using moments_tags = tmpl::list<
+      RadiationTransport::M1Grey::Tags::TildeE<Frame::Inertial, Species>...,
+      RadiationTransport::M1Grey::Tags::TildeS<Frame::Inertial, Species>...>;
+  using closure_tags = typename RadiationTransport::M1Grey::ComputeM1Closure<
+      tmpl::list<Species...>>::return_tags;
+  Variables<moments_tags> moments(number_of_points);
+  // Moments of different species and grid points range from optically thick
+  // to almost optically thin
+  size_t group = 0;
+  const auto set_moments = [&moments, &group, &number_of_points](
+                               auto species) noexcept {
+    using species_type = decltype(species);
+    auto& energy_density = get(
+        get<RadiationTransport::M1Grey::Tags::TildeE<Frame::Inertial,
+                                                     species_type>>(moments));
+    auto& momentum_density =
+        get<RadiationTransport::M1Grey::Tags::TildeS<Frame::Inertial,
+                                                     species_type>>(moments);
+    for (size_t s = 0; s < number_of_points; ++s) {
+      energy_density[s] = 1. + static_cast<double>(group);
+      const double flux_factor = 0.1 * static_cast<double>(group + s);
+      get<0>(momentum_density)[s] = 0.3 * flux_factor * energy_density[s];
+      get<1>(momentum_density)[s] = -0.2 * flux_factor * energy_density[s];
+      get<2>(momentum_density)[s] = 0.5 * flux_factor * energy_density[s];
+    }
+    ++group;
+  };
+  EXPAND_PACK_LEFT_TO_RIGHT(set_moments(Species{}));
+
+  const auto apply_closure = [&moments, &fluid_velocity, &fluid_lorentz_factor,
+                              &spatial_metric, &inv_spatial_metric](
+                                 auto closure,
+                                 const gsl::not_null<Variables<closure_tags>*>
+                                     result) noexcept {
+    decltype(closure)::apply(
+        make_not_null(
+            &get<RadiationTransport::M1Grey::Tags::ClosureFactor<Species>>(
+                *result))...,
+        make_not_null(&get<RadiationTransport::M1Grey::Tags::TildeP<
+                          Frame::Inertial, Species>>(*result))...,
+        make_not_null(
+            &get<RadiationTransport::M1Grey::Tags::TildeJ<Species>>(
+                *result))...,
+        make_not_null(
+            &get<RadiationTransport::M1Grey::Tags::TildeHNormal<Species>>(
+                *result))...,
+        make_not_null(&get<RadiationTransport::M1Grey::Tags::TildeHSpatial<
+                          Frame::Inertial, Species>>(*result))...,
+        get<RadiationTransport::M1Grey::Tags::TildeE<Frame::Inertial,
+                                                     Species>>(moments)...,
+        get<RadiationTransport::M1Grey::Tags::TildeS<Frame::Inertial,
+                                                     Species>>(moments)...,
+        fluid_velocity, fluid_lorentz_factor, spatial_metric,
+        inv_spatial_metric);
+  };
+
+  // Accuracy required for closure factor
+  Approx custom_approx = Approx::custom().epsilon(1.e-5).scale(1.0);
+  Variables<closure_tags> expected(number_of_points, -1.);
+  Variables<closure_tags> result(number_of_points, -1.);
+  // Without an initial guess for the closure factor...
+  apply_closure(
+      RadiationTransport::M1Grey::ComputeM1Closure<tmpl::list<Species...>>{},
+      make_not_null(&expected));
+  apply_closure(RadiationTransport::M1Grey::ComputeM1ClosureMultiGroup<
+                    tmpl::list<Species...>>{},
+                make_not_null(&result));
+  CHECK_VARIABLES_CUSTOM_APPROX(result, expected, custom_approx);
+  // ...and starting from the solution
+  apply_closure(RadiationTransport::M1Grey::ComputeM1ClosureMultiGroup<
+                    tmpl::list<Species...>>{},
+                make_not_null(&result));
+  CHECK_VARIABLES_CUSTOM_APPROX(result, expected, custom_approx);
+}
+
+static_assert(
+    std::is_same_v<
+        neutrinos::energy_groups<neutrinos::ElectronNeutrinos, 3>,
+        tmpl::list<neutrinos::ElectronNeutrinos<0>,
+                   neutrinos::ElectronNeutrinos<1>,
+                   neutrinos::ElectronNeutrinos<2>>>,
+    "Failed testing energy_groups");
+static_assert(
+    std::is_same_v<
+        RadiationTransport::M1Grey::MultiGroupSystem<
+            neutrinos::energy_groups<neutrinos::ElectronNeutrinos, 2>>::
+            m1_closure,
+        RadiationTransport::M1Grey::ComputeM1ClosureMultiGroup<
+            tmpl::list<neutrinos::ElectronNeutrinos<0>,
+                       neutrinos::ElectronNeutrinos<1>>>>,
+    "Failed testing MultiGroupSystem");
+}  // namespace
+
+/// Test M1 closure function
+SPECTRE_TEST_CASE("Evolution.Systems.RadiationTransport.M1Grey.M1Closure",
+                  "[Unit][M1Grey]") {
+  test_closure_limits<RadiationTransport::M1Grey::ComputeM1Closure<
+      tmpl::list<neutrinos::ElectronNeutrinos<0>>>>();
+  test_closure_limits<RadiationTransport::M1Grey::ComputeM1ClosureMultiGroup<
+      tmpl::list<neutrinos::ElectronNeutrinos<0>>>>();
+  test_multi_group_closure(
+      tmpl::append<neutrinos::energy_groups<neutrinos::ElectronNeutrinos, 3>,
+                   tmpl::list<neutrinos::HeavyLeptonNeutrinos<0>>>{});
+}
@@ -10,6 +10,12 @@ struct AnalyticData : public MarkAsAnalyticData {};
 struct Solution : public MarkAsAnalyticSolution {};
 struct SolutionDependentAnalyticData : public MarkAsAnalyticData,
                                        private Solution {};
+struct StationarySolution : public MarkAsAnalyticSolution {
+  static constexpr bool is_time_independent = true;
+};
+struct EvolvingSolution : public MarkAsAnalyticSolution {
+  static constexpr bool is_time_independent = false;
+};
 
 static_assert(evolution::is_analytic_solution_v<Solution>,
               "Failed testing evolution::is_analytic_solution_v");
@@ -30,4 +36,13 @@ static_assert(evolution::is_analytic_data<SolutionDependentAnalyticData>::value,
 static_assert(
     not evolution::is_analytic_solution<SolutionDependentAnalyticData>::value,
     "Failed testing evolution::is_solution_data");
+
+static_assert(evolution::is_time_independent_v<StationarySolution>,
+              "Failed testing evolution::is_time_independent_v");
+static_assert(not evolution::is_time_independent_v<EvolvingSolution>,
+              "Failed testing evolution::is_time_independent_v");
+static_assert(not evolution::is_time_independent_v<Solution>,
+              "Failed testing evolution::is_time_independent_v");
+static_assert(evolution::is_time_independent<StationarySolution>::value,
+              "Failed testing evolution::is_time_independent");
 }  // namespace
@@ -522,6 +522,13 @@ class MockDistributedObject {
         std::forward<Data>(data));
   }
 
+  // Tests step through actions manually, so this is the same as receive_data.
+  template <typename InboxTag, typename Data>
+  void insert_into_inbox(const typename InboxTag::temporal_id& id, Data&& data,
+                         const bool enable_if_disabled = false) {
+    receive_data<InboxTag>(id, std::forward<Data>(data), enable_if_disabled);
+  }
+
  private:
   template <typename Action, typename... Args, size_t... Is>
   void forward_tuple_to_simple_action(
@@ -18,6 +18,7 @@
 #include <random>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
@@ -31,6 +32,7 @@
 #include "Domain/Structure/OrientationMap.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "Helpers/Domain/DomainTestHelpers.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TypeTraits.hpp"
 
 /*!
@@ -395,6 +397,44 @@ void test_inverse_map(const Map& map,
   CHECK_ITERABLE_APPROX(test_point, map.inverse(map(test_point)).get());
 }
 
+/*!
+ * \ingroup TestingFrameworkGroup
+ * \brief Given a Map `map` with a batched inverse, checks that it agrees with
+ * the single-point inverse at all `target_points`, including the points where
+ * the inverse is not defined. Pass the time and functions of time as `args`
+ * for time-dependent maps.
+ */
+template <typename Map, typename... Args>
+void test_batch_inverse_map(
+    const Map& map, const std::array<DataVector, Map::dim>& target_points,
+    const Args&... args) noexcept {
+  auto source_points = target_points;
+  std::vector<bool> is_valid(target_points[0].size(), true);
+  map.inverse(make_not_null(&source_points), make_not_null(&is_valid),
+              args...);
+  for (size_t s = 0; s < is_valid.size(); ++s) {
+    std::array<double, Map::dim> target_point{};
+    for (size_t d = 0; d < Map::dim; ++d) {
+      gsl::at(target_point, d) = gsl::at(target_points, d)[s];
+    }
+    const auto expected_source_point = map.inverse(target_point, args...);
+    CHECK(is_valid[s] == static_cast<bool>(expected_source_point));
+    if (expected_source_point) {
+      for (size_t d = 0; d < Map::dim; ++d) {
+        CHECK(gsl::at(source_points, d)[s] ==
+              approx(gsl::at(*expected_source_point, d)));
+      }
+    }
+  }
+
+  // Points that are flagged as invalid on input stay invalid
+  source_points = target_points;
+  is_valid.assign(is_valid.size(), false);
+  map.inverse(make_not_null(&source_points), make_not_null(&is_valid),
+              args...);
+  CHECK(is_valid == std::vector<bool>(is_valid.size(), false));
+}
+
 /*!
  * \ingroup TestingFrameworkGroup
  * \brief Given a Map `map`, tests the map functions, including map inverse,
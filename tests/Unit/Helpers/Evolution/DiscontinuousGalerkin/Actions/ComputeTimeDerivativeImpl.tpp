@@ -29,6 +29,7 @@
 #include "Evolution/DiscontinuousGalerkin/MortarData.hpp"
 #include "Evolution/DiscontinuousGalerkin/MortarTags.hpp"
 #include "Evolution/DiscontinuousGalerkin/ProjectToBoundary.hpp"
+#include "Evolution/DiscontinuousGalerkin/TimeDerivativeIntermediates.hpp"
 #include "Framework/ActionTesting.hpp"
 #include "Helpers/Evolution/DiscontinuousGalerkin/Actions/ComputeTimeDerivativeImpl.hpp"
 #include "Helpers/Evolution/DiscontinuousGalerkin/Actions/SystemType.hpp"
@@ -41,6 +42,7 @@
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Parallel/Actions/SetupDataBox.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"
+#include "ParallelAlgorithms/DiscontinuousGalerkin/FluxCommunication.hpp"
 #include "ParallelAlgorithms/DiscontinuousGalerkin/InitializeMortars.hpp"
 #include "Time/Tags.hpp"
 #include "Utilities/Gsl.hpp"
@@ -710,7 +712,9 @@ struct component {
       domain::Tags::InverseJacobian<Metavariables::volume_dim, Frame::Logical,
                                     Frame::Inertial>,
       domain::Tags::MeshVelocity<Metavariables::volume_dim>,
-      domain::Tags::DivMeshVelocity>;
+      domain::Tags::DivMeshVelocity,
+      ::evolution::dg::Tags::TimeDerivativeIntermediates<
+          typename Metavariables::system>>;
   using simple_tags = tmpl::conditional_t<
       Metavariables::system_type == SystemType::Conservative,
       tmpl::push_back<
@@ -940,12 +944,15 @@ void test_impl(const Spectral::Quadrature quadrature,
   }
 
   const TimeStepId time_step_id{true, 3, Time{Slab{0.2, 3.4}, {3, 100}}};
+  using intermediates_tag =
+      ::evolution::dg::Tags::TimeDerivativeIntermediates<system>;
+  using intermediates_type = typename intermediates_tag::type;
   if constexpr (not std::is_same_v<tmpl::list<>, flux_tags>) {
     ActionTesting::emplace_component_and_initialize<component<metavars>>(
         &runner, self_id,
         {time_step_id, evolved_vars, dt_evolved_vars, var3, mesh,
          normal_dot_fluxes_interface, element, inv_jac, mesh_velocity,
-         div_mesh_velocity,
+         div_mesh_velocity, intermediates_type{},
          Variables<db::wrap_tags_in<::Tags::Flux, flux_tags, tmpl::size_t<Dim>,
                                     Frame::Inertial>>{2, -100.}});
     for (const auto& [direction, neighbor_ids] : neighbors) {
@@ -955,7 +962,7 @@ void test_impl(const Spectral::Quadrature quadrature,
             &runner, neighbor_id,
             {time_step_id, evolved_vars, dt_evolved_vars, var3, mesh,
              normal_dot_fluxes_interface, element, inv_jac, mesh_velocity,
-             div_mesh_velocity,
+             div_mesh_velocity, intermediates_type{},
              Variables<db::wrap_tags_in<::Tags::Flux, flux_tags,
                                         tmpl::size_t<Dim>, Frame::Inertial>>{
                  2, -100.}});
@@ -966,7 +973,7 @@ void test_impl(const Spectral::Quadrature quadrature,
         &runner, self_id,
         {time_step_id, evolved_vars, dt_evolved_vars, var3, mesh,
          normal_dot_fluxes_interface, element, inv_jac, mesh_velocity,
-         div_mesh_velocity});
+         div_mesh_velocity, intermediates_type{}});
     for (const auto& [direction, neighbor_ids] : neighbors) {
       (void)direction;
       for (const auto& neighbor_id : neighbor_ids) {
@@ -974,7 +981,7 @@ void test_impl(const Spectral::Quadrature quadrature,
             &runner, neighbor_id,
             {time_step_id, evolved_vars, dt_evolved_vars, var3, mesh,
              normal_dot_fluxes_interface, element, inv_jac, mesh_velocity,
-             div_mesh_velocity});
+             div_mesh_velocity, intermediates_type{}});
       }
     }
   }
@@ -1082,6 +1089,17 @@ void test_impl(const Spectral::Quadrature quadrature,
                                                                     self_id);
   };
 
+  // The buffers of the volume terms are kept in the DataBox
+  const auto& intermediates = get_tag(intermediates_tag{});
+  CHECK(intermediates.time_step_id == time_step_id);
+  CHECK(get<Var3Squared>(intermediates.temporaries) == Scalar<DataVector>{
+                                                           square(get(var3))});
+  if constexpr (not std::is_same_v<typename system::gradient_variables,
+                                   tmpl::list<>>) {
+    CHECK(intermediates.partial_derivatives.number_of_grid_points() ==
+          mesh.number_of_grid_points());
+  }
+
   const auto mortar_id_east =
       std::make_pair(Direction<Dim>::upper_xi(), east_id);
 
@@ -1119,6 +1137,21 @@ void test_impl(const Spectral::Quadrature quadrature,
       // per dimension.
       check_mortar(mortar_id_south, Dim == 2 ? 3 : 9);
     }
+
+    // Each neighbor must receive the boundary data exactly once, no matter
+    // whether it is sent before or after the volume terms are computed.
+    for (const auto& [direction, neighbor_ids] : neighbors) {
+      (void)direction;
+      for (const auto& neighbor_id : neighbor_ids) {
+        CAPTURE(neighbor_id);
+        const auto& inbox = ActionTesting::get_inbox_tag<
+            component<metavars>,
+            ::dg::FluxesInboxTag<typename metavars::boundary_scheme>>(
+            runner, neighbor_id);
+        REQUIRE(inbox.size() == 1);
+        CHECK(inbox.begin()->second.size() == 1);
+      }
+    }
   } else {
     // At this point we know the volume terms have been computed correctly and
     // we want to verify that the functions we expect to be called on the
@@ -0,0 +1,107 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "ErrorHandling/Error.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "IO/Observer/ReductionContributionSlots.hpp"
+#include "Parallel/Reduction.hpp"
+#include "Utilities/Functional.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+
+namespace {
+using Slots = observers::ReductionContributionSlots<
+    Parallel::ReductionDatum<double, funcl::AssertEqual<>>,
+    Parallel::ReductionDatum<size_t, funcl::Plus<>>,
+    Parallel::ReductionDatum<std::vector<double>, funcl::VectorPlus>>;
+using ReductionData = typename Slots::reduction_data;
+
+const std::vector<std::string> names{"Time", "NumberOfPoints", "Error"};
+
+void fill_and_check(const gsl::not_null<Slots*> slots,
+                    const double time) noexcept {
+  // Claim all slots before filling any of them, as happens when several
+  // contributors arrive at the node at the same time.
+  const size_t first_slot = slots->claim_slot();
+  const size_t second_slot = slots->claim_slot();
+  const size_t third_slot = slots->claim_slot();
+  CHECK(first_slot == 0);
+  CHECK(second_slot == 1);
+  CHECK(third_slot == 2);
+
+  // The slots may be filled in any order, and only the last one reports that
+  // all contributions have arrived.
+  CHECK_FALSE(slots->fill_slot(
+      second_slot, std::vector<std::string>{names},
+      ReductionData{time, 2_st, std::vector<double>{1.0, 2.0}}));
+  CHECK_FALSE(slots->fill_slot(
+      third_slot, std::vector<std::string>{names},
+      ReductionData{time, 3_st, std::vector<double>{10.0, 20.0}}));
+
+  // Slots must survive serialization while contributions are outstanding.
+  *slots = serialize_and_deserialize(*slots);
+
+  CHECK(slots->fill_slot(
+      first_slot, std::vector<std::string>{names},
+      ReductionData{time, 1_st, std::vector<double>{100.0, 200.0}}));
+
+  const auto [combined_names, combined_data] = slots->combine();
+  CHECK(combined_names == names);
+  CHECK(std::get<0>(combined_data.data()) == time);
+  CHECK(std::get<1>(combined_data.data()) == 6);
+  CHECK(std::get<2>(combined_data.data()) ==
+        std::vector<double>{111.0, 222.0});
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.IO.Observers.ReductionContributionSlots",
+                  "[Unit][Observers]") {
+  Slots slots{3};
+  fill_and_check(make_not_null(&slots), 1.0);
+
+  // A new set of slots is used for every observation, so replacing the
+  // combined slots must allow the same number of contributors again.
+  slots = Slots{3};
+  fill_and_check(make_not_null(&slots), 2.0);
+
+  Slots moved_slots{std::move(slots)};
+  (void)moved_slots;
+}
+
+// [[OutputRegex, Received more contributions \(2\) than were expected \(1\)]]
+[[noreturn]] SPECTRE_TEST_CASE(
+    "Unit.IO.Observers.ReductionContributionSlots.TooManyContributions",
+    "[Unit][Observers]") {
+  ASSERTION_TEST();
+#ifdef SPECTRE_DEBUG
+  Slots slots{1};
+  slots.claim_slot();
+  slots.claim_slot();
+  ERROR("Failed to trigger ASSERT in an assertion test");
+#endif
+}
+
+// [[OutputRegex, The reduction names passed in must match the currently known
+// reduction names]]
+[[noreturn]] SPECTRE_TEST_CASE(
+    "Unit.IO.Observers.ReductionContributionSlots.MismatchedNames",
+    "[Unit][Observers]") {
+  ERROR_TEST();
+  Slots slots{2};
+  const size_t first_slot = slots.claim_slot();
+  const size_t second_slot = slots.claim_slot();
+  slots.fill_slot(first_slot, std::vector<std::string>{names},
+                  ReductionData{1.0, 1_st, std::vector<double>{1.0}});
+  slots.fill_slot(second_slot, std::vector<std::string>{"Time", "Other"},
+                  ReductionData{1.0, 1_st, std::vector<double>{1.0}});
+  slots.combine();
+  ERROR("Failed to trigger ERROR in an error test");
+}
@@ -27,6 +27,8 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.Tags", "[Unit][Observers]") {
   TestHelpers::db::test_simple_tag<ReductionData<double>>("ReductionData");
   TestHelpers::db::test_simple_tag<ReductionDataNames<double>>(
       "ReductionDataNames");
+  TestHelpers::db::test_simple_tag<ReductionDataSlots<double>>(
+      "ReductionDataSlots");
   TestHelpers::db::test_simple_tag<H5FileLock>("H5FileLock");
   TestHelpers::db::test_simple_tag<VolumeFileName>("VolumeFileName");
   TestHelpers::db::test_simple_tag<ReductionFileName>("ReductionFileName");
@@ -38,5 +40,13 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.Tags", "[Unit][Observers]") {
       std::is_same_v<typename ReductionDataNames<double, int, char>::data_tag,
                      ReductionData<double, int, char>>,
       "Failed testing Observers tags");
+  static_assert(
+      std::is_same_v<typename ReductionData<double, int, char>::slots_tag,
+                     ReductionDataSlots<double, int, char>>,
+      "Failed testing Observers tags");
+  static_assert(
+      std::is_same_v<typename ReductionDataSlots<double, int, char>::data_tag,
+                     ReductionData<double, int, char>>,
+      "Failed testing Observers tags");
 }
 }  // namespace observers::Tags
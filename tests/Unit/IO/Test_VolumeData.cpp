@@ -7,6 +7,7 @@
 #include <boost/iterator/transform_iterator.hpp>
 #include <cstddef>
 #include <cstdint>
+#include <hdf5.h>
 #include <memory>
 #include <string>
 #include <vector>
@@ -15,11 +16,15 @@
 #include "DataStructures/Tensor/TensorData.hpp"
 #include "ErrorHandling/Error.hpp"
 #include "IO/H5/AccessType.hpp"
+#include "IO/H5/CheckH5.hpp"
 #include "IO/H5/File.hpp"
+#include "IO/H5/Helpers.hpp"
 #include "IO/H5/VolumeData.hpp"
+#include "IO/H5/Wrappers.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/FileSystem.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/MakeString.hpp"
 #include "Utilities/Numeric.hpp"
 
@@ -276,6 +281,173 @@ SPECTRE_TEST_CASE("Unit.IO.H5.VolumeData", "[Unit][IO][H5]") {
   }
 }
 
+namespace {
+// The address of the object at `path` in the file, which is the same for all
+// hard links to the object
+haddr_t object_address(const hid_t file_id, const std::string& path) {
+  const hid_t dataset_id = h5::open_dataset(file_id, path);
+#if H5_VERSION_GE(1, 12, 0)
+  H5O_info1_t info{};
+  CHECK_H5(H5Oget_info1(dataset_id, &info), "Failed to get object info");
+#else
+  H5O_info_t info{};
+  CHECK_H5(H5Oget_info(dataset_id, &info), "Failed to get object info");
+#endif
+  h5::close_dataset(dataset_id);
+  return info.addr;
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.IO.H5.VolumeData.SharedTopology", "[Unit][IO][H5]") {
+  const std::string h5_file_name("Unit.IO.H5.VolumeData.SharedTopology.h5");
+  const uint32_t version_number = 4;
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+  // The first and last observations share their topology, which is only
+  // written once, while the second observation has a different topology.
+  const std::vector<std::vector<size_t>> extents{{2}, {3}, {2}};
+  const std::vector<std::string> grid_names{"A", "B", "A"};
+  {
+    h5::H5File<h5::AccessType::ReadWrite> my_file(h5_file_name);
+    auto& volume_file =
+        my_file.insert<h5::VolumeData>("/element_data", version_number);
+    for (size_t i = 0; i < extents.size(); ++i) {
+      volume_file.write_volume_data(
+          i, static_cast<double>(i),
+          {{extents[i],
+            {TensorComponent{
+                grid_names[i] + "/S",
+                DataVector(extents[i][0], static_cast<double>(i))}},
+            {Spectral::Basis::Legendre},
+            {Spectral::Quadrature::Gauss}}});
+    }
+    // The subgroup holding the known topologies is not an observation
+    auto observation_ids = volume_file.list_observation_ids();
+    std::sort(observation_ids.begin(), observation_ids.end());
+    CHECK(observation_ids == std::vector<size_t>{0, 1, 2});
+    for (size_t i = 0; i < extents.size(); ++i) {
+      CAPTURE(i);
+      CHECK(volume_file.get_extents(i) ==
+            std::vector<std::vector<size_t>>{extents[i]});
+      CHECK(volume_file.get_grid_names(i) ==
+            std::vector<std::string>{grid_names[i]});
+      CHECK(volume_file.get_bases(i) ==
+            std::vector<std::vector<std::string>>{{"Legendre"}});
+      CHECK(volume_file.get_quadratures(i) ==
+            std::vector<std::vector<std::string>>{{"Gauss"}});
+      CHECK(volume_file.list_tensor_components(i) ==
+            std::vector<std::string>{"S"});
+      CHECK(volume_file.get_tensor_component(i, "S") ==
+            DataVector(extents[i][0], static_cast<double>(i)));
+    }
+  }
+
+  // Check that the topology datasets are hard links to the same objects in
+  // the file, and not copies
+  const hid_t file_id =
+      H5Fopen(h5_file_name.c_str(), H5F_ACC_RDONLY, h5p_default());
+  CHECK_H5(file_id, "Failed to open file " << h5_file_name);
+  const auto topologies =
+      h5::get_group_names(file_id, "/element_data.vol/Topologies");
+  CHECK(topologies.size() == 2);
+  for (const std::string dataset_name :
+       {"total_extents", "grid_names", "quadratures", "bases",
+        "connectivity"}) {
+    CAPTURE(dataset_name);
+    const auto address = [&file_id, &dataset_name](
+                             const std::string& group_name) noexcept {
+      return object_address(file_id,
+                            "/element_data.vol/" + group_name + "/" +
+                                dataset_name);
+    };
+    CHECK(address("ObservationId0") == address("ObservationId2"));
+    CHECK(address("ObservationId0") != address("ObservationId1"));
+    std::vector<haddr_t> topology_addresses{};
+    for (const auto& topology : topologies) {
+      topology_addresses.push_back(address("Topologies/" + topology));
+    }
+    CHECK(alg::count(topology_addresses, address("ObservationId0")) == 1);
+    CHECK(alg::count(topology_addresses, address("ObservationId1")) == 1);
+  }
+  CHECK_H5(H5Fclose(file_id), "Failed to close file " << h5_file_name);
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+}
+
+SPECTRE_TEST_CASE("Unit.IO.H5.VolumeData.ReadTensorComponents",
+                  "[Unit][IO][H5]") {
+  const std::string h5_file_name(
+      "Unit.IO.H5.VolumeData.ReadTensorComponents.h5");
+  const uint32_t version_number = 4;
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+  h5::H5File<h5::AccessType::ReadWrite> my_file(h5_file_name);
+  auto& volume_file =
+      my_file.insert<h5::VolumeData>("/element_data", version_number);
+  // Three grids with two points each, so the grid points in the file are
+  // S = {1, 2, 3, 4, 5, 6} and T = {10, 20, 30, 40, 50, 60}
+  std::vector<ElementVolumeData> elements{};
+  for (const std::string grid_name : {"A", "B", "C"}) {
+    const double first_value = 2.0 * static_cast<double>(elements.size());
+    elements.push_back(
+        {{2},
+         {TensorComponent{grid_name + "/S",
+                          DataVector{first_value + 1.0, first_value + 2.0}},
+          TensorComponent{grid_name + "/T",
+                          DataVector{10.0 * (first_value + 1.0),
+                                     10.0 * (first_value + 2.0)}}},
+         {Spectral::Basis::Legendre},
+         {Spectral::Quadrature::Gauss}});
+  }
+  volume_file.write_volume_data(0, 0.0, elements);
+
+  const size_t row_stride = 7;
+  std::vector<double> data(2 * row_stride, -1.0);
+  {
+    INFO("All grid points");
+    CHECK(volume_file.read_tensor_components(make_not_null(data.data()),
+                                             row_stride, 0, {"T", "S"},
+                                             {}) == 6);
+    CHECK(data == std::vector<double>{10.0, 20.0, 30.0, 40.0, 50.0, 60.0,
+                                      -1.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0,
+                                      -1.0});
+  }
+  {
+    INFO("Intervals out of the order of the file");
+    std::fill(data.begin(), data.end(), -1.0);
+    CHECK(volume_file.read_tensor_components(
+              make_not_null(data.data()), row_stride, 0, {"S", "T"},
+              {{4, 2}, {0, 2}, {3, 0}, {2, 1}}) == 5);
+    CHECK(data == std::vector<double>{5.0, 6.0, 1.0, 2.0, 3.0, -1.0, -1.0,
+                                      50.0, 60.0, 10.0, 20.0, 30.0, -1.0,
+                                      -1.0});
+  }
+  {
+    INFO("Overlapping intervals");
+    std::fill(data.begin(), data.end(), -1.0);
+    CHECK(volume_file.read_tensor_components(make_not_null(data.data()),
+                                             row_stride, 0, {"S"},
+                                             {{0, 3}, {1, 3}}) == 6);
+    CHECK(data == std::vector<double>{1.0, 2.0, 3.0, 2.0, 3.0, 4.0, -1.0,
+                                      -1.0, -1.0, -1.0, -1.0, -1.0, -1.0,
+                                      -1.0});
+  }
+  {
+    INFO("Only empty intervals");
+    std::fill(data.begin(), data.end(), -1.0);
+    CHECK(volume_file.read_tensor_components(make_not_null(data.data()),
+                                             row_stride, 0, {"S"},
+                                             {{2, 0}}) == 0);
+    CHECK(data == std::vector<double>(2 * row_stride, -1.0));
+  }
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+}
+
 // [[OutputRegex, The expected format of the tensor component names is
 // 'GROUP_NAME/COMPONENT_NAME' but could not find a '/' in]]
 [[noreturn]] SPECTRE_TEST_CASE("Unit.IO.H5.VolumeData.ComponentFormat0",
@@ -154,6 +154,43 @@ class TestVolumeData(unittest.TestCase):
                         tensor_component=expected_tensor_component_names[i]))
                 [0:8], expected_tensor_component_data)
 
+    # Test that the tensor components are read in bulk correctly
+    def test_get_tensor_components(self):
+        data = self.vol_file.get_tensor_components(
+            observation_ids=[0, 1], tensor_components=['field_1', 'field_2'])
+        self.assertEqual(data.shape, (2, 2, 16))
+        for i in range(2):
+            npt.assert_almost_equal(
+                data[i, 0], np.concatenate(
+                    (self.tensor_component_data[2 * i],
+                     self.tensor_component_data[2 * i + 1])))
+            npt.assert_almost_equal(
+                data[i, 1], np.concatenate(
+                    (self.tensor_component_data[2 * i + 1],
+                     self.tensor_component_data[2 * i])))
+        # Read only the second grid
+        data = self.vol_file.get_tensor_components(
+            observation_ids=[1],
+            tensor_components=['field_2'],
+            grid_names=['grid_2'])
+        self.assertEqual(data.shape, (1, 1, 8))
+        npt.assert_almost_equal(data[0, 0], self.tensor_component_data[2])
+
+    # Test that the tensor components are read in bulk from several files
+    def test_read_volume_data(self):
+        self.h5_file.close()
+        data = spectre_h5.read_volume_data(
+            file_names=[self.file_name, self.file_name],
+            subfile_name="/element_data",
+            observation_ids=[0],
+            tensor_components=['field_1'],
+            grid_names=['grid_1'])
+        self.assertEqual(data.shape, (1, 1, 16))
+        npt.assert_almost_equal(
+            data[0, 0],
+            np.concatenate((self.tensor_component_data[0],
+                            self.tensor_component_data[0])))
+
     # Test that the offset and length for certain grid is retrieved correctly
     def test_offset_and_length_for_grid(self):
         obs_id = self.vol_file.list_observation_ids()[0]
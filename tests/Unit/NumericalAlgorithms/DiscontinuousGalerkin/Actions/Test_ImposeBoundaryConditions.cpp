@@ -9,6 +9,7 @@
 #include <unordered_map>
 #include <utility>
 
+#include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/Prefixes.hpp"  // IWYU pragma: keep
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
@@ -19,6 +20,7 @@
 #include "Framework/ActionTesting.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Actions/ImposeBoundaryConditions.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Tags.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"  // IWYU pragma: keep
 #include "PointwiseFunctions/AnalyticSolutions/AnalyticSolution.hpp"
 #include "Time/Tags.hpp"
@@ -60,6 +62,24 @@ struct BoundaryConditionTag {
   using type = BoundaryCondition;
 };
 
+// Claims to be time-independent, but depends on the time so that we can check
+// whether the boundary data was recomputed.
+struct TimeIndependentBoundaryCondition : MarkAsAnalyticSolution {
+  static constexpr bool is_time_independent = true;
+
+  static tuples::TaggedTuple<Var> variables(
+      const tnsr::I<DataVector, Dim>& x, const double t,
+      tmpl::list<Var> /*meta*/) noexcept {
+    return tuples::TaggedTuple<Var>{Scalar<DataVector>{get<0>(x) + t}};
+  }
+  // clang-tidy: do not use references
+  void pup(PUP::er& /*p*/) noexcept {}  // NOLINT
+};
+
+struct TimeIndependentBoundaryConditionTag {
+  using type = TimeIndependentBoundaryCondition;
+};
+
 template <bool HasPrimitiveAndConservativeVars>
 struct System {
   static constexpr const size_t volume_dim = Dim;
@@ -83,35 +103,44 @@ struct System {
 using exterior_bdry_vars_tag =
     domain::Tags::Interface<domain::Tags::BoundaryDirectionsExterior<Dim>,
                             Tags::Variables<tmpl::list<Var>>>;
+using exterior_bdry_coords_tag =
+    domain::Tags::Interface<domain::Tags::BoundaryDirectionsExterior<Dim>,
+                            domain::Tags::Coordinates<Dim, Frame::Inertial>>;
 
 template <typename Metavariables>
 struct component {
   using metavariables = Metavariables;
   using chare_type = ActionTesting::MockArrayChare;
   using array_index = int;
-  using const_global_cache_tags = tmpl::list<BoundaryConditionTag>;
+  using const_global_cache_tags =
+      tmpl::list<typename Metavariables::boundary_condition_tag>;
 
   using phase_dependent_action_list = tmpl::list<
       Parallel::PhaseActions<
           typename Metavariables::Phase, Metavariables::Phase::Initialization,
-          tmpl::list<ActionTesting::InitializeDataBox<db::AddSimpleTags<
-              Tags::Time,
-              domain::Tags::Interface<
-                  domain::Tags::BoundaryDirectionsExterior<Dim>,
-                  domain::Tags::Coordinates<Dim, Frame::Inertial>>,
-              exterior_bdry_vars_tag>>>>,
+          tmpl::list<ActionTesting::InitializeDataBox<tmpl::append<
+              db::AddSimpleTags<Tags::Time, exterior_bdry_coords_tag,
+                                exterior_bdry_vars_tag>,
+              typename Metavariables::cache_tags>>>>,
       Parallel::PhaseActions<
           typename Metavariables::Phase, Metavariables::Phase::Testing,
           tmpl::list<
               dg::Actions::ImposeDirichletBoundaryConditions<Metavariables>>>>;
 };
 
-template <bool HasPrimitiveAndConservativeVars>
+template <bool HasPrimitiveAndConservativeVars,
+          bool CacheBoundaryData = false>
 struct Metavariables {
   using system = System<HasPrimitiveAndConservativeVars>;
   using component_list = tmpl::list<component<Metavariables>>;
 
-  using boundary_condition_tag = BoundaryConditionTag;
+  using boundary_condition_tag =
+      tmpl::conditional_t<CacheBoundaryData,
+                          TimeIndependentBoundaryConditionTag,
+                          BoundaryConditionTag>;
+  using cache_tags = tmpl::conditional_t<
+      CacheBoundaryData,
+      tmpl::list<Tags::ExternalBoundaryDataCoordinates<Dim>>, tmpl::list<>>;
   enum class Phase { Initialization, Testing, Exit };
 };
 
@@ -127,11 +156,9 @@ void run_test() {
   {
     tnsr::I<DataVector, Dim> arbitrary_coords{
         DataVector{3, std::numeric_limits<double>::signaling_NaN()}};
-    typename domain::Tags::Interface<
-        domain::Tags::BoundaryDirectionsExterior<Dim>,
-        domain::Tags::Coordinates<Dim, Frame::Inertial>>::type
-        external_bdry_coords{{{Direction<2>::lower_eta(), arbitrary_coords},
-                              {Direction<2>::upper_xi(), arbitrary_coords}}};
+    typename exterior_bdry_coords_tag::type external_bdry_coords{
+        {{Direction<2>::lower_eta(), arbitrary_coords},
+         {Direction<2>::upper_xi(), arbitrary_coords}}};
     typename exterior_bdry_vars_tag::type exterior_bdry_vars;
     for (const auto& direction : external_directions) {
       exterior_bdry_vars[direction].initialize(3);
@@ -161,10 +188,75 @@ void run_test() {
   CHECK(external_vars == expected_vars);
 }
 
+void test_time_independent_cache() {
+  using metavariables = Metavariables<false, true>;
+  using my_component = component<metavariables>;
+  using cache_tag = Tags::ExternalBoundaryDataCoordinates<Dim>;
+  const auto external_directions = {Direction<2>::lower_eta(),
+                                    Direction<2>::upper_xi()};
+
+  ActionTesting::MockRuntimeSystem<metavariables> runner{
+      {TimeIndependentBoundaryCondition{}}};
+  {
+    typename exterior_bdry_coords_tag::type external_bdry_coords{};
+    typename exterior_bdry_vars_tag::type exterior_bdry_vars{};
+    for (const auto& direction : external_directions) {
+      external_bdry_coords[direction] =
+          tnsr::I<DataVector, Dim>{DataVector{1., 2., 3.}};
+      exterior_bdry_vars[direction].initialize(3);
+    }
+    ActionTesting::emplace_component_and_initialize<my_component>(
+        &runner, 0,
+        {1.2, std::move(external_bdry_coords), std::move(exterior_bdry_vars),
+         typename cache_tag::type{}});
+  }
+  ActionTesting::set_phase(make_not_null(&runner),
+                           metavariables::Phase::Testing);
+
+  const auto check_vars = [&runner](const Direction<Dim>& direction,
+                                    const DataVector& expected) noexcept {
+    CHECK_ITERABLE_APPROX(
+        get(get<Var>(
+            ActionTesting::get_databox_tag<my_component,
+                                           exterior_bdry_vars_tag>(runner, 0)
+                .at(direction))),
+        expected);
+  };
+
+  ActionTesting::next_action<my_component>(make_not_null(&runner), 0);
+  for (const auto& direction : external_directions) {
+    check_vars(direction, DataVector{2.2, 3.2, 4.2});
+    CHECK(ActionTesting::get_databox_tag<my_component, cache_tag>(runner, 0)
+              .at(direction) ==
+          ActionTesting::get_databox_tag<my_component,
+                                         exterior_bdry_coords_tag>(runner, 0)
+              .at(direction));
+  }
+
+  // Changing the time doesn't recompute the boundary data, but changing the
+  // coordinates of a face does.
+  auto& box = ActionTesting::get_databox<
+      my_component, tmpl::list<Tags::Time, exterior_bdry_coords_tag,
+                               exterior_bdry_vars_tag, cache_tag>>(
+      make_not_null(&runner), 0);
+  db::mutate<Tags::Time, exterior_bdry_coords_tag>(
+      make_not_null(&box),
+      [](const gsl::not_null<double*> time,
+         const gsl::not_null<typename exterior_bdry_coords_tag::type*>
+             coords) noexcept {
+        *time = 2.5;
+        get<0>(coords->at(Direction<2>::upper_xi())) = DataVector{4., 5., 6.};
+      });
+  ActionTesting::next_action<my_component>(make_not_null(&runner), 0);
+  check_vars(Direction<2>::lower_eta(), DataVector{2.2, 3.2, 4.2});
+  check_vars(Direction<2>::upper_xi(), DataVector{6.5, 7.5, 8.5});
+}
+
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.DiscontinuousGalerkin.Actions.BoundaryConditions",
                   "[Unit][NumericalAlgorithms][Actions]") {
   run_test<false>();
   run_test<true>();
+  test_time_independent_cache();
 }
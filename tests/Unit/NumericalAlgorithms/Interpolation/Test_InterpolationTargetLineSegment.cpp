@@ -16,6 +16,7 @@
 #include "Framework/TestCreation.hpp"
 #include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
 #include "Helpers/NumericalAlgorithms/Interpolation/InterpolationTargetTestHelpers.hpp"
+#include "NumericalAlgorithms/Interpolation/InterpolationTargetDetail.hpp"
 #include "NumericalAlgorithms/Interpolation/InterpolationTargetLineSegment.hpp"
 #include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
 #include "Time/Tags.hpp"
@@ -29,6 +30,7 @@ struct MockMetavariables {
     using compute_items_on_target = tmpl::list<>;
     using compute_target_points =
         ::intrp::TargetPoints::LineSegment<InterpolationTargetA, 3>;
+    static constexpr size_t number_of_parallel_chunks = 4;
   };
   using temporal_id = ::Tags::TimeStepId;
   static constexpr size_t volume_dim = 3;
@@ -68,7 +70,19 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.InterpolationTarget.LineSegment",
         points.get(d)[i] = 1.0 + 0.1 * i;  // Worked out by hand.
       }
     }
-    return block_logical_coordinates(domain_creator.create_domain(), points);
+    const auto domain = domain_creator.create_domain();
+    const auto result = block_logical_coordinates(domain, points);
+    // Splitting the points into chunks must not change the result, even
+    // when there are more chunks than points.
+    for (const size_t number_of_chunks :
+         std::array<size_t, 4>{{1, 2, 4, 20}}) {
+      CAPTURE(number_of_chunks);
+      CHECK(intrp::InterpolationTarget_detail::
+                block_logical_coordinates_in_chunks(domain, points,
+                                                    number_of_chunks) ==
+            result);
+    }
+    return result;
   }
   ();
 
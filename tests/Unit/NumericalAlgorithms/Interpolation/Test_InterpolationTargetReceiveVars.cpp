@@ -6,6 +6,8 @@
 #include <array>
 #include <cstddef>
 #include <string>
+#include <utility>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -21,7 +23,9 @@
 #include "NumericalAlgorithms/Interpolation/InitializeInterpolationTarget.hpp"
 #include "NumericalAlgorithms/Interpolation/InitializeInterpolator.hpp"  // IWYU pragma: keep
 #include "NumericalAlgorithms/Interpolation/InterpolatedVars.hpp"  // IWYU pragma: keep
+#include "NumericalAlgorithms/Interpolation/InterpolationTargetDetail.hpp"
 #include "NumericalAlgorithms/Interpolation/InterpolationTargetReceiveVars.hpp"
+#include "NumericalAlgorithms/Interpolation/Tags.hpp"
 #include "Parallel/Actions/SetupDataBox.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"  // IWYU pragma: keep
 #include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
@@ -525,6 +529,67 @@ void test_interpolation_target_receive_vars() noexcept {
       ActionTesting::is_simple_action_queue_empty<interp_component>(runner, 0));
 }
 
+template <size_t NumberOfChunks>
+struct ChunkedTarget {
+  using vars_to_interpolate_to_target =
+      tmpl::list<gr::Tags::Lapse<DataVector>,
+                 gr::Tags::Shift<3, Frame::Inertial, DataVector>>;
+  static constexpr size_t number_of_parallel_chunks = NumberOfChunks;
+};
+
+// The received variables are copied in chunks of their components. Check that
+// the assembled variables do not depend on the number of chunks, also for a
+// point that is received from two sources.
+template <size_t NumberOfChunks>
+void test_add_received_variables_in_chunks() noexcept {
+  INFO("Add received variables in chunks");
+  CAPTURE(NumberOfChunks);
+  using target = ChunkedTarget<NumberOfChunks>;
+  using vars_type = Variables<typename target::vars_to_interpolate_to_target>;
+  using filled_tag = intrp::Tags::IndicesOfFilledInterpPoints<double>;
+  using vars_tag = intrp::Tags::InterpolatedVars<target, double>;
+  const double temporal_id = 1.5;
+  auto box = db::create<tmpl::list<filled_tag, vars_tag>>(
+      typename filled_tag::type{},
+      typename vars_tag::type{{temporal_id, vars_type{5, 0.0}}});
+
+  // The value of component `v` of point `i` of source `j` is 100 j + 10 v + i
+  const size_t number_of_components =
+      vars_type::number_of_independent_components;
+  std::vector<vars_type> vars_src{vars_type{3}, vars_type{3}};
+  for (size_t j = 0; j < vars_src.size(); ++j) {
+    for (size_t v = 0; v < number_of_components; ++v) {
+      for (size_t i = 0; i < 3; ++i) {
+        // clang-tidy: no pointer arithmetic
+        vars_src[j].data()[i + 3 * v] =  // NOLINT
+            100.0 * static_cast<double>(j) + 10.0 * static_cast<double>(v) +
+            static_cast<double>(i);
+      }
+    }
+  }
+  // The point with global offset 2 is received from both sources, and only
+  // the first one is used.
+  const std::vector<std::vector<size_t>> global_offsets{{0, 2, 4}, {1, 2, 3}};
+  intrp::InterpolationTarget_detail::add_received_variables<target>(
+      make_not_null(&box), vars_src, global_offsets, temporal_id);
+
+  CHECK(db::get<filled_tag>(box).at(temporal_id) ==
+        std::unordered_set<size_t>{0, 1, 2, 3, 4});
+  // Pairs of the source and of the point in the source for each point
+  const std::array<std::pair<size_t, size_t>, 5> expected_sources{
+      {{0, 0}, {1, 0}, {0, 1}, {1, 2}, {0, 2}}};
+  const auto& vars_dest = db::get<vars_tag>(box).at(temporal_id);
+  for (size_t v = 0; v < number_of_components; ++v) {
+    for (size_t point = 0; point < 5; ++point) {
+      const auto& [j, i] = gsl::at(expected_sources, point);
+      // clang-tidy: no pointer arithmetic
+      CHECK(vars_dest.data()[point + 5 * v] ==  // NOLINT
+            100.0 * static_cast<double>(j) + 10.0 * static_cast<double>(v) +
+                static_cast<double>(i));
+    }
+  }
+}
+
 SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.InterpolationTarget.ReceiveVars",
                   "[Unit]") {
   test_interpolation_target_receive_vars<MockPostInterpolationCallback, 1, 0>();
@@ -532,5 +597,8 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.InterpolationTarget.ReceiveVars",
                                          0, 0>();
   test_interpolation_target_receive_vars<
       MockPostInterpolationCallbackWithInvalidPoints<3>, 1, 3>();
+  test_add_received_variables_in_chunks<1>();
+  test_add_received_variables_in_chunks<2>();
+  test_add_received_variables_in_chunks<4>();
 }
 }  // namespace
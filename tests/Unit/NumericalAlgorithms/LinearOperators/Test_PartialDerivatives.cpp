@@ -26,7 +26,10 @@
 #include "Domain/CoordinateMaps/CoordinateMap.tpp"
 #include "Domain/CoordinateMaps/ProductMaps.hpp"
 #include "Domain/CoordinateMaps/ProductMaps.tpp"
+#include "Domain/ElementMap.hpp"
 #include "Domain/LogicalCoordinates.hpp"
+#include "Domain/SeparableInverseJacobian.hpp"
+#include "Domain/Structure/ElementId.hpp"
 #include "Domain/Tags.hpp"
 #include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.tpp"
@@ -361,6 +364,15 @@ void test_partial_derivatives_3d(const Mesh<3>& mesh) {
   inverse_jacobian.get(0, 0) = 2.0;
   inverse_jacobian.get(1, 1) = 8.0;
   inverse_jacobian.get(2, 2) = 4.0;
+  const domain::SeparableInverseJacobian<3, Frame::Grid>
+      separable_inverse_jacobian{
+          ElementMap<3, Frame::Grid>{
+              ElementId<3>{0},
+              domain::make_coordinate_map_base<Frame::Logical, Frame::Grid>(
+                  Affine3D{Affine{-1.0, 1.0, -0.3, 0.7},
+                           Affine{-1.0, 1.0, 0.3, 0.55},
+                           Affine{-1.0, 1.0, 2.3, 2.8}})},
+          mesh};
 
   Variables<VariableTags> u(number_of_grid_points);
   Variables<db::wrap_tags_in<Tags::deriv, GradientTags, tmpl::size_t<3>,
@@ -401,6 +413,11 @@ void test_partial_derivatives_3d(const Mesh<3>& mesh) {
             logical_partial_derivatives<GradientTags>(u, mesh),
             inverse_jacobian);
         helper(du_with_logical);
+
+        vars_type du_separable{};
+        partial_derivatives<GradientTags>(make_not_null(&du_separable), u,
+                                          mesh, separable_inverse_jacobian);
+        helper(du_separable);
       }
     }
   }
@@ -7,6 +7,7 @@
 #include <cmath>
 #include <cstddef>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "ErrorHandling/Error.hpp"
@@ -97,6 +98,44 @@ void test_datavector() noexcept {
   }
 }
 
+void test_safeguarded() noexcept {
+  const DataVector constant{2., 4., 2., 9.};
+  const DataVector lower{1., 0., -2., 0.};
+  const DataVector upper{2., 3., -1., 2.};
+  const auto func_and_deriv = [&constant](const DataVector& x) noexcept {
+    return std::make_pair(DataVector{constant - square(x)},
+                          DataVector{-2. * x});
+  };
+  // The Newton step from the second guess leaves the bracket, and the last
+  // root isn't bracketed
+  const DataVector guess{1.5, 0.1, -1.2, 1.};
+  DataVector root = guess;
+  const auto converged = RootFinder::safeguarded_newton_raphson(
+      make_not_null(&root), func_and_deriv, lower, upper, 1.e-14, 1.e-14);
+  CHECK(converged == std::vector<bool>{true, true, true, false});
+  CHECK(root[0] == approx(sqrt(2.)));
+  CHECK(root[1] == approx(2.));
+  CHECK(root[2] == approx(-sqrt(2.)));
+
+  // Roots on the bounds
+  root = DataVector{1.5, 2.5, -1.5, 1.};
+  CHECK(RootFinder::safeguarded_newton_raphson(
+            make_not_null(&root), func_and_deriv, DataVector{1., 2., -2., 0.},
+            DataVector{2., 3., -1., 3.}, 1.e-14, 1.e-14) ==
+        std::vector<bool>{true, true, true, true});
+  CHECK(root[0] == approx(sqrt(2.)));
+  CHECK(root[1] == 2.);
+  CHECK(root[2] == approx(-sqrt(2.)));
+  CHECK(root[3] == 3.);
+
+  // Not enough iterations
+  root = guess;
+  CHECK(RootFinder::safeguarded_newton_raphson(make_not_null(&root),
+                                               func_and_deriv, lower, upper,
+                                               1.e-14, 1.e-14, 1) ==
+        std::vector<bool>{false, false, false, false});
+}
+
 void test_convergence_error_double() noexcept {
   const size_t max_iterations = 2;
   const size_t digits = 8;
@@ -187,6 +226,7 @@ SPECTRE_TEST_CASE("Unit.Numerical.RootFinding.NewtonRaphson",
   test_simple();
   test_bounds();
   test_datavector();
+  test_safeguarded();
   test_convergence_error_double();
   test_convergence_error_datavector();
 }
@@ -265,6 +265,17 @@ void test_interpolation(const gsl::not_null<Generator*> generator) noexcept {
 
   CHECK_ITERABLE_CUSTOM_APPROX(clenshaw_interpolation, expected,
                                factorial_approx);
+
+  // splitting the target points into chunks must not change the result
+  for (const size_t number_of_chunks : {2_st, 3_st, 20_st}) {
+    CAPTURE(number_of_chunks);
+    const auto chunked_interpolator = serialize_and_deserialize(
+        SwshInterpolator{target_theta, target_phi, l_max, number_of_chunks});
+    SpinWeighted<ComplexDataVector, spin> chunked_interpolation;
+    chunked_interpolator.interpolate(make_not_null(&chunked_interpolation),
+                                     generated_collocation);
+    CHECK_ITERABLE_APPROX(chunked_interpolation, clenshaw_interpolation);
+  }
 }
 
 SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Spectral.SwshInterpolation",
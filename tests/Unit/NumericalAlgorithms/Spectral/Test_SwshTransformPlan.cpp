@@ -0,0 +1,141 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <random>
+
+#include "DataStructures/ComplexDataVector.hpp"
+#include "DataStructures/ComplexModalVector.hpp"
+#include "DataStructures/SpinWeighted.hpp"
+#include "Helpers/NumericalAlgorithms/Spectral/SwshTestHelpers.hpp"
+#include "NumericalAlgorithms/Spectral/SwshCoefficients.hpp"
+#include "NumericalAlgorithms/Spectral/SwshCollocation.hpp"
+#include "NumericalAlgorithms/Spectral/SwshTransform.hpp"
+#include "NumericalAlgorithms/Spectral/SwshTransformPlan.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace Spectral::Swsh {
+namespace {
+
+template <int Spin, typename Generator>
+SpinWeighted<ComplexModalVector, Spin> make_modes(
+    const gsl::not_null<Generator*> gen, const size_t l_max,
+    const size_t number_of_radial_points) noexcept {
+  UniformCustomDistribution<double> coefficient_distribution{-10.0, 10.0};
+  SpinWeighted<ComplexModalVector, Spin> modes{
+      size_of_libsharp_coefficient_vector(l_max) * number_of_radial_points};
+  TestHelpers::generate_swsh_modes<Spin>(
+      make_not_null(&modes.data()), gen,
+      make_not_null(&coefficient_distribution), number_of_radial_points,
+      l_max);
+  return modes;
+}
+
+template <ComplexRepresentation Representation>
+void test_transform_plan() noexcept {
+  MAKE_GENERATOR(gen);
+  UniformCustomDistribution<size_t> sdist{2, 7};
+  const size_t l_max = sdist(gen);
+
+  // several quantities of each of a few spin weights, with different numbers
+  // of radial points
+  const auto modes_m2_a = make_modes<-2>(make_not_null(&gen), l_max, 2);
+  const auto modes_m2_b = make_modes<-2>(make_not_null(&gen), l_max, 3);
+  const auto modes_0_a = make_modes<0>(make_not_null(&gen), l_max, 1);
+  const auto modes_0_b = make_modes<0>(make_not_null(&gen), l_max, 2);
+  const auto modes_1 = make_modes<1>(make_not_null(&gen), l_max, 2);
+
+  SwshTransformPlan<Representation> plan{l_max};
+  CHECK(plan.l_max() == l_max);
+  CHECK(plan.number_of_pending_transforms() == 0);
+
+  SpinWeighted<ComplexDataVector, -2> collocation_m2_a{};
+  SpinWeighted<ComplexDataVector, -2> collocation_m2_b{};
+  SpinWeighted<ComplexDataVector, 0> collocation_0_a{};
+  SpinWeighted<ComplexDataVector, 0> collocation_0_b{};
+  SpinWeighted<ComplexDataVector, 1> collocation_1{};
+  plan.add_inverse_transform(make_not_null(&collocation_m2_a), modes_m2_a);
+  plan.add_inverse_transform(make_not_null(&collocation_0_a), modes_0_a);
+  plan.add_inverse_transform(make_not_null(&collocation_1), modes_1);
+  plan.add_inverse_transform(make_not_null(&collocation_m2_b), modes_m2_b);
+  plan.add_inverse_transform(make_not_null(&collocation_0_b), modes_0_b);
+  CHECK(plan.number_of_pending_transforms() == 10);
+  CHECK(collocation_m2_b.size() ==
+        3 * number_of_swsh_collocation_points(l_max));
+  plan.execute();
+  CHECK(plan.number_of_pending_transforms() == 0);
+
+  Approx transform_approx =
+      Approx::custom()
+          .epsilon(std::numeric_limits<double>::epsilon() * 1.0e6)
+          .scale(1.0);
+
+  CHECK_ITERABLE_CUSTOM_APPROX(
+      collocation_m2_a.data(),
+      (inverse_swsh_transform<Representation>(l_max, 2, modes_m2_a).data()),
+      transform_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(
+      collocation_m2_b.data(),
+      (inverse_swsh_transform<Representation>(l_max, 3, modes_m2_b).data()),
+      transform_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(
+      collocation_0_a.data(),
+      (inverse_swsh_transform<Representation>(l_max, 1, modes_0_a).data()),
+      transform_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(
+      collocation_0_b.data(),
+      (inverse_swsh_transform<Representation>(l_max, 2, modes_0_b).data()),
+      transform_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(
+      collocation_1.data(),
+      (inverse_swsh_transform<Representation>(l_max, 2, modes_1).data()),
+      transform_approx);
+
+  // the plan is reusable, and the forward transforms recover the modes
+  // without altering the collocation data
+  const auto collocation_m2_a_copy = collocation_m2_a;
+  SpinWeighted<ComplexModalVector, -2> transformed_m2_a{};
+  SpinWeighted<ComplexModalVector, -2> transformed_m2_b{};
+  SpinWeighted<ComplexModalVector, 0> transformed_0_a{};
+  SpinWeighted<ComplexModalVector, 0> transformed_0_b{};
+  SpinWeighted<ComplexModalVector, 1> transformed_1{};
+  plan.add_transform(make_not_null(&transformed_0_b), collocation_0_b);
+  plan.add_transform(make_not_null(&transformed_m2_a), collocation_m2_a);
+  plan.add_transform(make_not_null(&transformed_1), collocation_1);
+  plan.add_transform(make_not_null(&transformed_m2_b), collocation_m2_b);
+  plan.add_transform(make_not_null(&transformed_0_a), collocation_0_a);
+  CHECK(plan.number_of_pending_transforms() == 10);
+  plan.execute();
+  CHECK(plan.number_of_pending_transforms() == 0);
+  CHECK(collocation_m2_a == collocation_m2_a_copy);
+
+  CHECK_ITERABLE_CUSTOM_APPROX(transformed_m2_a.data(), modes_m2_a.data(),
+                               transform_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(transformed_m2_b.data(), modes_m2_b.data(),
+                               transform_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(transformed_0_a.data(), modes_0_a.data(),
+                               transform_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(transformed_0_b.data(), modes_0_b.data(),
+                               transform_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(transformed_1.data(), modes_1.data(),
+                               transform_approx);
+
+  // the cached plan is shared by all callers with the same `l_max`
+  auto& cached_plan = cached_transform_plan<Representation>(l_max);
+  CHECK(cached_plan.l_max() == l_max);
+  CHECK(cached_plan.number_of_pending_transforms() == 0);
+  CHECK(&cached_transform_plan<Representation>(l_max) == &cached_plan);
+  CHECK(cached_transform_plan<Representation>(l_max + 1).l_max() ==
+        l_max + 1);
+}
+
+SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Spectral.SwshTransformPlan",
+                  "[Unit][NumericalAlgorithms]") {
+  test_transform_plan<ComplexRepresentation::Interleaved>();
+  test_transform_plan<ComplexRepresentation::RealsThenImags>();
+}
+}  // namespace
+}  // namespace Spectral::Swsh
@@ -562,6 +562,141 @@ struct ReceiveComponent {
   }
 };
 
+//////////////////////////////////////////////////////////////////////
+// Test handing off data to a local receiver past the inline call limit
+//////////////////////////////////////////////////////////////////////
+
+namespace handoff_test {
+// Parallel::receive_data evaluates the algorithm of a local receiver inline
+// for at most 64 calls in a row. Sending more than twice that many messages
+// ensures that some of them are inserted directly into the inbox, with only
+// the algorithm going through the Charm++ RTS.
+constexpr int number_of_messages = 130;
+
+struct sum_received {
+  using inbox_tags = tmpl::list<receive_data_test::IntReceiveTag>;
+
+  template <typename DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static auto apply(db::DataBox<DbTags>& box,
+                    tuples::TaggedTuple<InboxTags...>& inboxes,
+                    const Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/) noexcept {
+    auto& inbox = tuples::get<receive_data_test::IntReceiveTag>(inboxes);
+    int sum = 0;
+    for (const int value : inbox[TestAlgorithmArrayInstance{0}]) {
+      sum += value;
+    }
+    inbox.erase(TestAlgorithmArrayInstance{0});
+    db::mutate<CountActionsCalled, Int0>(
+        make_not_null(&box),
+        [sum](const gsl::not_null<int*> count_actions_called,
+              const gsl::not_null<int*> int0) {
+          ++*count_actions_called;
+          *int0 = sum;
+        });
+    return std::tuple<db::DataBox<DbTags>&&, bool>(std::move(box), true);
+  }
+
+  template <typename DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex>
+  static bool is_ready(
+      const db::DataBox<DbTags>& /*box*/,
+      const tuples::TaggedTuple<InboxTags...>& inboxes,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ArrayIndex& /*array_index*/) noexcept {
+    const auto& inbox = tuples::get<receive_data_test::IntReceiveTag>(inboxes);
+    const auto received = inbox.find(TestAlgorithmArrayInstance{0});
+    return received != inbox.end() and
+           received->second.size() == static_cast<size_t>(number_of_messages);
+  }
+};
+
+struct initialize {
+  template <
+      typename DbTagsList, typename... InboxTags, typename Metavariables,
+      typename ArrayIndex, typename ActionList, typename ParallelComponent,
+      Requires<not tmpl::list_contains_v<DbTagsList, CountActionsCalled>> =
+          nullptr>
+  static auto apply(db::DataBox<DbTagsList>& box,
+                    const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    const Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/) noexcept {
+    return std::make_tuple(
+        db::create_from<db::RemoveTags<>,
+                        tmpl::list<CountActionsCalled, Int0>>(std::move(box),
+                                                              0, 0),
+        true);
+  }
+
+  template <
+      typename DbTagsList, typename... InboxTags, typename Metavariables,
+      typename ArrayIndex, typename ActionList, typename ParallelComponent,
+      Requires<tmpl::list_contains_v<DbTagsList, CountActionsCalled>> = nullptr>
+  static std::tuple<db::DataBox<DbTagsList>&&, bool> apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) noexcept {
+    return {std::move(box), true};
+  }
+};
+
+struct finalize {
+  template <typename ParallelComponent, typename... DbTags,
+            typename Metavariables, typename ArrayIndex,
+            Requires<tmpl2::flat_any_v<
+                std::is_same_v<CountActionsCalled, DbTags>...>> = nullptr>
+  static void apply(db::DataBox<tmpl::list<DbTags...>>& box,
+                    const Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/) noexcept {
+    SPECTRE_PARALLEL_REQUIRE(db::get<CountActionsCalled>(box) == 1);
+    SPECTRE_PARALLEL_REQUIRE(db::get<Int0>(box) ==
+                             number_of_messages * (number_of_messages - 1) /
+                                 2);
+  }
+};
+}  // namespace handoff_test
+
+template <class Metavariables>
+struct HandoffComponent {
+  using chare_type = Parallel::Algorithms::Singleton;
+  using metavariables = Metavariables;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<typename Metavariables::Phase,
+                             Metavariables::Phase::Initialization,
+                             tmpl::list<handoff_test::initialize>>,
+      Parallel::PhaseActions<typename Metavariables::Phase,
+                             Metavariables::Phase::HandoffStart,
+                             tmpl::list<handoff_test::sum_received>>>;
+  using initialization_tags = Parallel::get_initialization_tags<
+      Parallel::get_initialization_actions_list<phase_dependent_action_list>>;
+
+  static void execute_next_phase(
+      const typename Metavariables::Phase next_phase,
+      const Parallel::CProxy_GlobalCache<Metavariables>& global_cache) {
+    auto& local_cache = *(global_cache.ckLocalBranch());
+    Parallel::get_parallel_component<HandoffComponent>(local_cache)
+        .start_phase(next_phase);
+    if (next_phase == Metavariables::Phase::HandoffStart) {
+      for (int i = 0; i < handoff_test::number_of_messages; ++i) {
+        Parallel::receive_data<receive_data_test::IntReceiveTag>(
+            Parallel::get_parallel_component<HandoffComponent>(local_cache),
+            TestAlgorithmArrayInstance{0}, i);
+      }
+    } else if (next_phase == Metavariables::Phase::HandoffFinish) {
+      Parallel::simple_action<handoff_test::finalize>(
+          Parallel::get_parallel_component<HandoffComponent>(local_cache));
+    }
+  }
+};
+
 //////////////////////////////////////////////////////////////////////
 // Test out of order execution of Actions
 //////////////////////////////////////////////////////////////////////
@@ -669,7 +804,8 @@ struct TestMetavariables {
   using component_list = tmpl::list<NoOpsComponent<TestMetavariables>,
                                     MutateComponent<TestMetavariables>,
                                     ReceiveComponent<TestMetavariables>,
-                                    AnyOrderComponent<TestMetavariables>>;
+                                    AnyOrderComponent<TestMetavariables>,
+                                    HandoffComponent<TestMetavariables>>;
   /// [component_list_example]
 
   /// [help_string_example]
@@ -677,8 +813,9 @@ struct TestMetavariables {
       "An executable for testing the core functionality of the Algorithm. "
       "Actions that do not perform any operations (no-ops), invoking simple "
       "actions, mutating data in the DataBox, adding and removing items from "
-      "the DataBox, receiving data from other parallel components, and "
-      "out-of-order execution of Actions are all tested. All tests are run "
+      "the DataBox, receiving data from other parallel components, "
+      "out-of-order execution of Actions, and handing off data to local "
+      "receivers are all tested. All tests are run "
       "just by running the executable, no input file or command line arguments "
       "are required";
   /// [help_string_example]
@@ -694,6 +831,8 @@ struct TestMetavariables {
     ReceiveFinish,
     AnyOrderStart,
     AnyOrderFinish,
+    HandoffStart,
+    HandoffFinish,
     Exit
   };
 
@@ -719,6 +858,10 @@ struct TestMetavariables {
       case Phase::AnyOrderStart:
         return Phase::AnyOrderFinish;
       case Phase::AnyOrderFinish:
+        return Phase::HandoffStart;
+      case Phase::HandoffStart:
+        return Phase::HandoffFinish;
+      case Phase::HandoffFinish:
         [[fallthrough]];
       case Phase::Exit:
         return Phase::Exit;
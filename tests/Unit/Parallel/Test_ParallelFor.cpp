@@ -0,0 +1,41 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+#include "Parallel/ParallelFor.hpp"
+
+SPECTRE_TEST_CASE("Unit.Parallel.ParallelFor", "[Unit][Parallel]") {
+  for (const size_t size : std::array<size_t, 6>{{0, 1, 2, 7, 64, 101}}) {
+    for (const size_t number_of_chunks :
+         std::array<size_t, 5>{{0, 1, 2, 3, 8}}) {
+      CAPTURE(size);
+      CAPTURE(number_of_chunks);
+      // Each chunk writes only into its own range, so no synchronization is
+      // needed. Every index must have been visited exactly once.
+      std::vector<size_t> visits(size, 0);
+      std::atomic<size_t> calls{0};
+      Parallel::parallel_for(
+          size, number_of_chunks,
+          [&visits, &calls](const size_t begin, const size_t end) noexcept {
+            ++calls;
+            for (size_t i = begin; i < end; ++i) {
+              ++visits[i];
+            }
+          });
+      for (size_t i = 0; i < size; ++i) {
+        CHECK(visits[i] == 1);
+      }
+      // The work is split into the requested number of chunks even when no
+      // other PE takes part, so chunked callers are tested by serial runs.
+      CHECK(calls.load() ==
+            std::max(std::min(number_of_chunks, size), size_t{1}));
+    }
+  }
+}
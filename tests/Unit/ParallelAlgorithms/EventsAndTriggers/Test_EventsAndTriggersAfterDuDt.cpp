@@ -0,0 +1,91 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "Framework/ActionTesting.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"  // IWYU pragma: keep
+#include "Parallel/RegisterDerivedClassesWithCharm.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Actions/RunEventsAndTriggersAfterDuDt.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Completion.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/EventsAndTriggers.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/LogicalTriggers.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Tags.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Trigger.hpp"
+#include "Time/Slab.hpp"
+#include "Time/Tags.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MakeVector.hpp"
+#include "Utilities/TMPL.hpp"
+
+// IWYU pragma: no_include <pup.h>
+
+namespace {
+using events_and_triggers_tag =
+    Tags::EventsAndTriggersAfterDuDt<tmpl::list<>, tmpl::list<>>;
+
+template <typename Metavariables>
+struct Component {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = int;
+  using const_global_cache_tags = tmpl::list<events_and_triggers_tag>;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<
+          typename Metavariables::Phase, Metavariables::Phase::Initialization,
+          tmpl::list<ActionTesting::InitializeDataBox<
+              tmpl::list<Tags::TimeStepId>>>>,
+      Parallel::PhaseActions<
+          typename Metavariables::Phase, Metavariables::Phase::Testing,
+          tmpl::list<Actions::RunEventsAndTriggersAfterDuDt>>>;
+};
+
+struct Metavariables {
+  using component_list = tmpl::list<Component<Metavariables>>;
+  enum class Phase { Initialization, Testing, Exit };
+};
+
+using EventsAndTriggersType = EventsAndTriggers<tmpl::list<>, tmpl::list<>>;
+
+void check(const int64_t slab_number, const bool expected) noexcept {
+  Parallel::register_derived_classes_with_charm<Event<tmpl::list<>>>();
+  Parallel::register_derived_classes_with_charm<Trigger<tmpl::list<>>>();
+
+  EventsAndTriggersType::Storage events_and_triggers_map;
+  events_and_triggers_map.emplace(
+      std::make_unique<Triggers::Always<tmpl::list<>>>(),
+      make_vector<std::unique_ptr<Event<tmpl::list<>>>>(
+          std::make_unique<Events::Completion<tmpl::list<>>>()));
+  const EventsAndTriggersType events_and_triggers(
+      std::move(events_and_triggers_map));
+
+  using my_component = Component<Metavariables>;
+  ActionTesting::MockRuntimeSystem<Metavariables> runner{
+      {serialize_and_deserialize(events_and_triggers)}};
+  const Slab slab(0.0, 1.0);
+  ActionTesting::emplace_component_and_initialize<my_component>(
+      &runner, 0, {TimeStepId(true, slab_number, slab.start())});
+  ActionTesting::set_phase(make_not_null(&runner),
+                           Metavariables::Phase::Testing);
+
+  ActionTesting::next_action<my_component>(make_not_null(&runner), 0);
+
+  CHECK(ActionTesting::get_terminate<my_component>(runner, 0) == expected);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.EventsAndTriggers.AfterDuDt",
+                  "[Unit][ParallelAlgorithms]") {
+  check(0, true);
+  check(3, true);
+  // The events are not run during self-start
+  check(-1, false);
+}
@@ -0,0 +1,297 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <pup.h>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Options/Options.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"  // IWYU pragma: keep
+#include "Parallel/RegisterDerivedClassesWithCharm.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Actions/RunEventsAtDenseTimes.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/EventsAtDenseTimes.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Tags.hpp"
+#include "Time/History.hpp"
+#include "Time/Slab.hpp"
+#include "Time/Tags.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeSequence.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Time/TimeSteppers/AdamsBashforthN.hpp"
+#include "Time/TimeSteppers/TimeStepper.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/NoSuchType.hpp"
+#include "Utilities/Registration.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+struct Var : db::SimpleTag {
+  using type = double;
+};
+
+struct Prim : db::SimpleTag {
+  using type = double;
+};
+
+// The time, the variable and the primitive seen by an event
+using State = std::array<double, 3>;
+
+struct RecordedStates : db::SimpleTag {
+  using type = std::vector<State>;
+};
+
+template <bool HasPrimitives>
+struct System {
+  using variables_tag = Var;
+  static constexpr bool has_primitive_and_conservative_vars = HasPrimitives;
+};
+
+struct PrimFromCon {
+  using return_tags = tmpl::list<Prim>;
+  using argument_tags = tmpl::list<Var>;
+  static void apply(const gsl::not_null<double*> prim,
+                    const double var) noexcept {
+    *prim = 2.0 * var;
+  }
+};
+
+// Adds a boundary coupling with a rate of 10 from the start of the step at
+// time 1
+struct BoundaryScheme {
+  struct DenseOutput {
+    using return_tags = tmpl::list<Var>;
+    using argument_tags = tmpl::list<>;
+    static void apply(const gsl::not_null<double*> var,
+                      const double time) noexcept {
+      *var += 10.0 * (time - 1.0);
+    }
+  };
+};
+
+struct RecordStateAction {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<DbTagsList>& box,  // NOLINT
+                    const Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const State& state) noexcept {
+    db::mutate<RecordedStates>(
+        make_not_null(&box),
+        [&state](const gsl::not_null<typename RecordedStates::type*>
+                     recorded_states) noexcept {
+          recorded_states->push_back(state);
+        });
+  }
+};
+
+template <typename EventRegistrars>
+class RecordState : public Event<EventRegistrars> {
+ public:
+  /// \cond
+  explicit RecordState(CkMigrateMessage* /*unused*/) noexcept {}
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(RecordState);  // NOLINT
+  /// \endcond
+
+  using options = tmpl::list<>;
+  static constexpr Options::String help =
+      "Record the time, variable and primitive";
+
+  RecordState() = default;
+
+  using argument_tags = tmpl::list<Tags::Time, Var, Prim>;
+
+  template <typename Metavariables, typename ArrayIndex, typename Component>
+  void operator()(const double time, const double var, const double prim,
+                  Parallel::GlobalCache<Metavariables>& cache,
+                  const ArrayIndex& array_index,
+                  const Component* const /*meta*/) const noexcept {
+    // The events only see a const DataBox, so the state is recorded by an
+    // action sent to the element running the event.
+    Parallel::simple_action<RecordStateAction>(
+        Parallel::get_parallel_component<Component>(cache)[array_index],
+        State{{time, var, prim}});
+  }
+};
+
+template <typename EventRegistrars>
+PUP::able::PUP_ID RecordState<EventRegistrars>::my_PUP_ID = 0;  // NOLINT
+
+namespace Registrars {
+using RecordState = ::Registration::Registrar<RecordState>;
+}  // namespace Registrars
+
+using event_registrars = tmpl::list<Registrars::RecordState>;
+using EventsAtDenseTimesType = EventsAtDenseTimes<event_registrars>;
+using history_tag = Tags::HistoryEvolvedVariables<Var>;
+
+template <typename Metavariables>
+struct Component {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = int;
+  using const_global_cache_tags =
+      tmpl::list<Tags::TimeStepper<tmpl::conditional_t<
+                     Metavariables::local_time_stepping, LtsTimeStepper,
+                     TimeStepper>>,
+                 Tags::EventsAtDenseTimes<event_registrars>>;
+  using simple_tags =
+      db::AddSimpleTags<Tags::TimeStepId, Tags::TimeStep, Tags::Time, Var,
+                        Prim, history_tag, RecordedStates>;
+  using run_events_action = Actions::RunEventsAtDenseTimes<
+      NoSuchType, typename Metavariables::primitive_from_conservative>;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<
+          typename Metavariables::Phase, Metavariables::Phase::Initialization,
+          tmpl::list<ActionTesting::InitializeDataBox<simple_tags>>>,
+      Parallel::PhaseActions<typename Metavariables::Phase,
+                             Metavariables::Phase::Testing,
+                             tmpl::list<run_events_action>>>;
+};
+
+template <bool LocalTimeStepping, bool HasPrimitives>
+struct Metavariables {
+  using system = System<HasPrimitives>;
+  using component_list = tmpl::list<Component<Metavariables>>;
+  static constexpr bool local_time_stepping = LocalTimeStepping;
+  using boundary_scheme = BoundaryScheme;
+  using primitive_from_conservative =
+      tmpl::conditional_t<HasPrimitives, PrimFromCon, NoSuchType>;
+  enum class Phase { Initialization, Testing, Exit };
+};
+
+void test_times_in_step(const EventsAtDenseTimesType& events) noexcept {
+  CHECK(events.times_in_step(1.0, 3.0, true) ==
+        std::vector<double>{1.0, 1.5, 2.0, 2.5, 3.0});
+  CHECK(events.times_in_step(1.0, 3.0, false) ==
+        std::vector<double>{1.5, 2.0, 2.5, 3.0});
+  CHECK(events.times_in_step(3.0, 1.0, true) ==
+        std::vector<double>{3.0, 2.5, 2.0, 1.5, 1.0});
+  CHECK(events.times_in_step(3.0, 1.0, false) ==
+        std::vector<double>{2.5, 2.0, 1.5, 1.0});
+  CHECK(events.times_in_step(1.1, 1.4, true).empty());
+  CHECK(events.times_in_step(3.5, 4.5, false) ==
+        std::vector<double>{4.0, 4.5});
+  CHECK(events.times_in_step(3.5, 4.5, true) ==
+        std::vector<double>{3.5, 4.0, 4.5});
+  CHECK(EventsAtDenseTimesType{}.times_in_step(1.0, 3.0, true).empty());
+}
+
+// Runs the action on a step of size 2 starting at time 1 in slab
+// `slab_number` and returns the recorded states, sorted.
+template <typename Metavars = Metavariables<false, false>>
+std::vector<State> test_action(const EventsAtDenseTimesType& events,
+                               const int64_t slab_number) noexcept {
+  using component = Component<Metavars>;
+
+  const Slab slab(1.0, 3.0);
+  const TimeStepId time_step_id(true, slab_number, slab.start());
+  history_tag::type history{};
+  history.insert(time_step_id, 3.0, 2.0);
+
+  ActionTesting::MockRuntimeSystem<Metavars> runner{
+      {std::make_unique<TimeSteppers::AdamsBashforthN>(1),
+       serialize_and_deserialize(events)}};
+  ActionTesting::emplace_component_and_initialize<component>(
+      &runner, 0,
+      {time_step_id, slab.duration(), 1.0, 3.0, -1.0, std::move(history),
+       std::vector<State>{}});
+  ActionTesting::set_phase(make_not_null(&runner),
+                           Metavars::Phase::Testing);
+  ActionTesting::next_action<component>(make_not_null(&runner), 0);
+
+  // the state is restored after the events run
+  CHECK(ActionTesting::get_databox_tag<component, Tags::Time>(runner, 0) ==
+        1.0);
+  CHECK(ActionTesting::get_databox_tag<component, Var>(runner, 0) == 3.0);
+  CHECK(ActionTesting::get_databox_tag<component, Prim>(runner, 0) == -1.0);
+
+  while (not ActionTesting::is_simple_action_queue_empty<component>(runner,
+                                                                    0)) {
+    ActionTesting::invoke_queued_simple_action<component>(
+        make_not_null(&runner), 0);
+  }
+  auto recorded_states =
+      ActionTesting::get_databox_tag<component, RecordedStates>(runner, 0);
+  std::sort(recorded_states.begin(), recorded_states.end());
+  return recorded_states;
+}
+
+SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.EventsAndTriggers.DenseTimes",
+                  "[Unit][ParallelAlgorithms]") {
+  Parallel::register_derived_classes_with_charm<Event<event_registrars>>();
+  Parallel::register_derived_classes_with_charm<TimeSequence<double>>();
+  Parallel::register_derived_classes_with_charm<TimeStepper>();
+  Parallel::register_derived_classes_with_charm<LtsTimeStepper>();
+
+  const auto events = TestHelpers::test_creation<EventsAtDenseTimesType>(
+      "? Specified:\n"
+      "    Values: [0.5, 1.0, 1.5, 2.5, 3.0]\n"
+      ": - RecordState\n"
+      "? EvenlySpaced:\n"
+      "    Interval: 0.5\n"
+      "    Offset: 0.0\n"
+      ": - RecordState\n");
+  test_times_in_step(events);
+  test_times_in_step(serialize_and_deserialize(events));
+
+  // The Euler dense output of dt Var = 2 from Var = 3 at time 1. The first
+  // step of the evolution includes its start, and every step includes its
+  // end. Times in both sequences are recorded twice.
+  CHECK(test_action(events, 0) == std::vector<State>{{{1.0, 3.0, -1.0}},
+                                                     {{1.0, 3.0, -1.0}},
+                                                     {{1.5, 4.0, -1.0}},
+                                                     {{1.5, 4.0, -1.0}},
+                                                     {{2.0, 5.0, -1.0}},
+                                                     {{2.5, 6.0, -1.0}},
+                                                     {{2.5, 6.0, -1.0}},
+                                                     {{3.0, 7.0, -1.0}},
+                                                     {{3.0, 7.0, -1.0}}});
+  // later steps leave their start to the previous step
+  CHECK(test_action(events, 1) == std::vector<State>{{{1.5, 4.0, -1.0}},
+                                                     {{1.5, 4.0, -1.0}},
+                                                     {{2.0, 5.0, -1.0}},
+                                                     {{2.5, 6.0, -1.0}},
+                                                     {{2.5, 6.0, -1.0}},
+                                                     {{3.0, 7.0, -1.0}},
+                                                     {{3.0, 7.0, -1.0}}});
+
+  // nothing is observed during self-start
+  CHECK(test_action(events, -1).empty());
+
+  // with local time-stepping the boundary coupling is added to the volume
+  // dense output
+  CHECK(test_action<Metavariables<true, false>>(events, 1) ==
+        std::vector<State>{{{1.5, 9.0, -1.0}},
+                           {{1.5, 9.0, -1.0}},
+                           {{2.0, 15.0, -1.0}},
+                           {{2.5, 21.0, -1.0}},
+                           {{2.5, 21.0, -1.0}},
+                           {{3.0, 27.0, -1.0}},
+                           {{3.0, 27.0, -1.0}}});
+
+  // the primitive is recomputed at each of the times
+  CHECK(test_action<Metavariables<false, true>>(events, 1) ==
+        std::vector<State>{{{1.5, 4.0, 8.0}},
+                           {{1.5, 4.0, 8.0}},
+                           {{2.0, 5.0, 10.0}},
+                           {{2.5, 6.0, 12.0}},
+                           {{2.5, 6.0, 12.0}},
+                           {{3.0, 7.0, 14.0}},
+                           {{3.0, 7.0, 14.0}}});
+}
+}  // namespace
@@ -18,4 +18,13 @@ SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.EventsAndTriggers.Tags",
       "EventsAndTriggersBase");
   TestHelpers::db::test_simple_tag<
       Tags::EventsAndTriggers<DummyType, DummyType>>("EventsAndTriggers");
+  TestHelpers::db::test_base_tag<Tags::EventsAtDenseTimesBase>(
+      "EventsAtDenseTimesBase");
+  TestHelpers::db::test_simple_tag<Tags::EventsAtDenseTimes<DummyType>>(
+      "EventsAtDenseTimes");
+  TestHelpers::db::test_base_tag<Tags::EventsAndTriggersAfterDuDtBase>(
+      "EventsAndTriggersAfterDuDtBase");
+  TestHelpers::db::test_simple_tag<
+      Tags::EventsAndTriggersAfterDuDt<DummyType, DummyType>>(
+      "EventsAndTriggersAfterDuDt");
 }
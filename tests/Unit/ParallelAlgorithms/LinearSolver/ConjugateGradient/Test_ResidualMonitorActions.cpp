@@ -147,7 +147,7 @@ SPECTRE_TEST_CASE(
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::cg::detail::InitializeResidual<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 4.);
+        make_not_null(&runner), 0, 4., 0.);
     ActionTesting::invoke_queued_threaded_action<observer_writer>(
         make_not_null(&runner), 0);
     // Test residual monitor state
@@ -176,7 +176,7 @@ SPECTRE_TEST_CASE(
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::cg::detail::InitializeResidual<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 0.);
+        make_not_null(&runner), 0, 0., 0.);
     // Test residual monitor state
     CHECK(get_residual_monitor_tag(residual_square_tag{}) == 0.);
     CHECK(get_residual_monitor_tag(initial_residual_magnitude_tag{}) == 0.);
@@ -191,7 +191,7 @@ SPECTRE_TEST_CASE(
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::cg::detail::InitializeResidual<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 1.);
+        make_not_null(&runner), 0, 1., 0.);
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::cg::detail::ComputeAlpha<
                               fields_tag, TestLinearSolver, element_array>>(
@@ -208,7 +208,7 @@ SPECTRE_TEST_CASE(
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::cg::detail::InitializeResidual<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 9.);
+        make_not_null(&runner), 0, 9., 0.);
     ActionTesting::invoke_queued_threaded_action<observer_writer>(
         make_not_null(&runner), 0);
     ActionTesting::simple_action<
@@ -247,7 +247,7 @@ SPECTRE_TEST_CASE(
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::cg::detail::InitializeResidual<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 1.);
+        make_not_null(&runner), 0, 1., 0.);
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::cg::detail::UpdateResidual<
                               fields_tag, TestLinearSolver, element_array>>(
@@ -271,7 +271,7 @@ SPECTRE_TEST_CASE(
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::cg::detail::InitializeResidual<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 1.);
+        make_not_null(&runner), 0, 1., 0.);
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::cg::detail::UpdateResidual<
                               fields_tag, TestLinearSolver, element_array>>(
@@ -295,7 +295,7 @@ SPECTRE_TEST_CASE(
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::cg::detail::InitializeResidual<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 1.);
+        make_not_null(&runner), 0, 1., 0.);
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::cg::detail::UpdateResidual<
                               fields_tag, TestLinearSolver, element_array>>(
@@ -314,4 +314,28 @@ SPECTRE_TEST_CASE(
     REQUIRE(has_converged);
     CHECK(has_converged.reason() == Convergence::Reason::RelativeResidual);
   }
+
+  SECTION("ConvergeByForcingTerm") {
+    ActionTesting::simple_action<
+        residual_monitor, LinearSolver::cg::detail::InitializeResidual<
+                              fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 1., 0.8);
+    ActionTesting::simple_action<
+        residual_monitor, LinearSolver::cg::detail::UpdateResidual<
+                              fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 0_st, 0.49);
+    // Test residual monitor state
+    CHECK(get_residual_monitor_tag(
+              LinearSolver::Tags::ForcingTerm<fields_tag>{}) == 0.8);
+    // Test element state. The residual ratio 0.7 is above the relative residual
+    // of the convergence criteria but below the forcing term.
+    const auto& element_inbox =
+        get_element_inbox_tag(
+            LinearSolver::cg::detail::Tags::ResidualRatioAndHasConverged<
+                TestLinearSolver>{})
+            .at(0);
+    const auto& has_converged = get<1>(element_inbox);
+    REQUIRE(has_converged);
+    CHECK(has_converged.reason() == Convergence::Reason::RelativeResidual);
+  }
 }
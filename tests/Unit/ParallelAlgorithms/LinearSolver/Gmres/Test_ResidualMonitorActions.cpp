@@ -151,7 +151,7 @@ SPECTRE_TEST_CASE(
         residual_monitor,
         LinearSolver::gmres::detail::InitializeResidualMagnitude<
             fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 2.);
+        make_not_null(&runner), 0, 2., 0.);
     ActionTesting::invoke_queued_threaded_action<observer_writer>(
         make_not_null(&runner), 0);
     // Test residual monitor state
@@ -184,7 +184,7 @@ SPECTRE_TEST_CASE(
         residual_monitor,
         LinearSolver::gmres::detail::InitializeResidualMagnitude<
             fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 0.);
+        make_not_null(&runner), 0, 0., 0.);
     // Test residual monitor state
     CHECK(get_residual_monitor_tag(initial_residual_magnitude_tag{}) == 0.);
     // Test element state
@@ -204,7 +204,7 @@ SPECTRE_TEST_CASE(
         residual_monitor,
         LinearSolver::gmres::detail::InitializeResidualMagnitude<
             fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 1.);
+        make_not_null(&runner), 0, 1., 0.);
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
@@ -224,7 +224,7 @@ SPECTRE_TEST_CASE(
         residual_monitor,
         LinearSolver::gmres::detail::InitializeResidualMagnitude<
             fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 2.);
+        make_not_null(&runner), 0, 2., 0.);
     ActionTesting::invoke_queued_threaded_action<observer_writer>(
         make_not_null(&runner), 0);
     ActionTesting::simple_action<
@@ -280,7 +280,7 @@ SPECTRE_TEST_CASE(
         residual_monitor,
         LinearSolver::gmres::detail::InitializeResidualMagnitude<
             fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 2.);
+        make_not_null(&runner), 0, 2., 0.);
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
@@ -317,7 +317,7 @@ SPECTRE_TEST_CASE(
         residual_monitor,
         LinearSolver::gmres::detail::InitializeResidualMagnitude<
             fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 1.);
+        make_not_null(&runner), 0, 1., 0.);
     // Perform 2 mock iterations
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
@@ -366,7 +366,7 @@ SPECTRE_TEST_CASE(
         residual_monitor,
         LinearSolver::gmres::detail::InitializeResidualMagnitude<
             fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 2.);
+        make_not_null(&runner), 0, 2., 0.);
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
@@ -397,4 +397,38 @@ SPECTRE_TEST_CASE(
     REQUIRE(has_converged);
     CHECK(has_converged.reason() == Convergence::Reason::RelativeResidual);
   }
+
+  SECTION("ConvergeByForcingTerm") {
+    ActionTesting::simple_action<
+        residual_monitor,
+        LinearSolver::gmres::detail::InitializeResidualMagnitude<
+            fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 2., 0.8);
+    ActionTesting::simple_action<
+        residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
+                              fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 0_st, 0_st, 3.);
+    ActionTesting::simple_action<
+        residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
+                              fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 0_st, 1_st, 9.);
+    // Test residual monitor state
+    CHECK(get_residual_monitor_tag(
+              LinearSolver::Tags::ForcingTerm<fields_tag>{}) == 0.8);
+    // Test element state
+    const auto& element_inbox =
+        get_element_inbox_tag(
+            LinearSolver::gmres::detail::Tags::FinalOrthogonalization<
+                TestLinearSolver>{})
+            .at(0);
+    // H = [[3.], [3.]]
+    // beta = [2., 0.]
+    // minres = [1. / 3.]
+    // r = beta - H * minres = [1., -1.]
+    // |r| / |r_initial| = 0.7071067811865476, which is above the relative
+    // residual of the convergence criteria but below the forcing term
+    const auto& has_converged = get<2>(element_inbox);
+    REQUIRE(has_converged);
+    CHECK(has_converged.reason() == Convergence::Reason::RelativeResidual);
+  }
 }
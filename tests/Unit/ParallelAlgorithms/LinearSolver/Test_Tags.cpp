@@ -33,6 +33,8 @@ SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.LinearSolver.Tags",
       "LinearMagnitudeSquare(Tag)");
   TestHelpers::db::test_prefix_tag<LinearSolver::Tags::Magnitude<Tag>>(
       "LinearMagnitude(Tag)");
+  TestHelpers::db::test_prefix_tag<LinearSolver::Tags::ForcingTerm<Tag>>(
+      "LinearForcingTerm(Tag)");
   TestHelpers::db::test_prefix_tag<LinearSolver::Tags::Orthogonalization<Tag>>(
       "LinearOrthogonalization(Tag)");
   TestHelpers::db::test_prefix_tag<
@@ -0,0 +1,36 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include "ParallelAlgorithms/NonlinearSolver/NewtonRaphson/ForcingTerm.hpp"
+
+SPECTRE_TEST_CASE("Unit.ParallelNewtonRaphson.ForcingTerm",
+                  "[Unit][ParallelAlgorithms]") {
+  using NonlinearSolver::newton_raphson::next_forcing_term;
+  {
+    // Choice 2 of Eisenstat & Walker: gamma * (|r_k| / |r_{k-1}|)^alpha
+    CHECK(next_forcing_term(0.1, 0.5, 1., 0., 0.9) == approx(0.225));
+    CHECK(next_forcing_term(0.1, 0.5, 1., 0., 0.9, 0.5, 1.) == approx(0.25));
+  }
+  {
+    // The forcing term doesn't decrease too quickly when the previous one was
+    // large: gamma * eta_{k-1}^alpha = 0.9 * 0.5^2 = 0.225 > 0.1
+    CHECK(next_forcing_term(0.5, 0.1, 1., 0., 0.9) == approx(0.225));
+    // but it may when the previous one was small: 0.9 * 0.3^2 = 0.081 < 0.1
+    CHECK(next_forcing_term(0.3, 0.1, 1., 0., 0.9) == approx(0.009));
+  }
+  {
+    // The forcing term is limited by its maximum
+    CHECK(next_forcing_term(0.1, 2., 1., 0., 0.9) == approx(0.9));
+    CHECK(next_forcing_term(0.1, 0.9, 1., 0., 0.5) == approx(0.5));
+  }
+  {
+    // The final linear solve doesn't reduce the residual far below the
+    // nonlinear tolerance: 0.5 * 1.e-3 / 1.e-2 = 0.05
+    CHECK(next_forcing_term(0.01, 1.e-2, 1., 1.e-3, 0.9) == approx(0.05));
+    CHECK(next_forcing_term(0.01, 1.e-2, 1., 1., 0.9) == approx(0.9));
+    // A vanishing residual is fine
+    CHECK(next_forcing_term(0.01, 0., 1., 1.e-3, 0.9) == 0.);
+  }
+}
@@ -3,6 +3,7 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <optional>
 #include <string>
 
 #include "DataStructures/DataBox/DataBox.hpp"
@@ -39,6 +40,13 @@ SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.NonlinearSolver.Tags",
   TestHelpers::db::test_simple_tag<
       Tags::MaxGlobalizationSteps<TestOptionsGroup>>(
       "MaxGlobalizationSteps(TestNonlinearSolver)");
+  TestHelpers::db::test_simple_tag<Tags::MaxForcingTerm<TestOptionsGroup>>(
+      "MaxForcingTerm(TestNonlinearSolver)");
+  CHECK(Tags::MaxForcingTerm<TestOptionsGroup>::create_from_options(0.5) ==
+        0.5);
+  CHECK_FALSE(Tags::MaxForcingTerm<TestOptionsGroup>::create_from_options(
+                  std::nullopt)
+                  .has_value());
   TestHelpers::db::test_prefix_tag<Tags::Globalization<Tag>>(
       "Globalization(Tag)");
   {
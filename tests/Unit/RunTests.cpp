@@ -19,6 +19,7 @@
 #include "Informer/InfoFromBuild.hpp"
 #include "Parallel/Abort.hpp"
 #include "Parallel/Exit.hpp"
+#include "Parallel/ParallelFor.hpp"
 #include "Parallel/Printf.hpp"
 #include "tests/Unit/RunTestsRegister.hpp"
 
@@ -28,6 +29,7 @@ RunTests::RunTests(CkArgMsg* msg) {
   register_run_tests_libs();
   Parallel::printf("%s", info_from_build().c_str());
   enable_floating_point_exceptions();
+  Parallel::initialize_parallel_for();
   Catch::StringMaker<double>::precision =
       std::numeric_limits<double>::max_digits10;
   Catch::StringMaker<float>::precision =